@@ -4,33 +4,10 @@
 #include "Bullet/BulletBodyDefinition.h"
 #include "Bullet/BulletShapes.h"
 #include "Bullet/BulletWorld.h"
+#include "Bullet/BulletMotionState.h"
 
 using namespace Helium;
 
-namespace Helium
-{
-	struct BulletMotionState : public btMotionState
-	{
-		BulletMotionState(const btTransform &worldTrans)
-			: m_Transform(worldTrans)
-		{
-
-		}
-
-		virtual void getWorldTransform( btTransform& worldTrans ) const
-		{
-			worldTrans = m_Transform;
-		}
-
-		virtual void setWorldTransform( const btTransform& worldTrans ) 
-		{
-			m_Transform = worldTrans;
-		}
-
-		btTransform m_Transform;
-	};
-}
-
 Helium::BulletBody::BulletBody()
 	: m_Body(0),
 	  m_MotionState(0)
@@ -60,51 +37,12 @@ void BulletBody::Initialize( BulletWorld &rWorld, const BulletBodyDefinition &rB
 		return;
 	}
 
-	btCollisionShape *pFinalShape = 0;
-	btVector3 finalInertia;
-	float finalMass;
+	m_SharedShape = rBodyDefinition.GetSharedShape();
+	HELIUM_ASSERT(m_SharedShape);
 
-	if (rBodyDefinition.m_Shapes.GetSize() > 1 || rBodyDefinition.m_Shapes[0]->m_Position.GetMagnitudeSquared() > HELIUM_EPSILON)
-	{
-		btCompoundShape *pCompoundShape = new btCompoundShape( true );
-
-		float mass = 0.0f;
-		for (size_t i = 0; i < rBodyDefinition.m_Shapes.GetSize(); ++i)
-		{
-			btVector3 position;
-			btQuaternion rotation;
-
-			ConvertToBullet( rBodyDefinition.m_Shapes[i]->m_Position, position );
-			ConvertToBullet( rBodyDefinition.m_Shapes[i]->m_Rotation, rotation );
-
-			btCollisionShape *pBulletShape = rBodyDefinition.m_Shapes[i]->CreateShape();
-			pCompoundShape->addChildShape(
-				btTransform(rotation, position), 
-				pBulletShape);
-
-			mass += rBodyDefinition.m_Shapes[i]->m_Mass;
-		}
-
-		if (mass != 0.0f)
-		{
-			pCompoundShape->calculateLocalInertia(mass, finalInertia);
-		}
-		pFinalShape = pCompoundShape;
-		finalMass = mass;
-	}
-	else
-	{
-		BulletShape *pShape = rBodyDefinition.m_Shapes[0];
-		btCollisionShape *pBulletShape = pShape->CreateShape();
-		
-		if (pShape->m_Mass != 0.0f)
-		{
-			pBulletShape->calculateLocalInertia(pShape->m_Mass, finalInertia);
-		}
-
-		pFinalShape = pBulletShape;
-		finalMass = pShape->m_Mass;
-	}
+	btVector3 finalInertia;
+	m_SharedShape->GetLocalInertia(finalInertia);
+	float finalMass = m_SharedShape->GetMass();
 
 	btVector3 origin;
 	ConvertToBullet(rInitialPosition, origin);
@@ -122,8 +60,9 @@ void BulletBody::Initialize( BulletWorld &rWorld, const BulletBodyDefinition &rB
 		finalMass = 0.0f;
 	}
 	
-	m_MotionState = new BulletMotionState(startTransform);
-	m_Body = new btRigidBody(finalMass, m_MotionState, pFinalShape, finalInertia);
+	m_MotionState = new BulletMotionState(startTransform, rWorld);
+	m_Body = new btRigidBody(finalMass, m_MotionState, m_SharedShape->GetShape(), finalInertia);
+	m_MotionState->m_pBody = m_Body;
 	m_Body->setRestitution(rBodyDefinition.m_Restitution);
 	
 	m_Body->setLinearFactor(
@@ -178,6 +117,7 @@ void Helium::BulletBody::SetPosition( const Helium::Simd::Vector3 &rPosition )
 	btVector3 position;
 	ConvertToBullet(rPosition, position);
 	m_MotionState->m_Transform.setOrigin(position);
+	m_MotionState->m_PreviousTransform.setOrigin(position);
 	m_Body->activate();
 }
 
@@ -188,21 +128,24 @@ void Helium::BulletBody::SetRotation( const Helium::Simd::Quat &rRotation )
 	btQuaternion q;
 	ConvertToBullet( rRotation, q );
 	m_MotionState->m_Transform.getBasis().setRotation(q);
+	m_MotionState->m_PreviousTransform.getBasis().setRotation(q);
 	m_Body->activate();
 }
 
 void Helium::BulletBody::Destruct( BulletWorld &rWorld )
 {
+	if (m_MotionState->m_bMoved)
+	{
+		rWorld.RemoveMovedBody(m_Body);
+	}
+
 	delete m_MotionState;
 
 	rWorld.GetBulletWorld()->removeCollisionObject(m_Body);
 	delete m_Body;
 
-	for (DynamicArray<btCollisionShape *>::Iterator shape = m_Shapes.Begin();
-		shape != m_Shapes.End(); ++shape)
-	{
-		delete *shape;
-	}
+	// The shape is shared with other bodies created from the same definition
+	m_SharedShape = NULL;
 
 #if HELIUM_ASSERT_ENABLED
 	// Clear m_Body so that the assert will succeed
@@ -4,7 +4,7 @@
 #include "Bullet/Bullet.h"
 #include "Engine/Asset.h"
 #include "Math/Vector3.h"
-#include "Foundation/DynamicArray.h"
+#include "Bullet/BulletSharedShape.h"
 
 class btDefaultCollisionConfiguration;
 class btCollisionDispatcher;
@@ -47,7 +47,7 @@ namespace Helium
 		void SetRotation(const Helium::Simd::Quat &rRotation);
 		
 	private:
-		DynamicArray<btCollisionShape *> m_Shapes;
+		BulletSharedShapePtr m_SharedShape;
 		btRigidBody *m_Body;
 		BulletMotionState *m_MotionState;
 	};
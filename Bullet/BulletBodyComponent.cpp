@@ -9,6 +9,9 @@
 
 #include "BulletCollision/CollisionDispatch/btGhostObject.h"
 
+#include "Bullet/BulletMotionState.h"
+#include "Engine/ParallelFor.h"
+
 using namespace Helium;
 
 HELIUM_IMPLEMENT_ASSET(Helium::BulletBodyComponentDefinition, Bullet, 0);
@@ -83,6 +86,16 @@ void BulletBodyComponent::PopulateMetaType( Reflect::MetaStruct& comp )
 
 }
 
+BulletBodyComponent::BulletBodyComponent()
+	: m_AssignedGroups(0)
+	, m_TrackPhysicalContactGroupMask(0)
+	, m_TrackCollisions(false)
+	, m_InContactList(false)
+	, m_KinematicBodyIndex(Invalid< size_t >())
+{
+
+}
+
 void BulletBodyComponent::Finalize( const BulletBodyComponentDefinition &definition )
 {
 	definition.CacheFlags();
@@ -106,6 +119,12 @@ void BulletBodyComponent::Finalize( const BulletBodyComponentDefinition &definit
 
 	m_AssignedGroups = definition.m_AssignedGroups;
 	m_TrackPhysicalContactGroupMask = definition.m_TrackPhysicalContactGroupMask;
+	m_TransformComponent = pTransform;
+
+	if (definition.m_BodyDefinition->m_IsKinematic)
+	{
+		pBulletWorldComponent->AddKinematicBody( this );
+	}
 }
 
 BulletBodyComponent::~BulletBodyComponent()
@@ -114,6 +133,12 @@ BulletBodyComponent::~BulletBodyComponent()
 	{
 		BulletWorldComponent *pBulletWorldComponent = GetWorld()->GetComponents().GetFirst<BulletWorldComponent>();
 
+		pBulletWorldComponent->GetContactTracker().RemoveBody( this );
+		if (IsValid( m_KinematicBodyIndex ))
+		{
+			pBulletWorldComponent->RemoveKinematicBody( this );
+		}
+
 		m_Body.Destruct( *pBulletWorldComponent->GetBulletWorld() );
 	}
 }
@@ -149,16 +174,69 @@ void BulletBodyComponent::SetAngularVelocity( const Simd::Vector3 &velocity )
 
 //////////////////////////////////////////////////////////////////////////
 
-void DoPreProcessPhysics( BulletBodyComponent *pBodyComponent, Helium::TransformComponent *pTransformComponent )
+// Bodies that moved are synced in parallel once there are at least this many
+static const size_t SYNC_PARALLEL_BODY_COUNT_MIN = 512;
+
+// Maximum number of bodies to sync in each job
+static const size_t SYNC_JOB_BODY_COUNT_MAX = 256;
+
+// A world's moved body list, handed to ParallelFor
+struct SyncBodyTransformsRange
+{
+	btRigidBody * const *ppBodies;
+	float alpha;
+};
+
+// Copy bullet's transforms for bodies that moved into their transform components. Each body is only touched by one
+// thread, so this is safe to run on any slice of the moved body list concurrently.
+static void SyncBodyTransforms( void *pUserData, size_t begin, size_t end )
+{
+	const SyncBodyTransformsRange *pRange = static_cast<const SyncBodyTransformsRange *>( pUserData );
+
+	for (size_t i = begin; i < end; ++i)
+	{
+		btRigidBody *pBody = pRange->ppBodies[i];
+		const BulletMotionState *pMotionState = static_cast<const BulletMotionState *>( pBody->getMotionState() );
+
+		BulletBodyComponent *pBodyComponent = static_cast<BulletBodyComponent *>( pBody->getUserPointer() );
+		TransformComponent *pTransformComponent = pBodyComponent ? pBodyComponent->GetTransformComponent() : NULL;
+		if (!pTransformComponent)
+		{
+			continue;
+		}
+
+		btTransform transform;
+		pMotionState->GetInterpolatedTransform( pRange->alpha, transform );
+
+		Simd::Vector3 position;
+		Simd::Quat rotation;
+		ConvertFromBullet( transform.getOrigin(), position );
+		ConvertFromBullet( transform.getRotation(), rotation );
+
+		pTransformComponent->SetPosition(position);
+		pTransformComponent->SetRotation(rotation);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// Only kinematic bodies take their transform from the transform component, so only those are visited
+void DoPreProcessPhysics( BulletWorldComponent *pWorldComponent )
 {
-	if (pBodyComponent->GetBody().GetBody()->isKinematicObject())
+	const DynamicArray< BulletBodyComponent * > &rKinematicBodies = pWorldComponent->GetKinematicBodies();
+	for (size_t i = 0; i < rKinematicBodies.GetSize(); ++i)
 	{
-		pBodyComponent->GetBody().SetPosition(pTransformComponent->GetPosition());
-		pBodyComponent->GetBody().SetRotation(pTransformComponent->GetRotation());
+		BulletBodyComponent *pBodyComponent = rKinematicBodies[i];
+		TransformComponent *pTransformComponent = pBodyComponent->GetTransformComponent();
+		if (pTransformComponent)
+		{
+			pBodyComponent->GetBody().SetPosition(pTransformComponent->GetPosition());
+			pBodyComponent->GetBody().SetRotation(pTransformComponent->GetRotation());
+		}
 	}
 };
 
-HELIUM_DEFINE_TASK( PreProcessPhysics, (ForEachWorld< QueryComponents< BulletBodyComponent, TransformComponent, DoPreProcessPhysics > >) )
+HELIUM_DEFINE_TASK( PreProcessPhysics, (ForEachWorld< QueryComponents< BulletWorldComponent, DoPreProcessPhysics > >) )
 
 void PreProcessPhysics::DefineContract( Helium::TaskContract &rContract )
 {
@@ -168,20 +246,28 @@ void PreProcessPhysics::DefineContract( Helium::TaskContract &rContract )
 
 //////////////////////////////////////////////////////////////////////////
 
-void DoPostProcessPhysics( BulletBodyComponent *pBodyComponent, Helium::TransformComponent *pTransformComponent )
+// Bullet tells us which bodies moved through their motion states, so sleeping bodies are skipped entirely. Fixed step
+// worlds keep the list until the next step so that bodies keep interpolating on frames where no step runs.
+void DoPostProcessPhysics( BulletWorldComponent *pWorldComponent )
 {
-	Simd::Vector3 position;
-	Simd::Quat rotation;
+	BulletWorld *pWorld = pWorldComponent->GetBulletWorld();
+	const DynamicArray< btRigidBody * > &rMovedBodies = pWorld->GetMovedBodies();
 
-	// TODO: This extra copy is lame, either make a mutable Get on transform component or refactor motion state to talk straight to transform component
-	pBodyComponent->GetBody().GetPosition(position);
-	pTransformComponent->SetPosition(position);
+	SyncBodyTransformsRange range;
+	range.ppBodies = rMovedBodies.GetData();
+	range.alpha = pWorld->GetInterpolationAlpha();
 
-	pBodyComponent->GetBody().GetRotation(rotation);
-	pTransformComponent->SetRotation(rotation);
+	if (rMovedBodies.GetSize() >= SYNC_PARALLEL_BODY_COUNT_MIN)
+	{
+		ParallelFor( SyncBodyTransforms, &range, rMovedBodies.GetSize(), SYNC_JOB_BODY_COUNT_MAX );
+	}
+	else
+	{
+		SyncBodyTransforms( &range, 0, rMovedBodies.GetSize() );
+	}
 };
 
-HELIUM_DEFINE_TASK( PostProcessPhysics, (ForEachWorld< QueryComponents< BulletBodyComponent, TransformComponent, DoPostProcessPhysics > >) )
+HELIUM_DEFINE_TASK( PostProcessPhysics, (ForEachWorld< QueryComponents< BulletWorldComponent, DoPostProcessPhysics > >) )
 
 void PostProcessPhysics::DefineContract( Helium::TaskContract &rContract )
 {
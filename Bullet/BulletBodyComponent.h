@@ -8,6 +8,7 @@
 #include "Framework/EntityComponent.h"
 #include "Bullet/BulletBody.h"
 #include "Bullet/HasPhysicalContacts.h"
+#include "Components/TransformComponent.h"
 
 namespace Helium
 {
@@ -19,6 +20,7 @@ namespace Helium
 		HELIUM_DECLARE_COMPONENT( Helium::BulletBodyComponent, Helium::Component );
 		static void PopulateMetaType( Reflect::MetaStruct& comp );
 
+		BulletBodyComponent();
 		~BulletBodyComponent();
 
 		void Finalize( const BulletBodyComponentDefinition &definition );
@@ -36,6 +38,9 @@ namespace Helium
 
 		BulletBody &GetBody() { return m_Body; }
 
+		// Cached at Finalize so that transform sync doesn't need to query the component collection
+		TransformComponent *GetTransformComponent() { return m_TransformComponent.Get(); }
+
 		enum
 		{
 			MAX_BULLET_BODY_FLAGS = 16
@@ -48,6 +53,16 @@ namespace Helium
 
 		ComponentPtr< HasPhysicalContactsComponent > m_HasPhysicalContactsComponent;
 		bool m_TrackCollisions; 
+
+		TransformComponentPtr m_TransformComponent;
+
+		// Set while the world's contact tracker may hold pairs referring to this body
+		bool m_InContactList;
+		friend class BulletContactTracker;
+
+		// Index in the world's kinematic body list, or invalid if not kinematic
+		size_t m_KinematicBodyIndex;
+		friend class BulletWorldComponent;
 	};
 
 	struct HELIUM_BULLET_API BulletBodyComponentDefinition : public Helium::ComponentDefinitionHelperFinalizeOnly<BulletBodyComponent, BulletBodyComponentDefinition>
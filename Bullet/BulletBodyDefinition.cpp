@@ -40,3 +40,21 @@ Helium::BulletBodyDefinition::BulletBodyDefinition()
 {
 
 }
+
+void Helium::BulletBodyDefinition::FinalizeLoad()
+{
+	Base::FinalizeLoad();
+
+	// Bodies already created from a previous version of this definition keep their own reference to the old shape
+	m_SharedShape = BulletSharedShape::Create( *this );
+}
+
+BulletSharedShape * Helium::BulletBodyDefinition::GetSharedShape() const
+{
+	if (!m_SharedShape)
+	{
+		m_SharedShape = BulletSharedShape::Create( *this );
+	}
+
+	return m_SharedShape.Ptr();
+}
@@ -3,6 +3,7 @@
 
 #include "Bullet/Bullet.h"
 #include "Bullet/BulletShapes.h"
+#include "Bullet/BulletSharedShape.h"
 #include "Engine/Asset.h"
 #include "Math/Vector3.h"
 
@@ -22,6 +23,12 @@ namespace Helium
 
 		BulletBodyDefinition();
 
+		virtual void FinalizeLoad();
+
+		// Collision shape shared by all bodies created from this definition, built on first use if FinalizeLoad
+		// has not already done so. Returns NULL if the definition has no shapes.
+		BulletSharedShape *GetSharedShape() const;
+
 		Helium::DynamicArray<BulletShapePtr> m_Shapes;
 		float m_Restitution;
 		float m_LinearDamping;
@@ -34,6 +41,9 @@ namespace Helium
 		bool m_LockRotationZ;
 		bool m_IsKinematic;
 		bool m_DisableCollisionResponse;
+
+	private:
+		mutable BulletSharedShapePtr m_SharedShape;
 	};
 	typedef Helium::StrongPtr<BulletBodyDefinition> BulletBodyDefinitionPtr;
 }
@@ -0,0 +1,180 @@
+#include "BulletPch.h"
+#include "Bullet/BulletContactTracker.h"
+#include "Bullet/BulletBodyComponent.h"
+#include "Bullet/HasPhysicalContacts.h"
+
+#include <algorithm>
+
+using namespace Helium;
+
+void Helium::BulletContactTracker::BeginFrame()
+{
+	// Pairs stay sorted as we compact, so no need to sort again
+	size_t writeIndex = 0;
+	for (size_t readIndex = 0; readIndex < m_Contacts.GetSize(); ++readIndex)
+	{
+		PhysicalContact &rContact = m_Contacts[ readIndex ];
+		if ( rContact.IsTouching() )
+		{
+			// Until a subtick says otherwise, the pair is still touching
+			rContact.m_Flags = PhysicalContact::TOUCHING_AT_BEGIN | PhysicalContact::TOUCHED_THIS_FRAME | PhysicalContact::TOUCHING_AT_END;
+			m_Contacts[ writeIndex++ ] = rContact;
+		}
+	}
+
+	m_Contacts.Resize( writeIndex );
+}
+
+void Helium::BulletContactTracker::BeginSubtick()
+{
+	for (size_t i = 0; i < m_Contacts.GetSize(); ++i)
+	{
+		m_Contacts[ i ].m_Flags &= ~PhysicalContact::TOUCHING_AT_END;
+	}
+
+	m_SubtickContacts.Resize( 0 );
+}
+
+void Helium::BulletContactTracker::AddContact( BulletBodyComponent *pBody, BulletBodyComponent *pOtherBody )
+{
+	HELIUM_ASSERT( pBody );
+	HELIUM_ASSERT( pOtherBody );
+
+	PhysicalContact contact;
+	contact.m_pBody = pBody;
+	contact.m_pOtherBody = pOtherBody;
+	contact.m_pOtherEntity = pOtherBody->GetEntity();
+	contact.m_Flags = PhysicalContact::TOUCHED_THIS_FRAME | PhysicalContact::TOUCHING_AT_END;
+	m_SubtickContacts.Push( contact );
+
+	pBody->m_InContactList = true;
+	pOtherBody->m_InContactList = true;
+}
+
+void Helium::BulletContactTracker::EndSubtick()
+{
+	if ( m_SubtickContacts.IsEmpty() )
+	{
+		return;
+	}
+
+	std::sort( m_SubtickContacts.GetData(), m_SubtickContacts.GetData() + m_SubtickContacts.GetSize() );
+
+	// Merge the two sorted lists
+	m_MergedContacts.Resize( 0 );
+	m_MergedContacts.Reserve( m_Contacts.GetSize() + m_SubtickContacts.GetSize() );
+
+	size_t contactIndex = 0;
+	size_t subtickIndex = 0;
+	while ( contactIndex < m_Contacts.GetSize() || subtickIndex < m_SubtickContacts.GetSize() )
+	{
+		if ( subtickIndex == m_SubtickContacts.GetSize() )
+		{
+			m_MergedContacts.Push( m_Contacts[ contactIndex++ ] );
+			continue;
+		}
+
+		const PhysicalContact &rSubtickContact = m_SubtickContacts[ subtickIndex++ ];
+
+		// Several manifolds can report the same pair
+		if ( !m_MergedContacts.IsEmpty() && m_MergedContacts.GetLast() == rSubtickContact )
+		{
+			m_MergedContacts.GetLast().m_Flags |= PhysicalContact::TOUCHED_THIS_FRAME | PhysicalContact::TOUCHING_AT_END;
+			continue;
+		}
+
+		while ( contactIndex < m_Contacts.GetSize() && m_Contacts[ contactIndex ] < rSubtickContact )
+		{
+			m_MergedContacts.Push( m_Contacts[ contactIndex++ ] );
+		}
+
+		if ( contactIndex < m_Contacts.GetSize() && m_Contacts[ contactIndex ] == rSubtickContact )
+		{
+			const PhysicalContact &rContact = m_Contacts[ contactIndex++ ];
+			if ( rContact.IsValid() )
+			{
+				m_MergedContacts.Push( rContact );
+				m_MergedContacts.GetLast().m_Flags |= PhysicalContact::TOUCHED_THIS_FRAME | PhysicalContact::TOUCHING_AT_END;
+				continue;
+			}
+
+			// A destroyed body's memory was reused by a new body, drop the stale pair in favor of the new one
+		}
+
+		m_MergedContacts.Push( rSubtickContact );
+	}
+
+	m_Contacts.Swap( m_MergedContacts );
+}
+
+void Helium::BulletContactTracker::EndFrame( ComponentManager &rComponentManager )
+{
+	RemoveDestroyedContacts();
+
+	for (ComponentIteratorT<HasPhysicalContactsComponent> iter( rComponentManager ); iter.GetBaseComponent(); iter.Advance())
+	{
+		iter->SetContacts( NULL, 0 );
+	}
+
+	size_t rangeBegin = 0;
+	while ( rangeBegin < m_Contacts.GetSize() )
+	{
+		BulletBodyComponent *pBody = m_Contacts[ rangeBegin ].m_pBody;
+
+		size_t rangeEnd = rangeBegin + 1;
+		while ( rangeEnd < m_Contacts.GetSize() && m_Contacts[ rangeEnd ].m_pBody == pBody )
+		{
+			++rangeEnd;
+		}
+
+		HasPhysicalContactsComponent *pContacts = pBody->GetOrCreateHasPhysicalContactsComponent();
+		pContacts->SetContacts( m_Contacts.GetData() + rangeBegin, rangeEnd - rangeBegin );
+
+		rangeBegin = rangeEnd;
+	}
+
+	for (ComponentIteratorT<HasPhysicalContactsComponent> iter( rComponentManager ); iter.GetBaseComponent(); iter.Advance())
+	{
+		if ( !iter->GetContactCount() )
+		{
+			iter->FreeComponentDeferred();
+		}
+	}
+}
+
+void Helium::BulletContactTracker::RemoveBody( BulletBodyComponent *pBody )
+{
+	HELIUM_ASSERT( pBody );
+
+	if ( !pBody->m_InContactList )
+	{
+		return;
+	}
+
+	// Keep the pairs in place so the list stays sorted, they are dropped at the end of the frame
+	for (size_t i = 0; i < m_Contacts.GetSize(); ++i)
+	{
+		PhysicalContact &rContact = m_Contacts[ i ];
+		if ( rContact.m_pBody == pBody || rContact.m_pOtherBody == pBody )
+		{
+			rContact.m_pOtherEntity = NULL;
+			rContact.m_Flags |= PhysicalContact::DESTROYED;
+		}
+	}
+
+	pBody->m_InContactList = false;
+}
+
+void Helium::BulletContactTracker::RemoveDestroyedContacts()
+{
+	size_t writeIndex = 0;
+	for (size_t readIndex = 0; readIndex < m_Contacts.GetSize(); ++readIndex)
+	{
+		if ( m_Contacts[ readIndex ].IsValid() )
+		{
+			m_Contacts[ writeIndex++ ] = m_Contacts[ readIndex ];
+		}
+	}
+
+	m_Contacts.Resize( writeIndex );
+}
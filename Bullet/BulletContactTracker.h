@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Bullet/Bullet.h"
+#include "Foundation/DynamicArray.h"
+
+namespace Helium
+{
+	class BulletBodyComponent;
+	class ComponentManager;
+	class Entity;
+
+	// A tracking body and another body it touched during the frame
+	struct HELIUM_BULLET_API PhysicalContact
+	{
+		enum
+		{
+			TOUCHING_AT_BEGIN  = 1 << 0,  // Touching at the end of the previous frame
+			TOUCHED_THIS_FRAME = 1 << 1,  // Touching during any subtick of this frame
+			TOUCHING_AT_END    = 1 << 2,  // Touching during the last subtick of this frame
+			DESTROYED          = 1 << 3,  // One of the bodies was destroyed after the contact was recorded
+		};
+
+		BulletBodyComponent *m_pBody;
+		BulletBodyComponent *m_pOtherBody;
+		Entity *m_pOtherEntity;
+		uint32_t m_Flags;
+
+		bool IsValid() const { return ( m_Flags & DESTROYED ) == 0; }
+		bool IsTouching() const { return ( m_Flags & ( TOUCHING_AT_END | DESTROYED ) ) == TOUCHING_AT_END; }
+		bool WasTouchedThisFrame() const { return ( m_Flags & ( TOUCHED_THIS_FRAME | DESTROYED ) ) == TOUCHED_THIS_FRAME; }
+
+		// Started touching this frame, even if it stopped again before the end of the frame
+		bool IsBeginTouch() const { return ( m_Flags & ( TOUCHED_THIS_FRAME | TOUCHING_AT_BEGIN | DESTROYED ) ) == TOUCHED_THIS_FRAME; }
+
+		// Stopped touching this frame, even if it only touched briefly during the frame
+		bool IsEndTouch() const { return ( m_Flags & ( TOUCHED_THIS_FRAME | TOUCHING_AT_END | DESTROYED ) ) == TOUCHED_THIS_FRAME; }
+
+		bool operator<( const PhysicalContact &rhs ) const
+		{
+			return m_pBody < rhs.m_pBody || ( m_pBody == rhs.m_pBody && m_pOtherBody < rhs.m_pOtherBody );
+		}
+
+		bool operator==( const PhysicalContact &rhs ) const
+		{
+			return m_pBody == rhs.m_pBody && m_pOtherBody == rhs.m_pOtherBody;
+		}
+	};
+
+	// Tracks contacts for every body in a bullet world that wants them as one flat list of pairs, sorted by tracking body
+	// and then by the body it touched. Each subtick's contacts are gathered from the dispatcher's manifolds in a single
+	// pass, sorted, and merged into the list, and at the end of the frame each tracking body's HasPhysicalContactsComponent
+	// is pointed at its range of the list. The arrays keep their capacity from frame to frame, so once the number of
+	// contacts settles, tracking does no allocation and takes no references.
+	class HELIUM_BULLET_API BulletContactTracker
+	{
+	public:
+		// Carry pairs that were touching at the end of the last frame into this one
+		void BeginFrame();
+
+		void BeginSubtick();
+		void AddContact( BulletBodyComponent *pBody, BulletBodyComponent *pOtherBody );
+		void EndSubtick();
+
+		// Assign contact ranges to HasPhysicalContactsComponents, creating and freeing them as needed
+		void EndFrame( ComponentManager &rComponentManager );
+
+		// Mark any pairs referring to a body that is being destroyed
+		void RemoveBody( BulletBodyComponent *pBody );
+
+		const PhysicalContact *GetContacts() const { return m_Contacts.GetData(); }
+		size_t GetContactCount() const { return m_Contacts.GetSize(); }
+
+	private:
+		void RemoveDestroyedContacts();
+
+		DynamicArray< PhysicalContact > m_Contacts;
+		DynamicArray< PhysicalContact > m_MergedContacts;
+		DynamicArray< PhysicalContact > m_SubtickContacts;
+	};
+}
@@ -211,6 +211,7 @@ HELIUM_DEFINE_TASK( DrawDebugPhysics, (ForEachWorld< DoDrawDebugPhysics >) )
 
 void DrawDebugPhysics::DefineContract( Helium::TaskContract &rContract )
 {
+	rContract.RequiresGraphics();
 	rContract.ExecuteAfter<Helium::StandardDependencies::ProcessPhysics>();
 	rContract.ExecuteBefore<Helium::StandardDependencies::Render>();
 }
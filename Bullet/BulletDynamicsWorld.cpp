@@ -0,0 +1,267 @@
+#include "BulletPch.h"
+#include "Bullet/BulletDynamicsWorld.h"
+
+#include "Engine/ParallelFor.h"
+
+#include <algorithm>
+
+using namespace Helium;
+
+// Islands are only solved in parallel once the step has at least this much work (bodies, manifolds and constraints)
+static const uint32_t SOLVE_PARALLEL_COST_MIN = 256;
+
+// Same island id bullet's own island callback uses for constraints
+static inline int GetConstraintIslandId( const btTypedConstraint *pConstraint )
+{
+	const btCollisionObject &rBodyA = pConstraint->getRigidBodyA();
+	const btCollisionObject &rBodyB = pConstraint->getRigidBodyB();
+	return rBodyA.getIslandTag() >= 0 ? rBodyA.getIslandTag() : rBodyB.getIslandTag();
+}
+
+static inline bool IsKinematic( const btCollisionObject *pObject )
+{
+	return pObject->isKinematicObject();
+}
+
+struct ConstraintIslandLess
+{
+	bool operator()( const btTypedConstraint *pLhs, const btTypedConstraint *pRhs ) const
+	{
+		return GetConstraintIslandId( pLhs ) < GetConstraintIslandId( pRhs );
+	}
+};
+
+// A step's parallel islands split into one contiguous range per solver, handed to ParallelFor
+struct SolveIslandsRanges
+{
+	BulletDynamicsWorld *pWorld;
+	const btContactSolverInfo *pSolverInfo;
+	// Island range boundaries, one range per solver
+	const uint32_t *pRangeStarts;
+};
+
+// Solve each range with the solver matching its index, so no two threads share a solver
+static void SolveIslandRanges( void *pUserData, size_t begin, size_t end )
+{
+	const SolveIslandsRanges *pRanges = static_cast< const SolveIslandsRanges * >( pUserData );
+
+	for ( size_t rangeIndex = begin; rangeIndex < end; ++rangeIndex )
+	{
+		uint32_t firstIsland = pRanges->pRangeStarts[ rangeIndex ];
+		uint32_t islandCount = pRanges->pRangeStarts[ rangeIndex + 1 ] - firstIsland;
+		pRanges->pWorld->SolveIslands(
+			firstIsland, islandCount, static_cast< uint32_t >( rangeIndex ), *pRanges->pSolverInfo );
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// Records every island bullet builds instead of solving it on the spot
+class Helium::BulletDynamicsWorld::IslandGatherCallback : public btSimulationIslandManager::IslandCallback
+{
+public:
+	IslandGatherCallback( BulletDynamicsWorld &rWorld )
+		: m_rWorld( rWorld )
+		, m_ConstraintIndex( 0 )
+	{
+
+	}
+
+	virtual void processIsland( btCollisionObject **bodies, int numBodies, btPersistentManifold **manifolds, int numManifolds, int islandId )
+	{
+		DynamicArray< btTypedConstraint * > &rConstraints = m_rWorld.m_SortedConstraints;
+		btTypedConstraint **ppConstraints = NULL;
+		size_t constraintCount = 0;
+
+		if ( islandId < 0 )
+		{
+			// Islands aren't split, everything is solved together
+			ppConstraints = rConstraints.GetData();
+			constraintCount = rConstraints.GetSize();
+		}
+		else
+		{
+			// Islands arrive in increasing id order, as do the sorted constraints
+			while ( m_ConstraintIndex < rConstraints.GetSize() && GetConstraintIslandId( rConstraints[ m_ConstraintIndex ] ) < islandId )
+			{
+				++m_ConstraintIndex;
+			}
+
+			ppConstraints = rConstraints.GetData() + m_ConstraintIndex;
+			while ( m_ConstraintIndex < rConstraints.GetSize() && GetConstraintIslandId( rConstraints[ m_ConstraintIndex ] ) == islandId )
+			{
+				++m_ConstraintIndex;
+				++constraintCount;
+			}
+		}
+
+		if ( !numManifolds && !constraintCount )
+		{
+			return;
+		}
+
+		bool bTouchesKinematic = false;
+		for ( int i = 0; i < numManifolds && !bTouchesKinematic; ++i )
+		{
+			bTouchesKinematic = IsKinematic( manifolds[i]->getBody0() ) || IsKinematic( manifolds[i]->getBody1() );
+		}
+
+		for ( size_t i = 0; i < constraintCount && !bTouchesKinematic; ++i )
+		{
+			bTouchesKinematic = IsKinematic( &ppConstraints[i]->getRigidBodyA() ) || IsKinematic( &ppConstraints[i]->getRigidBodyB() );
+		}
+
+		Island *pIsland = bTouchesKinematic ? m_rWorld.m_SerialIslands.New() : m_rWorld.m_ParallelIslands.New();
+		HELIUM_ASSERT( pIsland );
+		pIsland->m_FirstBody = m_rWorld.m_IslandBodies.GetSize();
+		pIsland->m_BodyCount = static_cast< uint32_t >( numBodies );
+		pIsland->m_ppManifolds = manifolds;
+		pIsland->m_ManifoldCount = static_cast< uint32_t >( numManifolds );
+		pIsland->m_ppConstraints = ppConstraints;
+		pIsland->m_ConstraintCount = static_cast< uint32_t >( constraintCount );
+
+		for ( int i = 0; i < numBodies; ++i )
+		{
+			m_rWorld.m_IslandBodies.Push( bodies[i] );
+		}
+	}
+
+private:
+	BulletDynamicsWorld &m_rWorld;
+	size_t m_ConstraintIndex;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+Helium::BulletDynamicsWorld::BulletDynamicsWorld(
+	btDispatcher *pDispatcher,
+	btBroadphaseInterface *pPairCache,
+	btSequentialImpulseConstraintSolver *pSolver,
+	btCollisionConfiguration *pCollisionConfiguration,
+	uint32_t solverPoolSize )
+	: btDiscreteDynamicsWorld( pDispatcher, pPairCache, pSolver, pCollisionConfiguration )
+{
+	if ( solverPoolSize > SOLVER_POOL_SIZE_MAX )
+	{
+		solverPoolSize = SOLVER_POOL_SIZE_MAX;
+	}
+
+	// The world's own solver is the first in the pool
+	for ( uint32_t i = 1; i < solverPoolSize; ++i )
+	{
+		m_SolverPool.Push( new btSequentialImpulseConstraintSolver );
+	}
+}
+
+Helium::BulletDynamicsWorld::~BulletDynamicsWorld()
+{
+	for ( size_t i = 0; i < m_SolverPool.GetSize(); ++i )
+	{
+		delete m_SolverPool[i];
+	}
+}
+
+void Helium::BulletDynamicsWorld::solveConstraints( btContactSolverInfo &solverInfo )
+{
+	if ( m_SolverPool.IsEmpty() )
+	{
+		btDiscreteDynamicsWorld::solveConstraints( solverInfo );
+		return;
+	}
+
+	BT_PROFILE("solveConstraints");
+
+	m_SortedConstraints.Resize( 0 );
+	for ( int i = 0; i < getNumConstraints(); ++i )
+	{
+		m_SortedConstraints.Push( getConstraint( i ) );
+	}
+
+	std::sort( m_SortedConstraints.GetData(), m_SortedConstraints.GetData() + m_SortedConstraints.GetSize(), ConstraintIslandLess() );
+
+	m_ParallelIslands.Resize( 0 );
+	m_SerialIslands.Resize( 0 );
+	m_IslandBodies.Resize( 0 );
+
+	btConstraintSolver *pSolver = getConstraintSolver();
+	pSolver->prepareSolve( getCollisionWorld()->getNumCollisionObjects(), getCollisionWorld()->getDispatcher()->getNumManifolds() );
+
+	IslandGatherCallback gatherCallback( *this );
+	getSimulationIslandManager()->buildAndProcessIslands( getCollisionWorld()->getDispatcher(), getCollisionWorld(), &gatherCallback );
+
+	// Split the parallel islands into one contiguous range per solver with roughly even work in each
+	uint32_t islandCount = static_cast< uint32_t >( m_ParallelIslands.GetSize() );
+	uint32_t totalCost = 0;
+	for ( uint32_t i = 0; i < islandCount; ++i )
+	{
+		const Island &rIsland = m_ParallelIslands[i];
+		totalCost += rIsland.m_BodyCount + rIsland.m_ManifoldCount + rIsland.m_ConstraintCount;
+	}
+
+	uint32_t rangeCount = Min( GetSolverPoolSize(), islandCount );
+	if ( rangeCount > 1 && totalCost >= SOLVE_PARALLEL_COST_MIN )
+	{
+		uint32_t rangeStarts[ SOLVER_POOL_SIZE_MAX + 1 ];
+		uint32_t rangeIndex = 0;
+		uint32_t rangeCost = 0;
+		uint32_t targetCost = ( totalCost + rangeCount - 1 ) / rangeCount;
+
+		rangeStarts[ 0 ] = 0;
+		for ( uint32_t i = 0; i < islandCount && rangeIndex + 1 < rangeCount; ++i )
+		{
+			const Island &rIsland = m_ParallelIslands[i];
+			rangeCost += rIsland.m_BodyCount + rIsland.m_ManifoldCount + rIsland.m_ConstraintCount;
+			if ( rangeCost >= targetCost )
+			{
+				rangeStarts[ ++rangeIndex ] = i + 1;
+				rangeCost = 0;
+			}
+		}
+
+		rangeStarts[ ++rangeIndex ] = islandCount;
+		rangeCount = rangeIndex;
+
+		SolveIslandsRanges ranges;
+		ranges.pWorld = this;
+		ranges.pSolverInfo = &solverInfo;
+		ranges.pRangeStarts = rangeStarts;
+		ParallelFor( SolveIslandRanges, &ranges, rangeCount, 1 );
+	}
+	else
+	{
+		SolveIslands( 0, islandCount, 0, solverInfo );
+	}
+
+	// Kinematic bodies can be shared between these, so they go one at a time once the parallel islands are done
+	for ( size_t i = 0; i < m_SerialIslands.GetSize(); ++i )
+	{
+		SolveIsland( *pSolver, m_SerialIslands[i], solverInfo );
+	}
+
+	pSolver->allSolved( solverInfo, getDebugDrawer() );
+}
+
+void Helium::BulletDynamicsWorld::SolveIslands( uint32_t firstIsland, uint32_t islandCount, uint32_t solverIndex, const btContactSolverInfo &rSolverInfo )
+{
+	HELIUM_ASSERT( solverIndex < GetSolverPoolSize() );
+	btConstraintSolver *pSolver = solverIndex ? m_SolverPool[ solverIndex - 1 ] : getConstraintSolver();
+
+	for ( uint32_t i = firstIsland; i < firstIsland + islandCount; ++i )
+	{
+		SolveIsland( *pSolver, m_ParallelIslands[i], rSolverInfo );
+	}
+}
+
+void Helium::BulletDynamicsWorld::SolveIsland( btConstraintSolver &rSolver, const Island &rIsland, const btContactSolverInfo &rSolverInfo )
+{
+	rSolver.solveGroup(
+		rIsland.m_BodyCount ? m_IslandBodies.GetData() + rIsland.m_FirstBody : NULL,
+		static_cast< int >( rIsland.m_BodyCount ),
+		rIsland.m_ppManifolds,
+		static_cast< int >( rIsland.m_ManifoldCount ),
+		rIsland.m_ppConstraints,
+		static_cast< int >( rIsland.m_ConstraintCount ),
+		rSolverInfo,
+		getDebugDrawer(),
+		getCollisionWorld()->getDispatcher() );
+}
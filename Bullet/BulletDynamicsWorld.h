@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Bullet/Bullet.h"
+#include "Foundation/DynamicArray.h"
+
+#include "BulletDynamics/Dynamics/btDiscreteDynamicsWorld.h"
+
+class btSequentialImpulseConstraintSolver;
+
+namespace Helium
+{
+	// Discrete dynamics world that solves its simulation islands on the job system. Islands share no dynamic bodies, so
+	// each one can be handed to its own solver from a pool. Islands touching a kinematic body are still solved on the
+	// stepping thread, since bullet's solver writes to every non-static body it sees and kinematic bodies aren't
+	// confined to one island.
+	class HELIUM_BULLET_API BulletDynamicsWorld : public btDiscreteDynamicsWorld
+	{
+	public:
+		// Largest solver pool a world may have, one child job is spawned per solver
+		static const uint32_t SOLVER_POOL_SIZE_MAX = 64;
+
+		BulletDynamicsWorld(
+			btDispatcher *pDispatcher,
+			btBroadphaseInterface *pPairCache,
+			btSequentialImpulseConstraintSolver *pSolver,
+			btCollisionConfiguration *pCollisionConfiguration,
+			uint32_t solverPoolSize );
+		virtual ~BulletDynamicsWorld();
+
+		uint32_t GetSolverPoolSize() const { return static_cast< uint32_t >( m_SolverPool.GetSize() ) + 1; }
+
+		// Solve a range of parallel islands with the given pool solver
+		void SolveIslands( uint32_t firstIsland, uint32_t islandCount, uint32_t solverIndex, const btContactSolverInfo &rSolverInfo );
+
+	protected:
+		virtual void solveConstraints( btContactSolverInfo &solverInfo );
+
+	private:
+		struct Island
+		{
+			size_t m_FirstBody;
+			uint32_t m_BodyCount;
+			btPersistentManifold **m_ppManifolds;
+			uint32_t m_ManifoldCount;
+			btTypedConstraint **m_ppConstraints;
+			uint32_t m_ConstraintCount;
+		};
+
+		class IslandGatherCallback;
+		friend class IslandGatherCallback;
+
+		void SolveIsland( btConstraintSolver &rSolver, const Island &rIsland, const btContactSolverInfo &rSolverInfo );
+
+		// Solvers other than the world's own, which solves serial islands and the first range of parallel ones
+		DynamicArray< btSequentialImpulseConstraintSolver * > m_SolverPool;
+
+		// Islands gathered during the current step. Island bodies are copied since bullet reuses its body array for
+		// every island, but manifolds stay valid in the island manager until the next step.
+		DynamicArray< Island > m_ParallelIslands;
+		DynamicArray< Island > m_SerialIslands;
+		DynamicArray< btCollisionObject * > m_IslandBodies;
+		DynamicArray< btTypedConstraint * > m_SortedConstraints;
+	};
+}
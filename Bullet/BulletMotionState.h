@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Bullet/Bullet.h"
+#include "Bullet/BulletWorld.h"
+
+#include "LinearMath/btMotionState.h"
+#include "LinearMath/btTransform.h"
+
+class btRigidBody;
+
+namespace Helium
+{
+	// Bullet only calls setWorldTransform for bodies that are awake, so this is also how we find out which bodies
+	// moved during a step without touching the sleeping ones. The transform before the most recent step is kept so
+	// that fixed step worlds can interpolate between steps when syncing to transform components.
+	struct BulletMotionState : public btMotionState
+	{
+		BulletMotionState(const btTransform &worldTrans, BulletWorld &rWorld)
+			: m_Transform(worldTrans)
+			, m_PreviousTransform(worldTrans)
+			, m_pWorld(&rWorld)
+			, m_pBody(NULL)
+			, m_bMoved(false)
+			, m_bStepped(false)
+		{
+
+		}
+
+		virtual void getWorldTransform( btTransform& worldTrans ) const
+		{
+			worldTrans = m_Transform;
+		}
+
+		virtual void setWorldTransform( const btTransform& worldTrans ) 
+		{
+			m_PreviousTransform = m_Transform;
+			m_Transform = worldTrans;
+			m_bStepped = true;
+
+			if (!m_bMoved && m_pBody)
+			{
+				m_bMoved = true;
+				m_pWorld->AddMovedBody(m_pBody);
+			}
+		}
+
+		// Interpolated transform, weight is from BulletWorld::GetInterpolationAlpha()
+		void GetInterpolatedTransform( float alpha, btTransform &rTransform ) const
+		{
+			if (alpha >= 1.0f)
+			{
+				rTransform = m_Transform;
+				return;
+			}
+
+			rTransform.setOrigin( m_PreviousTransform.getOrigin().lerp( m_Transform.getOrigin(), alpha ) );
+			rTransform.setRotation( slerp( m_PreviousTransform.getRotation(), m_Transform.getRotation(), alpha ) );
+		}
+
+		btTransform m_Transform;
+		btTransform m_PreviousTransform;
+		BulletWorld *m_pWorld;
+		btRigidBody *m_pBody;
+
+		// Set while the body is in the world's moved body list
+		bool m_bMoved;
+		// Set when bullet moved the body since the world last cleared its moved body list
+		bool m_bStepped;
+	};
+}
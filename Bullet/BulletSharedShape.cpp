@@ -0,0 +1,92 @@
+#include "BulletPch.h"
+#include "Bullet/BulletSharedShape.h"
+#include "Bullet/BulletBodyDefinition.h"
+#include "Bullet/BulletShapes.h"
+
+using namespace Helium;
+
+Helium::BulletSharedShape::BulletSharedShape()
+	: m_Shape(NULL)
+	, m_Mass(0.0f)
+{
+	m_LocalInertia[0] = 0.0f;
+	m_LocalInertia[1] = 0.0f;
+	m_LocalInertia[2] = 0.0f;
+}
+
+Helium::BulletSharedShape::~BulletSharedShape()
+{
+	// Compound shapes are pushed last, so they are deleted before their children
+	for (size_t i = m_OwnedShapes.GetSize(); i > 0; --i)
+	{
+		delete m_OwnedShapes[i - 1];
+	}
+}
+
+BulletSharedShape * Helium::BulletSharedShape::Create( const BulletBodyDefinition &rBodyDefinition )
+{
+	if (rBodyDefinition.m_Shapes.IsEmpty())
+	{
+		return NULL;
+	}
+
+	BulletSharedShape *pSharedShape = new BulletSharedShape();
+	btVector3 inertia(0.0f, 0.0f, 0.0f);
+
+	if (rBodyDefinition.m_Shapes.GetSize() > 1 || rBodyDefinition.m_Shapes[0]->m_Position.GetMagnitudeSquared() > HELIUM_EPSILON)
+	{
+		btCompoundShape *pCompoundShape = new btCompoundShape( true );
+
+		float mass = 0.0f;
+		for (size_t i = 0; i < rBodyDefinition.m_Shapes.GetSize(); ++i)
+		{
+			btVector3 position;
+			btQuaternion rotation;
+
+			ConvertToBullet( rBodyDefinition.m_Shapes[i]->m_Position, position );
+			ConvertToBullet( rBodyDefinition.m_Shapes[i]->m_Rotation, rotation );
+
+			btCollisionShape *pBulletShape = rBodyDefinition.m_Shapes[i]->CreateShape();
+			pSharedShape->m_OwnedShapes.Push( pBulletShape );
+			pCompoundShape->addChildShape(
+				btTransform(rotation, position), 
+				pBulletShape);
+
+			mass += rBodyDefinition.m_Shapes[i]->m_Mass;
+		}
+
+		if (mass != 0.0f)
+		{
+			pCompoundShape->calculateLocalInertia(mass, inertia);
+		}
+
+		pSharedShape->m_OwnedShapes.Push( pCompoundShape );
+		pSharedShape->m_Shape = pCompoundShape;
+		pSharedShape->m_Mass = mass;
+	}
+	else
+	{
+		BulletShape *pShape = rBodyDefinition.m_Shapes[0];
+		btCollisionShape *pBulletShape = pShape->CreateShape();
+
+		if (pShape->m_Mass != 0.0f)
+		{
+			pBulletShape->calculateLocalInertia(pShape->m_Mass, inertia);
+		}
+
+		pSharedShape->m_OwnedShapes.Push( pBulletShape );
+		pSharedShape->m_Shape = pBulletShape;
+		pSharedShape->m_Mass = pShape->m_Mass;
+	}
+
+	pSharedShape->m_LocalInertia[0] = inertia.getX();
+	pSharedShape->m_LocalInertia[1] = inertia.getY();
+	pSharedShape->m_LocalInertia[2] = inertia.getZ();
+
+	return pSharedShape;
+}
+
+void Helium::BulletSharedShape::GetLocalInertia( btVector3 &rInertia ) const
+{
+	rInertia.setValue(m_LocalInertia[0], m_LocalInertia[1], m_LocalInertia[2]);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Bullet/Bullet.h"
+#include "Foundation/DynamicArray.h"
+#include "Foundation/SmartPtr.h"
+
+class btCollisionShape;
+class btVector3;
+
+namespace Helium
+{
+	struct BulletBodyDefinition;
+
+	// Collision shape built once from a body definition and shared by every body created from that definition. The
+	// definition holds one reference and each body holds another, so a body keeps its shape alive even if the
+	// definition is reloaded or destroyed first. Compound children, total mass and local inertia are all computed
+	// when the shape is built, so creating a body from a cached shape does no shape work at all.
+	class HELIUM_BULLET_API BulletSharedShape : public Helium::RefCountBase< BulletSharedShape >
+	{
+	public:
+		// Returns NULL if the definition has no shapes
+		static BulletSharedShape *Create( const BulletBodyDefinition &rBodyDefinition );
+
+		~BulletSharedShape();
+
+		btCollisionShape *GetShape() const { return m_Shape; }
+		float GetMass() const { return m_Mass; }
+		void GetLocalInertia( btVector3 &rInertia ) const;
+
+	private:
+		BulletSharedShape();
+
+		// Every bullet shape owned by this object, including compound children
+		DynamicArray<btCollisionShape *> m_OwnedShapes;
+		btCollisionShape *m_Shape;
+		float m_Mass;
+		float m_LocalInertia[3];
+	};
+	typedef Helium::SmartPtr< BulletSharedShape > BulletSharedShapePtr;
+}
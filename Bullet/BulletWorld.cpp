@@ -4,19 +4,15 @@
 #include "Bullet/BulletWorldDefinition.h"
 #include "Bullet/BulletBodyComponent.h"
 #include "Bullet/BulletWorldComponent.h"
+#include "Bullet/BulletMotionState.h"
+#include "Bullet/BulletDynamicsWorld.h"
 
 using namespace Helium;
 
 void InternalTickCallback(btDynamicsWorld *world, btScalar timeStep)
 {
-	BulletWorld * pWorld = static_cast<BulletWorld *>( world->getWorldUserInfo() );
-
-	ComponentManager &pComponentManager = *static_cast<BulletWorldComponent *>(world->getWorldUserInfo())->GetComponentManager();
-	for (ComponentIteratorT<HasPhysicalContactsComponent> iter( pComponentManager ); iter.GetBaseComponent(); iter.Advance())
-	{
-		//HELIUM_TRACE( TraceLevels::Debug, "iter->m_EndFrameTouching.Clear %d\n", iter->m_EndFrameTouching.GetSize());
-		iter->m_EndFrameTouching.Clear();
-	}
+	BulletContactTracker &rContactTracker = static_cast<BulletWorldComponent *>(world->getWorldUserInfo())->GetContactTracker();
+	rContactTracker.BeginSubtick();
 
 	int numManifolds = world->getDispatcher()->getNumManifolds();
 	for (int i=0;i<numManifolds;i++)
@@ -28,11 +24,13 @@ void InternalTickCallback(btDynamicsWorld *world, btScalar timeStep)
 		BulletBodyComponent *pBodyComponentA = static_cast<BulletBodyComponent *>( obA->getUserPointer() );
 		BulletBodyComponent *pBodyComponentB = static_cast<BulletBodyComponent *>( obB->getUserPointer() );
 
-		bool trackACollisions = pBodyComponentA && pBodyComponentA->ShouldTrackCollisions();
-		bool trackBCollisions = pBodyComponentB && pBodyComponentB->ShouldTrackCollisions();
+		if ( !pBodyComponentA || !pBodyComponentB )
+		{
+			continue;
+		}
 
-		trackACollisions = pBodyComponentA->GetShouldTrackPhysicalContact( pBodyComponentB );
-		trackBCollisions = pBodyComponentB->GetShouldTrackPhysicalContact( pBodyComponentA );
+		bool trackACollisions = pBodyComponentA->GetShouldTrackPhysicalContact( pBodyComponentB );
+		bool trackBCollisions = pBodyComponentB->GetShouldTrackPhysicalContact( pBodyComponentA );
 
 		if ( trackACollisions || trackBCollisions )
 		{
@@ -42,20 +40,12 @@ void InternalTickCallback(btDynamicsWorld *world, btScalar timeStep)
 			{
 				if ( trackACollisions )
 				{
-					HasPhysicalContactsComponent *pContacts = pBodyComponentA->GetOrCreateHasPhysicalContactsComponent();
-					pContacts->m_EverTouchedThisFrame.Insert( pBodyComponentB->GetEntity() );
-
-					// TODO: Only need to do this on last subtick really
-					pContacts->m_EndFrameTouching.Insert( pBodyComponentB->GetEntity() );
+					rContactTracker.AddContact( pBodyComponentA, pBodyComponentB );
 				}
 
 				if ( trackBCollisions )
 				{
-					HasPhysicalContactsComponent *pContacts = pBodyComponentB->GetOrCreateHasPhysicalContactsComponent();
-					pContacts->m_EverTouchedThisFrame.Insert( pBodyComponentA->GetEntity() );
-
-					// TODO: Only need to do this on last subtick really
-					pContacts->m_EndFrameTouching.Insert( pBodyComponentA->GetEntity() );
+					rContactTracker.AddContact( pBodyComponentB, pBodyComponentA );
 				}
 			}
 
@@ -107,27 +97,52 @@ void InternalTickCallback(btDynamicsWorld *world, btScalar timeStep)
 #endif
 		}
 	}
+
+	rContactTracker.EndSubtick();
+}
+
+BulletWorld::BulletWorld()
+	: m_CollisionConfiguration(NULL)
+	, m_Dispatcher(NULL)
+	, m_OverlappingPairCache(NULL)
+	, m_Solver(NULL)
+	, m_DynamicsWorld(NULL)
+	, m_FixedTimeStep(0.0f)
+	, m_MaxSubSteps(0)
+	, m_InterpolateTransforms(false)
+	, m_StepConcurrently(false)
+	, m_Accumulator(0.0f)
+	, m_InterpolationAlpha(1.0f)
+{
+
 }
 
 void BulletWorld::Initialize(const BulletWorldDefinition &rWorldDefinition)
 {	
+	m_FixedTimeStep = rWorldDefinition.m_FixedTimeStep;
+	m_MaxSubSteps = Max< uint32_t >( rWorldDefinition.m_MaxSubSteps, 1 );
+	m_InterpolateTransforms = rWorldDefinition.m_InterpolateTransforms;
+	m_StepConcurrently = rWorldDefinition.m_StepConcurrently;
+
+
 	// collision configuration contains default setup for memory, collision setup. Advanced users can create their own configuration.
 	m_CollisionConfiguration = new btDefaultCollisionConfiguration();
 
-	// use the default collision dispatcher. For parallel processing you can use a diffent dispatcher (see Extras/BulletMultiThreaded)
+	// use the default collision dispatcher. Narrowphase stays serial, the convex algorithms share the configuration's simplex solver
 	m_Dispatcher = new btCollisionDispatcher(m_CollisionConfiguration);
 
 	// btDbvtBroadphase is a good general purpose broadphase. You can also try out btAxis3Sweep.
 	m_OverlappingPairCache = new btDbvtBroadphase();
 
-	// the default constraint solver. For parallel processing you can use a different solver (see Extras/BulletMultiThreaded)
+	// the world's own solver, more are created for the world's solver pool to solve islands in parallel
 	m_Solver = new btSequentialImpulseConstraintSolver;
 	
-	m_DynamicsWorld = new btDiscreteDynamicsWorld(
+	m_DynamicsWorld = new BulletDynamicsWorld(
 		m_Dispatcher,
 		m_OverlappingPairCache,
 		m_Solver,
-		m_CollisionConfiguration);
+		m_CollisionConfiguration,
+		rWorldDefinition.m_SolverPoolSize);
 
 	btVector3 gravity;
 	//ConvertToBullet(pWorldDefinition->m_Gravity, gravity);
@@ -148,5 +163,75 @@ BulletWorld::~BulletWorld()
 
 void BulletWorld::Simulate( float dt )
 {
-	m_DynamicsWorld->stepSimulation(dt,10);
+	if (m_FixedTimeStep <= 0.0f)
+	{
+		ClearMovedBodies();
+		m_DynamicsWorld->stepSimulation(dt,10);
+		return;
+	}
+
+	// Run whole fixed steps only, so the simulation is reproducible regardless of frame rate. Time beyond the substep
+	// budget is dropped rather than carried over, so a slow frame can't make the following frames slower still.
+	m_Accumulator += dt;
+
+	uint32_t stepCount = static_cast< uint32_t >( m_Accumulator / m_FixedTimeStep );
+	if (stepCount > m_MaxSubSteps)
+	{
+		stepCount = m_MaxSubSteps;
+		m_Accumulator = m_FixedTimeStep * static_cast< float >( stepCount );
+	}
+
+	if (stepCount)
+	{
+		ClearMovedBodies();
+	}
+
+	for (uint32_t i = 0; i < stepCount; ++i)
+	{
+		// No substeps, so bullet takes exactly one step of the given length and doesn't interpolate on its own
+		m_DynamicsWorld->stepSimulation(m_FixedTimeStep, 0, m_FixedTimeStep);
+		m_Accumulator -= m_FixedTimeStep;
+	}
+
+	m_Accumulator = Max( m_Accumulator, 0.0f );
+	m_InterpolationAlpha = m_InterpolateTransforms ? Min( m_Accumulator / m_FixedTimeStep, 1.0f ) : 1.0f;
+}
+
+void BulletWorld::ClearMovedBodies()
+{
+	// A body that stops moving (usually because it fell asleep) was last synced somewhere between its previous and
+	// current transforms. Keep it listed for one more sync with the interpolation range collapsed onto its current
+	// transform so it comes to rest where bullet left it, then drop it the next time around. Bodies that do move
+	// again simply overwrite the previous transform in setWorldTransform.
+	size_t keptCount = 0;
+	for (size_t i = 0; i < m_MovedBodies.GetSize(); ++i)
+	{
+		btRigidBody *pBody = m_MovedBodies[i];
+		BulletMotionState *pMotionState = static_cast<BulletMotionState *>( pBody->getMotionState() );
+
+		if (pMotionState->m_bStepped)
+		{
+			pMotionState->m_bStepped = false;
+			pMotionState->m_PreviousTransform = pMotionState->m_Transform;
+			m_MovedBodies[keptCount++] = pBody;
+		}
+		else
+		{
+			pMotionState->m_bMoved = false;
+		}
+	}
+
+	m_MovedBodies.Resize( keptCount );
+}
+
+void BulletWorld::RemoveMovedBody( btRigidBody *pBody )
+{
+	for (size_t i = 0; i < m_MovedBodies.GetSize(); ++i)
+	{
+		if (m_MovedBodies[i] == pBody)
+		{
+			m_MovedBodies.RemoveSwap(i);
+			return;
+		}
+	}
 }
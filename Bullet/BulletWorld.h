@@ -3,6 +3,7 @@
 
 #include "Bullet/Bullet.h"
 #include "Math/Vector3.h"
+#include "Foundation/DynamicArray.h"
 
 class btDefaultCollisionConfiguration;
 class btCollisionDispatcher;
@@ -11,6 +12,7 @@ class btSequentialImpulseConstraintSolver;
 class btDiscreteDynamicsWorld;
 class btCollisionShape;
 class btDynamicsWorld;
+class btRigidBody;
 
 template <class T>
 class btAlignedObjectArray;
@@ -22,6 +24,7 @@ namespace Helium
     class HELIUM_BULLET_API BulletWorld
     {
     public:
+        BulletWorld();
         ~BulletWorld();
         
         void Initialize(const BulletWorldDefinition &rWorldDefinition);
@@ -30,12 +33,38 @@ namespace Helium
 
         void Simulate(float dt);
 
+        // Bodies that bullet moved during the most recent call to Simulate that ran a step, plus bodies that stopped
+        // moving at that step and need one last sync at their resting transform. Kinematic bodies are never added.
+        const DynamicArray< btRigidBody * > &GetMovedBodies() const { return m_MovedBodies; }
+        void AddMovedBody( btRigidBody *pBody ) { m_MovedBodies.Push( pBody ); }
+        void RemoveMovedBody( btRigidBody *pBody );
+
+        // Weight of the current step's transforms against the previous step's, 1 unless interpolating fixed steps
+        float GetInterpolationAlpha() const { return m_InterpolationAlpha; }
+
+        // Whether this world may be stepped in a job at the same time as other worlds
+        bool GetStepConcurrently() const { return m_StepConcurrently; }
+
     private:
+        void ClearMovedBodies();
+
         btDefaultCollisionConfiguration *m_CollisionConfiguration;
 	    btCollisionDispatcher* m_Dispatcher;
 	    btBroadphaseInterface* m_OverlappingPairCache;
 	    btSequentialImpulseConstraintSolver* m_Solver;
         btDynamicsWorld * m_DynamicsWorld;
+
+        DynamicArray< btRigidBody * > m_MovedBodies;
+
+        // Fixed step settings, a zero time step lets bullet step with the frame time as before
+        float m_FixedTimeStep;
+        uint32_t m_MaxSubSteps;
+        bool m_InterpolateTransforms;
+        bool m_StepConcurrently;
+
+        // Simulation time not yet consumed by a fixed step
+        float m_Accumulator;
+        float m_InterpolationAlpha;
     };
     typedef Helium::StrongPtr< BulletWorld > BulletWorldPtr;
 }
@@ -4,6 +4,8 @@
 #include "Framework/WorldManager.h"
 #include "Framework/ComponentQuery.h"
 #include "Bullet/HasPhysicalContacts.h"
+#include "Bullet/BulletBodyComponent.h"
+#include "Engine/ParallelFor.h"
 
 using namespace Helium;
 
@@ -46,109 +48,106 @@ void Helium::BulletWorldComponent::Simulate( float dt )
 	m_World->Simulate(dt);
 }
 
+void Helium::BulletWorldComponent::AddKinematicBody( BulletBodyComponent *pBody )
+{
+	HELIUM_ASSERT( IsInvalid( pBody->m_KinematicBodyIndex ) );
+	pBody->m_KinematicBodyIndex = m_KinematicBodies.GetSize();
+	m_KinematicBodies.Push( pBody );
+}
+
+void Helium::BulletWorldComponent::RemoveKinematicBody( BulletBodyComponent *pBody )
+{
+	size_t index = pBody->m_KinematicBodyIndex;
+	HELIUM_ASSERT( index < m_KinematicBodies.GetSize() && m_KinematicBodies[ index ] == pBody );
+
+	m_KinematicBodies.RemoveSwap( index );
+	if ( index < m_KinematicBodies.GetSize() )
+	{
+		m_KinematicBodies[ index ]->m_KinematicBodyIndex = index;
+	}
+
+	SetInvalid( pBody->m_KinematicBodyIndex );
+}
+
 //////////////////////////////////////////////////////////////////////////
 
-void DoProcessPhysics( BulletWorldComponent *pComponent )
+// The frame's worlds and step length, handed to ParallelFor
+struct StepWorldsRange
 {
-	ComponentManager *pComponentManager = pComponent->GetComponentManager();
-	HELIUM_ASSERT( pComponentManager );
+	WorldPtr *pWorlds;
+	float dt;
+};
 
-	// For each HasPhysicalContactsComponent
-	for (ComponentIteratorT<HasPhysicalContactsComponent> iter( *pComponentManager ); iter.GetBaseComponent(); iter.Advance())
+// Step the bullet worlds that allow concurrent stepping, one Helium world per slice item. Bullet worlds share no
+// bullet state (each has its own configuration, dispatcher and solvers) and contacts are only recorded into the
+// world's own tracker, so a bullet world can step on any thread.
+static void StepConcurrentWorlds( void *pUserData, size_t begin, size_t end )
+{
+	const StepWorldsRange *pRange = static_cast< const StepWorldsRange * >( pUserData );
+
+	for ( size_t i = begin; i < end; ++i )
 	{
-		iter->m_BeginFrameTouching.Clear();
-		for (Set<EntityWPtr>::Iterator wptr_iter = iter->m_EndFrameTouching.Begin(); wptr_iter != iter->m_EndFrameTouching.End(); ++wptr_iter)
+		ComponentManager *pComponentManager = pRange->pWorlds[i]->GetComponentManager();
+		HELIUM_ASSERT( pComponentManager );
+
+		for ( ImplementingComponentIterator< BulletWorldComponent > componentIter( *pComponentManager ); componentIter.GetBaseComponent(); componentIter.Advance() )
 		{
-			Entity *pEntity = *wptr_iter;
-			if (pEntity)
+			BulletWorldComponent *pComponent = *componentIter;
+			if ( pComponent->GetBulletWorld()->GetStepConcurrently() )
 			{
-				iter->m_BeginFrameTouching.Insert(pEntity);
+				pComponent->Simulate( pRange->dt );
 			}
 		}
-		iter->m_EverTouchedThisFrame = iter->m_BeginFrameTouching;
-		iter->m_EndFrameTouching.Clear();
 	}
+}
 
-	pComponent->Simulate(WorldManager::GetStaticInstance().GetFrameDeltaSeconds());
+// Worlds are independent of each other, so all worlds that allow it are stepped at once rather than one after another.
+// Each world's components are found through its own component manager, so nothing is kept between frames.
+void DoProcessPhysics( DynamicArray< WorldPtr > &rWorlds )
+{
+	float dt = WorldManager::GetStaticInstance().GetFrameDeltaSeconds();
 
-	for (ComponentIteratorT<HasPhysicalContactsComponent> iter( *pComponentManager ); iter.GetBaseComponent(); iter.Advance())
+	// Contacts are tracked for the whole frame rather than per subtick
+	//   RATIONALE: Bouncing is important and must not get lost. Untouching a retouching during a frame is generally
+	//   something we don't care about since it would never get rendered. We want BeginTouch, EndTouch, and Touching
+	//   queries.
+	for ( DynamicArray< WorldPtr >::Iterator iter = rWorlds.Begin(); iter != rWorlds.End(); ++iter )
 	{
-		// We care about
-		// - BeginTouch = m_EverTouchedThisFrame - m_BeginFrameTouching
-		// - EndTouch = m_EverTouchedThisFrame - m_SubtickTouching
-		// - IsTouching = m_SubtickTouching
-		// - Were we still touching it at end of physics tick? We have what is touching in last subtick in m_SubtickTouching, combine with m_EverTouchedThisFrame to populate m_EndTouch
-		//   RATIONALE: Bouncing is important and must not get lost. Untouching a retouching during a frame is generally
-		//   something we don't care about since it would never get rendered. We want BeginTouch, EndTouch, and Touching
-		//   queries.
-		HasPhysicalContactsComponent *pHasPhysicalContacts = *iter;
-
-		pHasPhysicalContacts->m_BeginTouch.Clear();
-		pHasPhysicalContacts->m_EndTouch.Clear();
-
-		if (pHasPhysicalContacts->m_EverTouchedThisFrame.IsEmpty())
-		{
-			// These have to be cleared since we're using deferred delete
-			HELIUM_ASSERT( pHasPhysicalContacts->m_BeginFrameTouching.IsEmpty() );
-			HELIUM_ASSERT( pHasPhysicalContacts->m_EndFrameTouching.IsEmpty() );
-			HELIUM_ASSERT( pHasPhysicalContacts->m_BeginTouch.IsEmpty() );
-			HELIUM_ASSERT( pHasPhysicalContacts->m_EndTouch.IsEmpty() );
-			HELIUM_ASSERT( pHasPhysicalContacts->m_EverTouchedThisFrame.IsEmpty() );
-			pHasPhysicalContacts->FreeComponentDeferred();
-			continue;
-		}
+		ComponentManager *pComponentManager = ( *iter )->GetComponentManager();
+		HELIUM_ASSERT( pComponentManager );
 
-		// TODO: I think there may be an O(n) way to do this if both sets are sorted
-		for (Set<EntityWPtr>::Iterator ever_touched = pHasPhysicalContacts->m_EverTouchedThisFrame.Begin(); ever_touched != pHasPhysicalContacts->m_EverTouchedThisFrame.End(); ++ever_touched)
+		for ( ImplementingComponentIterator< BulletWorldComponent > componentIter( *pComponentManager ); componentIter.GetBaseComponent(); componentIter.Advance() )
 		{
-			// For everything that touches in any subtick
-			bool found = false;
+			BulletWorldComponent *pComponent = *componentIter;
+			pComponent->GetContactTracker().BeginFrame();
 
-			for (Set<EntityWPtr>::Iterator touching = pHasPhysicalContacts->m_BeginFrameTouching.Begin(); touching != pHasPhysicalContacts->m_BeginFrameTouching.End(); ++touching)
+			if ( !pComponent->GetBulletWorld()->GetStepConcurrently() )
 			{
-				// See if it was touching when we started
-				if (*touching == *ever_touched)
-				{
-					found = true;
-					break;
-				}
-			}
-
-			if (!found)
-			{
-				//HELIUM_TRACE(TraceLevels::Debug, "BeginTouch %x -> %x\n", pHasPhysicalContacts->GetOwner(), *ever_touched);
-				// It's in ever touched, and not in touching, so we must have them untouching
-				pHasPhysicalContacts->m_BeginTouch.Push(*ever_touched);
+				pComponent->Simulate( dt );
 			}
 		}
+	}
 
-		// TODO: I think there may be an O(n) way to do this if both sets are sorted
-		for (Set<EntityWPtr>::Iterator ever_touched = pHasPhysicalContacts->m_EverTouchedThisFrame.Begin(); ever_touched != pHasPhysicalContacts->m_EverTouchedThisFrame.End(); ++ever_touched)
-		{
-			// For everything that touches in any subtick
-			bool found = false;
+	// One Helium world per job
+	StepWorldsRange range;
+	range.pWorlds = rWorlds.GetData();
+	range.dt = dt;
+	ParallelFor( StepConcurrentWorlds, &range, rWorlds.GetSize(), 1 );
 
-			for (Set<EntityWPtr>::Iterator touching = pHasPhysicalContacts->m_EndFrameTouching.Begin(); touching != pHasPhysicalContacts->m_EndFrameTouching.End(); ++touching)
-			{
-				// See if it was still touching at end of last subtick
-				if (*touching == *ever_touched)
-				{
-					found = true;
-					break;
-				}
-			}
+	// Contacts are handed to the components on this thread once every world has stepped
+	for ( DynamicArray< WorldPtr >::Iterator iter = rWorlds.Begin(); iter != rWorlds.End(); ++iter )
+	{
+		ComponentManager *pComponentManager = ( *iter )->GetComponentManager();
+		HELIUM_ASSERT( pComponentManager );
 
-			if (!found)
-			{
-				//HELIUM_TRACE(TraceLevels::Debug, "EndTouch %x -> %x\n", pHasPhysicalContacts->GetOwner(), *ever_touched);
-				// It's in ever touched, and not in touching, so we must have them untouching
-				pHasPhysicalContacts->m_EndTouch.Push(*ever_touched);
-			}
+		for ( ImplementingComponentIterator< BulletWorldComponent > componentIter( *pComponentManager ); componentIter.GetBaseComponent(); componentIter.Advance() )
+		{
+			componentIter->GetContactTracker().EndFrame( *pComponentManager );
 		}
 	}
 };
 
-HELIUM_DEFINE_TASK( ProcessPhysics, (ForEachWorld< QueryComponents< BulletWorldComponent, DoProcessPhysics > >) )
+HELIUM_DEFINE_TASK( ProcessPhysics, DoProcessPhysics )
 
 void ProcessPhysics::DefineContract( Helium::TaskContract &rContract )
 {
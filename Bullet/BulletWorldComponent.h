@@ -3,6 +3,7 @@
 
 #include "Bullet/Bullet.h"
 #include "Bullet/BulletWorld.h"
+#include "Bullet/BulletContactTracker.h"
 #include "Bullet/BulletWorldDefinition.h"
 #include "Framework/ComponentDefinition.h"
 #include "Framework/TaskScheduler.h"
@@ -10,6 +11,7 @@
 namespace Helium
 {
 	class BulletWorldComponentDefinition;
+	class BulletBodyComponent;
 
 	class HELIUM_BULLET_API BulletWorldComponent : public Component
 	{
@@ -25,12 +27,22 @@ namespace Helium
 		void Simulate(float dt);
 
 		BulletWorld *GetBulletWorld() { return m_World; }
+		BulletContactTracker &GetContactTracker() { return m_ContactTracker; }
+
+		// Kinematic bodies are driven by their transform components, so they are kept in their own list to avoid
+		// visiting every body in the world before each step
+		const DynamicArray< BulletBodyComponent * > &GetKinematicBodies() const { return m_KinematicBodies; }
+		void AddKinematicBody( BulletBodyComponent *pBody );
+		void RemoveKinematicBody( BulletBodyComponent *pBody );
 
 	private:
 		
 		// I would love to use an auto_ptr here but microsoft's compiler breaks when I try to do that. 
 		// http://www.youtube.com/watch?v=1ytCEuuW2_A
 		BulletWorld *m_World;
+
+		BulletContactTracker m_ContactTracker;
+		DynamicArray< BulletBodyComponent * > m_KinematicBodies;
 	};
 
 	class HELIUM_BULLET_API BulletWorldComponentDefinition : public Helium::ComponentDefinitionHelper<BulletWorldComponent, BulletWorldComponentDefinition>
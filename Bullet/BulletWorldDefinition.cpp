@@ -9,4 +9,19 @@ HELIUM_IMPLEMENT_ASSET(Helium::BulletWorldDefinition, Bullet, 0);
 void BulletWorldDefinition::PopulateMetaType( Reflect::MetaStruct& comp )
 {
     comp.AddField(&BulletWorldDefinition::m_Gravity, TXT( "m_Gravity" ) );
+    comp.AddField(&BulletWorldDefinition::m_FixedTimeStep, TXT( "m_FixedTimeStep" ) );
+    comp.AddField(&BulletWorldDefinition::m_MaxSubSteps, TXT( "m_MaxSubSteps" ) );
+    comp.AddField(&BulletWorldDefinition::m_InterpolateTransforms, TXT( "m_InterpolateTransforms" ) );
+    comp.AddField(&BulletWorldDefinition::m_SolverPoolSize, TXT( "m_SolverPoolSize" ) );
+    comp.AddField(&BulletWorldDefinition::m_StepConcurrently, TXT( "m_StepConcurrently" ) );
+}
+
+BulletWorldDefinition::BulletWorldDefinition()
+    : m_FixedTimeStep(1.0f / 60.0f)
+    , m_MaxSubSteps(4)
+    , m_InterpolateTransforms(true)
+    , m_SolverPoolSize(1)
+    , m_StepConcurrently(true)
+{
+
 }
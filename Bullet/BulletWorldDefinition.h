@@ -14,7 +14,22 @@ namespace Helium
         HELIUM_DECLARE_ASSET(Helium::BulletWorldDefinition, Helium::Asset);
         static void PopulateMetaType( Reflect::MetaStruct& comp );
 
+        BulletWorldDefinition();
+
         Helium::Simd::Vector3 m_Gravity;
+
+        // Length of each simulation step in seconds. Zero steps with the frame time, letting bullet subdivide it.
+        float m_FixedTimeStep;
+        // Maximum number of fixed steps to run in one frame, time beyond this is dropped
+        uint32_t m_MaxSubSteps;
+        // Interpolate between the last two fixed steps when syncing body transforms
+        bool m_InterpolateTransforms;
+
+        // Number of constraint solvers used to solve simulation islands in parallel. One solves every island on the
+        // thread stepping the world.
+        uint32_t m_SolverPoolSize;
+        // Step this world in a job alongside other worlds instead of on the task thread
+        bool m_StepConcurrently;
     };
     typedef Helium::StrongPtr<BulletWorldDefinition> BulletWorldDefinitionPtr;
 }
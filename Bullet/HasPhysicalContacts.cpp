@@ -13,12 +13,3 @@ void Helium::HasPhysicalContactsComponent::PopulateMetaType( Reflect::MetaStruct
 {
 
 }
-
-Helium::HasPhysicalContactsComponent::~HasPhysicalContactsComponent()
-{
-	m_BeginTouch.Clear();
-	m_EndFrameTouching.Clear();
-	m_EndTouch.Clear();
-	m_BeginFrameTouching.Clear();
-	m_EverTouchedThisFrame.Clear();
-}
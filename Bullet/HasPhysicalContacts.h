@@ -3,6 +3,7 @@
 
 #include "Framework/ComponentDefinition.h"
 #include "Framework/TaskScheduler.h"
+#include "Bullet/BulletContactTracker.h"
 
 namespace Helium
 {
@@ -19,17 +20,27 @@ namespace Helium
 		HELIUM_DECLARE_COMPONENT( Helium::HasPhysicalContactsComponent, Helium::Component );
 		static void PopulateMetaType( Reflect::MetaStruct& comp );
 
-		~HasPhysicalContactsComponent();
+		HasPhysicalContactsComponent()
+			: m_pContacts(NULL)
+			, m_ContactCount(0)
+		{
 
-		// TODO: There's a lot of dynamic allocation here.. maybe there's a clever way we could just have a wad of Entity* or some shorter
-		// handle used as a ringbuffer? BeginFrameTouching, then intermediate ticks, then EndFrameTouching? EndFrameTouching would be 
-		// BeginFrameTouching on next frame.
-		DynamicArray<EntityWPtr> m_BeginTouch;
-		DynamicArray<EntityWPtr> m_EndTouch;
+		}
 
-		// Assuming that using fields, these will be small lists
-		Set<EntityWPtr> m_BeginFrameTouching;
-		Set<EntityWPtr> m_EndFrameTouching;
-		Set<EntityWPtr> m_EverTouchedThisFrame;
+		// Every body this one touched at any point this frame. Check the flags on each contact to tell begin touch, end
+		// touch, and still touching apart. Only valid until the next physics update.
+		const PhysicalContact *GetContacts() const { return m_pContacts; }
+		size_t GetContactCount() const { return m_ContactCount; }
+
+		void SetContacts( const PhysicalContact *pContacts, size_t contactCount )
+		{
+			m_pContacts = pContacts;
+			m_ContactCount = contactCount;
+		}
+
+	private:
+		// Range of the world's BulletContactTracker list that belongs to this body
+		const PhysicalContact *m_pContacts;
+		size_t m_ContactCount;
 	};
 }
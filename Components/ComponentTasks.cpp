@@ -8,6 +8,7 @@
 
 #include "Foundation/DynamicArray.h"
 #include "Components/TransformComponent.h"
+#include "Components/TransformHierarchy.h"
 #include "Components/MeshComponent.h"
 #include "Components/RotateComponent.h"
 #include "Graphics/GraphicsManagerComponent.h"
@@ -15,20 +16,27 @@
 using namespace Helium;
 
 //////////////////////////////////////////////////////////////////////////
-//
-//void ClearTransformComponentDirtyFlags( World *pWorld )
-//{
-//    Components::ComponentListT<TransformComponent> list = pWorld->GetComponentManager()->GetAllocatedComponents<TransformComponent>();
-// 
-//    for (int i = 0; i < list.m_Count; ++i)
-//    {
-//        list.m_pComponents[i]->ClearDirtyFlag();
-//    }
-//}
-
-void ClearTransformComponentDirtyFlags( TransformComponent *pWorld )
+
+// World transforms are propagated once per frame, after gameplay and physics have moved things and before anything
+// reads them for rendering
+void UpdateTransformHierarchy( TransformHierarchyComponent *pHierarchyComponent )
+{
+	pHierarchyComponent->GetHierarchy().Update();
+}
+
+void Helium::UpdateTransformHierarchyTask::DefineContract( TaskContract &rContract )
+{
+	rContract.ExecuteAfter<StandardDependencies::ProcessPhysics>();
+	rContract.ExecuteBefore<StandardDependencies::Render>();
+}
+
+HELIUM_DEFINE_TASK( UpdateTransformHierarchyTask, (ForEachWorld< QueryComponents< TransformHierarchyComponent, UpdateTransformHierarchy > >) )
+
+//////////////////////////////////////////////////////////////////////////
+
+void ClearTransformComponentDirtyFlags( TransformHierarchyComponent *pHierarchyComponent )
 {
-	pWorld->ClearDirtyFlag();
+	pHierarchyComponent->GetHierarchy().ClearDirtyFlags();
 }
 
 void Helium::ClearTransformComponentDirtyFlagsTask::DefineContract( TaskContract &rContract )
@@ -36,8 +44,7 @@ void Helium::ClearTransformComponentDirtyFlagsTask::DefineContract( TaskContract
 	rContract.ExecuteAfter<StandardDependencies::Render>();
 }
 
-//HELIUM_DEFINE_TASK(ClearTransformComponentDirtyFlagsTask, ForEachWorld<ClearTransformComponentDirtyFlags> )
-HELIUM_DEFINE_TASK( ClearTransformComponentDirtyFlagsTask, (ForEachWorld< QueryComponents< TransformComponent, ClearTransformComponentDirtyFlags > >) )
+HELIUM_DEFINE_TASK( ClearTransformComponentDirtyFlagsTask, (ForEachWorld< QueryComponents< TransformHierarchyComponent, ClearTransformComponentDirtyFlags > >) )
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -56,28 +63,47 @@ HELIUM_DEFINE_TASK( UpdateRotatorComponentsTask, (ForEachWorld< QueryComponents<
 
 //////////////////////////////////////////////////////////////////////////
 
-static GraphicsScene *pGraphicsScene = NULL;
-
-void UpdateMeshComponent(TransformComponent *pTransform, MeshComponent *pMeshComponent)
-{
-	pMeshComponent->Update( pGraphicsScene, pTransform );
-}
-
+// Only transforms whose world matrix changed this frame are visited, so the cost follows what moved rather than how
+// many meshes exist
 void UpdateMeshComponents( World *pWorld )
 {
 	GraphicsManagerComponent *pGraphicsManager = pWorld->GetComponents().GetFirst<GraphicsManagerComponent>();
 	HELIUM_ASSERT( pGraphicsManager );
 
-	pGraphicsScene = pGraphicsManager->GetGraphicsScene();
+	GraphicsScene *pGraphicsScene = pGraphicsManager->GetGraphicsScene();
 	HELIUM_ASSERT( pGraphicsScene );
 
-	QueryComponents< TransformComponent, MeshComponent, UpdateMeshComponent >( pWorld );
+	TransformHierarchyComponent *pHierarchyComponent = pWorld->GetComponents().GetFirst<TransformHierarchyComponent>();
+	if ( !pHierarchyComponent )
+	{
+		return;
+	}
+
+	const TransformHierarchy &rHierarchy = pHierarchyComponent->GetHierarchy();
+	const DynamicArray< TransformHierarchy::NodeId > &rChangedNodes = rHierarchy.GetChangedNodes();
+
+	for ( size_t i = 0; i < rChangedNodes.GetSize(); ++i )
+	{
+		// Nodes freed since they changed have no owner
+		TransformComponent *pTransform = rHierarchy.GetOwner( rChangedNodes[i] );
+		if ( !pTransform )
+		{
+			continue;
+		}
+
+		for ( MeshComponent *pMesh = pTransform->GetComponentCollection()->GetFirst<MeshComponent>(); pMesh; pMesh = pMesh->GetNextComponent() )
+		{
+			pMesh->Update( pGraphicsScene, pTransform );
+		}
+	}
 }
 
 void Helium::UpdateMeshComponentsTask::DefineContract( TaskContract &rContract )
 {
+	rContract.RequiresGraphics();
 	rContract.ExecuteBefore<StandardDependencies::Render>();
 	rContract.ExecuteAfter<StandardDependencies::ProcessPhysics>();
+	rContract.ExecuteAfter<UpdateTransformHierarchyTask>();
 }
 
 HELIUM_DEFINE_TASK( UpdateMeshComponentsTask, (ForEachWorld< UpdateMeshComponents >) );
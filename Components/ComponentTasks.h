@@ -6,6 +6,12 @@
 
 namespace Helium
 {
+    struct HELIUM_COMPONENTS_API UpdateTransformHierarchyTask : public TaskDefinition
+    {
+        HELIUM_DECLARE_TASK(UpdateTransformHierarchyTask)
+        virtual void DefineContract(TaskContract &rContract);
+    };
+
     struct HELIUM_COMPONENTS_API ClearTransformComponentDirtyFlagsTask : public TaskDefinition
     {
         HELIUM_DECLARE_TASK(ClearTransformComponentDirtyFlagsTask)
@@ -54,6 +54,7 @@ void MeshComponentDefinition::PopulateMetaType( Reflect::MetaStruct& comp )
 /// Constructor.
 MeshComponent::MeshComponent()
 : m_graphicsSceneObjectId( Invalid< size_t >() )
+, m_NeedsReattach( false )
 {
 }
 
@@ -139,6 +140,21 @@ void MeshComponent::SetMesh( Mesh* pMesh )
 	}
 }
 
+/// Reattach to the graphics scene on the next mesh update.
+///
+/// Meshes are only updated when their transform changes, so the transform is marked dirty to make sure the update
+/// happens.
+void MeshComponent::DeferredReattach()
+{
+	m_NeedsReattach = true;
+
+	TransformComponent *pTransform = GetComponentCollection()->GetFirst<TransformComponent>();
+	if ( pTransform )
+	{
+		pTransform->MarkDirty();
+	}
+}
+
 /// Flag the graphics scene object as requiring an update if one exists.
 ///
 /// This is safe to call by an entity during its pre-update.  It should only ever be called by the entity itself.
@@ -179,16 +195,15 @@ void MeshComponent::GraphicsSceneObjectUpdate(
 	HELIUM_ASSERT( pScene );
 	HELIUM_ASSERT( pSceneObject );
 	
-	const Simd::Vector3& rPosition = pTransform->GetPosition();
-	Simd::Matrix44 transform(
-		Simd::Matrix44::INIT_ROTATION_TRANSLATION,
-		pTransform->GetRotation(),
-		rPosition);
+	// World transforms are composed once per frame by the transform hierarchy
+	const Simd::Matrix44& transform = pTransform->GetWorldTransform();
 	pSceneObject->SetTransform( transform );
 
 	Mesh* pMesh = pThis->m_Mesh;
 
-	Simd::AaBox worldBounds( rPosition, rPosition );
+	Simd::Vector3 position;
+	transform.TransformPoint( position, Simd::Vector3::Zero );
+	Simd::AaBox worldBounds( position, position );
 
 	// Only thing remaining if this is a transform-only update is the world bounds, so update it and return.
 	if( pSceneObject->GetUpdateMode() == GraphicsSceneObject::UPDATE_TRANSFORM_ONLY )
@@ -224,7 +239,12 @@ void MeshComponent::GraphicsSceneObjectUpdate(
 	if( !pVertexBuffer || !pIndexBuffer )
 	{
 		pSceneObject->SetVertexData( NULL, NULL, 0 );
-		pSceneObject->SetIndexBuffer( NULL );
+		for( size_t lodIndex = 0; lodIndex < GraphicsSceneObject::LOD_COUNT_MAX; ++lodIndex )
+		{
+			pSceneObject->SetIndexBuffer( NULL, lodIndex );
+		}
+
+		pSceneObject->SetLodCount( 1 );
 	}
 	else
 	{
@@ -244,7 +264,21 @@ void MeshComponent::GraphicsSceneObjectUpdate(
 		}
 
 		pSceneObject->SetVertexData( pVertexBuffer, pVertexDescription, vertexStride );
-		pSceneObject->SetIndexBuffer( pIndexBuffer );
+
+		// Additional levels of detail share the vertex buffer and only swap index buffers.
+		size_t lodCount = pMesh->GetLodCount();
+		if( lodCount > GraphicsSceneObject::LOD_COUNT_MAX )
+		{
+			lodCount = GraphicsSceneObject::LOD_COUNT_MAX;
+		}
+
+		pSceneObject->SetLodCount( lodCount );
+		for( size_t lodIndex = 0; lodIndex < GraphicsSceneObject::LOD_COUNT_MAX; ++lodIndex )
+		{
+			bool bLodAvailable = ( lodIndex < lodCount );
+			pSceneObject->SetIndexBuffer( bLodAvailable ? pMesh->GetIndexBuffer( lodIndex ) : NULL, lodIndex );
+			pSceneObject->SetLodScreenSize( lodIndex, bLodAvailable ? pMesh->GetLodScreenSize( lodIndex ) : 0.0f );
+		}
 
 		meshSectionCount = pMesh->GetSectionCount();
 		if( meshSectionCount > subMeshCount )
@@ -253,7 +287,7 @@ void MeshComponent::GraphicsSceneObjectUpdate(
 		}
 
 		uint32_t sectionVertexOffset = 0;
-		uint32_t sectionIndexOffset = 0;
+		uint32_t sectionIndexOffsets[ GraphicsSceneObject::LOD_COUNT_MAX ] = { 0 };
 		for( size_t meshSectionIndex = 0; meshSectionIndex < meshSectionCount; ++meshSectionIndex )
 		{
 			GraphicsSceneObject::SubMeshData* pSubMeshData = pScene->GetSceneObjectSubMeshData(
@@ -261,17 +295,27 @@ void MeshComponent::GraphicsSceneObjectUpdate(
 			HELIUM_ASSERT( pSubMeshData );
 
 			uint32_t vertexCount = pMesh->GetSectionVertexCount( meshSectionIndex );
-			uint32_t triangleCount = pMesh->GetSectionTriangleCount( meshSectionIndex );
 
 			pSubMeshData->SetMaterial( pThis->GetMaterial( meshSectionIndex ) );
 			pSubMeshData->SetPrimitiveType( RENDERER_PRIMITIVE_TYPE_TRIANGLE_LIST );
-			pSubMeshData->SetPrimitiveCount( triangleCount );
 			pSubMeshData->SetStartVertex( sectionVertexOffset );
 			pSubMeshData->SetVertexRange( vertexCount );
-			pSubMeshData->SetStartIndex( sectionIndexOffset );
+
+			for( size_t lodIndex = 0; lodIndex < GraphicsSceneObject::LOD_COUNT_MAX; ++lodIndex )
+			{
+				uint32_t triangleCount = 0;
+				if( lodIndex < lodCount )
+				{
+					triangleCount = pMesh->GetSectionTriangleCount( meshSectionIndex, lodIndex );
+				}
+
+				pSubMeshData->SetPrimitiveCount( triangleCount, lodIndex );
+				pSubMeshData->SetStartIndex( sectionIndexOffsets[ lodIndex ], lodIndex );
+
+				sectionIndexOffsets[ lodIndex ] += triangleCount * 3;
+			}
 
 			sectionVertexOffset += vertexCount;
-			sectionIndexOffset += triangleCount * 3;
 		}
 	}
 
@@ -283,10 +327,13 @@ void MeshComponent::GraphicsSceneObjectUpdate(
 
 		pSubMeshData->SetMaterial( NULL );
 		pSubMeshData->SetPrimitiveType( RENDERER_PRIMITIVE_TYPE_TRIANGLE_LIST );
-		pSubMeshData->SetPrimitiveCount( 0 );
 		pSubMeshData->SetStartVertex( 0 );
 		pSubMeshData->SetVertexRange( 0 );
-		pSubMeshData->SetStartIndex( 0 );
+		for( size_t lodIndex = 0; lodIndex < GraphicsSceneObject::LOD_COUNT_MAX; ++lodIndex )
+		{
+			pSubMeshData->SetPrimitiveCount( 0, lodIndex );
+			pSubMeshData->SetStartIndex( 0, lodIndex );
+		}
 	}
 }
 
@@ -296,6 +343,7 @@ void Helium::MeshComponent::Update( GraphicsScene *pGraphicsScene, TransformComp
 	{
 		Detach(pGraphicsScene);
 		Attach(pGraphicsScene, pTransform);
+		m_NeedsReattach = false;
 	}
 
 	if (pTransform->IsDirty())
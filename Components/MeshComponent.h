@@ -86,7 +86,7 @@ namespace Helium
 			GraphicsSceneObject::EUpdate updateMode = GraphicsSceneObject::UPDATE_FULL );
 		//@}
 
-		void DeferredReattach() { m_NeedsReattach = true; }
+		void DeferredReattach();
 	};
 	typedef Helium::ComponentPtr<MeshComponent> MeshComponentPtr;
 	
@@ -9,11 +9,58 @@ void Helium::TransformComponent::PopulateMetaType( Reflect::MetaStruct& comp )
 
 }
 
+Helium::TransformComponent::TransformComponent()
+{
+	// GetOrCreate() may allocate the hierarchy component from inside this constructor. That relies on
+	// Components::Pool::Allocate() inserting us into the owner's collection and setting our owner before it runs the
+	// constructor, so GetWorld() already works here and allocating from another type's pool is safe.
+	HELIUM_ASSERT_MSG( GetWorld(), TXT( "TransformComponent must be allocated on a host that belongs to a world" ) );
+
+	TransformHierarchyComponent *pHierarchyComponent = TransformHierarchyComponent::GetOrCreate( GetWorld() );
+	m_HierarchyComponent = pHierarchyComponent;
+	m_pHierarchy = &pHierarchyComponent->GetHierarchy();
+	m_Node = m_pHierarchy->AllocateNode( this );
+}
+
+Helium::TransformComponent::~TransformComponent()
+{
+	// The hierarchy may already be gone if the world is being torn down
+	if ( m_HierarchyComponent.IsGood() )
+	{
+		m_pHierarchy->FreeNode( m_Node );
+	}
+}
+
 void Helium::TransformComponent::Initialize( const TransformComponentDefinition &definition )
 {
-	m_Position = definition.m_Position;
-	m_Rotation = definition.m_Rotation;
-	m_bDirty = true;
+	m_pHierarchy->SetLocalPosition( m_Node, definition.m_Position );
+	m_pHierarchy->SetLocalRotation( m_Node, definition.m_Rotation );
+	m_pHierarchy->SetLocalScale( m_Node, definition.m_Scale );
+}
+
+void Helium::TransformComponent::SetPosition( const Simd::Vector3& rPosition )
+{
+	m_pHierarchy->SetLocalPosition( m_Node, rPosition );
+}
+
+void Helium::TransformComponent::SetRotation( const Simd::Quat& rRotation )
+{
+	m_pHierarchy->SetLocalRotation( m_Node, rRotation );
+}
+
+void Helium::TransformComponent::SetScale( const Simd::Vector3& rScale )
+{
+	m_pHierarchy->SetLocalScale( m_Node, rScale );
+}
+
+void Helium::TransformComponent::SetParent( TransformComponent *pParent )
+{
+	HELIUM_ASSERT( !pParent || pParent->m_pHierarchy == m_pHierarchy );
+
+	if ( m_pHierarchy->SetParent( m_Node, pParent ? pParent->m_Node : Invalid< TransformHierarchy::NodeId >() ) )
+	{
+		m_Parent = pParent;
+	}
 }
 
 HELIUM_IMPLEMENT_ASSET(Helium::TransformComponentDefinition, Components, 0);
@@ -21,6 +68,7 @@ HELIUM_IMPLEMENT_ASSET(Helium::TransformComponentDefinition, Components, 0);
 Helium::TransformComponentDefinition::TransformComponentDefinition()
 : m_Position( 0.0f )
 , m_Rotation( Simd::Quat::IDENTITY )
+, m_Scale( Simd::Vector3::Unit )
 {
 
 }
@@ -29,4 +77,5 @@ void Helium::TransformComponentDefinition::PopulateMetaType( Reflect::MetaStruct
 {
 	comp.AddField(&TransformComponentDefinition::m_Position, "m_Position");
 	comp.AddField(&TransformComponentDefinition::m_Rotation, "m_Rotation");
+	comp.AddField(&TransformComponentDefinition::m_Scale, "m_Scale");
 }
@@ -6,6 +6,7 @@
 #include "MathSimd/Quat.h"
 #include "MathSimd/Matrix44.h"
 #include "Framework/ComponentDefinition.h"
+#include "Components/TransformHierarchy.h"
 
 namespace Helium
 {
@@ -16,20 +17,41 @@ namespace Helium
 		HELIUM_DECLARE_COMPONENT( Helium::TransformComponent, Helium::Component );
 		static void PopulateMetaType( Reflect::MetaStruct& comp );
 
+		TransformComponent();
+		~TransformComponent();
+
 		void Initialize( const TransformComponentDefinition &definition);
-				
-		inline const Simd::Vector3& GetPosition() const { return m_Position; }
-		virtual void SetPosition( const Simd::Vector3& rPosition ) { m_Position = rPosition; m_bDirty = true; }
 
-		inline const Simd::Quat& GetRotation() const { return m_Rotation; }
-		virtual void SetRotation( const Simd::Quat& rRotation ) { m_Rotation = rRotation; m_bDirty = true; }
+		// Position, rotation, and scale are relative to the parent transform, or to the world if there is no parent
+		inline const Simd::Vector3& GetPosition() const;
+		virtual void SetPosition( const Simd::Vector3& rPosition );
 
-		bool IsDirty() const { return m_bDirty; }
-		void ClearDirtyFlag() { m_bDirty = false; }
+		inline const Simd::Quat& GetRotation() const;
+		virtual void SetRotation( const Simd::Quat& rRotation );
 
-		Simd::Vector3 m_Position;
-		Simd::Quat m_Rotation;
-		bool m_bDirty;
+		inline const Simd::Vector3& GetScale() const;
+		virtual void SetScale( const Simd::Vector3& rScale );
+
+		// The local transform is kept when attaching, so the world transform follows the new parent from the next
+		// update. Attaching to a descendant is rejected, leaving the current parent in place.
+		TransformComponent *GetParent() const { return m_Parent.Get(); }
+		void SetParent( TransformComponent *pParent );
+
+		// World transform as of the last UpdateTransformHierarchyTask
+		inline const Simd::Matrix44& GetWorldTransform() const;
+
+		// Dirty if the local transform changed or the world transform was recomputed (this includes a parent moving)
+		inline bool IsDirty() const;
+
+		// Queue the transform for the next hierarchy update, so anything that follows it (such as meshes) is refreshed
+		// even though the transform itself didn't move
+		inline void MarkDirty();
+
+	private:
+		TransformHierarchyComponentPtr m_HierarchyComponent;
+		TransformHierarchy *m_pHierarchy;
+		TransformHierarchy::NodeId m_Node;
+		Helium::ComponentPtr<TransformComponent> m_Parent;
 	};
 	typedef Helium::ComponentPtr<TransformComponent> TransformComponentPtr;
 		
@@ -46,8 +68,12 @@ namespace Helium
 		inline const Simd::Quat& GetRotation() const { return m_Rotation; }
 		virtual void SetRotation( const Simd::Quat& rRotation ) { m_Rotation = rRotation; }
 
+		inline const Simd::Vector3& GetScale() const { return m_Scale; }
+		virtual void SetScale( const Simd::Vector3& rScale ) { m_Scale = rScale; }
+
 		Simd::Vector3 m_Position;
 		Simd::Quat m_Rotation;
+		Simd::Vector3 m_Scale;
 	};
 	typedef StrongPtr<TransformComponentDefinition> TransformComponentDefinitionPtr;
 }
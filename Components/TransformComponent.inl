@@ -1,5 +1,32 @@
-
 namespace Helium
 {
+	const Simd::Vector3& TransformComponent::GetPosition() const
+	{
+		return m_pHierarchy->GetLocalPosition( m_Node );
+	}
+
+	const Simd::Quat& TransformComponent::GetRotation() const
+	{
+		return m_pHierarchy->GetLocalRotation( m_Node );
+	}
+
+	const Simd::Vector3& TransformComponent::GetScale() const
+	{
+		return m_pHierarchy->GetLocalScale( m_Node );
+	}
+
+	const Simd::Matrix44& TransformComponent::GetWorldTransform() const
+	{
+		return m_pHierarchy->GetWorldMatrix( m_Node );
+	}
+
+	bool TransformComponent::IsDirty() const
+	{
+		return m_pHierarchy->IsDirty( m_Node );
+	}
 
-}
\ No newline at end of file
+	void TransformComponent::MarkDirty()
+	{
+		m_pHierarchy->MarkDirty( m_Node );
+	}
+}
@@ -0,0 +1,432 @@
+#include "ComponentsPch.h"
+#include "Components/TransformHierarchy.h"
+
+#include "Framework/World.h"
+#include "Engine/ParallelFor.h"
+
+using namespace Helium;
+
+// Depth levels are split across jobs once they have at least this many nodes
+static const size_t TRANSFORM_PARALLEL_NODE_COUNT_MIN = 1024;
+
+// Maximum number of nodes to update in each job
+static const size_t TRANSFORM_JOB_NODE_COUNT_MAX = 256;
+
+// One depth level's nodes, handed to ParallelFor
+struct UpdateTransformsRange
+{
+	TransformHierarchy *pHierarchy;
+	const TransformHierarchy::NodeId *pNodes;
+};
+
+// Update a slice of one depth level
+static void UpdateTransforms( void *pUserData, size_t begin, size_t end )
+{
+	const UpdateTransformsRange *pRange = static_cast< const UpdateTransformsRange * >( pUserData );
+	pRange->pHierarchy->UpdateNodes( pRange->pNodes + begin, end - begin );
+}
+
+/// Constructor.
+TransformHierarchy::TransformHierarchy()
+: m_DirtyNodeCount( 0 )
+{
+}
+
+/// Destructor.
+TransformHierarchy::~TransformHierarchy()
+{
+}
+
+/// Allocate a root node with an identity transform.
+///
+/// @param[in] pOwner  Component that owns the node.
+///
+/// @return  Allocated node.
+///
+/// @see FreeNode()
+TransformHierarchy::NodeId TransformHierarchy::AllocateNode( TransformComponent* pOwner )
+{
+	NodeId node;
+	if( !m_FreeNodes.IsEmpty() )
+	{
+		node = m_FreeNodes.GetLast();
+		m_FreeNodes.Pop();
+
+		m_LocalPositions[ node ] = Simd::Vector3::Zero;
+		m_LocalRotations[ node ] = Simd::Quat::IDENTITY;
+		m_LocalScales[ node ] = Simd::Vector3::Unit;
+		m_WorldMatrices[ node ] = Simd::Matrix44::IDENTITY;
+		SetInvalid( m_Parents[ node ] );
+		SetInvalid( m_FirstChildren[ node ] );
+		SetInvalid( m_NextSiblings[ node ] );
+		m_Depths[ node ] = 0;
+		m_Owners[ node ] = pOwner;
+
+		// A node freed while still on the dirty or changed list keeps its place there
+		m_Flags[ node ] &= ( FLAG_LOCAL_DIRTY | FLAG_WORLD_CHANGED );
+	}
+	else
+	{
+		node = static_cast< NodeId >( m_Parents.GetSize() );
+
+		m_LocalPositions.Push( Simd::Vector3::Zero );
+		m_LocalRotations.Push( Simd::Quat::IDENTITY );
+		m_LocalScales.Push( Simd::Vector3::Unit );
+		m_WorldMatrices.Push( Simd::Matrix44::IDENTITY );
+		m_Parents.Push( Invalid< NodeId >() );
+		m_FirstChildren.Push( Invalid< NodeId >() );
+		m_NextSiblings.Push( Invalid< NodeId >() );
+		m_Depths.Push( 0 );
+		m_Owners.Push( pOwner );
+		m_Flags.Push( 0 );
+
+		m_DirtyNodes.Resize( m_Parents.GetSize() );
+	}
+
+	MarkDirty( node );
+
+	return node;
+}
+
+/// Release a node for reuse.
+///
+/// Children of the node become roots, keeping their local transforms.
+///
+/// @param[in] node  Node to free.
+///
+/// @see AllocateNode()
+void TransformHierarchy::FreeNode( NodeId node )
+{
+	HELIUM_ASSERT( node < m_Flags.GetSize() );
+	HELIUM_ASSERT( !( m_Flags[ node ] & FLAG_FREE ) );
+
+	while( IsValid( m_FirstChildren[ node ] ) )
+	{
+		SetParent( m_FirstChildren[ node ], Invalid< NodeId >() );
+	}
+
+	SetParent( node, Invalid< NodeId >() );
+
+	m_Owners[ node ] = NULL;
+	m_Flags[ node ] |= FLAG_FREE;
+	m_FreeNodes.Push( node );
+}
+
+/// Attach a node to a parent.
+///
+/// The node's local transform is kept, so its world transform changes to follow the new parent.  Attaching a node to
+/// itself or to one of its descendants would create a cycle, so such requests are rejected and leave the hierarchy
+/// unchanged.
+///
+/// @param[in] node    Node to attach.
+/// @param[in] parent  New parent, or an invalid index to make the node a root.
+///
+/// @return  True if the node now has the requested parent, false if the request was rejected.
+bool TransformHierarchy::SetParent( NodeId node, NodeId parent )
+{
+	HELIUM_ASSERT( node < m_Parents.GetSize() );
+
+	NodeId oldParent = m_Parents[ node ];
+	if( oldParent == parent )
+	{
+		return true;
+	}
+
+	if( IsValid( parent ) )
+	{
+		HELIUM_ASSERT( parent < m_Parents.GetSize() );
+		HELIUM_ASSERT( !( m_Flags[ parent ] & FLAG_FREE ) );
+
+		if( parent == node || IsAncestor( node, parent ) )
+		{
+			HELIUM_TRACE(
+				TraceLevels::Warning,
+				TXT( "TransformHierarchy: Cannot attach node %" ) PRIu32 TXT( " to %" ) PRIu32 TXT( ", as it would " )
+				TXT( "create a cycle.\n" ),
+				node,
+				parent );
+
+			return false;
+		}
+	}
+
+	if( IsValid( oldParent ) )
+	{
+		UnlinkChild( node, oldParent );
+	}
+
+	if( IsValid( parent ) )
+	{
+		LinkChild( node, parent );
+		SetSubtreeDepth( node, m_Depths[ parent ] + 1 );
+	}
+	else
+	{
+		SetInvalid( m_Parents[ node ] );
+		SetSubtreeDepth( node, 0 );
+	}
+
+	MarkDirty( node );
+
+	return true;
+}
+
+/// Get whether one node is an ancestor of another.
+///
+/// @param[in] ancestor  Possible ancestor.
+/// @param[in] node      Node whose parent chain to search.
+///
+/// @return  True if @c ancestor is a parent, grandparent, etc. of @c node.
+bool TransformHierarchy::IsAncestor( NodeId ancestor, NodeId node ) const
+{
+	for( NodeId parent = m_Parents[ node ]; IsValid( parent ); parent = m_Parents[ parent ] )
+	{
+		if( parent == ancestor )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/// Recompute the world matrices of all dirty nodes and their descendants.
+///
+/// Only the dirty nodes and their subtrees are visited, so the cost scales with what moved rather than with the size
+/// of the hierarchy.  This must not run while local transforms are being changed.
+void TransformHierarchy::Update()
+{
+	size_t dirtyCount = static_cast< size_t >( m_DirtyNodeCount );
+	if( dirtyCount == 0 )
+	{
+		return;
+	}
+
+	m_DirtyNodeCount = 0;
+
+	// Queue every dirty node along with its descendants, skipping subtrees that are already queued
+	m_QueuedNodes.Resize( 0 );
+	for( size_t dirtyIndex = 0; dirtyIndex < dirtyCount; ++dirtyIndex )
+	{
+		NodeId node = m_DirtyNodes[ dirtyIndex ];
+		uint8_t& rFlags = m_Flags[ node ];
+		rFlags &= ~FLAG_LOCAL_DIRTY;
+
+		if( !( rFlags & ( FLAG_FREE | FLAG_QUEUED ) ) )
+		{
+			QueueSubtree( node );
+		}
+	}
+
+	// Counting sort by depth, so each level can be updated as a block once the level above it is complete
+	uint32_t maxDepth = 0;
+	size_t queuedCount = m_QueuedNodes.GetSize();
+	for( size_t queuedIndex = 0; queuedIndex < queuedCount; ++queuedIndex )
+	{
+		maxDepth = Max( maxDepth, m_Depths[ m_QueuedNodes[ queuedIndex ] ] );
+	}
+
+	size_t levelCount = ( queuedCount != 0 ? maxDepth + 1 : 0 );
+	m_LevelStarts.Resize( 0 );
+	m_LevelStarts.Resize( levelCount + 1 );
+	MemoryZero( m_LevelStarts.GetData(), m_LevelStarts.GetSize() * sizeof( uint32_t ) );
+
+	for( size_t queuedIndex = 0; queuedIndex < queuedCount; ++queuedIndex )
+	{
+		++m_LevelStarts[ m_Depths[ m_QueuedNodes[ queuedIndex ] ] + 1 ];
+	}
+
+	for( size_t levelIndex = 1; levelIndex <= levelCount; ++levelIndex )
+	{
+		m_LevelStarts[ levelIndex ] += m_LevelStarts[ levelIndex - 1 ];
+	}
+
+	// Reuse the node stack as each level's write position
+	m_NodeStack.Resize( levelCount );
+	for( size_t levelIndex = 0; levelIndex < levelCount; ++levelIndex )
+	{
+		m_NodeStack[ levelIndex ] = m_LevelStarts[ levelIndex ];
+	}
+
+	m_SortedNodes.Resize( queuedCount );
+	for( size_t queuedIndex = 0; queuedIndex < queuedCount; ++queuedIndex )
+	{
+		NodeId node = m_QueuedNodes[ queuedIndex ];
+		m_SortedNodes[ m_NodeStack[ m_Depths[ node ] ]++ ] = node;
+	}
+
+	// Each level only reads the world matrices of the level above it, which is complete once the previous level's
+	// jobs have finished.
+	for( size_t levelIndex = 0; levelIndex < levelCount; ++levelIndex )
+	{
+		const NodeId* pNodes = m_SortedNodes.GetData() + m_LevelStarts[ levelIndex ];
+		size_t nodeCount = m_LevelStarts[ levelIndex + 1 ] - m_LevelStarts[ levelIndex ];
+
+		if( nodeCount >= TRANSFORM_PARALLEL_NODE_COUNT_MIN )
+		{
+			UpdateTransformsRange range;
+			range.pHierarchy = this;
+			range.pNodes = pNodes;
+			ParallelFor( UpdateTransforms, &range, nodeCount, TRANSFORM_JOB_NODE_COUNT_MAX );
+		}
+		else
+		{
+			UpdateNodes( pNodes, nodeCount );
+		}
+	}
+
+	// Nodes already on the changed list from an earlier update that wasn't followed by ClearDirtyFlags() are only
+	// listed once
+	for( size_t queuedIndex = 0; queuedIndex < queuedCount; ++queuedIndex )
+	{
+		NodeId node = m_QueuedNodes[ queuedIndex ];
+		uint8_t& rFlags = m_Flags[ node ];
+		if( !( rFlags & FLAG_WORLD_CHANGED ) )
+		{
+			m_ChangedNodes.Push( node );
+		}
+
+		rFlags = static_cast< uint8_t >( ( rFlags & ~FLAG_QUEUED ) | FLAG_WORLD_CHANGED );
+	}
+}
+
+/// Clear the dirty state of every node that changed, normally once all consumers of this frame's transforms have run.
+void TransformHierarchy::ClearDirtyFlags()
+{
+	size_t changedCount = m_ChangedNodes.GetSize();
+	for( size_t changedIndex = 0; changedIndex < changedCount; ++changedIndex )
+	{
+		m_Flags[ m_ChangedNodes[ changedIndex ] ] &= ~FLAG_WORLD_CHANGED;
+	}
+
+	m_ChangedNodes.Resize( 0 );
+}
+
+/// Recompute the world matrices of the given nodes.
+///
+/// All nodes must be at the same depth, and all nodes above that depth must already be up to date.  Each call only
+/// writes to the given nodes, so calls for separate ranges of a level may run concurrently.
+///
+/// @param[in] pNodes     Nodes to update.
+/// @param[in] nodeCount  Number of nodes to update.
+void TransformHierarchy::UpdateNodes( const NodeId* pNodes, size_t nodeCount )
+{
+	HELIUM_ASSERT( pNodes || nodeCount == 0 );
+
+	const NodeId* pParents = m_Parents.GetData();
+	Simd::Matrix44* pWorldMatrices = m_WorldMatrices.GetData();
+
+	Simd::Matrix44 localMatrix;
+	for( size_t nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex )
+	{
+		NodeId node = pNodes[ nodeIndex ];
+		NodeId parent = pParents[ node ];
+
+		localMatrix.SetRotationTranslationScaling( m_LocalRotations[ node ], m_LocalPositions[ node ], m_LocalScales[ node ] );
+		if( IsValid( parent ) )
+		{
+			pWorldMatrices[ node ].MultiplySet( localMatrix, pWorldMatrices[ parent ] );
+		}
+		else
+		{
+			pWorldMatrices[ node ] = localMatrix;
+		}
+	}
+}
+
+/// Add a node to the front of a parent's child list.
+void TransformHierarchy::LinkChild( NodeId node, NodeId parent )
+{
+	m_Parents[ node ] = parent;
+	m_NextSiblings[ node ] = m_FirstChildren[ parent ];
+	m_FirstChildren[ parent ] = node;
+}
+
+/// Remove a node from its parent's child list.
+void TransformHierarchy::UnlinkChild( NodeId node, NodeId parent )
+{
+	NodeId* pLink = &m_FirstChildren[ parent ];
+	while( *pLink != node )
+	{
+		HELIUM_ASSERT( IsValid( *pLink ) );
+		pLink = &m_NextSiblings[ *pLink ];
+	}
+
+	*pLink = m_NextSiblings[ node ];
+	SetInvalid( m_NextSiblings[ node ] );
+	SetInvalid( m_Parents[ node ] );
+}
+
+/// Set the depth of a node and update the depths of its descendants to match.
+void TransformHierarchy::SetSubtreeDepth( NodeId node, uint32_t depth )
+{
+	m_Depths[ node ] = depth;
+
+	m_NodeStack.Resize( 0 );
+	m_NodeStack.Push( node );
+	while( !m_NodeStack.IsEmpty() )
+	{
+		NodeId parent = m_NodeStack.GetLast();
+		m_NodeStack.Pop();
+
+		for( NodeId child = m_FirstChildren[ parent ]; IsValid( child ); child = m_NextSiblings[ child ] )
+		{
+			m_Depths[ child ] = m_Depths[ parent ] + 1;
+			m_NodeStack.Push( child );
+		}
+	}
+}
+
+/// Queue a node and all of its descendants for the update in progress.
+void TransformHierarchy::QueueSubtree( NodeId node )
+{
+	m_Flags[ node ] |= FLAG_QUEUED;
+	m_QueuedNodes.Push( node );
+
+	m_NodeStack.Resize( 0 );
+	m_NodeStack.Push( node );
+	while( !m_NodeStack.IsEmpty() )
+	{
+		NodeId parent = m_NodeStack.GetLast();
+		m_NodeStack.Pop();
+
+		for( NodeId child = m_FirstChildren[ parent ]; IsValid( child ); child = m_NextSiblings[ child ] )
+		{
+			// A queued child was dirty itself, so its own subtree is already queued
+			uint8_t& rFlags = m_Flags[ child ];
+			if( !( rFlags & FLAG_QUEUED ) )
+			{
+				rFlags |= FLAG_QUEUED;
+				m_QueuedNodes.Push( child );
+				m_NodeStack.Push( child );
+			}
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+HELIUM_DEFINE_COMPONENT(Helium::TransformHierarchyComponent, 16);
+
+void Helium::TransformHierarchyComponent::PopulateMetaType( Reflect::MetaStruct& comp )
+{
+
+}
+
+/// Get the transform hierarchy component of a world, allocating it on the world if it doesn't exist yet.
+Helium::TransformHierarchyComponent *Helium::TransformHierarchyComponent::GetOrCreate( World *pWorld )
+{
+	HELIUM_ASSERT( pWorld );
+
+	TransformHierarchyComponent *pComponent = pWorld->GetComponents().GetFirst<TransformHierarchyComponent>();
+	if ( !pComponent )
+	{
+		ComponentManager *pComponentManager = pWorld->GetComponentManager();
+		HELIUM_ASSERT( pComponentManager );
+
+		pComponent = pComponentManager->Allocate<TransformHierarchyComponent>( pWorld, pWorld->GetComponents() );
+		HELIUM_ASSERT( pComponent );
+	}
+
+	return pComponent;
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "Components/Components.h"
+#include "Platform/Atomic.h"
+#include "Foundation/DynamicArray.h"
+#include "MathSimd/Vector3.h"
+#include "MathSimd/Quat.h"
+#include "MathSimd/Matrix44.h"
+#include "Framework/Components.h"
+
+namespace Helium
+{
+	class TransformComponent;
+
+	/// Parented transforms for all TransformComponents in a world.
+	///
+	/// Local position, rotation, and scale, cached world matrices, parent and child links, depths and flags are each
+	/// kept in their own array, indexed by node.  Changing a node's local transform queues it on a dirty list.
+	/// Update() recomputes the world matrices of the queued nodes and their descendants one depth level at a time, so
+	/// every parent is final before its children read it, and the nodes within a level are split across jobs once
+	/// there are enough of them.  Nodes whose world matrix was recomputed are kept on a changed list until the dirty
+	/// flags are cleared, so consumers only visit transforms that actually moved.
+	class HELIUM_COMPONENTS_API TransformHierarchy : NonCopyable
+	{
+	public:
+		typedef uint32_t NodeId;
+
+		/// Node flags.
+		enum EFlag
+		{
+			/// Local transform or parent changed since the last update (node is on the dirty list).
+			FLAG_LOCAL_DIRTY   = 1 << 0,
+			/// World matrix was recomputed since the dirty flags were last cleared (node is on the changed list).
+			FLAG_WORLD_CHANGED = 1 << 1,
+			/// Node is not allocated.
+			FLAG_FREE          = 1 << 2,
+			/// Node is queued for recomputation by the update in progress.
+			FLAG_QUEUED        = 1 << 3,
+		};
+
+		/// @name Construction/Destruction
+		//@{
+		TransformHierarchy();
+		~TransformHierarchy();
+		//@}
+
+		/// @name Node Allocation
+		//@{
+		NodeId AllocateNode( TransformComponent* pOwner );
+		void FreeNode( NodeId node );
+		inline TransformComponent* GetOwner( NodeId node ) const;
+		//@}
+
+		/// @name Local Transform
+		//@{
+		inline const Simd::Vector3& GetLocalPosition( NodeId node ) const;
+		inline void SetLocalPosition( NodeId node, const Simd::Vector3& rPosition );
+		inline const Simd::Quat& GetLocalRotation( NodeId node ) const;
+		inline void SetLocalRotation( NodeId node, const Simd::Quat& rRotation );
+		inline const Simd::Vector3& GetLocalScale( NodeId node ) const;
+		inline void SetLocalScale( NodeId node, const Simd::Vector3& rScale );
+		inline void MarkDirty( NodeId node );
+		//@}
+
+		/// @name Parenting
+		//@{
+		inline NodeId GetParent( NodeId node ) const;
+		bool SetParent( NodeId node, NodeId parent );
+		bool IsAncestor( NodeId ancestor, NodeId node ) const;
+		//@}
+
+		/// @name World Transform
+		//@{
+		inline const Simd::Matrix44& GetWorldMatrix( NodeId node ) const;
+		inline bool IsDirty( NodeId node ) const;
+		inline const DynamicArray< NodeId >& GetChangedNodes() const;
+		void Update();
+		void ClearDirtyFlags();
+		//@}
+
+		/// @name Internal Use
+		//@{
+		void UpdateNodes( const NodeId* pNodes, size_t nodeCount );
+		//@}
+
+	private:
+		/// Local positions.
+		DynamicArray< Simd::Vector3 > m_LocalPositions;
+		/// Local rotations.
+		DynamicArray< Simd::Quat > m_LocalRotations;
+		/// Local scales.
+		DynamicArray< Simd::Vector3 > m_LocalScales;
+		/// World matrices, valid as of the last update.
+		DynamicArray< Simd::Matrix44 > m_WorldMatrices;
+		/// Parent of each node, invalid for roots.
+		DynamicArray< NodeId > m_Parents;
+		/// First child of each node.
+		DynamicArray< NodeId > m_FirstChildren;
+		/// Next node with the same parent.
+		DynamicArray< NodeId > m_NextSiblings;
+		/// Number of ancestors of each node.
+		DynamicArray< uint32_t > m_Depths;
+		/// Component that owns each node.
+		DynamicArray< TransformComponent* > m_Owners;
+		/// Combination of EFlag values for each node.
+		DynamicArray< uint8_t > m_Flags;
+
+		/// Nodes available for reuse.
+		DynamicArray< NodeId > m_FreeNodes;
+
+		/// Nodes flagged FLAG_LOCAL_DIRTY, sized to the node count so slots can be claimed from any thread.
+		DynamicArray< NodeId > m_DirtyNodes;
+		/// Number of used slots in m_DirtyNodes.
+		volatile int32_t m_DirtyNodeCount;
+		/// Nodes flagged FLAG_WORLD_CHANGED.
+		DynamicArray< NodeId > m_ChangedNodes;
+
+		/// Scratch space for the update in progress.
+		DynamicArray< NodeId > m_QueuedNodes;
+		DynamicArray< NodeId > m_SortedNodes;
+		DynamicArray< uint32_t > m_LevelStarts;
+		DynamicArray< NodeId > m_NodeStack;
+
+		/// @name Private Utility Functions
+		//@{
+		void LinkChild( NodeId node, NodeId parent );
+		void UnlinkChild( NodeId node, NodeId parent );
+		void SetSubtreeDepth( NodeId node, uint32_t depth );
+		void QueueSubtree( NodeId node );
+		//@}
+	};
+
+	/// Owner of a world's TransformHierarchy, allocated on the world itself the first time a transform needs it.
+	class HELIUM_COMPONENTS_API TransformHierarchyComponent : public Component
+	{
+	public:
+		HELIUM_DECLARE_COMPONENT( Helium::TransformHierarchyComponent, Helium::Component );
+		static void PopulateMetaType( Reflect::MetaStruct& comp );
+
+		TransformHierarchy &GetHierarchy() { return m_Hierarchy; }
+
+		static TransformHierarchyComponent *GetOrCreate( World *pWorld );
+
+	private:
+		TransformHierarchy m_Hierarchy;
+	};
+	typedef Helium::ComponentPtr<TransformHierarchyComponent> TransformHierarchyComponentPtr;
+}
+
+#include "Components/TransformHierarchy.inl"
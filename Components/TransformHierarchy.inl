@@ -0,0 +1,93 @@
+namespace Helium
+{
+	/// Get the component that owns a node.
+	TransformComponent* TransformHierarchy::GetOwner( NodeId node ) const
+	{
+		return m_Owners[ node ];
+	}
+
+	/// Get the position of a node relative to its parent.
+	const Simd::Vector3& TransformHierarchy::GetLocalPosition( NodeId node ) const
+	{
+		return m_LocalPositions[ node ];
+	}
+
+	/// Set the position of a node relative to its parent.
+	void TransformHierarchy::SetLocalPosition( NodeId node, const Simd::Vector3& rPosition )
+	{
+		m_LocalPositions[ node ] = rPosition;
+		MarkDirty( node );
+	}
+
+	/// Get the rotation of a node relative to its parent.
+	const Simd::Quat& TransformHierarchy::GetLocalRotation( NodeId node ) const
+	{
+		return m_LocalRotations[ node ];
+	}
+
+	/// Set the rotation of a node relative to its parent.
+	void TransformHierarchy::SetLocalRotation( NodeId node, const Simd::Quat& rRotation )
+	{
+		m_LocalRotations[ node ] = rRotation;
+		MarkDirty( node );
+	}
+
+	/// Get the scale of a node relative to its parent.
+	const Simd::Vector3& TransformHierarchy::GetLocalScale( NodeId node ) const
+	{
+		return m_LocalScales[ node ];
+	}
+
+	/// Set the scale of a node relative to its parent.
+	void TransformHierarchy::SetLocalScale( NodeId node, const Simd::Vector3& rScale )
+	{
+		m_LocalScales[ node ] = rScale;
+		MarkDirty( node );
+	}
+
+	/// Queue a node to have its world matrix recomputed by the next update.
+	///
+	/// Different nodes may be marked from different threads at once (physics syncs bodies in parallel), but a single
+	/// node must only be changed from one thread at a time.
+	void TransformHierarchy::MarkDirty( NodeId node )
+	{
+		uint8_t& rFlags = m_Flags[ node ];
+		if( !( rFlags & FLAG_LOCAL_DIRTY ) )
+		{
+			rFlags |= FLAG_LOCAL_DIRTY;
+
+			int32_t slot = AtomicIncrementUnsafe( m_DirtyNodeCount ) - 1;
+			HELIUM_ASSERT( static_cast< size_t >( slot ) < m_DirtyNodes.GetSize() );
+			m_DirtyNodes[ slot ] = node;
+		}
+	}
+
+	/// Get the parent of a node.
+	///
+	/// @return  Parent node, or an invalid index if the node is a root.
+	TransformHierarchy::NodeId TransformHierarchy::GetParent( NodeId node ) const
+	{
+		return m_Parents[ node ];
+	}
+
+	/// Get the world matrix of a node as of the last Update().
+	const Simd::Matrix44& TransformHierarchy::GetWorldMatrix( NodeId node ) const
+	{
+		return m_WorldMatrices[ node ];
+	}
+
+	/// Get whether a node's local transform changed or its world matrix was recomputed since the dirty flags were
+	/// last cleared.
+	bool TransformHierarchy::IsDirty( NodeId node ) const
+	{
+		return ( m_Flags[ node ] & ( FLAG_LOCAL_DIRTY | FLAG_WORLD_CHANGED ) ) != 0;
+	}
+
+	/// Get the nodes whose world matrices were recomputed since the dirty flags were last cleared.
+	///
+	/// Nodes freed since then stay in the list with FLAG_FREE set, or belong to their new owner if reallocated.
+	const DynamicArray< TransformHierarchy::NodeId >& TransformHierarchy::GetChangedNodes() const
+	{
+		return m_ChangedNodes;
+	}
+}
@@ -12,6 +12,11 @@ project "bullet"
 	uuid "23112391-0616-46AF-B0C2-5325E8530FBC"
 	kind "StaticLib"
 	language "C++"
+	defines
+	{
+		-- bullet's profiler keeps global state, worlds are stepped and solved on several threads at once
+		"BT_NO_PROFILE=1",
+	}
 	includedirs
 	{
 		"bullet/src/",
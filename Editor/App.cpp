@@ -108,6 +108,24 @@ namespace Helium
 	}
 }
 
+#if HELIUM_PROFILE_JOBS
+///////////////////////////////////////////////////////////////////////////////
+// Write out the job trace if -profile_jobs was passed.  The trace includes job
+//  pool statistics, so this must run before the job manager is destroyed.
+// 
+static void ShutdownJobProfiler()
+{
+	JobProfiler* pJobProfiler = JobProfiler::GetRecordingInstance();
+	if ( pJobProfiler )
+	{
+		pJobProfiler->Stop();
+		pJobProfiler->WriteChromeTrace( TXT( "JobProfile.json" ) );
+	}
+
+	JobProfiler::DestroyStaticInstance();
+}
+#endif
+
 #ifdef IDLE_LOOP
 BEGIN_EVENT_TABLE( App, wxApp )
 EVT_IDLE( App::OnIdle )
@@ -242,6 +260,9 @@ bool App::OnInit()
 	JobManager& rJobManager = JobManager::GetStaticInstance();
 	HELIUM_VERIFY( rJobManager.Initialize() );
 	m_InitializerStack.Push( JobManager::DestroyStaticInstance );
+#if HELIUM_PROFILE_JOBS
+	m_InitializerStack.Push( ShutdownJobProfiler );
+#endif
 
 	LoadSettings();
 
@@ -635,8 +656,21 @@ int Main( int argc, const char** argv )
 		wxGetApp().GetSettingsManager()->GetSettings< EditorSettings >()->SetEnableAssetTracker( false );
 	}
 
+#if HELIUM_PROFILE_JOBS
+	bool profileJobs = false;
+	success &= processor.AddOption( new FlagOption( &profileJobs, TXT( "profile_jobs" ), TXT( "record a job trace to JobProfile.json" ) ), error );
+#endif
+
 	success &= processor.ParseOptions( argsBegin, argsEnd, error );
 
+#if HELIUM_PROFILE_JOBS
+	if ( success && profileJobs )
+	{
+		// same as the runtime's -profile_jobs, recording starts before the job manager runs anything
+		JobProfiler::GetStaticInstance().Start();
+	}
+#endif
+
 	if ( success )
 	{
 		if ( helpFlag )
@@ -0,0 +1,288 @@
+#include "EditorPch.h"
+#include "FileWatcher.h"
+
+#include "Foundation/Log.h"
+
+#if HELIUM_OS_LINUX
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+using namespace Helium;
+using namespace Helium::Editor;
+
+#if HELIUM_OS_LINUX
+
+// Events we care about, file contents are only considered changed once the writer closes them
+static const uint32_t WATCH_MASK = IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+
+FileWatcher::FileWatcher()
+: m_Descriptor( -1 )
+{
+
+}
+
+FileWatcher::~FileWatcher()
+{
+	Close();
+}
+
+bool FileWatcher::Open( const Helium::FilePath& directory )
+{
+	Close();
+
+	m_Descriptor = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+	if ( m_Descriptor < 0 )
+	{
+		Log::Warning( TXT( "FileWatcher: inotify is unavailable (errno %d)\n" ), errno );
+		return false;
+	}
+
+	std::string root = directory.Get();
+	if ( root.empty() || root[ root.length() - 1 ] != '/' )
+	{
+		root += '/';
+	}
+
+	// inotify is not recursive, every directory in the tree needs its own watch
+	WatchTree( root, NULL );
+
+	if ( m_WatchedDirectories.empty() )
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void FileWatcher::Close()
+{
+	if ( m_Descriptor >= 0 )
+	{
+		close( m_Descriptor );
+		m_Descriptor = -1;
+	}
+
+	m_WatchedDirectories.clear();
+}
+
+bool FileWatcher::IsOpen() const
+{
+	return m_Descriptor >= 0;
+}
+
+bool FileWatcher::Wait( std::vector< FileChange >& changes, uint32_t timeoutMilliseconds )
+{
+	HELIUM_ASSERT( IsOpen() );
+
+	pollfd descriptor;
+	descriptor.fd = m_Descriptor;
+	descriptor.events = POLLIN;
+	descriptor.revents = 0;
+
+	if ( poll( &descriptor, 1, static_cast< int >( timeoutMilliseconds ) ) <= 0 )
+	{
+		return true;
+	}
+
+	bool overflowed = false;
+	ReadEvents( changes, overflowed );
+
+	return !overflowed;
+}
+
+void FileWatcher::WatchTree( const std::string& directory, std::vector< FileChange >* changes )
+{
+	std::vector< std::string > pending;
+	pending.push_back( directory );
+
+	while ( !pending.empty() )
+	{
+		std::string current = pending.back();
+		pending.pop_back();
+
+		int watch = inotify_add_watch( m_Descriptor, current.c_str(), WATCH_MASK );
+		if ( watch < 0 )
+		{
+			// ENOSPC means fs.inotify.max_user_watches is too low for this tree
+			Log::Warning( TXT( "FileWatcher: Unable to watch '%s' (errno %d)\n" ), current.c_str(), errno );
+			continue;
+		}
+
+		m_WatchedDirectories[ watch ] = current;
+
+		DIR* dir = opendir( current.c_str() );
+		if ( !dir )
+		{
+			continue;
+		}
+
+		while ( dirent* entry = readdir( dir ) )
+		{
+			if ( entry->d_name[ 0 ] == '.' && ( entry->d_name[ 1 ] == '\0' || ( entry->d_name[ 1 ] == '.' && entry->d_name[ 2 ] == '\0' ) ) )
+			{
+				continue;
+			}
+
+			std::string path = current + entry->d_name;
+
+			bool isDirectory = entry->d_type == DT_DIR;
+			if ( entry->d_type == DT_UNKNOWN )
+			{
+				struct stat status;
+				isDirectory = lstat( path.c_str(), &status ) == 0 && S_ISDIR( status.st_mode );
+			}
+
+			if ( isDirectory )
+			{
+				pending.push_back( path + '/' );
+			}
+			else if ( changes )
+			{
+				// files created before the watch was added would otherwise be missed
+				FileChange change;
+				change.m_Type = FileChangeTypes::Added;
+				change.m_Path = Helium::FilePath( path );
+				changes->push_back( change );
+			}
+		}
+
+		closedir( dir );
+	}
+}
+
+void FileWatcher::ReadEvents( std::vector< FileChange >& changes, bool& overflowed )
+{
+	char buffer[ 16 * 1024 ] __attribute__(( aligned( __alignof__( inotify_event ) ) ));
+
+	while ( true )
+	{
+		ssize_t length = read( m_Descriptor, buffer, sizeof( buffer ) );
+		if ( length <= 0 )
+		{
+			break;
+		}
+
+		for ( const char* cursor = buffer; cursor < buffer + length; )
+		{
+			const inotify_event* event = reinterpret_cast< const inotify_event* >( cursor );
+			cursor += sizeof( inotify_event ) + event->len;
+
+			if ( event->mask & IN_Q_OVERFLOW )
+			{
+				overflowed = true;
+				continue;
+			}
+
+			std::map< int, std::string >::iterator found = m_WatchedDirectories.find( event->wd );
+			if ( found == m_WatchedDirectories.end() )
+			{
+				continue;
+			}
+
+			if ( event->mask & IN_IGNORED )
+			{
+				m_WatchedDirectories.erase( found );
+				continue;
+			}
+
+			if ( event->len == 0 )
+			{
+				continue;
+			}
+
+			std::string path = found->second + event->name;
+
+			if ( event->mask & IN_ISDIR )
+			{
+				if ( event->mask & ( IN_CREATE | IN_MOVED_TO ) )
+				{
+					WatchTree( path + '/', &changes );
+				}
+				else if ( event->mask & IN_MOVED_FROM )
+				{
+					// the files below a directory moved out of the tree vanish without their own events, report the
+					//  directory itself and stop watching it
+					std::string prefix = path + '/';
+					for ( std::map< int, std::string >::iterator itr = m_WatchedDirectories.begin(); itr != m_WatchedDirectories.end(); )
+					{
+						if ( itr->second.compare( 0, prefix.length(), prefix ) == 0 )
+						{
+							inotify_rm_watch( m_Descriptor, itr->first );
+							m_WatchedDirectories.erase( itr++ );
+						}
+						else
+						{
+							++itr;
+						}
+					}
+
+					FileChange change;
+					change.m_Type = FileChangeTypes::Removed;
+					change.m_Path = Helium::FilePath( prefix );
+					changes.push_back( change );
+				}
+
+				continue;
+			}
+
+			FileChange change;
+			change.m_Path = Helium::FilePath( path );
+
+			if ( event->mask & IN_CREATE )
+			{
+				change.m_Type = FileChangeTypes::Added;
+			}
+			else if ( event->mask & ( IN_CLOSE_WRITE | IN_MOVED_TO ) )
+			{
+				change.m_Type = FileChangeTypes::Modified;
+			}
+			else
+			{
+				change.m_Type = FileChangeTypes::Removed;
+			}
+
+			changes.push_back( change );
+		}
+	}
+}
+
+#else
+
+FileWatcher::FileWatcher()
+{
+
+}
+
+FileWatcher::~FileWatcher()
+{
+
+}
+
+bool FileWatcher::Open( const Helium::FilePath& directory )
+{
+	return false;
+}
+
+void FileWatcher::Close()
+{
+
+}
+
+bool FileWatcher::IsOpen() const
+{
+	return false;
+}
+
+bool FileWatcher::Wait( std::vector< FileChange >& changes, uint32_t timeoutMilliseconds )
+{
+	HELIUM_ASSERT( false );
+	return false;
+}
+
+#endif
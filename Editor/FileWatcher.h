@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Editor/API.h"
+
+#include "Foundation/FilePath.h"
+
+#include <map>
+#include <vector>
+
+namespace Helium
+{
+    namespace Editor
+    {
+        namespace FileChangeTypes
+        {
+            enum FileChangeType
+            {
+                Added,
+                Modified,
+                Removed,
+            };
+        }
+        typedef FileChangeTypes::FileChangeType FileChangeType;
+
+        struct FileChange
+        {
+            FileChangeType m_Type;
+            Helium::FilePath m_Path;
+        };
+
+        //
+        // Reports changes to the files under a directory as the OS notifies them (inotify on Linux), instead of
+        //  rescanning the tree to find them.  Open() fails where no backend is available, callers should fall back to
+        //  scanning in that case.
+        //
+
+        class FileWatcher
+        {
+        public:
+            FileWatcher();
+            ~FileWatcher();
+
+            bool Open( const Helium::FilePath& directory );
+            void Close();
+            bool IsOpen() const;
+
+            // Wait up to timeoutMilliseconds for changes and append them to changes.  Returns false if notifications
+            //  were lost (the OS queue overflowed), after which the watched tree must be rescanned.
+            bool Wait( std::vector< FileChange >& changes, uint32_t timeoutMilliseconds );
+
+        private:
+#if HELIUM_OS_LINUX
+            void WatchTree( const std::string& directory, std::vector< FileChange >* changes );
+            void ReadEvents( std::vector< FileChange >& changes, bool& overflowed );
+
+            int m_Descriptor;
+            std::map< int, std::string > m_WatchedDirectories; // watch descriptor -> directory (with trailing slash)
+#endif
+        };
+    }
+}
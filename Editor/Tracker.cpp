@@ -1,15 +1,97 @@
 #include "EditorPch.h"
 #include "Tracker.h"
 
+#include "Platform/File.h"
 #include "Foundation/FilePath.h"
+#include "Foundation/FileStream.h"
 #include "Foundation/Log.h"
+#include "Foundation/MemoryStream.h"
 #include "Foundation/Wildcard.h"
+#include "Persist/ArchiveJson.h"
+#include "PcSupport/LoosePackageLoader.h"
 
 #include "SceneGraph/SearchableProperties.h"
 
 using namespace Helium;
 using namespace Helium::Editor;
 
+///////////////////////////////////////////////////////////////////////////////
+// Last modified time of a file, zero if it can't be read
+static int64_t GetModifiedTime( const Helium::FilePath& path )
+{
+	Status status;
+	if ( !status.Read( path.Get().c_str() ) )
+	{
+		return 0;
+	}
+
+	return status.m_ModifiedTime;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Searchable metadata of an asset file: the type and template of the object it
+//  describes, empty for anything that isn't a readable asset file
+static std::string GetSearchMetadata( const Helium::FilePath& path )
+{
+	std::string metadata;
+	if ( path.Extension() != TXT( "json" ) )
+	{
+		return metadata;
+	}
+
+	FileStream* pFileStream = FileStream::OpenFileStream( path.c_str(), FileStream::MODE_READ );
+	if ( !pFileStream )
+	{
+		return metadata;
+	}
+
+	int64_t size64 = pFileStream->GetSize();
+	if ( size64 <= 0 || static_cast< uint64_t >( size64 ) > SIZE_MAX )
+	{
+		delete pFileStream;
+		return metadata;
+	}
+
+	size_t size = static_cast< size_t >( size64 );
+	DynamicArray< uint8_t > contents;
+	contents.Resize( size );
+	size_t bytesRead = pFileStream->Read( contents.GetData(), 1, size );
+	delete pFileStream;
+
+	if ( bytesRead != size )
+	{
+		return metadata;
+	}
+
+	// the descriptor is always the first object, so there's no need to read the rest
+	StaticMemoryStream archiveStream( contents.GetData(), size );
+	Persist::ArchiveReaderJson archive( &archiveStream );
+
+	try
+	{
+		Reflect::ObjectPtr descriptor;
+		archive.Start();
+		archive.ReadNext( descriptor, 0 );
+
+		ObjectDescriptor* pObjectDescriptor = Reflect::SafeCast< ObjectDescriptor >( descriptor.Get() );
+		if ( pObjectDescriptor )
+		{
+			metadata = pObjectDescriptor->m_TypeName;
+			if ( !pObjectDescriptor->m_TemplatePath.empty() )
+			{
+				metadata += ' ';
+				metadata += pObjectDescriptor->m_TemplatePath;
+			}
+		}
+	}
+	catch ( Persist::Exception& )
+	{
+		// not an asset file after all, index it by path alone
+	}
+
+	return metadata;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Sleep between runs and yield to other threads
 // The complex loop is to prevent Editor from hanging on exit (max hang will be "increments" seconds)
@@ -61,6 +143,7 @@ void Tracker::SetProject( Project* project )
 #pragma TODO("Tidy db")
 
 	m_Project = project;
+	m_SearchIndex.Clear();
 
 	if ( m_Project )
 	{
@@ -116,144 +199,294 @@ void Tracker::TrackEverything()
 
 #pragma TODO("Create default tables/migrate db")
 
-	std::set< Helium::FilePath > assetFiles;
+	// Start watching before the initial scan so nothing changed while scanning is missed
+	FileWatcher watcher;
+	bool watching = watcher.Open( FilePath( m_Project->GetPath().Directory() ) );
+	if ( !watching )
+	{
+		Log::Print( TXT("Tracker: File change notifications are unavailable, rescanning periodically instead\n") );
+	}
+
+	m_TrackedFiles.clear();
+	m_SearchIndex.Clear();
+	m_SearchIndex.SetRoot( m_Project->GetPath().Directory() );
+	ScanProject();
+
+	std::vector< FileChange > changes;
 	while ( !m_StopTracking )
 	{
-		Log::Print( m_InitialIndexingCompleted ? Log::Levels::Verbose : Log::Levels::Default,
-			m_InitialIndexingCompleted ? TXT("Tracker: Looking for new or updated files...\n") : TXT("Tracker: Finding asset files...\n" ));
+		if ( !watching )
+		{
+			// Sleep between runs and yield to other threads
+			// The complex loop is to prevent Editor from hanging on exit (max hang will be "increments" seconds)
+			SleepBetweenTracking( &m_StopTracking );
+
+			if ( !m_StopTracking )
+			{
+				ScanProject();
+			}
 
-		// find all the files in the project
+			continue;
+		}
+
+		// Wake up every second to see if we've been asked to stop
+		changes.clear();
+		if ( !watcher.Wait( changes, 1000 ) )
 		{
-			SimpleTimer timer;
-			Helium::DirectoryIterator directory( FilePath( m_Project->GetPath().Directory() ) );
-			directory.GetFiles( assetFiles, true );
-			Log::Print( m_InitialIndexingCompleted ? Log::Levels::Verbose : Log::Levels::Default, TXT("Tracker: File reslover database lookup took %.2fms\n"), timer.Elapsed() );
+			Log::Print( TXT("Tracker: File change notifications overflowed, rescanning...\n") );
+			ScanProject();
+			continue;
 		}
 
-		// for each file
-		m_CurrentProgress = 0;
-		m_Total = (uint32_t)assetFiles.size();
+		for ( std::vector< FileChange >::const_iterator itr = changes.begin(), end = changes.end(); !m_StopTracking && itr != end; ++itr )
+		{
+			ApplyChange( *itr );
+		}
+	}
+}
 
+void Tracker::ScanProject()
+{
+	Log::Print( m_InitialIndexingCompleted ? Log::Levels::Verbose : Log::Levels::Default,
+		m_InitialIndexingCompleted ? TXT("Tracker: Looking for new or updated files...\n") : TXT("Tracker: Finding asset files...\n" ));
+
+	// find all the files in the project
+	std::set< Helium::FilePath > assetFiles;
+	{
 		SimpleTimer timer;
-		Log::Print( m_InitialIndexingCompleted ? Log::Levels::Verbose : Log::Levels::Default, TXT("Tracker: Scanning %d asset file(s) for changes...\n"), (uint32_t)assetFiles.size() );
+		Helium::DirectoryIterator directory( FilePath( m_Project->GetPath().Directory() ) );
+		directory.GetFiles( assetFiles, true );
+		Log::Print( m_InitialIndexingCompleted ? Log::Levels::Verbose : Log::Levels::Default, TXT("Tracker: File reslover database lookup took %.2fms\n"), timer.Elapsed() );
+	}
 
-		for( std::set< Helium::FilePath >::const_iterator assetFileItr = assetFiles.begin(), assetFileItrEnd = assetFiles.end();
-			!m_StopTracking && assetFileItr != assetFileItrEnd; ++assetFileItr )
-		{
-			Log::Listener listener ( ~Log::Streams::Error );
-			++m_CurrentProgress;
+	// for each file
+	m_CurrentProgress = 0;
+	m_Total = (uint32_t)assetFiles.size();
 
-			// see if the file has changed
-			// insert/update the file: path, timestamp, etc...
-			const Helium::FilePath& assetFilePath = (*assetFileItr);
+	SimpleTimer timer;
+	Log::Print( m_InitialIndexingCompleted ? Log::Levels::Verbose : Log::Levels::Default, TXT("Tracker: Scanning %d asset file(s) for changes...\n"), (uint32_t)assetFiles.size() );
 
-#pragma TODO( "Make a configurable list of places to ignore" )
-			// skip files in the meta directory
-			if ( assetFilePath.IsUnder( m_Project->GetPath().Directory() + TXT( ".Helium/" ) ) )
-			{
-				continue;
-			}
+	for( std::set< Helium::FilePath >::const_iterator assetFileItr = assetFiles.begin(), assetFileItrEnd = assetFiles.end();
+		!m_StopTracking && assetFileItr != assetFileItrEnd; ++assetFileItr )
+	{
+		++m_CurrentProgress;
 
-			// start transaction
-#pragma TODO("Start transaction")
-			try
-			{
-#pragma TODO("Select tracked from from db, delete db obj if the real file has changed more recently")
+		const Helium::FilePath& assetFilePath = (*assetFileItr);
+		if ( IsIgnored( assetFilePath ) )
+		{
+			continue;
+		}
 
-				if ( WildcardMatch( TXT( "Helium*" ), assetFilePath.Extension().c_str() ) )
-				{
-#ifdef ASSET_REFACTOR
-					const Asset::AssetClassPtr assetClass = Asset::AssetClass::LoadAssetClass( assetFilePath );
-					if ( assetClass.ReferencesObject() )
-					{
-						// get file's properties
-						Helium::SearchableProperties fileProperties;
-						assetClass->GatherSearchableProperties( &fileProperties );
-						for( std::multimap< std::string, std::string >::const_iterator filePropertiesItr = fileProperties.GetStringProperties().begin(), filePropertiesItrEnd = fileProperties.GetStringProperties().end(); filePropertiesItr != filePropertiesItrEnd; ++filePropertiesItr )
-						{
-							//TrackedProperty
-							TrackedProperty prop( *m_TrackerDB );
-							prop.mName = filePropertiesItr->first;
-							prop.update();
-
-							assetTrackedFile.properties().link( prop, filePropertiesItr->second );
-						}
-
-						// get file's dependencies
-						std::set< Helium::FilePath > fileReferences;
-						assetClass->GetFileReferences( fileReferences );
-						for( std::set< Helium::FilePath >::const_iterator fileRefsItr = fileReferences.begin(), fileRefsItrEnd = fileReferences.end(); fileRefsItr != fileRefsItrEnd; ++fileRefsItr )
-						{
-							//   see if the file has changed
-							const Helium::FilePath& fileRefPath = (*fileRefsItr);
-
-							TrackedFile fileRefTrackedFile( *m_TrackerDB );
-							fileRefTrackedFile.mPath = fileRefPath.Get();
-							fileRefTrackedFile.update();
-
-							assetTrackedFile.fileReferences().link( fileRefTrackedFile );
-						}
-					}
-#endif
-				}
+		// a rescan after dropped notifications has to catch edits too, so compare against the time we last indexed
+		int64_t modifiedTime = GetModifiedTime( assetFilePath );
+		std::map< Helium::FilePath, int64_t >::iterator trackedItr = m_TrackedFiles.find( assetFilePath );
+		if ( trackedItr != m_TrackedFiles.end() && trackedItr->second == modifiedTime )
+		{
+			continue;
+		}
 
-#pragma TODO("Clear broken flag in the tracked file object")
-			}
-			catch ( const Helium::Exception& e )
+		TrackFile( assetFilePath );
+		m_SearchIndex.Add( assetFilePath, GetSearchMetadata( assetFilePath ) );
+
+		// listeners do their own initial indexing, only report what later rescans find
+		if ( trackedItr == m_TrackedFiles.end() )
+		{
+			m_TrackedFiles.insert( std::make_pair( assetFilePath, modifiedTime ) );
+			if ( m_InitialIndexingCompleted )
 			{
-				Log::Error( TXT( "Exception in Tracker thread: %s" ), e.What() );
-#pragma TODO("Set the broken flag in the tracked file object")
+				RaiseFileChanged( FileChangeTypes::Added, assetFilePath );
 			}
-			catch ( ... )
+		}
+		else
+		{
+			trackedItr->second = modifiedTime;
+			if ( m_InitialIndexingCompleted )
 			{
-				Log::Error( TXT( "Unknown exception in Tracker thread." ) );
-
-#pragma TODO("Rollback transaction")
-
-				// the consequences could never be the same here, rethrow
-				throw;
+				RaiseFileChanged( FileChangeTypes::Modified, assetFilePath );
 			}
-
-#pragma TODO("Update and commit object state")
-#if 0
-			// update LastModified
-			assetTrackedFile.mPath = assetFilePath.GetRelativePath( m_Project->m_Path ).Get();
-			assetTrackedFile.mSize = (int32_t) assetFilePath.Size();
-			assetTrackedFile.mLastModified = litesql::DateTime( assetFilePath.ModifiedTime() );
-			assetTrackedFile.update();
-
-			// commit transaction
-			m_TrackerDB->commit();
-#endif
 		}
+	}
 
-		if ( m_StopTracking )
+	if ( m_StopTracking )
+	{
+		uint32_t percentComplete = (uint32_t)(((float32_t)m_CurrentProgress/(float32_t)m_Total) * 100);
+		Log::Print( m_InitialIndexingCompleted ? Log::Levels::Verbose : Log::Levels::Default, TXT("Tracker: Indexing (%d%% complete) pre-empted after %.2fm\n"), percentComplete, timer.Elapsed() / 1000.f / 60.f );
+	}
+	else
+	{
+		// anything we were tracking that the scan didn't find is gone
+		for ( std::map< Helium::FilePath, int64_t >::iterator itr = m_TrackedFiles.begin(); itr != m_TrackedFiles.end(); )
 		{
-			uint32_t percentComplete = (uint32_t)(((float32_t)m_CurrentProgress/(float32_t)m_Total) * 100);
-			Log::Print( m_InitialIndexingCompleted ? Log::Levels::Verbose : Log::Levels::Default, TXT("Tracker: Indexing (%d%% complete) pre-empted after %.2fm\n"), percentComplete, timer.Elapsed() / 1000.f / 60.f );
+			if ( assetFiles.find( itr->first ) == assetFiles.end() )
+			{
+				m_SearchIndex.Remove( itr->first );
+				RaiseFileChanged( FileChangeTypes::Removed, itr->first );
+				m_TrackedFiles.erase( itr++ );
+			}
+			else
+			{
+				++itr;
+			}
 		}
-		else if ( !m_InitialIndexingCompleted )
+
+		if ( !m_InitialIndexingCompleted )
 		{
 			m_InitialIndexingCompleted = true;
 			Log::Print( TXT("Tracker: Initial indexing completed in %.2fm\n"), timer.Elapsed() / 1000.f / 60.f );
 		}
-		else 
+		else
 		{
 			Log::Print( Log::Levels::Verbose, TXT("Tracker: Indexing updated in %.2fm\n") , timer.Elapsed() / 1000.f / 60.f );
 		}
+	}
 
-		m_Total = 0;
-		m_CurrentProgress = 0;
+	m_Total = 0;
+	m_CurrentProgress = 0;
+}
 
-		////////////////////////////////
-		// Recurse
-		if ( !m_StopTracking )
+void Tracker::ApplyChange( const FileChange& change )
+{
+	if ( change.m_Type == FileChangeTypes::Removed )
+	{
+		// a directory moved out of the project takes every file below it along
+		const std::string& path = change.m_Path.Get();
+		if ( !path.empty() && path[ path.length() - 1 ] == '/' )
 		{
-			// Sleep between runs and yield to other threads
-			// The complex loop is to prevent Editor from hanging on exit (max hang will be "increments" seconds)
-			SleepBetweenTracking( &m_StopTracking );
+			for ( std::map< Helium::FilePath, int64_t >::iterator itr = m_TrackedFiles.begin(); itr != m_TrackedFiles.end(); )
+			{
+				if ( itr->first.IsUnder( path ) )
+				{
+					m_SearchIndex.Remove( itr->first );
+					RaiseFileChanged( FileChangeTypes::Removed, itr->first );
+					m_TrackedFiles.erase( itr++ );
+				}
+				else
+				{
+					++itr;
+				}
+			}
 		}
+		else if ( m_TrackedFiles.erase( change.m_Path ) )
+		{
+			m_SearchIndex.Remove( change.m_Path );
+			RaiseFileChanged( FileChangeTypes::Removed, change.m_Path );
+		}
+
+		return;
 	}
+
+	if ( IsIgnored( change.m_Path ) )
+	{
+		return;
+	}
+
+	TrackFile( change.m_Path );
+	m_SearchIndex.Add( change.m_Path, GetSearchMetadata( change.m_Path ) );
+
+	int64_t modifiedTime = GetModifiedTime( change.m_Path );
+	std::pair< std::map< Helium::FilePath, int64_t >::iterator, bool > inserted =
+		m_TrackedFiles.insert( std::make_pair( change.m_Path, modifiedTime ) );
+	if ( !inserted.second )
+	{
+		inserted.first->second = modifiedTime;
+	}
+
+	RaiseFileChanged( inserted.second ? FileChangeTypes::Added : FileChangeTypes::Modified, change.m_Path );
+}
+
+bool Tracker::IsIgnored( const Helium::FilePath& path ) const
+{
+#pragma TODO( "Make a configurable list of places to ignore" )
+	// skip files in the meta directory
+	return path.IsUnder( m_Project->GetPath().Directory() + TXT( ".Helium/" ) );
+}
+
+void Tracker::RaiseFileChanged( FileChangeType type, const Helium::FilePath& path )
+{
+	FileChange change;
+	change.m_Type = type;
+	change.m_Path = path;
+	m_FileChanged.Raise( change );
+}
+
+void Tracker::TrackFile( const Helium::FilePath& assetFilePath )
+{
+	Log::Listener listener ( ~Log::Streams::Error );
+
+	// see if the file has changed
+	// insert/update the file: path, timestamp, etc...
+
+	// start transaction
+#pragma TODO("Start transaction")
+	try
+	{
+#pragma TODO("Select tracked from from db, delete db obj if the real file has changed more recently")
+
+		if ( WildcardMatch( TXT( "Helium*" ), assetFilePath.Extension().c_str() ) )
+		{
+#ifdef ASSET_REFACTOR
+			const Asset::AssetClassPtr assetClass = Asset::AssetClass::LoadAssetClass( assetFilePath );
+			if ( assetClass.ReferencesObject() )
+			{
+				// get file's properties
+				Helium::SearchableProperties fileProperties;
+				assetClass->GatherSearchableProperties( &fileProperties );
+				for( std::multimap< std::string, std::string >::const_iterator filePropertiesItr = fileProperties.GetStringProperties().begin(), filePropertiesItrEnd = fileProperties.GetStringProperties().end(); filePropertiesItr != filePropertiesItrEnd; ++filePropertiesItr )
+				{
+					//TrackedProperty
+					TrackedProperty prop( *m_TrackerDB );
+					prop.mName = filePropertiesItr->first;
+					prop.update();
+
+					assetTrackedFile.properties().link( prop, filePropertiesItr->second );
+				}
+
+				// get file's dependencies
+				std::set< Helium::FilePath > fileReferences;
+				assetClass->GetFileReferences( fileReferences );
+				for( std::set< Helium::FilePath >::const_iterator fileRefsItr = fileReferences.begin(), fileRefsItrEnd = fileReferences.end(); fileRefsItr != fileRefsItrEnd; ++fileRefsItr )
+				{
+					//   see if the file has changed
+					const Helium::FilePath& fileRefPath = (*fileRefsItr);
+
+					TrackedFile fileRefTrackedFile( *m_TrackerDB );
+					fileRefTrackedFile.mPath = fileRefPath.Get();
+					fileRefTrackedFile.update();
+
+					assetTrackedFile.fileReferences().link( fileRefTrackedFile );
+				}
+			}
+#endif
+		}
+
+#pragma TODO("Clear broken flag in the tracked file object")
+	}
+	catch ( const Helium::Exception& e )
+	{
+		Log::Error( TXT( "Exception in Tracker thread: %s" ), e.What() );
+#pragma TODO("Set the broken flag in the tracked file object")
+	}
+	catch ( ... )
+	{
+		Log::Error( TXT( "Unknown exception in Tracker thread." ) );
+
+#pragma TODO("Rollback transaction")
+
+		// the consequences could never be the same here, rethrow
+		throw;
+	}
+
+#pragma TODO("Update and commit object state")
+#if 0
+	// update LastModified
+	assetTrackedFile.mPath = assetFilePath.GetRelativePath( m_Project->m_Path ).Get();
+	assetTrackedFile.mSize = (int32_t) assetFilePath.Size();
+	assetTrackedFile.mLastModified = litesql::DateTime( assetFilePath.ModifiedTime() );
+	assetTrackedFile.update();
+
+	// commit transaction
+	m_TrackerDB->commit();
+#endif
 }
 
 bool Tracker::InitialIndexingCompleted() const
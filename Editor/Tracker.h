@@ -4,9 +4,13 @@
 
 #include "Application/InitializerStack.h"
 #include "Foundation/DirectoryIterator.h"
+#include "Foundation/Event.h"
 #include "Platform/Thread.h"
 #include "SceneGraph/Project.h"
 
+#include "Editor/FileWatcher.h"
+#include "Editor/Vault/VaultSearchIndex.h"
+
 namespace Helium
 {
     namespace Editor
@@ -32,10 +36,42 @@ namespace Helium
             uint32_t GetCurrentProgress() const;
             uint32_t GetTrackingTotal() const;
 
+            // Trigram index over the tracked files, kept current as they change
+            const VaultSearchIndex* GetSearchIndex() const
+            {
+                return &m_SearchIndex;
+            }
+
+            //
+            // Raised in the tracker thread for each file added, modified or removed after the initial indexing
+            //
+            typedef Helium::Signature< const FileChange& > FileChangedSignature;
+
+        private:
+            FileChangedSignature::Event m_FileChanged;
+        public:
+            void AddFileChangedListener( FileChangedSignature::Delegate listener )
+            {
+                m_FileChanged.Add( listener );
+            }
+            void RemoveFileChangedListener( FileChangedSignature::Delegate listener )
+            {
+                m_FileChanged.Remove( listener );
+            }
+
         protected:
+            void ScanProject();
+            void ApplyChange( const FileChange& change );
+            bool IsIgnored( const Helium::FilePath& path ) const;
+            void RaiseFileChanged( FileChangeType type, const Helium::FilePath& path );
+            void TrackFile( const Helium::FilePath& assetFilePath );
+
             Helium::CallbackThread m_Thread;
             bool m_StopTracking;
             Project* m_Project;
+            // Files found in the project, with their modified time as of when they were last indexed
+            std::map< Helium::FilePath, int64_t > m_TrackedFiles;
+            VaultSearchIndex m_SearchIndex;
 
             // Status update
             bool m_InitialIndexingCompleted;
@@ -14,6 +14,16 @@ Thumbnail::Thumbnail( DeviceManager* d3dManager )
 {
 }
 
+Thumbnail::Thumbnail( DeviceManager* d3dManager, const Image& image )
+: m_DeviceManager( d3dManager )
+, m_Image( image )
+#ifdef VIEWPORT_REFACTOR
+, m_Texture( NULL )
+#endif
+, m_IsFromIcon( false )
+{
+}
+
 #ifdef VIEWPORT_REFACTOR
 
 Thumbnail::Thumbnail( DeviceManager* d3dManager, IDirect3DTexture9* texture )
@@ -37,6 +47,37 @@ Thumbnail::~Thumbnail()
 
 #ifdef VIEWPORT_REFACTOR
 
+IDirect3DTexture9* Thumbnail::GetTexture() const
+{
+  if ( !m_Texture && m_Image.GetPixelData() )
+  {
+    uint32_t width = m_Image.GetWidth();
+    uint32_t height = m_Image.GetHeight();
+
+    if ( SUCCEEDED( m_DeviceManager->GetD3DDevice()->CreateTexture( width, height, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &m_Texture, NULL ) ) )
+    {
+      D3DLOCKED_RECT rect;
+      if ( SUCCEEDED( m_Texture->LockRect( 0, &rect, NULL, D3DLOCK_NOSYSLOCK ) ) )
+      {
+        // the image is already in D3DFMT_A8R8G8B8 layout, so just copy the rows
+        const uint8_t* source = static_cast< const uint8_t* >( m_Image.GetPixelData() );
+        uint8_t* dest = static_cast< uint8_t* >( rect.pBits );
+
+        for ( uint32_t y = 0; y < height; y++ )
+        {
+          MemoryCopy( dest, source, width * 4 );
+          source += m_Image.GetPitch();
+          dest += rect.Pitch;
+        }
+
+        m_Texture->UnlockRect( 0 );
+      }
+    }
+  }
+
+  return m_Texture;
+}
+
 bool Thumbnail::FromIcon( HICON icon )
 {
   wxIcon temp;
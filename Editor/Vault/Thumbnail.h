@@ -6,6 +6,8 @@
 
 #include "SceneGraph/DeviceManager.h"
 
+#include "EditorSupport/Image.h"
+
 namespace Helium
 {
     namespace Editor
@@ -14,17 +16,22 @@ namespace Helium
         {
         public:
             Thumbnail( DeviceManager* d3dManager );
+            Thumbnail( DeviceManager* d3dManager, const Image& image );
 #ifdef VIEWPORT_REFACTOR
             Thumbnail( DeviceManager* d3dManager, IDirect3DTexture9* texture );
 #endif
             virtual ~Thumbnail();
 
-#ifdef VIEWPORT_REFACTOR
-            inline IDirect3DTexture9* GetTexture() const
+            // CPU copy of the thumbnail (32-bit BGRA), empty if created from a texture or icon
+            inline const Image& GetImage() const
             {
-                return m_Texture;
+                return m_Image;
             }
 
+#ifdef VIEWPORT_REFACTOR
+            // Creates the texture from the image on first use, so it must only be called from the render thread
+            IDirect3DTexture9* GetTexture() const;
+
             bool FromIcon( HICON icon );
 #endif
             bool IsFromIcon() const
@@ -34,9 +41,10 @@ namespace Helium
 
         private:
             DeviceManager* m_DeviceManager;
+            Image m_Image;
 
 #ifdef VIEWPORT_REFACTOR
-            IDirect3DTexture9* m_Texture;
+            mutable IDirect3DTexture9* m_Texture;
 #endif
             bool m_IsFromIcon;
         };
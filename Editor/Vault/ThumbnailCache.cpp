@@ -0,0 +1,376 @@
+#include "EditorPch.h"
+#include "ThumbnailCache.h"
+
+#include "Foundation/FileStream.h"
+#include "Foundation/MemoryStream.h"
+#include "Application/Preferences.h"
+
+#include "EditorSupport/PngImageLoader.h"
+#include "EditorSupport/TgaImageLoader.h"
+
+#if HELIUM_SIMD_SSE
+#include <emmintrin.h>
+#endif
+
+using namespace Helium;
+using namespace Helium::Editor;
+
+// Cached thumbnail file header, followed by width * height packed BGRA pixels
+struct ThumbnailCacheHeader
+{
+    uint32_t m_Magic;
+    uint32_t m_Version;
+    uint32_t m_Width;
+    uint32_t m_Height;
+};
+
+static const uint32_t THUMBNAIL_CACHE_MAGIC = 0x424d4854;  // 'THMB'
+static const uint32_t THUMBNAIL_CACHE_VERSION = 1;
+
+static const uint64_t FNV1A_64_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+static const uint64_t FNV1A_64_PRIME = 0x100000001b3ULL;
+
+///////////////////////////////////////////////////////////////////////////////
+// Get the 32-bit BGRA format used by all cached thumbnails (matches D3DFMT_A8R8G8B8).
+//
+static Image::Format GetBgraFormat()
+{
+    Image::Format bgraFormat;
+    bgraFormat.SetBytesPerPixel( 4 );
+    bgraFormat.SetChannelBitCount( Image::CHANNEL_RED, 8 );
+    bgraFormat.SetChannelBitCount( Image::CHANNEL_GREEN, 8 );
+    bgraFormat.SetChannelBitCount( Image::CHANNEL_BLUE, 8 );
+    bgraFormat.SetChannelBitCount( Image::CHANNEL_ALPHA, 8 );
+#if HELIUM_ENDIAN_LITTLE
+    bgraFormat.SetChannelBitOffset( Image::CHANNEL_RED, 16 );
+    bgraFormat.SetChannelBitOffset( Image::CHANNEL_GREEN, 8 );
+    bgraFormat.SetChannelBitOffset( Image::CHANNEL_BLUE, 0 );
+    bgraFormat.SetChannelBitOffset( Image::CHANNEL_ALPHA, 24 );
+#else
+    bgraFormat.SetChannelBitOffset( Image::CHANNEL_RED, 8 );
+    bgraFormat.SetChannelBitOffset( Image::CHANNEL_GREEN, 16 );
+    bgraFormat.SetChannelBitOffset( Image::CHANNEL_BLUE, 24 );
+    bgraFormat.SetChannelBitOffset( Image::CHANNEL_ALPHA, 0 );
+#endif
+
+    return bgraFormat;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Read an entire file into memory.
+//
+static bool ReadFileContents( const Helium::FilePath& path, DynamicArray< uint8_t >& rContents )
+{
+    FileStream* pFileStream = FileStream::OpenFileStream( path.c_str(), FileStream::MODE_READ );
+    if ( !pFileStream )
+    {
+        return false;
+    }
+
+    int64_t size64 = pFileStream->GetSize();
+    if ( size64 <= 0 || static_cast< uint64_t >( size64 ) > SIZE_MAX )
+    {
+        delete pFileStream;
+        return false;
+    }
+
+    size_t size = static_cast< size_t >( size64 );
+    rContents.Resize( size );
+    size_t bytesRead = pFileStream->Read( rContents.GetData(), 1, size );
+
+    delete pFileStream;
+
+    return bytesRead == size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Compute a 64-bit FNV-1a hash of a block of memory.
+//
+static uint64_t HashContents( const uint8_t* pData, size_t size )
+{
+    uint64_t hash = FNV1A_64_OFFSET_BASIS;
+    for ( size_t i = 0; i < size; ++i )
+    {
+        hash ^= pData[ i ];
+        hash *= FNV1A_64_PRIME;
+    }
+
+    return hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Constructor
+// sizeClass - the largest width or height of the generated thumbnails.
+//
+ThumbnailCache::ThumbnailCache( uint32_t sizeClass )
+: m_SizeClass( sizeClass )
+{
+    HELIUM_ASSERT( m_SizeClass > 0 );
+
+    Helium::GetPreferencesDirectory( m_Directory );
+    m_Directory += TXT( "ThumbnailCache/" );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Destructor
+//
+ThumbnailCache::~ThumbnailCache()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Get the thumbnail for a source image, reading it from the cache if the same
+// contents were seen before and generating (and caching) it otherwise.  Safe to
+// call from multiple threads at once.
+//
+bool ThumbnailCache::GetThumbnail( const Helium::FilePath& sourcePath, Image& rThumbnail ) const
+{
+    // The whole file is needed to decode it anyway, and hashing it is far cheaper than decoding it
+    DynamicArray< uint8_t > contents;
+    if ( !ReadFileContents( sourcePath, contents ) )
+    {
+        return false;
+    }
+
+    Helium::FilePath cachePath = GetCachePath( HashContents( contents.GetData(), contents.GetSize() ) );
+    if ( Read( cachePath, rThumbnail ) )
+    {
+        return true;
+    }
+
+    Image sourceImage;
+    bool loaded;
+
+    {
+        StaticMemoryStream sourceStream( contents.GetData(), contents.GetSize() );
+        if ( sourcePath.Extension() == TXT( "png" ) )
+        {
+            loaded = PngImageLoader::Load( sourceImage, &sourceStream );
+        }
+        else
+        {
+            loaded = TgaImageLoader::Load( sourceImage, &sourceStream );
+        }
+    }
+
+    contents.Clear();
+
+    if ( !loaded )
+    {
+        HELIUM_TRACE( TraceLevels::Warning, TXT( "ThumbnailCache: Failed to load source image \"%s\".\n" ), sourcePath.c_str() );
+        return false;
+    }
+
+    Image thumbnail;
+    if ( !sourceImage.Convert( thumbnail, GetBgraFormat() ) )
+    {
+        return false;
+    }
+
+    sourceImage.Unload();
+
+    Image downsampled;
+    while ( thumbnail.GetWidth() > m_SizeClass || thumbnail.GetHeight() > m_SizeClass )
+    {
+        Downsample( thumbnail, downsampled );
+        thumbnail.Swap( downsampled );
+    }
+
+    if ( !Write( cachePath, thumbnail ) )
+    {
+        HELIUM_TRACE( TraceLevels::Warning, TXT( "ThumbnailCache: Failed to write \"%s\".\n" ), cachePath.c_str() );
+    }
+
+    rThumbnail.Swap( thumbnail );
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Get whether a file is an image the cache can generate thumbnails for.
+//
+bool ThumbnailCache::IsSupportedImage( const Helium::FilePath& path )
+{
+    std::string extension = path.Extension();
+    return extension == TXT( "png" ) || extension == TXT( "tga" );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Halve a 32-bit image in each dimension, averaging each 2x2 block of pixels.
+// Odd edges are clamped so a 1 pixel wide or tall image stays 1 pixel.
+//
+void ThumbnailCache::Downsample( const Image& rSource, Image& rDestination )
+{
+    HELIUM_ASSERT( rSource.GetFormat().GetBytesPerPixel() == 4 );
+
+    uint32_t sourceWidth = rSource.GetWidth();
+    uint32_t sourceHeight = rSource.GetHeight();
+    uint32_t sourcePitch = rSource.GetPitch();
+
+    Image::InitParameters parameters;
+    parameters.format = rSource.GetFormat();
+    parameters.width = Max< uint32_t >( sourceWidth / 2, 1 );
+    parameters.height = Max< uint32_t >( sourceHeight / 2, 1 );
+    HELIUM_VERIFY( rDestination.Initialize( parameters ) );
+
+    uint32_t destWidth = rDestination.GetWidth();
+    uint32_t destHeight = rDestination.GetHeight();
+    uint32_t destPitch = rDestination.GetPitch();
+
+#if HELIUM_SIMD_SSE
+    // Each SIMD iteration reads 4 source pixels from each row and writes 2, so it can only run over whole blocks
+    uint32_t simdWidth = ( sourceWidth / 4 ) * 2;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16( 2 );
+#endif
+
+    const uint8_t* pSource = static_cast< const uint8_t* >( rSource.GetPixelData() );
+    uint8_t* pDest = static_cast< uint8_t* >( rDestination.GetPixelData() );
+
+    for ( uint32_t y = 0; y < destHeight; ++y )
+    {
+        const uint8_t* pRow0 = pSource + ( 2 * y ) * sourcePitch;
+        const uint8_t* pRow1 = pSource + Min( 2 * y + 1, sourceHeight - 1 ) * sourcePitch;
+        uint8_t* pDestRow = pDest + y * destPitch;
+
+        uint32_t x = 0;
+
+#if HELIUM_SIMD_SSE
+        for ( ; x < simdWidth; x += 2 )
+        {
+            __m128i row0 = _mm_loadu_si128( reinterpret_cast< const __m128i* >( pRow0 + x * 8 ) );
+            __m128i row1 = _mm_loadu_si128( reinterpret_cast< const __m128i* >( pRow1 + x * 8 ) );
+
+            // Sum vertically in 16 bits, pixels 0 and 1 in the low half, 2 and 3 in the high half
+            __m128i sumLow = _mm_add_epi16( _mm_unpacklo_epi8( row0, zero ), _mm_unpacklo_epi8( row1, zero ) );
+            __m128i sumHigh = _mm_add_epi16( _mm_unpackhi_epi8( row0, zero ), _mm_unpackhi_epi8( row1, zero ) );
+
+            // Sum horizontally, leaving each output pixel in the low 64 bits
+            sumLow = _mm_add_epi16( sumLow, _mm_srli_si128( sumLow, 8 ) );
+            sumHigh = _mm_add_epi16( sumHigh, _mm_srli_si128( sumHigh, 8 ) );
+
+            __m128i sum = _mm_unpacklo_epi64( sumLow, sumHigh );
+            sum = _mm_srli_epi16( _mm_add_epi16( sum, bias ), 2 );
+
+            _mm_storel_epi64( reinterpret_cast< __m128i* >( pDestRow + x * 4 ), _mm_packus_epi16( sum, zero ) );
+        }
+#endif
+
+        for ( ; x < destWidth; ++x )
+        {
+            const uint8_t* pPixel00 = pRow0 + ( 2 * x ) * 4;
+            const uint8_t* pPixel01 = pRow0 + Min( 2 * x + 1, sourceWidth - 1 ) * 4;
+            const uint8_t* pPixel10 = pRow1 + ( 2 * x ) * 4;
+            const uint8_t* pPixel11 = pRow1 + Min( 2 * x + 1, sourceWidth - 1 ) * 4;
+
+            for ( uint32_t channel = 0; channel < 4; ++channel )
+            {
+                uint32_t sum = pPixel00[ channel ] + pPixel01[ channel ] + pPixel10[ channel ] + pPixel11[ channel ];
+                pDestRow[ x * 4 + channel ] = static_cast< uint8_t >( ( sum + 2 ) / 4 );
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Get the cache file for the given source contents at this size class.
+//
+Helium::FilePath ThumbnailCache::GetCachePath( uint64_t contentHash ) const
+{
+    tchar_t fileName[ 64 ];
+    StringPrint( fileName, TXT( "%016" ) PRIx64 TXT( "_%" ) PRIu32 TXT( ".thumb" ), contentHash, m_SizeClass );
+
+    Helium::FilePath cachePath( m_Directory );
+    cachePath += fileName;
+
+    return cachePath;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Read a cached thumbnail, returns false if it is missing or incomplete.
+//
+bool ThumbnailCache::Read( const Helium::FilePath& cachePath, Image& rThumbnail ) const
+{
+    if ( !cachePath.Exists() )
+    {
+        return false;
+    }
+
+    FileStream* pFileStream = FileStream::OpenFileStream( cachePath.c_str(), FileStream::MODE_READ );
+    if ( !pFileStream )
+    {
+        return false;
+    }
+
+    ThumbnailCacheHeader header;
+    bool valid = pFileStream->Read( &header, sizeof( header ), 1 ) == 1 &&
+        header.m_Magic == THUMBNAIL_CACHE_MAGIC &&
+        header.m_Version == THUMBNAIL_CACHE_VERSION &&
+        header.m_Width > 0 && header.m_Width <= m_SizeClass &&
+        header.m_Height > 0 && header.m_Height <= m_SizeClass;
+
+    if ( valid )
+    {
+        Image::InitParameters parameters;
+        parameters.format = GetBgraFormat();
+        parameters.width = header.m_Width;
+        parameters.height = header.m_Height;
+        valid = rThumbnail.Initialize( parameters );
+    }
+
+    // Rows are written packed, a short read means another thread or session was interrupted writing it
+    if ( valid )
+    {
+        uint8_t* pPixels = static_cast< uint8_t* >( rThumbnail.GetPixelData() );
+        size_t rowSize = header.m_Width * 4;
+        for ( uint32_t y = 0; y < header.m_Height && valid; ++y )
+        {
+            valid = pFileStream->Read( pPixels + y * rThumbnail.GetPitch(), 1, rowSize ) == rowSize;
+        }
+    }
+
+    delete pFileStream;
+
+    if ( !valid )
+    {
+        rThumbnail.Unload();
+    }
+
+    return valid;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Write a thumbnail to the cache.
+//
+bool ThumbnailCache::Write( const Helium::FilePath& cachePath, const Image& rThumbnail ) const
+{
+    if ( !cachePath.MakePath() )
+    {
+        return false;
+    }
+
+    FileStream* pFileStream = FileStream::OpenFileStream( cachePath.c_str(), FileStream::MODE_WRITE, true );
+    if ( !pFileStream )
+    {
+        return false;
+    }
+
+    ThumbnailCacheHeader header;
+    header.m_Magic = THUMBNAIL_CACHE_MAGIC;
+    header.m_Version = THUMBNAIL_CACHE_VERSION;
+    header.m_Width = rThumbnail.GetWidth();
+    header.m_Height = rThumbnail.GetHeight();
+
+    bool written = pFileStream->Write( &header, sizeof( header ), 1 ) == 1;
+
+    const uint8_t* pPixels = static_cast< const uint8_t* >( rThumbnail.GetPixelData() );
+    size_t rowSize = header.m_Width * 4;
+    for ( uint32_t y = 0; y < header.m_Height && written; ++y )
+    {
+        written = pFileStream->Write( pPixels + y * rThumbnail.GetPitch(), 1, rowSize ) == rowSize;
+    }
+
+    delete pFileStream;
+
+    return written;
+}
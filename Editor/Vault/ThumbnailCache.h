@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Foundation/FilePath.h"
+
+#include "EditorSupport/Image.h"
+
+namespace Helium
+{
+    namespace Editor
+    {
+        //
+        // Thumbnail cache generates small BGRA thumbnails from source images on the CPU and keeps them on disk, keyed
+        // by a hash of the source file contents and the thumbnail size class, so each image is only decoded once
+        //
+
+        class ThumbnailCache
+        {
+        public:
+            /// Default maximum thumbnail width and height, in pixels.
+            static const uint32_t DEFAULT_SIZE_CLASS = 128;
+
+            ThumbnailCache( uint32_t sizeClass = DEFAULT_SIZE_CLASS );
+            ~ThumbnailCache();
+
+            inline uint32_t GetSizeClass() const
+            {
+                return m_SizeClass;
+            }
+
+            bool GetThumbnail( const Helium::FilePath& sourcePath, Image& rThumbnail ) const;
+
+            static bool IsSupportedImage( const Helium::FilePath& path );
+            static void Downsample( const Image& rSource, Image& rDestination );
+
+        private:
+            Helium::FilePath GetCachePath( uint64_t contentHash ) const;
+            bool Read( const Helium::FilePath& cachePath, Image& rThumbnail ) const;
+            bool Write( const Helium::FilePath& cachePath, const Image& rThumbnail ) const;
+
+            Helium::FilePath m_Directory;   // Directory the cached thumbnails are stored in
+            uint32_t         m_SizeClass;   // Maximum thumbnail width and height
+        };
+    }
+}
@@ -3,12 +3,14 @@
 
 #include "Foundation/DirectoryIterator.h"
 #include "SceneGraph/DeviceManager.h"
-#include "SceneGraph/Render.h"
 
 using namespace Helium;
 using namespace Helium::SceneGraph;
 using namespace Helium::Editor;
 
+// Upper bound on the number of threads generating thumbnails at once
+static const int MAX_LOAD_THREADS = 4;
+
 void* ThumbnailLoader::LoadThread::Entry()
 {
 #ifdef HELIUM_ASSERT_ENABLED
@@ -24,35 +26,6 @@ void* ThumbnailLoader::LoadThread::Entry()
             break;
         }
 
-#ifdef VIEWPORT_REFACTOR
-        // the device is gone, our glorious benefactor is probably cleaning up
-        IDirect3DDevice9* device = m_Loader.m_DeviceManager->GetD3DDevice();
-        if ( !device )
-        {
-            // You should stop this thread before letting go of the window that
-            // owns the device.
-            HELIUM_BREAK();
-            break;
-        }
-
-        // while the device is lost, just wait for it to come back
-        while ( device->TestCooperativeLevel() != D3D_OK )
-        {
-            if ( m_Loader.m_Quit )
-            {
-                break;
-            }
-
-            wxThread::Sleep( 100 );
-            continue;
-        }
-#endif
-
-        if ( m_Loader.m_Quit )
-        {
-            break;
-        }
-
         Helium::FilePath path;
 
         {
@@ -82,88 +55,93 @@ void* ThumbnailLoader::LoadThread::Entry()
         args.m_Path = path;
         args.m_Cancelled = false;
 
-#ifdef VIEWPORT_REFACTOR
-        if ( SceneGraph::IsSupportedTexture( path.Get() ) )
+        m_Loader.LoadThumbnail( path, args.m_Textures );
+
+        m_Loader.m_Result.Raise( args );
+    }
+
+    return NULL;
+}
+
+bool ThumbnailLoader::LoadThumbnail( const Helium::FilePath& path, V_ThumbnailPtr& thumbnails ) const
+{
+    Image image;
+
+    if ( ThumbnailCache::IsSupportedImage( path ) )
+    {
+        if ( m_Cache.GetThumbnail( path, image ) )
         {
-            IDirect3DTexture9* texture = NULL;
-            if ( texture = LoadTexture( device, path.Get() ) )
-            {
-                ThumbnailPtr thumbnail = new Thumbnail( m_Loader.m_DeviceManager, texture );
-                args.m_Textures.push_back( thumbnail );
-            }
+            thumbnails.push_back( new Thumbnail( m_DeviceManager, image ) );
         }
-        else
-#endif
-        {
+    }
+    else
+    {
 #pragma TODO( "When we store the thumbnail in the asset file, fix this." )
 
-            if ( path.Extension() == TXT( "HeliumEntity" ) )
-            {
-                FilePath thumbnailPath( path.Directory() + path.Basename() + TXT( "_thumbnail.png" ) );
+        if ( path.Extension() == TXT( "HeliumEntity" ) )
+        {
+            FilePath thumbnailPath( path.Directory() + path.Basename() + TXT( "_thumbnail.png" ) );
 
-                if ( thumbnailPath.Exists() )
-                {
-#ifdef VIEWPORT_REFACTOR
-                    IDirect3DTexture9* texture = NULL;
-                    if ( texture = LoadTexture( device, thumbnailPath.Get() ) )
-                    {
-                        ThumbnailPtr thumbnail = new Thumbnail( m_Loader.m_DeviceManager, texture );
-                        args.m_Textures.push_back( thumbnail );
-                    }
-#endif
-                }
-            }
-            // Include the color map of a shader as a possible thumbnail image
-            else if ( path.Extension() == TXT( "HeliumShader" ) )
+            if ( thumbnailPath.Exists() && m_Cache.GetThumbnail( thumbnailPath, image ) )
             {
-#ifdef VIEWPORT_REFACTOR
-                if ( colorMap->GetContentPath().Exists() && SceneGraph::IsSupportedTexture( colorMap->GetContentPath().Get() ) )
-                {
-                    IDirect3DTexture9* texture = NULL;
-                    if ( texture = LoadTexture( device, colorMap->GetContentPath().Get() ) )
-                    {
-                        ThumbnailPtr thumbnail = new Thumbnail( m_Loader.m_DeviceManager, texture );
-                        args.m_Textures.push_back( thumbnail );
-                    }
-                }
-#endif
+                thumbnails.push_back( new Thumbnail( m_DeviceManager, image ) );
             }
-            else if ( path.Extension() == TXT( "HeliumTexture" ) )
-            {
+        }
+        // Include the color map of a shader as a possible thumbnail image
+        else if ( path.Extension() == TXT( "HeliumShader" ) )
+        {
 #ifdef VIEWPORT_REFACTOR
-                if ( textureAsset->GetContentPath().Exists() && SceneGraph::IsSupportedTexture( textureAsset->GetContentPath().Get() ) )
-                {
-                    IDirect3DTexture9* texture = NULL;
-                    if ( texture = LoadTexture( device, textureAsset->GetContentPath().Get() ) )
-                    {
-                        ThumbnailPtr thumbnail = new Thumbnail( m_Loader.m_DeviceManager, texture );
-                        args.m_Textures.push_back( thumbnail );
-                    }
-                }
+            if ( colorMap->GetContentPath().Exists() && ThumbnailCache::IsSupportedImage( colorMap->GetContentPath() ) && m_Cache.GetThumbnail( colorMap->GetContentPath(), image ) )
+            {
+                thumbnails.push_back( new Thumbnail( m_DeviceManager, image ) );
+            }
 #endif
+        }
+        else if ( path.Extension() == TXT( "HeliumTexture" ) )
+        {
+#ifdef VIEWPORT_REFACTOR
+            if ( textureAsset->GetContentPath().Exists() && ThumbnailCache::IsSupportedImage( textureAsset->GetContentPath() ) && m_Cache.GetThumbnail( textureAsset->GetContentPath(), image ) )
+            {
+                thumbnails.push_back( new Thumbnail( m_DeviceManager, image ) );
             }
+#endif
         }
-
-        m_Loader.m_Result.Raise( args );
     }
 
-    return NULL;
+    return !thumbnails.empty();
 }
 
 ThumbnailLoader::ThumbnailLoader( DeviceManager* d3dManager )
-: m_LoadThread( *this )
-, m_Quit( false )
+: m_Quit( false )
 , m_DeviceManager( d3dManager )
 {
-    m_LoadThread.Create();
-    m_LoadThread.Run();
+    // Leave a core for the UI, decoding is the bottleneck and each thread works on its own file
+    int threadCount = wxThread::GetCPUCount() - 1;
+    threadCount = Max( 1, Min( threadCount, MAX_LOAD_THREADS ) );
+
+    for ( int i = 0; i < threadCount; ++i )
+    {
+        LoadThread* thread = new LoadThread( *this );
+        thread->Create();
+        thread->Run();
+        m_LoadThreads.push_back( thread );
+    }
 }
 
 ThumbnailLoader::~ThumbnailLoader()
 {
     m_Quit = true;
-    m_Signal.Increment();
-    m_LoadThread.Wait();
+
+    for ( size_t i = 0; i < m_LoadThreads.size(); ++i )
+    {
+        m_Signal.Increment();
+    }
+
+    for ( std::vector< LoadThread* >::const_iterator itr = m_LoadThreads.begin(), end = m_LoadThreads.end(); itr != end; ++itr )
+    {
+        (*itr)->Wait();
+        delete *itr;
+    }
 }
 
 void ThumbnailLoader::Enqueue( const std::set< Helium::FilePath >& files )
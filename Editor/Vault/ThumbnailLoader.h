@@ -9,13 +9,15 @@
 #include "SceneGraph/DeviceManager.h"
 
 #include "Editor/Vault/Thumbnail.h"
+#include "Editor/Vault/ThumbnailCache.h"
 
 namespace Helium
 {
     namespace Editor
     {
         //
-        // Thumbnail loader loads textures in a thread and notifies results in that background thread via an event
+        // Thumbnail loader generates thumbnails on a pool of worker threads (through the on-disk thumbnail cache) and
+        // notifies results in those background threads via an event
         //
 
         class ThumbnailLoader
@@ -68,8 +70,12 @@ namespace Helium
 
             private:
                 ThumbnailLoader& m_Loader;
-            } m_LoadThread; // The loading thread object
+            };
+
+            bool LoadThumbnail( const Helium::FilePath& path, V_ThumbnailPtr& thumbnails ) const;
 
+            std::vector< LoadThread* >                              m_LoadThreads; // The loading thread objects
+            ThumbnailCache                                          m_Cache; // Generates and stores the thumbnail images
             Helium::Locker< Helium::OrderedSet< Helium::FilePath > >    m_FileQueue; // The queue of files to load (mutex locked)
             Helium::Semaphore                                       m_Signal; // Signalling semaphore to wake up load thread
             bool                                                    m_Quit;
@@ -154,6 +154,7 @@ void VaultPanel::Search( const std::string& queryString )
     }
 
     m_VaultSearch.SetProject( wxGetApp().GetFrame()->GetProject() );
+    m_VaultSearch.SetSearchIndex( wxGetApp().GetTracker()->GetSearchIndex() );
     m_VaultSearch.StartSearchThread( query );
 }
 
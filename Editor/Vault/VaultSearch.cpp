@@ -158,6 +158,7 @@ namespace Helium
 /////////////////////////////////////////////////////////////////////////////
 VaultSearch::VaultSearch( Project* project )
 : m_Project( project )
+, m_SearchIndex( NULL )
 , m_SearchResults( NULL )
 , m_StopSearching( true )
 , m_DummyWindow( NULL )
@@ -189,6 +190,11 @@ void VaultSearch::SetProject( Project* project )
     m_Project = project;
 }
 
+void VaultSearch::SetSearchIndex( const VaultSearchIndex* searchIndex )
+{
+    m_SearchIndex = searchIndex;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Creates and starts the VaultSearchThread
 //
@@ -321,55 +327,36 @@ void VaultSearch::SearchThreadProc( int32_t searchID )
 
     SearchThreadEnter( searchID );
 
-#ifdef TRACKER_REFACTOR
-    TrackerDBGenerated trackerDB( TXT( "sqlite3" ), dbSpec.c_str() );
-
-    // create tables, sequences and indexes
-    trackerDB.verbose = true;
-
-    if ( !m_Project->GetTrackerDB().Exists() )
+    // the tracker keeps the index current, so a search is a few posting list intersections rather than a scan
+    if ( m_SearchIndex )
     {
-        trackerDB.create();
-    }
-
-    if ( trackerDB.needsUpgrade() )
-    {
-        trackerDB.upgrade();
-    }
+        std::vector< VaultSearchIndex::Match > matches;
+        m_SearchIndex->Query( m_CurrentSearchQuery->GetQueryString(), matches );
 
-    if ( CheckSearchThreadLeave( searchID ) )
-    {
-        return;
-    }
-
-    std::vector<TrackedFile> assetFiles = litesql::select<TrackedFile>( trackerDB, TrackedFile::MPath.like( m_CurrentSearchQuery->GetSQLQueryString().c_str() ) ).all();
+        if ( CheckSearchThreadLeave( searchID ) )
+        {
+            return;
+        }
 
-    {
         Helium::MutexScopeLock mutex (m_SearchResultsMutex);
 
         m_FoundFiles.clear();
 
-        for ( std::vector< TrackedFile >::const_iterator itr = assetFiles.begin(), end = assetFiles.end(); itr != end; ++itr )
+        for ( std::vector< VaultSearchIndex::Match >::const_iterator itr = matches.begin(), end = matches.end(); itr != end; ++itr )
         {
-            m_FoundFiles.insert( (*itr) );
-
-            if ( CheckSearchThreadLeave( searchID ) )
-            {
-                m_FoundFiles.clear();
-                return;
-            }
+            TrackedFile file;
+            file.m_Path = itr->m_Path;
+            file.m_Rank = itr->m_Rank;
+            m_FoundFiles.insert( file );
         }
 
         m_SearchResults->SetResults( m_FoundFiles );
     }
 
-    assetFiles.clear();
-
     if ( CheckSearchThreadLeave( searchID ) )
     {
         return;
     }
-#endif
 
     SearchThreadLeave( searchID );
 }
@@ -446,7 +433,7 @@ uint32_t VaultSearch::Add( const TrackedFile& file, int32_t searchID )
     MutexScopeLock mutex (m_SearchResultsMutex);
 
 #ifdef TRACKER_REFACTOR
-    HELIUM_ASSERT( !FilePath( file.mPath.value() ).IsDirectory() );
+    HELIUM_ASSERT( !file.m_Path.IsDirectory() );
 
     std::pair< std::set< TrackedFile >::const_iterator, bool > inserted = m_FoundFiles.insert( file );
     if ( m_SearchResults && inserted.second )
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "VaultSearchIndex.h"
 #include "VaultSearchQuery.h"
 #include "VaultSearchResults.h"
 
@@ -107,6 +108,7 @@ namespace Helium
             virtual ~VaultSearch();
 
             void SetProject( Project* project );
+            void SetSearchIndex( const VaultSearchIndex* searchIndex );
 
             bool StartSearchThread( VaultSearchQuery* searchQuery );
             void StopSearchThreadAndWait();
@@ -115,6 +117,7 @@ namespace Helium
 
         private:
             Project* m_Project;
+            const VaultSearchIndex* m_SearchIndex;
 
             //----------DO NOT ACCESS outside of m_SearchResultsMutex---------//
             // VaultSearchResults and Status
@@ -0,0 +1,393 @@
+#include "EditorPch.h"
+#include "VaultSearchIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+using namespace Helium;
+using namespace Helium::Editor;
+
+// rank tiers for where a query word matched, best first
+static const uint32_t s_RankFileNamePrefix = 0;
+static const uint32_t s_RankFileName = 1;
+static const uint32_t s_RankDirectory = 2;
+static const uint32_t s_RankMetadata = 3;
+static const uint32_t s_RankTierScale = 0x10000; // shorter paths break ties within a tier
+
+static inline void ToSearchText( std::string& text )
+{
+    for ( std::string::iterator itr = text.begin(), end = text.end(); itr != end; ++itr )
+    {
+        char c = static_cast< char >( tolower( static_cast< unsigned char >( *itr ) ) );
+        *itr = ( c == '\\' ) ? '/' : c;
+    }
+}
+
+static bool SortPostingsBySize( const std::vector< uint32_t >* lhs, const std::vector< uint32_t >* rhs )
+{
+    return lhs->size() < rhs->size();
+}
+
+static bool SortMatchesByRank( const VaultSearchIndex::Match& lhs, const VaultSearchIndex::Match& rhs )
+{
+    return ( lhs.m_Rank != rhs.m_Rank ) ? ( lhs.m_Rank < rhs.m_Rank ) : ( lhs.m_Path < rhs.m_Path );
+}
+
+// find the fragments of a pattern in order within [begin, end) of text, returns the offset of the first one
+static size_t FindPattern( const std::string& text, const std::vector< std::string >& pattern, size_t begin, size_t end )
+{
+    size_t first = std::string::npos;
+    size_t offset = begin;
+    for ( std::vector< std::string >::const_iterator itr = pattern.begin(), itrEnd = pattern.end(); itr != itrEnd; ++itr )
+    {
+        size_t found = text.find( *itr, offset );
+        if ( found == std::string::npos || found + itr->length() > end )
+        {
+            return std::string::npos;
+        }
+
+        if ( first == std::string::npos )
+        {
+            first = found;
+        }
+        offset = found + itr->length();
+    }
+
+    return first;
+}
+
+VaultSearchIndex::VaultSearchIndex()
+: m_NextFileId( 0 )
+{
+}
+
+VaultSearchIndex::~VaultSearchIndex()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Paths are indexed relative to the root, so the project directory shared by
+//  every file doesn't bloat the posting lists or match every query
+void VaultSearchIndex::SetRoot( const std::string& directory )
+{
+    MutexScopeLock mutex( m_Mutex );
+
+    m_Root = directory;
+    ToSearchText( m_Root );
+}
+
+void VaultSearchIndex::Clear()
+{
+    MutexScopeLock mutex( m_Mutex );
+
+    m_Files.clear();
+    m_FileIds.clear();
+    m_Postings.clear();
+    m_NextFileId = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Adds a file, or updates it if it's already indexed
+void VaultSearchIndex::Add( const FilePath& path, const std::string& metadata )
+{
+    IndexedFile file;
+    file.m_Path = path;
+    file.m_Text = path.Get();
+    ToSearchText( file.m_Text );
+
+    MutexScopeLock mutex( m_Mutex );
+
+    if ( !m_Root.empty() && file.m_Text.compare( 0, m_Root.length(), m_Root ) == 0 )
+    {
+        file.m_Text.erase( 0, m_Root.length() );
+    }
+
+    size_t slash = file.m_Text.rfind( '/' );
+    file.m_NameOffset = ( slash == std::string::npos ) ? 0 : slash + 1;
+    file.m_PathLength = file.m_Text.length();
+
+    if ( !metadata.empty() )
+    {
+        std::string searchMetadata = metadata;
+        ToSearchText( searchMetadata );
+        file.m_Text += '\n';
+        file.m_Text += searchMetadata;
+    }
+
+    std::map< std::string, FileId >::iterator idItr = m_FileIds.find( path.Get() );
+    if ( idItr != m_FileIds.end() )
+    {
+        std::map< FileId, IndexedFile >::iterator fileItr = m_Files.find( idItr->second );
+        HELIUM_ASSERT( fileItr != m_Files.end() );
+
+        // rescans re-add every file, only reindex what actually changed
+        if ( fileItr->second.m_Text == file.m_Text )
+        {
+            return;
+        }
+
+        RemoveFile( fileItr );
+    }
+
+    GetTrigrams( file.m_Text, file.m_Trigrams );
+
+    FileId id = m_NextFileId++;
+    for ( std::vector< Trigram >::const_iterator itr = file.m_Trigrams.begin(), end = file.m_Trigrams.end(); itr != end; ++itr )
+    {
+        m_Postings[ *itr ].push_back( id );
+    }
+
+    m_FileIds[ path.Get() ] = id;
+    m_Files[ id ] = file;
+}
+
+bool VaultSearchIndex::Remove( const FilePath& path )
+{
+    MutexScopeLock mutex( m_Mutex );
+
+    std::map< std::string, FileId >::iterator idItr = m_FileIds.find( path.Get() );
+    if ( idItr == m_FileIds.end() )
+    {
+        return false;
+    }
+
+    std::map< FileId, IndexedFile >::iterator fileItr = m_Files.find( idItr->second );
+    HELIUM_ASSERT( fileItr != m_Files.end() );
+    RemoveFile( fileItr );
+
+    return true;
+}
+
+size_t VaultSearchIndex::GetFileCount() const
+{
+    MutexScopeLock mutex( m_Mutex );
+
+    return m_Files.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Intersects the posting lists of every trigram in the query, smallest first,
+//  then checks the surviving candidates against the query words to confirm
+//  the match (trigrams don't capture order) and rank it
+bool VaultSearchIndex::Query( const std::string& queryString, std::vector< Match >& matches, size_t maxMatches ) const
+{
+    matches.clear();
+
+    std::vector< Pattern > patterns;
+    ParseQuery( queryString, patterns );
+    if ( patterns.empty() )
+    {
+        return false;
+    }
+
+    std::vector< Trigram > queryTrigrams;
+    for ( std::vector< Pattern >::const_iterator patternItr = patterns.begin(), patternEnd = patterns.end(); patternItr != patternEnd; ++patternItr )
+    {
+        for ( Pattern::const_iterator itr = patternItr->begin(), end = patternItr->end(); itr != end; ++itr )
+        {
+            GetTrigrams( *itr, queryTrigrams );
+        }
+    }
+
+    MutexScopeLock mutex( m_Mutex );
+
+    std::vector< FileId > candidates;
+    if ( queryTrigrams.empty() )
+    {
+        // words shorter than a trigram can't narrow the search, check every file
+        candidates.reserve( m_Files.size() );
+        for ( std::map< FileId, IndexedFile >::const_iterator itr = m_Files.begin(), end = m_Files.end(); itr != end; ++itr )
+        {
+            candidates.push_back( itr->first );
+        }
+    }
+    else
+    {
+        std::vector< const std::vector< FileId >* > postings;
+        postings.reserve( queryTrigrams.size() );
+        for ( std::vector< Trigram >::const_iterator itr = queryTrigrams.begin(), end = queryTrigrams.end(); itr != end; ++itr )
+        {
+            std::map< Trigram, std::vector< FileId > >::const_iterator found = m_Postings.find( *itr );
+            if ( found == m_Postings.end() )
+            {
+                return false;
+            }
+            postings.push_back( &found->second );
+        }
+
+        // the shortest list bounds the result, start there so every step is as cheap as possible
+        std::sort( postings.begin(), postings.end(), SortPostingsBySize );
+
+        candidates = *postings[ 0 ];
+        std::vector< FileId > intersection;
+        for ( size_t i = 1; i < postings.size() && !candidates.empty(); ++i )
+        {
+            intersection.clear();
+            std::set_intersection( candidates.begin(), candidates.end(), postings[ i ]->begin(), postings[ i ]->end(), std::back_inserter( intersection ) );
+            candidates.swap( intersection );
+        }
+    }
+
+    for ( std::vector< FileId >::const_iterator candidateItr = candidates.begin(), candidateEnd = candidates.end(); candidateItr != candidateEnd; ++candidateItr )
+    {
+        std::map< FileId, IndexedFile >::const_iterator fileItr = m_Files.find( *candidateItr );
+        HELIUM_ASSERT( fileItr != m_Files.end() );
+        const IndexedFile& file = fileItr->second;
+
+        uint32_t rank = 0;
+        bool matched = true;
+        for ( std::vector< Pattern >::const_iterator patternItr = patterns.begin(), patternEnd = patterns.end(); matched && patternItr != patternEnd; ++patternItr )
+        {
+            uint32_t patternRank = 0;
+            matched = MatchPattern( file, *patternItr, patternRank );
+            rank += patternRank;
+        }
+
+        if ( matched )
+        {
+            Match match;
+            match.m_Path = file.m_Path;
+            match.m_Rank = rank * s_RankTierScale + static_cast< uint32_t >( std::min< size_t >( file.m_PathLength, s_RankTierScale - 1 ) );
+            matches.push_back( match );
+        }
+    }
+
+    std::sort( matches.begin(), matches.end(), SortMatchesByRank );
+    if ( maxMatches && matches.size() > maxMatches )
+    {
+        matches.resize( maxMatches );
+    }
+
+    return !matches.empty();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Splits the query into lower case words (or double quoted phrases), and each
+//  of those into the literal fragments between '*' wildcards
+void VaultSearchIndex::ParseQuery( const std::string& queryString, std::vector< Pattern >& patterns )
+{
+    std::string text = queryString;
+    ToSearchText( text );
+
+    std::vector< std::string > words;
+    std::string word;
+    bool quoted = false;
+    for ( std::string::const_iterator itr = text.begin(), end = text.end(); itr != end; ++itr )
+    {
+        if ( *itr == '"' )
+        {
+            quoted = !quoted;
+        }
+        else if ( !quoted && isspace( static_cast< unsigned char >( *itr ) ) )
+        {
+            if ( !word.empty() )
+            {
+                words.push_back( word );
+                word.clear();
+            }
+        }
+        else
+        {
+            word += *itr;
+        }
+    }
+    if ( !word.empty() )
+    {
+        words.push_back( word );
+    }
+
+    for ( std::vector< std::string >::const_iterator wordItr = words.begin(), wordEnd = words.end(); wordItr != wordEnd; ++wordItr )
+    {
+        Pattern pattern;
+        size_t begin = 0;
+        while ( begin <= wordItr->length() )
+        {
+            size_t wildcard = wordItr->find( '*', begin );
+            if ( wildcard == std::string::npos )
+            {
+                wildcard = wordItr->length();
+            }
+
+            if ( wildcard > begin )
+            {
+                pattern.push_back( wordItr->substr( begin, wildcard - begin ) );
+            }
+            begin = wildcard + 1;
+        }
+
+        if ( !pattern.empty() )
+        {
+            patterns.push_back( pattern );
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Appends the trigrams of text, leaving the list sorted and unique
+void VaultSearchIndex::GetTrigrams( const std::string& text, std::vector< Trigram >& trigrams )
+{
+    for ( size_t i = 0; i + 3 <= text.length(); ++i )
+    {
+        trigrams.push_back(
+            ( static_cast< Trigram >( static_cast< unsigned char >( text[ i ] ) ) << 16 ) |
+            ( static_cast< Trigram >( static_cast< unsigned char >( text[ i + 1 ] ) ) << 8 ) |
+            static_cast< Trigram >( static_cast< unsigned char >( text[ i + 2 ] ) ) );
+    }
+
+    std::sort( trigrams.begin(), trigrams.end() );
+    trigrams.erase( std::unique( trigrams.begin(), trigrams.end() ), trigrams.end() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Matches are ranked by the best place the pattern was found: the start of
+//  the file name, anywhere in the file name, the directory, then metadata
+bool VaultSearchIndex::MatchPattern( const IndexedFile& file, const Pattern& pattern, uint32_t& rank )
+{
+    size_t found = FindPattern( file.m_Text, pattern, file.m_NameOffset, file.m_PathLength );
+    if ( found != std::string::npos )
+    {
+        rank = ( found == file.m_NameOffset ) ? s_RankFileNamePrefix : s_RankFileName;
+        return true;
+    }
+
+    if ( FindPattern( file.m_Text, pattern, 0, file.m_PathLength ) != std::string::npos )
+    {
+        rank = s_RankDirectory;
+        return true;
+    }
+
+    if ( file.m_Text.length() > file.m_PathLength
+        && FindPattern( file.m_Text, pattern, file.m_PathLength + 1, file.m_Text.length() ) != std::string::npos )
+    {
+        rank = s_RankMetadata;
+        return true;
+    }
+
+    return false;
+}
+
+void VaultSearchIndex::RemoveFile( std::map< FileId, IndexedFile >::iterator fileItr )
+{
+    FileId id = fileItr->first;
+    const IndexedFile& file = fileItr->second;
+
+    for ( std::vector< Trigram >::const_iterator itr = file.m_Trigrams.begin(), end = file.m_Trigrams.end(); itr != end; ++itr )
+    {
+        std::map< Trigram, std::vector< FileId > >::iterator posting = m_Postings.find( *itr );
+        HELIUM_ASSERT( posting != m_Postings.end() );
+
+        std::vector< FileId >& ids = posting->second;
+        std::vector< FileId >::iterator found = std::lower_bound( ids.begin(), ids.end(), id );
+        HELIUM_ASSERT( found != ids.end() && *found == id );
+        ids.erase( found );
+
+        if ( ids.empty() )
+        {
+            m_Postings.erase( posting );
+        }
+    }
+
+    m_FileIds.erase( file.m_Path.Get() );
+    m_Files.erase( fileItr );
+}
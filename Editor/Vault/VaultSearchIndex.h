@@ -0,0 +1,78 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Editor/API.h"
+
+#include "Foundation/FilePath.h"
+#include "Platform/Locks.h"
+#include "Platform/Types.h"
+
+namespace Helium
+{
+    namespace Editor
+    {
+        //
+        // In-memory trigram index over tracked file paths (relative to the project root) and their searchable
+        //  metadata.  The Tracker keeps it up to date as files are found, changed and removed, and searches intersect
+        //  the posting lists of the query's trigrams before checking the few remaining candidates, instead of scanning
+        //  every tracked file.  Safe to query from one thread while another updates it.
+        //
+
+        class VaultSearchIndex
+        {
+        public:
+            struct Match
+            {
+                Helium::FilePath m_Path;
+                uint32_t         m_Rank;    // lower is better
+            };
+
+            VaultSearchIndex();
+            ~VaultSearchIndex();
+
+            void SetRoot( const std::string& directory );
+            void Clear();
+
+            void Add( const Helium::FilePath& path, const std::string& metadata = std::string() );
+            bool Remove( const Helium::FilePath& path );
+            size_t GetFileCount() const;
+
+            // Query syntax matches the vault search field: whitespace separated words (or double quoted phrases) must
+            //  all match, '*' matches anything within a word.  Results are sorted by rank, at most maxMatches of them
+            //  (0 for no limit) are returned.
+            bool Query( const std::string& queryString, std::vector< Match >& matches, size_t maxMatches = 0 ) const;
+
+        private:
+            typedef uint32_t FileId;
+            typedef uint32_t Trigram;
+
+            struct IndexedFile
+            {
+                Helium::FilePath        m_Path;
+                std::string             m_Text;         // lower case path relative to the root, then metadata
+                size_t                  m_NameOffset;   // start of the file name in m_Text
+                size_t                  m_PathLength;   // length of the path part of m_Text
+                std::vector< Trigram >  m_Trigrams;     // sorted, unique
+            };
+
+            // a word from the query, split at each '*' into fragments that must appear in order
+            typedef std::vector< std::string > Pattern;
+
+            static void ParseQuery( const std::string& queryString, std::vector< Pattern >& patterns );
+            static void GetTrigrams( const std::string& text, std::vector< Trigram >& trigrams );
+            static bool MatchPattern( const IndexedFile& file, const Pattern& pattern, uint32_t& rank );
+
+            void RemoveFile( std::map< FileId, IndexedFile >::iterator fileItr );
+
+            mutable Helium::Mutex                       m_Mutex;
+            std::string                                 m_Root;
+            FileId                                      m_NextFileId;   // only grows, so posting lists stay sorted by appending
+            std::map< FileId, IndexedFile >             m_Files;
+            std::map< std::string, FileId >             m_FileIds;      // path -> id
+            std::map< Trigram, std::vector< FileId > >  m_Postings;     // trigram -> sorted ids of files containing it
+        };
+    }
+}
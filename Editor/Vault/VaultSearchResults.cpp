@@ -4,10 +4,15 @@
 using namespace Helium;
 using namespace Helium::Editor;
 
+// Result sets iterate in rank order
 bool Helium::Editor::operator<( const TrackedFile& lhs, const TrackedFile& rhs )
 {
-#pragma TODO("Implement this")
-    return true;
+    if ( lhs.m_Rank != rhs.m_Rank )
+    {
+        return lhs.m_Rank < rhs.m_Rank;
+    }
+
+    return lhs.m_Path < rhs.m_Path;
 }
 
 VaultSearchResults::VaultSearchResults( uint32_t vaultSearchID )
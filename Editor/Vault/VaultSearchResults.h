@@ -15,6 +15,10 @@ namespace Helium
 #pragma TODO("Define Tracked file as a db-serialized reflect object")
         struct TrackedFile
         {
+            Helium::FilePath m_Path;
+            uint32_t         m_Rank;    // search result rank, lower is better
+
+            TrackedFile() : m_Rank( 0 ) {}
         };
         bool operator<( const TrackedFile& lhs, const TrackedFile& rhs );
 
@@ -4,6 +4,8 @@
 
 #include "EditorSupport/FbxSupport.h"
 
+#include "EditorSupport/MeshProcessing.h"
+
 #include "MathSimd/Vector2.h"
 #include "Foundation/StringConverter.h"
 #include "Rendering/Color.h"
@@ -303,8 +305,8 @@ void FbxSupport::Release()
 bool FbxSupport::LoadMesh(
 						  const String& rSourceFilePath,
 						  DynamicArray< StaticMeshVertex< 1 > >& rVertices,
-						  DynamicArray< uint16_t >& rIndices,
-						  DynamicArray< uint16_t >& rSectionVertexCounts,
+						  DynamicArray< uint32_t >& rIndices,
+						  DynamicArray< uint32_t >& rSectionVertexCounts,
 						  DynamicArray< uint32_t >& rSectionTriangleCounts,
 						  DynamicArray< BoneData >& rBones,
 						  DynamicArray< BlendData >& rVertexBlendData,
@@ -554,7 +556,7 @@ void FbxSupport::BuildSkinningInformation(
 	FbxMesh* pMesh,
 	FbxNode* pSkeletonRootNode,
 	const DynamicArray< int >& rControlPointIndices,
-	const DynamicArray< uint16_t >& rSectionVertexCounts,
+	const DynamicArray< uint32_t >& rSectionVertexCounts,
 	DynamicArray< BoneData >& rBones,
 	DynamicArray< BlendData >& rVertexBlendData,
 	DynamicArray< uint8_t >& rSkinningPaletteMap,
@@ -1125,7 +1127,8 @@ void FbxSupport::RecursiveAddAnimationSkeletonData(
 ///
 /// @param[in]  pScene                  Scene to parse.
 /// @param[out] rVertices               Mesh vertices.
-/// @param[out] rIndices                Mesh vertex indices (three per triangle).
+/// @param[out] rIndices                Mesh vertex indices (three per triangle), relative to the first vertex of
+///                                     their section.
 /// @param[out] rSectionVertexCounts    Number of vertices addressed by each mesh section.
 /// @param[out] rSectionTriangleCounts  Number of triangles per mesh section.
 /// @param[out] rBones                  Information about each bone in the mesh (if the mesh contains skinning
@@ -1140,8 +1143,8 @@ void FbxSupport::RecursiveAddAnimationSkeletonData(
 bool FbxSupport::BuildMeshFromScene(
 									FbxScene* pScene,
 									DynamicArray< StaticMeshVertex< 1 > >& rVertices,
-									DynamicArray< uint16_t >& rIndices,
-									DynamicArray< uint16_t >& rSectionVertexCounts,
+									DynamicArray< uint32_t >& rIndices,
+									DynamicArray< uint32_t >& rSectionVertexCounts,
 									DynamicArray< uint32_t >& rSectionTriangleCounts,
 									DynamicArray< BoneData >& rBones,
 									DynamicArray< BlendData >& rVertexBlendData,
@@ -1309,15 +1312,18 @@ bool FbxSupport::BuildMeshFromScene(
 	}
 
 	DynamicArray< DynamicArray< StaticMeshVertex< 1 > > > sectionVertices;
-	DynamicArray< DynamicArray< uint16_t > > sectionVertexIndices;
+	DynamicArray< DynamicArray< uint32_t > > sectionVertexIndices;
 	DynamicArray< DynamicArray< int > > sectionControlPointIndices;
+	DynamicArray< VertexWelder > sectionWelders;
 
 	size_t totalVertexCount = 0;
 	size_t totalTriangleCount = 0;
 
 	size_t polygonsTriangulated = 0;
 
+	// Tangents are computed once all vertices are known, so leave them zeroed while welding.
 	StaticMeshVertex< 1 > vertex;
+	MemoryZero( &vertex, sizeof( vertex ) );
 
 	int meshVertexIndex = 0;
 	Float32 packedFloat;
@@ -1345,8 +1351,8 @@ bool FbxSupport::BuildMeshFromScene(
 			++polygonsTriangulated;
 		}
 
-		uint16_t vertexIndex0 = 0;
-		uint16_t vertexIndexPrev = 0;
+		uint32_t vertexIndex0 = 0;
+		uint32_t vertexIndexPrev = 0;
 
 		// Only use the material from the first vertex for the whole polygon.
 		int sectionIndex = 0;
@@ -1371,11 +1377,13 @@ bool FbxSupport::BuildMeshFromScene(
 			sectionVertices.Resize( newSectionCount );
 			sectionVertexIndices.Resize( newSectionCount );
 			sectionControlPointIndices.Resize( newSectionCount );
+			sectionWelders.Resize( newSectionCount );
 		}
 
 		DynamicArray< StaticMeshVertex< 1 > >& rCurrentSectionVertices = sectionVertices[ sectionIndex ];
-		DynamicArray< uint16_t >& rCurrentSectionIndices = sectionVertexIndices[ sectionIndex ];
+		DynamicArray< uint32_t >& rCurrentSectionIndices = sectionVertexIndices[ sectionIndex ];
 		DynamicArray< int >& rCurrentSectionControlPointIndices = sectionControlPointIndices[ sectionIndex ];
+		VertexWelder& rCurrentSectionWelder = sectionWelders[ sectionIndex ];
 
 		for( int_fast32_t polygonVertexIndex = 0;
 			polygonVertexIndex < polygonVertexCount;
@@ -1435,62 +1443,48 @@ bool FbxSupport::BuildMeshFromScene(
 				vertex.texCoords[ 0 ][ 1 ] = Float32To16( packedFloat );
 			}
 
-			size_t vertexCount = rCurrentSectionVertices.GetSize();
-			size_t vertexIndex;
-			for( vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+			// Note that when getting the position, we need to flip vertices across the x-axis manually since
+			// FbxAxisSystem::ConvertScene() doesn't actually modify the mesh data.
+			FbxVector4 position = pMesh->GetControlPointAt( controlPointIndex );
+			vertex.position[ 0 ] = -static_cast< float32_t >( position[ 0 ] );
+			vertex.position[ 1 ] = static_cast< float32_t >( position[ 1 ] );
+			vertex.position[ 2 ] = static_cast< float32_t >( position[ 2 ] );
+
+			// Vertices are only welded if they share the same control point, which keeps skinning influences intact.
+			bool bAdded;
+			uint32_t vertexIndex32 = rCurrentSectionWelder.Weld(
+				vertex,
+				static_cast< uint32_t >( controlPointIndex ),
+				bAdded );
+			if( bAdded )
 			{
-				const StaticMeshVertex< 1 >& rVertex = rCurrentSectionVertices[ vertexIndex ];
-				if( rCurrentSectionControlPointIndices[ vertexIndex ] == controlPointIndex &&
-					rVertex.normal[ 0 ] == vertex.normal[ 0 ] &&
-					rVertex.normal[ 1 ] == vertex.normal[ 1 ] &&
-					rVertex.normal[ 2 ] == vertex.normal[ 2 ] &&
-					rVertex.color == vertex.color &&
-					rVertex.texCoords[ 0 ][ 0 ].packed == vertex.texCoords[ 0 ][ 0 ].packed &&
-					rVertex.texCoords[ 0 ][ 1 ].packed == vertex.texCoords[ 0 ][ 1 ].packed )
-				{
-					break;
-				}
-			}
-
-			HELIUM_ASSERT( vertexIndex <= vertexCount );
-			HELIUM_ASSERT( vertexIndex <= UINT16_MAX );
-			if( vertexIndex >= vertexCount )
-			{
-				// Note that when getting the position, we need to flip vertices across the x-axis manually since
-				// FbxAxisSystem::ConvertScene() doesn't actually modify the mesh data.
-				FbxVector4 position = pMesh->GetControlPointAt( controlPointIndex );
-				vertex.position[ 0 ] = -static_cast< float32_t >( position[ 0 ] );
-				vertex.position[ 1 ] = static_cast< float32_t >( position[ 1 ] );
-				vertex.position[ 2 ] = static_cast< float32_t >( position[ 2 ] );
-
+				HELIUM_ASSERT( vertexIndex32 == rCurrentSectionVertices.GetSize() );
 				rCurrentSectionControlPointIndices.Push( controlPointIndex );
 				rCurrentSectionVertices.Push( vertex );
 
 				++totalVertexCount;
 			}
 
-			uint16_t vertexIndex16 = static_cast< uint16_t >( vertexIndex );
-
 			if( polygonVertexIndex > 1 )
 			{
 				// Reverse the triangle ordering when building the index list since we flipped the mesh across the
 				// x-axis.
 				rCurrentSectionIndices.Push( vertexIndex0 );
-				rCurrentSectionIndices.Push( vertexIndex16 );
+				rCurrentSectionIndices.Push( vertexIndex32 );
 				rCurrentSectionIndices.Push( vertexIndexPrev );
 
-				vertexIndexPrev = vertexIndex16;
+				vertexIndexPrev = vertexIndex32;
 
 				++totalTriangleCount;
 			}
 			else if( polygonVertexIndex == 0 )
 			{
-				vertexIndex0 = vertexIndex16;
+				vertexIndex0 = vertexIndex32;
 			}
 			else
 			{
 				HELIUM_ASSERT( polygonVertexIndex == 1 );
-				vertexIndexPrev = vertexIndex16;
+				vertexIndexPrev = vertexIndex32;
 			}
 		}
 	}
@@ -1522,15 +1516,15 @@ bool FbxSupport::BuildMeshFromScene(
 	for( size_t sectionIndex = 0; sectionIndex < meshSectionCount; ++sectionIndex )
 	{
 		const DynamicArray< StaticMeshVertex< 1 > >& rCurrentSectionVertices = sectionVertices[ sectionIndex ];
-		const DynamicArray< uint16_t >& rCurrentSectionIndices = sectionVertexIndices[ sectionIndex ];
+		const DynamicArray< uint32_t >& rCurrentSectionIndices = sectionVertexIndices[ sectionIndex ];
 		const DynamicArray< int >& rCurrentSectionControlPointIndices = sectionControlPointIndices[ sectionIndex ];
 
 		size_t sectionVertexCount = rCurrentSectionVertices.GetSize();
 		HELIUM_ASSERT( rCurrentSectionControlPointIndices.GetSize() == sectionVertexCount );
 		rVertices.AddArray( rCurrentSectionVertices.GetData(), sectionVertexCount );
 		controlPointIndices.AddArray( rCurrentSectionControlPointIndices.GetData(), sectionVertexCount );
-		HELIUM_ASSERT( sectionVertexCount <= UINT16_MAX );
-		rSectionVertexCounts.Push( static_cast< uint16_t >( sectionVertexCount ) );
+		HELIUM_ASSERT( sectionVertexCount <= UINT32_MAX );
+		rSectionVertexCounts.Push( static_cast< uint32_t >( sectionVertexCount ) );
 
 		size_t sectionIndexCount = rCurrentSectionIndices.GetSize();
 		rIndices.AddArray( rCurrentSectionIndices.GetData(), sectionIndexCount );
@@ -1542,6 +1536,7 @@ bool FbxSupport::BuildMeshFromScene(
 	sectionVertices.Clear();
 	sectionVertexIndices.Clear();
 	sectionControlPointIndices.Clear();
+	sectionWelders.Clear();
 
 	HELIUM_ASSERT( rVertices.GetSize() == totalVertexCount );
 	HELIUM_ASSERT( rIndices.GetSize() == totalTriangleCount * 3 );
@@ -118,8 +118,8 @@ namespace Helium
         /// @name Resource Loading
         //@{
         bool LoadMesh(
-            const String& rSourceFilePath, DynamicArray< StaticMeshVertex< 1 > >& rVertices, DynamicArray< uint16_t >& rIndices,
-            DynamicArray< uint16_t >& rSectionVertexCounts, DynamicArray< uint32_t >& rSectionTriangleCounts,
+            const String& rSourceFilePath, DynamicArray< StaticMeshVertex< 1 > >& rVertices, DynamicArray< uint32_t >& rIndices,
+            DynamicArray< uint32_t >& rSectionVertexCounts, DynamicArray< uint32_t >& rSectionTriangleCounts,
             DynamicArray< BoneData >& rBones, DynamicArray< BlendData >& rVertexBlendData,
             DynamicArray< uint8_t >& rSkinningPaletteMap, bool bStripNamespaces = true );
         bool LoadAnimation(
@@ -185,7 +185,7 @@ namespace Helium
 
         void BuildSkinningInformation(
             FbxScene* pScene, FbxMesh* pMesh, FbxNode* pSkeletonRootNode,
-            const DynamicArray< int >& rControlPointIndices, const DynamicArray< uint16_t >& rSectionVertexCounts,
+            const DynamicArray< int >& rControlPointIndices, const DynamicArray< uint32_t >& rSectionVertexCounts,
             DynamicArray< BoneData >& rBones, DynamicArray< BlendData >& rVertexBlendData,
             DynamicArray< uint8_t >& rSkinningPaletteMap, bool bStripNamespaces );
 
@@ -198,8 +198,8 @@ namespace Helium
             DynamicArray< WorkingTrackData >& rWorkingTracks, bool bStripNamespaces );
 
         bool BuildMeshFromScene(
-            FbxScene* pScene, DynamicArray< StaticMeshVertex< 1 > >& rVertices, DynamicArray< uint16_t >& rIndices,
-            DynamicArray< uint16_t >& rSectionVertexCounts, DynamicArray< uint32_t >& rSectionTriangleCounts,
+            FbxScene* pScene, DynamicArray< StaticMeshVertex< 1 > >& rVertices, DynamicArray< uint32_t >& rIndices,
+            DynamicArray< uint32_t >& rSectionVertexCounts, DynamicArray< uint32_t >& rSectionTriangleCounts,
             DynamicArray< BoneData >& rBones, DynamicArray< BlendData >& rVertexBlendData,
             DynamicArray< uint8_t >& rSkinningPaletteMap, bool bStripNamespaces );
         bool BuildAnimationFromScene(
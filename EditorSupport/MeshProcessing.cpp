@@ -0,0 +1,1237 @@
+#include "EditorSupportPch.h"
+
+#if HELIUM_TOOLS
+
+#include "EditorSupport/MeshProcessing.h"
+
+#include "Foundation/Math.h"
+
+#include <algorithm>
+
+using namespace Helium;
+
+static const uint32_t FNV1A_32_OFFSET_BASIS = 0x811c9dc5;
+static const uint32_t FNV1A_32_PRIME = 0x01000193;
+
+/// Smallest number of hash table slots allocated once a welder is in use.
+static const size_t MIN_WELD_SLOT_COUNT = 64;
+
+/// Smallest cosine of the angle by which a collapse may rotate the normal of a remaining triangle when simplifying.
+static const float64_t SIMPLIFY_MIN_NORMAL_COSINE = 0.5;
+
+/// Constructor.
+///
+/// @param[in] positionTolerance  Size of the grid to which positions are snapped before being compared, or zero to
+///                               only weld vertices with identical positions.
+VertexWelder::VertexWelder( float32_t positionTolerance )
+: m_inversePositionTolerance( 0.0f )
+, m_positionTolerance( 0.0f )
+{
+	SetPositionTolerance( positionTolerance );
+}
+
+/// Set the position tolerance used when welding.
+///
+/// This must be set before any vertices are added.
+///
+/// @param[in] positionTolerance  Size of the grid to which positions are snapped before being compared, or zero to
+///                               only weld vertices with identical positions.
+///
+/// @see GetPositionTolerance()
+void VertexWelder::SetPositionTolerance( float32_t positionTolerance )
+{
+	HELIUM_ASSERT( positionTolerance >= 0.0f );
+	HELIUM_ASSERT( m_keys.IsEmpty() );
+
+	m_positionTolerance = ( positionTolerance > 0.0f ? positionTolerance : 0.0f );
+	m_inversePositionTolerance = ( positionTolerance > 0.0f ? 1.0f / positionTolerance : 0.0f );
+}
+
+/// Preallocate space for the given number of unique vertices.
+///
+/// @param[in] vertexCount  Number of unique vertices expected.
+void VertexWelder::Reserve( size_t vertexCount )
+{
+	m_keys.Reserve( vertexCount );
+
+	// Keep the table at most half full to keep probe sequences short.
+	size_t slotCount = MIN_WELD_SLOT_COUNT;
+	while( slotCount < vertexCount * 2 )
+	{
+		slotCount *= 2;
+	}
+
+	if( slotCount > m_slots.GetSize() )
+	{
+		Rehash( slotCount );
+	}
+}
+
+/// Remove all vertices from this welder.
+void VertexWelder::Clear()
+{
+	m_slots.Clear();
+	m_keys.Clear();
+}
+
+/// Find a vertex matching the given vertex, adding it if no match exists.
+///
+/// @param[in]  rVertex  Vertex to weld.
+/// @param[in]  tag      Caller-defined value that must also match (for example, the source control point index, so
+///                      that vertices with different skinning influences are never merged).
+/// @param[out] rbAdded  Set to true if the vertex was added, false if it was welded to an existing vertex.
+///
+/// @return  Index of the matching vertex, in the order unique vertices were added to this welder.
+uint32_t VertexWelder::Weld( const StaticMeshVertex< 1 >& rVertex, uint32_t tag, bool& rbAdded )
+{
+	if( m_keys.GetSize() * 2 >= m_slots.GetSize() )
+	{
+		Rehash( m_slots.IsEmpty() ? MIN_WELD_SLOT_COUNT : m_slots.GetSize() * 2 );
+	}
+
+	Key key;
+	BuildKey( rVertex, tag, key );
+
+	size_t slotMask = m_slots.GetSize() - 1;
+	size_t slotIndex = HashKey( key ) & slotMask;
+	for( ; ; )
+	{
+		uint32_t keyIndex = m_slots[ slotIndex ];
+		if( IsInvalid( keyIndex ) )
+		{
+			break;
+		}
+
+		if( KeysEqual( m_keys[ keyIndex ], key ) )
+		{
+			rbAdded = false;
+
+			return keyIndex;
+		}
+
+		slotIndex = ( slotIndex + 1 ) & slotMask;
+	}
+
+	size_t keyIndex = m_keys.GetSize();
+	HELIUM_ASSERT( keyIndex < UINT32_MAX );
+	m_keys.Push( key );
+	m_slots[ slotIndex ] = static_cast< uint32_t >( keyIndex );
+
+	rbAdded = true;
+
+	return static_cast< uint32_t >( keyIndex );
+}
+
+/// Weld the duplicate vertices of an indexed triangle mesh in place.
+///
+/// Unique vertices keep the order in which they are first referenced by the vertex array, and indices are remapped
+/// to point to them.
+///
+/// @param[in,out] rVertices          Mesh vertices.
+/// @param[in,out] rIndices           Mesh vertex indices.
+/// @param[in]     positionTolerance  Size of the grid to which positions are snapped before being compared, or zero
+///                                   to only weld vertices with identical positions.
+void VertexWelder::WeldMesh(
+	DynamicArray< StaticMeshVertex< 1 > >& rVertices,
+	DynamicArray< uint32_t >& rIndices,
+	float32_t positionTolerance )
+{
+	size_t vertexCount = rVertices.GetSize();
+
+	VertexWelder welder( positionTolerance );
+	welder.Reserve( vertexCount );
+
+	DynamicArray< uint32_t > remap;
+	remap.Resize( vertexCount );
+
+	size_t weldedVertexCount = 0;
+	for( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+	{
+		bool bAdded;
+		uint32_t weldedIndex = welder.Weld( rVertices[ vertexIndex ], 0, bAdded );
+		remap[ vertexIndex ] = weldedIndex;
+
+		if( bAdded )
+		{
+			HELIUM_ASSERT( weldedIndex == weldedVertexCount );
+			rVertices[ weldedVertexCount ] = rVertices[ vertexIndex ];
+			++weldedVertexCount;
+		}
+	}
+
+	rVertices.Resize( weldedVertexCount );
+
+	size_t indexCount = rIndices.GetSize();
+	for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+	{
+		HELIUM_ASSERT( rIndices[ indexIndex ] < vertexCount );
+		rIndices[ indexIndex ] = remap[ rIndices[ indexIndex ] ];
+	}
+}
+
+/// Build the hash table key for a vertex.
+///
+/// @param[in]  rVertex  Vertex.
+/// @param[in]  tag      Caller-defined tag.
+/// @param[out] rKey     Key (fully initialized, including any unused bytes, so keys can be hashed as raw memory).
+void VertexWelder::BuildKey( const StaticMeshVertex< 1 >& rVertex, uint32_t tag, Key& rKey ) const
+{
+	MemoryZero( &rKey, sizeof( rKey ) );
+
+	for( size_t axisIndex = 0; axisIndex < 3; ++axisIndex )
+	{
+		float32_t position = rVertex.position[ axisIndex ];
+		if( m_inversePositionTolerance != 0.0f )
+		{
+			float32_t snapped = Floor( position * m_inversePositionTolerance + 0.5f );
+			rKey.position[ axisIndex ] = static_cast< int32_t >( snapped );
+		}
+		else
+		{
+			// Compare exact positions, treating positive and negative zero as the same position.
+			if( position == 0.0f )
+			{
+				position = 0.0f;
+			}
+
+			MemoryCopy( &rKey.position[ axisIndex ], &position, sizeof( position ) );
+		}
+	}
+
+	rKey.tag = tag;
+
+	// The fourth normal component is unused padding.
+	rKey.normal[ 0 ] = rVertex.normal[ 0 ];
+	rKey.normal[ 1 ] = rVertex.normal[ 1 ];
+	rKey.normal[ 2 ] = rVertex.normal[ 2 ];
+	MemoryCopy( rKey.tangent, rVertex.tangent, sizeof( rKey.tangent ) );
+	MemoryCopy( rKey.color, rVertex.color, sizeof( rKey.color ) );
+	rKey.texCoords[ 0 ] = rVertex.texCoords[ 0 ][ 0 ].packed;
+	rKey.texCoords[ 1 ] = rVertex.texCoords[ 0 ][ 1 ].packed;
+}
+
+/// Resize the hash table and reinsert all existing keys.
+///
+/// @param[in] slotCount  New number of slots (must be a power of two).
+void VertexWelder::Rehash( size_t slotCount )
+{
+	HELIUM_ASSERT( ( slotCount & ( slotCount - 1 ) ) == 0 );
+	HELIUM_ASSERT( slotCount > m_keys.GetSize() );
+
+	m_slots.Resize( 0 );
+	m_slots.Resize( slotCount );
+	for( size_t slotIndex = 0; slotIndex < slotCount; ++slotIndex )
+	{
+		SetInvalid( m_slots[ slotIndex ] );
+	}
+
+	size_t slotMask = slotCount - 1;
+	size_t keyCount = m_keys.GetSize();
+	for( size_t keyIndex = 0; keyIndex < keyCount; ++keyIndex )
+	{
+		size_t slotIndex = HashKey( m_keys[ keyIndex ] ) & slotMask;
+		while( IsValid( m_slots[ slotIndex ] ) )
+		{
+			slotIndex = ( slotIndex + 1 ) & slotMask;
+		}
+
+		m_slots[ slotIndex ] = static_cast< uint32_t >( keyIndex );
+	}
+}
+
+/// Compute a 32-bit FNV-1a hash of a key.
+///
+/// @param[in] rKey  Key to hash.
+///
+/// @return  Key hash.
+uint32_t VertexWelder::HashKey( const Key& rKey )
+{
+	const uint8_t* pBytes = reinterpret_cast< const uint8_t* >( &rKey );
+
+	uint32_t hash = FNV1A_32_OFFSET_BASIS;
+	for( size_t byteIndex = 0; byteIndex < sizeof( rKey ); ++byteIndex )
+	{
+		hash ^= pBytes[ byteIndex ];
+		hash *= FNV1A_32_PRIME;
+	}
+
+	return hash;
+}
+
+/// Compare two keys.
+///
+/// @param[in] rKey0  First key.
+/// @param[in] rKey1  Second key.
+///
+/// @return  True if the keys match, false if not.
+bool VertexWelder::KeysEqual( const Key& rKey0, const Key& rKey1 )
+{
+	return
+		rKey0.position[ 0 ] == rKey1.position[ 0 ] &&
+		rKey0.position[ 1 ] == rKey1.position[ 1 ] &&
+		rKey0.position[ 2 ] == rKey1.position[ 2 ] &&
+		rKey0.tag == rKey1.tag &&
+		rKey0.normal[ 0 ] == rKey1.normal[ 0 ] &&
+		rKey0.normal[ 1 ] == rKey1.normal[ 1 ] &&
+		rKey0.normal[ 2 ] == rKey1.normal[ 2 ] &&
+		rKey0.tangent[ 0 ] == rKey1.tangent[ 0 ] &&
+		rKey0.tangent[ 1 ] == rKey1.tangent[ 1 ] &&
+		rKey0.tangent[ 2 ] == rKey1.tangent[ 2 ] &&
+		rKey0.tangent[ 3 ] == rKey1.tangent[ 3 ] &&
+		rKey0.color[ 0 ] == rKey1.color[ 0 ] &&
+		rKey0.color[ 1 ] == rKey1.color[ 1 ] &&
+		rKey0.color[ 2 ] == rKey1.color[ 2 ] &&
+		rKey0.color[ 3 ] == rKey1.color[ 3 ] &&
+		rKey0.texCoords[ 0 ] == rKey1.texCoords[ 0 ] &&
+		rKey0.texCoords[ 1 ] == rKey1.texCoords[ 1 ];
+}
+
+/// Triangle cluster considered when sorting for overdraw.
+struct OverdrawCluster
+{
+	/// First triangle in the cluster.
+	uint32_t startTriangle;
+	/// Number of triangles in the cluster.
+	uint32_t triangleCount;
+	/// Sort key (higher values are drawn first).
+	float32_t sortKey;
+};
+
+// Order clusters so the most outward-facing are drawn first, keeping the original order for ties.
+static bool SortClustersForOverdraw( const OverdrawCluster& rCluster0, const OverdrawCluster& rCluster1 )
+{
+	if( rCluster0.sortKey != rCluster1.sortKey )
+	{
+		return rCluster0.sortKey > rCluster1.sortKey;
+	}
+
+	return rCluster0.startTriangle < rCluster1.startTriangle;
+}
+
+/// Compute the average cache miss ratio (vertices transformed per triangle) for an index list.
+///
+/// This simulates a FIFO post-transform vertex cache.  A value of 3.0 means no reuse at all, while well ordered
+/// regular meshes approach 0.5.
+///
+/// @param[in] pIndices     Triangle list indices.
+/// @param[in] indexCount   Number of indices.
+/// @param[in] vertexCount  Number of vertices addressed by the indices.
+/// @param[in] cacheSize    Number of vertices held by the simulated cache.
+///
+/// @return  Average number of cache misses per triangle.
+float32_t MeshOptimizer::ComputeAcmr(
+	const uint32_t* pIndices,
+	size_t indexCount,
+	size_t vertexCount,
+	uint32_t cacheSize )
+{
+	HELIUM_ASSERT( pIndices || indexCount == 0 );
+	HELIUM_ASSERT( indexCount % 3 == 0 );
+
+	size_t triangleCount = indexCount / 3;
+	if( triangleCount == 0 )
+	{
+		return 0.0f;
+	}
+
+	// A vertex is in the cache if fewer than cacheSize misses have occurred since it was last loaded.
+	DynamicArray< uint32_t > cacheTimes;
+	cacheTimes.Resize( vertexCount );
+	MemoryZero( cacheTimes.GetData(), vertexCount * sizeof( uint32_t ) );
+
+	uint32_t time = cacheSize + 1;
+	size_t missCount = 0;
+	for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+	{
+		uint32_t vertexIndex = pIndices[ indexIndex ];
+		HELIUM_ASSERT( vertexIndex < vertexCount );
+		if( time - cacheTimes[ vertexIndex ] > cacheSize )
+		{
+			cacheTimes[ vertexIndex ] = time;
+			++time;
+			++missCount;
+		}
+	}
+
+	return static_cast< float32_t >( missCount ) / static_cast< float32_t >( triangleCount );
+}
+
+/// Reorder triangles to improve post-transform vertex cache reuse.
+///
+/// Triangles are emitted as fans around a sequence of vertices, each chosen from the vertices of the last fan that
+/// are still likely to be in the cache.  When no such vertex remains the cache is effectively flushed, and the
+/// triangles emitted between two flushes form a cluster that can be reordered as a unit by OptimizeOverdraw().
+///
+/// @param[in,out] pIndices        Triangle list indices to reorder.
+/// @param[in]     indexCount      Number of indices.
+/// @param[in]     vertexCount     Number of vertices addressed by the indices.
+/// @param[in]     cacheSize       Number of vertices held by the target post-transform cache.
+/// @param[out]    pClusterStarts  If not null, filled with the index of the first triangle of each cluster.
+void MeshOptimizer::OptimizeVertexCache(
+	uint32_t* pIndices,
+	size_t indexCount,
+	size_t vertexCount,
+	uint32_t cacheSize,
+	DynamicArray< uint32_t >* pClusterStarts )
+{
+	HELIUM_ASSERT( pIndices || indexCount == 0 );
+	HELIUM_ASSERT( indexCount % 3 == 0 );
+	HELIUM_ASSERT( indexCount / 3 <= UINT32_MAX );
+	HELIUM_ASSERT( cacheSize >= 3 );
+
+	if( pClusterStarts )
+	{
+		pClusterStarts->Resize( 0 );
+	}
+
+	size_t triangleCount = indexCount / 3;
+	if( triangleCount == 0 )
+	{
+		return;
+	}
+
+	// Build the list of triangles adjacent to each vertex.
+	DynamicArray< uint32_t > liveCounts;
+	liveCounts.Resize( vertexCount );
+	MemoryZero( liveCounts.GetData(), vertexCount * sizeof( uint32_t ) );
+	for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+	{
+		HELIUM_ASSERT( pIndices[ indexIndex ] < vertexCount );
+		++liveCounts[ pIndices[ indexIndex ] ];
+	}
+
+	DynamicArray< uint32_t > adjacencyOffsets;
+	adjacencyOffsets.Resize( vertexCount + 1 );
+	adjacencyOffsets[ 0 ] = 0;
+	for( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+	{
+		adjacencyOffsets[ vertexIndex + 1 ] = adjacencyOffsets[ vertexIndex ] + liveCounts[ vertexIndex ];
+	}
+
+	DynamicArray< uint32_t > adjacentTriangles;
+	adjacentTriangles.Resize( indexCount );
+
+	DynamicArray< uint32_t > adjacencyFill;
+	adjacencyFill.AddArray( adjacencyOffsets.GetData(), vertexCount );
+	for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+	{
+		adjacentTriangles[ adjacencyFill[ pIndices[ indexIndex ] ]++ ] = static_cast< uint32_t >( indexIndex / 3 );
+	}
+
+	adjacencyFill.Clear();
+
+	DynamicArray< uint32_t > cacheTimes;
+	cacheTimes.Resize( vertexCount );
+	MemoryZero( cacheTimes.GetData(), vertexCount * sizeof( uint32_t ) );
+
+	DynamicArray< bool > emitted;
+	emitted.Resize( triangleCount );
+	for( size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex )
+	{
+		emitted[ triangleIndex ] = false;
+	}
+
+	DynamicArray< uint32_t > outputIndices;
+	outputIndices.Reserve( indexCount );
+
+	DynamicArray< uint32_t > deadEndStack;
+	DynamicArray< uint32_t > candidates;
+
+	uint32_t time = cacheSize + 1;
+	size_t cursor = 0;
+
+	// Start with the first referenced vertex.
+	size_t fanVertex = 0;
+	while( fanVertex < vertexCount && liveCounts[ fanVertex ] == 0 )
+	{
+		++fanVertex;
+	}
+
+	if( pClusterStarts )
+	{
+		pClusterStarts->Push( 0 );
+	}
+
+	while( fanVertex < vertexCount )
+	{
+		candidates.Resize( 0 );
+
+		// Emit all remaining triangles around the fan vertex.
+		uint32_t adjacencyEnd = adjacencyOffsets[ fanVertex + 1 ];
+		for( uint32_t adjacencyIndex = adjacencyOffsets[ fanVertex ]; adjacencyIndex < adjacencyEnd; ++adjacencyIndex )
+		{
+			uint32_t triangleIndex = adjacentTriangles[ adjacencyIndex ];
+			if( emitted[ triangleIndex ] )
+			{
+				continue;
+			}
+
+			for( size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+			{
+				uint32_t vertexIndex = pIndices[ triangleIndex * 3 + cornerIndex ];
+				outputIndices.Push( vertexIndex );
+				deadEndStack.Push( vertexIndex );
+				candidates.Push( vertexIndex );
+
+				HELIUM_ASSERT( liveCounts[ vertexIndex ] != 0 );
+				--liveCounts[ vertexIndex ];
+
+				if( time - cacheTimes[ vertexIndex ] > cacheSize )
+				{
+					cacheTimes[ vertexIndex ] = time;
+					++time;
+				}
+			}
+
+			emitted[ triangleIndex ] = true;
+		}
+
+		// Pick the candidate that will most likely still be in the cache once all of its triangles are emitted,
+		// preferring the one that has been in the cache the longest.
+		size_t nextVertex = Invalid< size_t >();
+		int64_t bestPriority = -1;
+		size_t candidateCount = candidates.GetSize();
+		for( size_t candidateIndex = 0; candidateIndex < candidateCount; ++candidateIndex )
+		{
+			uint32_t vertexIndex = candidates[ candidateIndex ];
+			if( liveCounts[ vertexIndex ] == 0 )
+			{
+				continue;
+			}
+
+			int64_t priority = 0;
+			uint32_t age = time - cacheTimes[ vertexIndex ];
+			if( static_cast< uint64_t >( age ) + 2 * static_cast< uint64_t >( liveCounts[ vertexIndex ] ) <= cacheSize )
+			{
+				priority = age;
+			}
+
+			if( priority > bestPriority )
+			{
+				bestPriority = priority;
+				nextVertex = vertexIndex;
+			}
+		}
+
+		if( IsInvalid( nextVertex ) )
+		{
+			// Dead end: fall back to recently used vertices that still have triangles left, then to the next vertex
+			// in input order.  Either way, the cache contents are no longer useful, so a new cluster starts here.
+			while( !deadEndStack.IsEmpty() )
+			{
+				uint32_t vertexIndex = deadEndStack.GetLast();
+				deadEndStack.Pop();
+				if( liveCounts[ vertexIndex ] != 0 )
+				{
+					nextVertex = vertexIndex;
+					break;
+				}
+			}
+
+			if( IsInvalid( nextVertex ) )
+			{
+				while( cursor < vertexCount && liveCounts[ cursor ] == 0 )
+				{
+					++cursor;
+				}
+
+				nextVertex = cursor;
+			}
+
+			if( pClusterStarts && nextVertex < vertexCount )
+			{
+				pClusterStarts->Push( static_cast< uint32_t >( outputIndices.GetSize() / 3 ) );
+			}
+		}
+
+		fanVertex = nextVertex;
+	}
+
+	HELIUM_ASSERT( outputIndices.GetSize() == indexCount );
+	MemoryCopy( pIndices, outputIndices.GetData(), indexCount * sizeof( uint32_t ) );
+}
+
+/// Reorder triangle clusters to reduce overdraw.
+///
+/// Clusters facing away from the center of the mesh are drawn first, as they are the most likely to occlude the rest
+/// of the mesh from any viewpoint.  Triangle order within each cluster is kept, so vertex cache efficiency is mostly
+/// preserved.
+///
+/// @param[in,out] pIndices        Triangle list indices to reorder (typically the output of OptimizeVertexCache()).
+/// @param[in]     indexCount      Number of indices.
+/// @param[in]     pVertices       Vertices addressed by the indices.
+/// @param[in]     vertexCount     Number of vertices.
+/// @param[in]     rClusterStarts  Index of the first triangle of each cluster, in increasing order.
+void MeshOptimizer::OptimizeOverdraw(
+	uint32_t* pIndices,
+	size_t indexCount,
+	const StaticMeshVertex< 1 >* pVertices,
+	size_t vertexCount,
+	const DynamicArray< uint32_t >& rClusterStarts )
+{
+	HELIUM_ASSERT( pIndices || indexCount == 0 );
+	HELIUM_ASSERT( pVertices || vertexCount == 0 );
+	HELIUM_ASSERT( indexCount % 3 == 0 );
+
+	size_t triangleCount = indexCount / 3;
+	size_t clusterCount = rClusterStarts.GetSize();
+	if( clusterCount < 2 || triangleCount == 0 )
+	{
+		return;
+	}
+
+	// Compute the area-weighted normal and centroid of each cluster, along with the centroid of the whole mesh.
+	DynamicArray< OverdrawCluster > clusters;
+	clusters.Resize( clusterCount );
+
+	DynamicArray< float32_t > clusterData;
+	clusterData.Resize( clusterCount * 7 );
+	MemoryZero( clusterData.GetData(), clusterCount * 7 * sizeof( float32_t ) );
+
+	float32_t meshCentroid[ 3 ] = { 0.0f, 0.0f, 0.0f };
+	float32_t meshArea = 0.0f;
+
+	for( size_t clusterIndex = 0; clusterIndex < clusterCount; ++clusterIndex )
+	{
+		uint32_t startTriangle = rClusterStarts[ clusterIndex ];
+		size_t endTriangle = ( clusterIndex + 1 < clusterCount ? rClusterStarts[ clusterIndex + 1 ] : triangleCount );
+		HELIUM_ASSERT( startTriangle < endTriangle );
+
+		OverdrawCluster& rCluster = clusters[ clusterIndex ];
+		rCluster.startTriangle = startTriangle;
+		rCluster.triangleCount = static_cast< uint32_t >( endTriangle - startTriangle );
+		rCluster.sortKey = 0.0f;
+
+		float32_t* pClusterNormal = &clusterData[ clusterIndex * 7 ];
+		float32_t* pClusterCentroid = pClusterNormal + 3;
+		float32_t& rClusterArea = pClusterNormal[ 6 ];
+
+		for( size_t triangleIndex = startTriangle; triangleIndex < endTriangle; ++triangleIndex )
+		{
+			const float32_t* pPosition0 = pVertices[ pIndices[ triangleIndex * 3 ] ].position;
+			const float32_t* pPosition1 = pVertices[ pIndices[ triangleIndex * 3 + 1 ] ].position;
+			const float32_t* pPosition2 = pVertices[ pIndices[ triangleIndex * 3 + 2 ] ].position;
+
+			float32_t edge0[ 3 ], edge1[ 3 ];
+			for( size_t axisIndex = 0; axisIndex < 3; ++axisIndex )
+			{
+				edge0[ axisIndex ] = pPosition1[ axisIndex ] - pPosition0[ axisIndex ];
+				edge1[ axisIndex ] = pPosition2[ axisIndex ] - pPosition0[ axisIndex ];
+			}
+
+			// Front faces are clockwise in our left-handed space, so this cross product faces outward, with a length
+			// of twice the triangle area.
+			float32_t normal[ 3 ] =
+			{
+				edge0[ 1 ] * edge1[ 2 ] - edge0[ 2 ] * edge1[ 1 ],
+				edge0[ 2 ] * edge1[ 0 ] - edge0[ 0 ] * edge1[ 2 ],
+				edge0[ 0 ] * edge1[ 1 ] - edge0[ 1 ] * edge1[ 0 ]
+			};
+			float32_t area =
+				0.5f * sqrt( normal[ 0 ] * normal[ 0 ] + normal[ 1 ] * normal[ 1 ] + normal[ 2 ] * normal[ 2 ] );
+
+			for( size_t axisIndex = 0; axisIndex < 3; ++axisIndex )
+			{
+				float32_t center =
+					( pPosition0[ axisIndex ] + pPosition1[ axisIndex ] + pPosition2[ axisIndex ] ) * ( 1.0f / 3.0f );
+				pClusterNormal[ axisIndex ] += normal[ axisIndex ];
+				pClusterCentroid[ axisIndex ] += center * area;
+				meshCentroid[ axisIndex ] += center * area;
+			}
+
+			rClusterArea += area;
+			meshArea += area;
+		}
+	}
+
+	if( meshArea <= 0.0f )
+	{
+		return;
+	}
+
+	for( size_t axisIndex = 0; axisIndex < 3; ++axisIndex )
+	{
+		meshCentroid[ axisIndex ] /= meshArea;
+	}
+
+	for( size_t clusterIndex = 0; clusterIndex < clusterCount; ++clusterIndex )
+	{
+		const float32_t* pClusterNormal = &clusterData[ clusterIndex * 7 ];
+		const float32_t* pClusterCentroid = pClusterNormal + 3;
+		float32_t clusterArea = pClusterNormal[ 6 ];
+
+		float32_t normalLength = sqrt(
+			pClusterNormal[ 0 ] * pClusterNormal[ 0 ] +
+			pClusterNormal[ 1 ] * pClusterNormal[ 1 ] +
+			pClusterNormal[ 2 ] * pClusterNormal[ 2 ] );
+		if( clusterArea <= 0.0f || normalLength <= 0.0f )
+		{
+			continue;
+		}
+
+		float32_t sortKey = 0.0f;
+		for( size_t axisIndex = 0; axisIndex < 3; ++axisIndex )
+		{
+			float32_t offset = pClusterCentroid[ axisIndex ] / clusterArea - meshCentroid[ axisIndex ];
+			sortKey += offset * pClusterNormal[ axisIndex ];
+		}
+
+		clusters[ clusterIndex ].sortKey = sortKey / normalLength;
+	}
+
+	std::sort( clusters.GetData(), clusters.GetData() + clusterCount, SortClustersForOverdraw );
+
+	DynamicArray< uint32_t > outputIndices;
+	outputIndices.Reserve( indexCount );
+	for( size_t clusterIndex = 0; clusterIndex < clusterCount; ++clusterIndex )
+	{
+		const OverdrawCluster& rCluster = clusters[ clusterIndex ];
+		outputIndices.AddArray( pIndices + rCluster.startTriangle * 3, rCluster.triangleCount * 3 );
+	}
+
+	HELIUM_ASSERT( outputIndices.GetSize() == indexCount );
+	MemoryCopy( pIndices, outputIndices.GetData(), indexCount * sizeof( uint32_t ) );
+}
+
+/// Renumber vertices in the order they are first referenced by an index list.
+///
+/// Indices are updated in place.  Vertices that aren't referenced are moved after all referenced vertices, keeping
+/// their relative order.  Use RemapVertices() to reorder the vertex data itself.
+///
+/// @param[in,out] pIndices     Triangle list indices.
+/// @param[in]     indexCount   Number of indices.
+/// @param[in]     vertexCount  Number of vertices addressed by the indices.
+/// @param[out]    rRemap       New index of each vertex.
+void MeshOptimizer::OptimizeVertexFetch(
+	uint32_t* pIndices,
+	size_t indexCount,
+	size_t vertexCount,
+	DynamicArray< uint32_t >& rRemap )
+{
+	HELIUM_ASSERT( pIndices || indexCount == 0 );
+	HELIUM_ASSERT( vertexCount <= UINT32_MAX );
+
+	rRemap.Resize( 0 );
+	rRemap.Resize( vertexCount );
+	for( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+	{
+		SetInvalid( rRemap[ vertexIndex ] );
+	}
+
+	uint32_t nextVertexIndex = 0;
+	for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+	{
+		uint32_t& rNewIndex = rRemap[ pIndices[ indexIndex ] ];
+		if( IsInvalid( rNewIndex ) )
+		{
+			rNewIndex = nextVertexIndex;
+			++nextVertexIndex;
+		}
+
+		pIndices[ indexIndex ] = rNewIndex;
+	}
+
+	for( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+	{
+		if( IsInvalid( rRemap[ vertexIndex ] ) )
+		{
+			rRemap[ vertexIndex ] = nextVertexIndex;
+			++nextVertexIndex;
+		}
+	}
+
+	HELIUM_ASSERT( nextVertexIndex == vertexCount );
+}
+
+/// Error quadric accumulated from the planes of the triangles around a vertex when simplifying.
+struct SimplifyQuadric
+{
+	/// Upper triangle of the plane normal outer product (xx, xy, xz, yy, yz, zz).
+	float64_t a[ 6 ];
+	/// Plane normal scaled by the plane distance.
+	float64_t b[ 3 ];
+	/// Squared plane distance.
+	float64_t c;
+};
+
+/// Edge collapse considered when simplifying.
+struct CollapseCandidate
+{
+	/// Vertex removed by the collapse.
+	uint32_t sourceVertex;
+	/// Vertex kept in its place.
+	uint32_t targetVertex;
+	/// Quadric error introduced by the collapse.
+	float64_t cost;
+};
+
+// Order collapses by increasing error, breaking ties by vertex index so the result is deterministic.
+static bool SortCollapseCandidates( const CollapseCandidate& rCandidate0, const CollapseCandidate& rCandidate1 )
+{
+	if( rCandidate0.cost != rCandidate1.cost )
+	{
+		return rCandidate0.cost < rCandidate1.cost;
+	}
+
+	if( rCandidate0.sourceVertex != rCandidate1.sourceVertex )
+	{
+		return rCandidate0.sourceVertex < rCandidate1.sourceVertex;
+	}
+
+	return rCandidate0.targetVertex < rCandidate1.targetVertex;
+}
+
+// Compute the outward normal of a triangle, with a length of twice the triangle area.
+static void ComputeSimplifyNormal(
+	const float32_t* pPosition0,
+	const float32_t* pPosition1,
+	const float32_t* pPosition2,
+	float64_t* pNormal )
+{
+	float64_t edge0[ 3 ], edge1[ 3 ];
+	for( size_t axisIndex = 0; axisIndex < 3; ++axisIndex )
+	{
+		edge0[ axisIndex ] = static_cast< float64_t >( pPosition1[ axisIndex ] ) - pPosition0[ axisIndex ];
+		edge1[ axisIndex ] = static_cast< float64_t >( pPosition2[ axisIndex ] ) - pPosition0[ axisIndex ];
+	}
+
+	pNormal[ 0 ] = edge0[ 1 ] * edge1[ 2 ] - edge0[ 2 ] * edge1[ 1 ];
+	pNormal[ 1 ] = edge0[ 2 ] * edge1[ 0 ] - edge0[ 0 ] * edge1[ 2 ];
+	pNormal[ 2 ] = edge0[ 0 ] * edge1[ 1 ] - edge0[ 1 ] * edge1[ 0 ];
+}
+
+// Add one quadric to another.
+static void AddSimplifyQuadric( SimplifyQuadric& rQuadric, const SimplifyQuadric& rOther )
+{
+	for( size_t elementIndex = 0; elementIndex < 6; ++elementIndex )
+	{
+		rQuadric.a[ elementIndex ] += rOther.a[ elementIndex ];
+	}
+
+	for( size_t axisIndex = 0; axisIndex < 3; ++axisIndex )
+	{
+		rQuadric.b[ axisIndex ] += rOther.b[ axisIndex ];
+	}
+
+	rQuadric.c += rOther.c;
+}
+
+// Compute the error of a quadric at a given position (the weighted sum of squared distances to its planes).
+static float64_t EvaluateSimplifyQuadric( const SimplifyQuadric& rQuadric, const float32_t* pPosition )
+{
+	float64_t x = pPosition[ 0 ];
+	float64_t y = pPosition[ 1 ];
+	float64_t z = pPosition[ 2 ];
+
+	return
+		rQuadric.a[ 0 ] * x * x + rQuadric.a[ 3 ] * y * y + rQuadric.a[ 5 ] * z * z +
+		2.0 * ( rQuadric.a[ 1 ] * x * y + rQuadric.a[ 2 ] * x * z + rQuadric.a[ 4 ] * y * z ) +
+		2.0 * ( rQuadric.b[ 0 ] * x + rQuadric.b[ 1 ] * y + rQuadric.b[ 2 ] * z ) +
+		rQuadric.c;
+}
+
+/// Reduce the number of triangles in an index list by collapsing edges.
+///
+/// Each collapse merges a vertex into one of its neighbors, cheapest first according to the quadric error metric
+/// (Garland and Heckbert, "Surface Simplification Using Quadric Error Metrics").  Vertices are never moved or
+/// created, so the simplified indices still address the original vertex data and can share its vertex buffer.
+/// Vertices on open borders or non-manifold edges, and vertices sharing their position with another vertex (attribute
+/// seams), are never removed, and collapses that would flip a triangle or pinch the surface are rejected.  Collapses
+/// are applied in batches that don't share any triangles, so the result is deterministic.
+///
+/// @param[in,out] pIndices          Triangle list indices; the simplified triangles are written to the start of the
+///                                  array.
+/// @param[in]     indexCount        Number of indices.
+/// @param[in]     pVertices         Vertices addressed by the indices.
+/// @param[in]     vertexCount       Number of vertices.
+/// @param[in]     targetIndexCount  Number of indices at or below which to stop simplifying.
+///
+/// @return  Number of indices in the simplified index list.  This can be above the target if no more edges can be
+///          collapsed.
+size_t MeshOptimizer::SimplifyMesh(
+	uint32_t* pIndices,
+	size_t indexCount,
+	const StaticMeshVertex< 1 >* pVertices,
+	size_t vertexCount,
+	size_t targetIndexCount )
+{
+	HELIUM_ASSERT( pIndices || indexCount == 0 );
+	HELIUM_ASSERT( pVertices || vertexCount == 0 );
+	HELIUM_ASSERT( indexCount % 3 == 0 );
+	HELIUM_ASSERT( vertexCount <= UINT32_MAX );
+
+	if( indexCount <= targetIndexCount )
+	{
+		return indexCount;
+	}
+
+	size_t triangleCount = indexCount / 3;
+
+	// Identify vertices sharing the same position.
+	DynamicArray< uint32_t > positionIds;
+	positionIds.Resize( vertexCount );
+
+	DynamicArray< uint32_t > positionVertexCounts;
+
+	VertexWelder positionWelder;
+	positionWelder.Reserve( vertexCount );
+
+	StaticMeshVertex< 1 > positionVertex;
+	MemoryZero( &positionVertex, sizeof( positionVertex ) );
+	for( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+	{
+		MemoryCopy( positionVertex.position, pVertices[ vertexIndex ].position, sizeof( positionVertex.position ) );
+
+		bool bAdded;
+		uint32_t positionId = positionWelder.Weld( positionVertex, 0, bAdded );
+		if( bAdded )
+		{
+			positionVertexCounts.Push( 0 );
+		}
+
+		++positionVertexCounts[ positionId ];
+		positionIds[ vertexIndex ] = positionId;
+	}
+
+	// Find the edges not shared by exactly two triangles, comparing positions so that attribute seams aren't mistaken
+	// for open borders.
+	DynamicArray< uint64_t > edges;
+	edges.Reserve( indexCount );
+	for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+	{
+		HELIUM_ASSERT( pIndices[ indexIndex ] < vertexCount );
+
+		size_t nextIndexIndex = ( indexIndex % 3 == 2 ? indexIndex - 2 : indexIndex + 1 );
+		uint32_t positionId0 = positionIds[ pIndices[ indexIndex ] ];
+		uint32_t positionId1 = positionIds[ pIndices[ nextIndexIndex ] ];
+		if( positionId0 != positionId1 )
+		{
+			uint64_t edge = ( static_cast< uint64_t >( Min( positionId0, positionId1 ) ) << 32 );
+			edges.Push( edge | Max( positionId0, positionId1 ) );
+		}
+	}
+
+	std::sort( edges.GetData(), edges.GetData() + edges.GetSize() );
+
+	size_t positionCount = positionVertexCounts.GetSize();
+	DynamicArray< uint8_t > lockedPositions;
+	lockedPositions.Resize( positionCount );
+	MemoryZero( lockedPositions.GetData(), positionCount );
+
+	size_t edgeCount = edges.GetSize();
+	for( size_t edgeIndex = 0; edgeIndex < edgeCount; )
+	{
+		size_t edgeEnd = edgeIndex + 1;
+		while( edgeEnd < edgeCount && edges[ edgeEnd ] == edges[ edgeIndex ] )
+		{
+			++edgeEnd;
+		}
+
+		if( edgeEnd - edgeIndex != 2 )
+		{
+			lockedPositions[ static_cast< uint32_t >( edges[ edgeIndex ] >> 32 ) ] = 1;
+			lockedPositions[ static_cast< uint32_t >( edges[ edgeIndex ] ) ] = 1;
+		}
+
+		edgeIndex = edgeEnd;
+	}
+
+	edges.Clear();
+
+	DynamicArray< uint8_t > lockedVertices;
+	lockedVertices.Resize( vertexCount );
+	for( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+	{
+		uint32_t positionId = positionIds[ vertexIndex ];
+		lockedVertices[ vertexIndex ] =
+			( lockedPositions[ positionId ] || positionVertexCounts[ positionId ] > 1 ? 1 : 0 );
+	}
+
+	// Accumulate the area-weighted plane of each triangle into the quadrics of its vertices.
+	DynamicArray< SimplifyQuadric > quadrics;
+	quadrics.Resize( vertexCount );
+	MemoryZero( quadrics.GetData(), vertexCount * sizeof( SimplifyQuadric ) );
+
+	for( size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex )
+	{
+		const uint32_t* pTriangle = pIndices + triangleIndex * 3;
+		const float32_t* pPosition0 = pVertices[ pTriangle[ 0 ] ].position;
+
+		float64_t normal[ 3 ];
+		ComputeSimplifyNormal(
+			pPosition0,
+			pVertices[ pTriangle[ 1 ] ].position,
+			pVertices[ pTriangle[ 2 ] ].position,
+			normal );
+
+		float64_t normalLength =
+			sqrt( normal[ 0 ] * normal[ 0 ] + normal[ 1 ] * normal[ 1 ] + normal[ 2 ] * normal[ 2 ] );
+		if( normalLength <= 0.0 )
+		{
+			continue;
+		}
+
+		float64_t area = 0.5 * normalLength;
+		normal[ 0 ] /= normalLength;
+		normal[ 1 ] /= normalLength;
+		normal[ 2 ] /= normalLength;
+
+		float64_t distance =
+			-( normal[ 0 ] * pPosition0[ 0 ] + normal[ 1 ] * pPosition0[ 1 ] + normal[ 2 ] * pPosition0[ 2 ] );
+
+		SimplifyQuadric triangleQuadric;
+		triangleQuadric.a[ 0 ] = normal[ 0 ] * normal[ 0 ] * area;
+		triangleQuadric.a[ 1 ] = normal[ 0 ] * normal[ 1 ] * area;
+		triangleQuadric.a[ 2 ] = normal[ 0 ] * normal[ 2 ] * area;
+		triangleQuadric.a[ 3 ] = normal[ 1 ] * normal[ 1 ] * area;
+		triangleQuadric.a[ 4 ] = normal[ 1 ] * normal[ 2 ] * area;
+		triangleQuadric.a[ 5 ] = normal[ 2 ] * normal[ 2 ] * area;
+		triangleQuadric.b[ 0 ] = normal[ 0 ] * distance * area;
+		triangleQuadric.b[ 1 ] = normal[ 1 ] * distance * area;
+		triangleQuadric.b[ 2 ] = normal[ 2 ] * distance * area;
+		triangleQuadric.c = distance * distance * area;
+
+		for( size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+		{
+			AddSimplifyQuadric( quadrics[ pTriangle[ cornerIndex ] ], triangleQuadric );
+		}
+	}
+
+	DynamicArray< uint32_t > remap;
+	remap.Resize( vertexCount );
+	for( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+	{
+		remap[ vertexIndex ] = static_cast< uint32_t >( vertexIndex );
+	}
+
+	// Vertices are stamped with the current pass once a collapse has changed any of their triangles, and with a
+	// running counter when checking the neighbors shared by the two ends of an edge.
+	DynamicArray< uint32_t > touchedPasses;
+	touchedPasses.Resize( vertexCount );
+	MemoryZero( touchedPasses.GetData(), vertexCount * sizeof( uint32_t ) );
+
+	DynamicArray< uint32_t > neighborStamps;
+	neighborStamps.Resize( vertexCount );
+	MemoryZero( neighborStamps.GetData(), vertexCount * sizeof( uint32_t ) );
+	uint32_t neighborStamp = 0;
+
+	DynamicArray< uint32_t > adjacencyOffsets;
+	adjacencyOffsets.Resize( vertexCount + 1 );
+	DynamicArray< uint32_t > adjacentTriangles;
+	DynamicArray< CollapseCandidate > candidates;
+
+	for( uint32_t pass = 1; indexCount > targetIndexCount; ++pass )
+	{
+		triangleCount = indexCount / 3;
+
+		// Build the list of triangles adjacent to each vertex.
+		MemoryZero( adjacencyOffsets.GetData(), ( vertexCount + 1 ) * sizeof( uint32_t ) );
+		for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+		{
+			++adjacencyOffsets[ pIndices[ indexIndex ] + 1 ];
+		}
+
+		for( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+		{
+			adjacencyOffsets[ vertexIndex + 1 ] += adjacencyOffsets[ vertexIndex ];
+		}
+
+		adjacentTriangles.Resize( indexCount );
+		for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+		{
+			uint32_t triangleIndex = static_cast< uint32_t >( indexIndex / 3 );
+			adjacentTriangles[ adjacencyOffsets[ pIndices[ indexIndex ] ]++ ] = triangleIndex;
+		}
+
+		// Filling shifted each offset to the start of the next vertex's range, so shift them back.
+		for( size_t vertexIndex = vertexCount; vertexIndex > 0; --vertexIndex )
+		{
+			adjacencyOffsets[ vertexIndex ] = adjacencyOffsets[ vertexIndex - 1 ];
+		}
+
+		adjacencyOffsets[ 0 ] = 0;
+
+		// Gather every collapse along a triangle edge, in both directions.
+		candidates.Resize( 0 );
+		for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+		{
+			uint32_t sourceVertex = pIndices[ indexIndex ];
+			if( lockedVertices[ sourceVertex ] )
+			{
+				continue;
+			}
+
+			size_t triangleStart = indexIndex - indexIndex % 3;
+			for( size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+			{
+				uint32_t targetVertex = pIndices[ triangleStart + cornerIndex ];
+				if( targetVertex == sourceVertex )
+				{
+					continue;
+				}
+
+				const float32_t* pTargetPosition = pVertices[ targetVertex ].position;
+
+				CollapseCandidate* pCandidate = candidates.New();
+				HELIUM_ASSERT( pCandidate );
+				pCandidate->sourceVertex = sourceVertex;
+				pCandidate->targetVertex = targetVertex;
+				pCandidate->cost =
+					EvaluateSimplifyQuadric( quadrics[ sourceVertex ], pTargetPosition ) +
+					EvaluateSimplifyQuadric( quadrics[ targetVertex ], pTargetPosition );
+			}
+		}
+
+		std::sort( candidates.GetData(), candidates.GetData() + candidates.GetSize(), SortCollapseCandidates );
+
+		// Apply the cheapest valid collapses that don't touch the triangles of any other collapse in this pass.
+		size_t removeTriangleCount = ( indexCount - targetIndexCount + 2 ) / 3;
+		size_t removedTriangleCount = 0;
+		size_t collapseCount = 0;
+
+		size_t candidateCount = candidates.GetSize();
+		for( size_t candidateIndex = 0;
+			candidateIndex < candidateCount && removedTriangleCount < removeTriangleCount;
+			++candidateIndex )
+		{
+			const CollapseCandidate& rCandidate = candidates[ candidateIndex ];
+			uint32_t sourceVertex = rCandidate.sourceVertex;
+			uint32_t targetVertex = rCandidate.targetVertex;
+			if( touchedPasses[ sourceVertex ] == pass || touchedPasses[ targetVertex ] == pass )
+			{
+				continue;
+			}
+
+			// Reject collapses that would flip or sharply rotate any remaining triangle around the removed vertex.
+			++neighborStamp;
+
+			const float32_t* pTargetPosition = pVertices[ targetVertex ].position;
+			size_t sharedTriangleCount = 0;
+			bool bValid = true;
+
+			uint32_t sourceAdjacencyEnd = adjacencyOffsets[ sourceVertex + 1 ];
+			for( uint32_t adjacencyIndex = adjacencyOffsets[ sourceVertex ];
+				adjacencyIndex < sourceAdjacencyEnd && bValid;
+				++adjacencyIndex )
+			{
+				const uint32_t* pTriangle = pIndices + adjacentTriangles[ adjacencyIndex ] * 3;
+
+				const float32_t* pPositions[ 3 ];
+				const float32_t* pCollapsedPositions[ 3 ];
+				bool bShared = false;
+				for( size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+				{
+					uint32_t vertexIndex = pTriangle[ cornerIndex ];
+					neighborStamps[ vertexIndex ] = neighborStamp;
+					bShared |= ( vertexIndex == targetVertex );
+
+					pPositions[ cornerIndex ] = pVertices[ vertexIndex ].position;
+					pCollapsedPositions[ cornerIndex ] =
+						( vertexIndex == sourceVertex ? pTargetPosition : pPositions[ cornerIndex ] );
+				}
+
+				if( bShared )
+				{
+					++sharedTriangleCount;
+
+					continue;
+				}
+
+				float64_t normal[ 3 ], collapsedNormal[ 3 ];
+				ComputeSimplifyNormal( pPositions[ 0 ], pPositions[ 1 ], pPositions[ 2 ], normal );
+				ComputeSimplifyNormal(
+					pCollapsedPositions[ 0 ], pCollapsedPositions[ 1 ], pCollapsedPositions[ 2 ], collapsedNormal );
+				float64_t normalDot =
+					normal[ 0 ] * collapsedNormal[ 0 ] +
+					normal[ 1 ] * collapsedNormal[ 1 ] +
+					normal[ 2 ] * collapsedNormal[ 2 ];
+				float64_t normalLengthProduct = sqrt(
+					( normal[ 0 ] * normal[ 0 ] + normal[ 1 ] * normal[ 1 ] + normal[ 2 ] * normal[ 2 ] ) *
+					( collapsedNormal[ 0 ] * collapsedNormal[ 0 ] + collapsedNormal[ 1 ] * collapsedNormal[ 1 ] +
+					collapsedNormal[ 2 ] * collapsedNormal[ 2 ] ) );
+				bValid = ( normalDot > 0.0 && normalDot >= SIMPLIFY_MIN_NORMAL_COSINE * normalLengthProduct );
+			}
+
+			if( !bValid )
+			{
+				continue;
+			}
+
+			// Reject collapses that would pinch the surface, which happens when the two vertices share more neighbors
+			// than the far corners of the triangles along their edge.
+			++neighborStamp;
+
+			size_t sharedNeighborCount = 0;
+			uint32_t targetAdjacencyEnd = adjacencyOffsets[ targetVertex + 1 ];
+			for( uint32_t adjacencyIndex = adjacencyOffsets[ targetVertex ];
+				adjacencyIndex < targetAdjacencyEnd;
+				++adjacencyIndex )
+			{
+				const uint32_t* pTriangle = pIndices + adjacentTriangles[ adjacencyIndex ] * 3;
+				for( size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+				{
+					uint32_t vertexIndex = pTriangle[ cornerIndex ];
+					if( vertexIndex != sourceVertex && vertexIndex != targetVertex &&
+						neighborStamps[ vertexIndex ] == neighborStamp - 1 )
+					{
+						neighborStamps[ vertexIndex ] = neighborStamp;
+						++sharedNeighborCount;
+					}
+				}
+			}
+
+			if( sharedNeighborCount > sharedTriangleCount )
+			{
+				continue;
+			}
+
+			// Collapse the edge, and keep every vertex whose triangles it changed out of the rest of this pass.
+			remap[ sourceVertex ] = targetVertex;
+			AddSimplifyQuadric( quadrics[ targetVertex ], quadrics[ sourceVertex ] );
+
+			touchedPasses[ targetVertex ] = pass;
+			for( uint32_t adjacencyIndex = adjacencyOffsets[ sourceVertex ];
+				adjacencyIndex < sourceAdjacencyEnd;
+				++adjacencyIndex )
+			{
+				const uint32_t* pTriangle = pIndices + adjacentTriangles[ adjacencyIndex ] * 3;
+				for( size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+				{
+					touchedPasses[ pTriangle[ cornerIndex ] ] = pass;
+				}
+			}
+
+			removedTriangleCount += sharedTriangleCount;
+			++collapseCount;
+		}
+
+		if( collapseCount == 0 )
+		{
+			break;
+		}
+
+		// Rewrite the index list, dropping the triangles that collapsed.
+		size_t writeIndex = 0;
+		for( size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex )
+		{
+			uint32_t vertexIndex0 = remap[ pIndices[ triangleIndex * 3 ] ];
+			uint32_t vertexIndex1 = remap[ pIndices[ triangleIndex * 3 + 1 ] ];
+			uint32_t vertexIndex2 = remap[ pIndices[ triangleIndex * 3 + 2 ] ];
+			if( vertexIndex0 == vertexIndex1 || vertexIndex1 == vertexIndex2 || vertexIndex2 == vertexIndex0 )
+			{
+				continue;
+			}
+
+			pIndices[ writeIndex ] = vertexIndex0;
+			pIndices[ writeIndex + 1 ] = vertexIndex1;
+			pIndices[ writeIndex + 2 ] = vertexIndex2;
+			writeIndex += 3;
+		}
+
+		indexCount = writeIndex;
+	}
+
+	return indexCount;
+}
+
+#endif  // HELIUM_TOOLS
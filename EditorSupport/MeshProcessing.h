@@ -0,0 +1,128 @@
+#pragma once
+
+#include "EditorSupport/EditorSupport.h"
+
+#if HELIUM_TOOLS
+
+#include "Foundation/DynamicArray.h"
+#include "GraphicsTypes/VertexTypes.h"
+
+namespace Helium
+{
+    /// Vertex welding for mesh import.
+    ///
+    /// Vertices are looked up in an open-addressed hash table keyed on their quantized attributes (plus a
+    /// caller-supplied tag, such as the source control point), so welding a mesh costs O(n) instead of comparing every
+    /// incoming vertex against each vertex kept so far.  Only depends on the vertex types, so it can be exercised
+    /// without any source file format support.
+    class HELIUM_EDITOR_SUPPORT_API VertexWelder
+    {
+    public:
+        /// @name Construction/Destruction
+        //@{
+        explicit VertexWelder( float32_t positionTolerance = 0.0f );
+        //@}
+
+        /// @name Welding
+        //@{
+        void SetPositionTolerance( float32_t positionTolerance );
+        inline float32_t GetPositionTolerance() const;
+
+        void Reserve( size_t vertexCount );
+        void Clear();
+
+        uint32_t Weld( const StaticMeshVertex< 1 >& rVertex, uint32_t tag, bool& rbAdded );
+        inline size_t GetVertexCount() const;
+        //@}
+
+        /// @name Static Utility Functions
+        //@{
+        static void WeldMesh(
+            DynamicArray< StaticMeshVertex< 1 > >& rVertices, DynamicArray< uint32_t >& rIndices,
+            float32_t positionTolerance = 0.0f );
+        //@}
+
+    private:
+        /// Quantized vertex attributes compared when welding.
+        struct Key
+        {
+            /// Position, either snapped to the tolerance grid or the exact floating-point bits.
+            int32_t position[ 3 ];
+            /// Caller-supplied tag (vertices with different tags are never welded).
+            uint32_t tag;
+            /// Normal.
+            uint8_t normal[ 4 ];
+            /// Tangent.
+            uint8_t tangent[ 4 ];
+            /// Color.
+            uint8_t color[ 4 ];
+            /// Packed texture coordinates.
+            uint16_t texCoords[ 2 ];
+        };
+
+        /// Hash table slots (indices into m_keys, or an invalid index for empty slots).
+        DynamicArray< uint32_t > m_slots;
+        /// Keys of the welded vertices, in the order they were added.
+        DynamicArray< Key > m_keys;
+        /// Reciprocal of the position tolerance (zero to compare exact positions).
+        float32_t m_inversePositionTolerance;
+        /// Position tolerance.
+        float32_t m_positionTolerance;
+
+        /// @name Private Utility Functions
+        //@{
+        void BuildKey( const StaticMeshVertex< 1 >& rVertex, uint32_t tag, Key& rKey ) const;
+        void Rehash( size_t slotCount );
+
+        static uint32_t HashKey( const Key& rKey );
+        static bool KeysEqual( const Key& rKey0, const Key& rKey1 );
+        //@}
+    };
+
+    /// Triangle and vertex reordering for GPU throughput, and index list simplification.
+    ///
+    /// Triangles are reordered with Tipsify (Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex Locality
+    /// and Reduced Overdraw") to improve post-transform vertex cache reuse.  The clusters it produces can then be
+    /// sorted so that outward-facing geometry is drawn first, and vertices renumbered in the order they're first used
+    /// to improve fetch locality.  Every step is deterministic, so caching the same source data twice produces the same
+    /// output.  Index lists can also be simplified to build coarser levels of detail that reuse the same vertices.
+    /// All functions operate on a single index range whose indices address vertices [0, vertexCount).
+    class HELIUM_EDITOR_SUPPORT_API MeshOptimizer
+    {
+    public:
+        /// Post-transform vertex cache size (in vertices) assumed when optimizing and measuring.
+        static const uint32_t DEFAULT_CACHE_SIZE = 16;
+
+        /// @name Measurement
+        //@{
+        static float32_t ComputeAcmr(
+            const uint32_t* pIndices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = DEFAULT_CACHE_SIZE );
+        //@}
+
+        /// @name Optimization
+        //@{
+        static void OptimizeVertexCache(
+            uint32_t* pIndices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = DEFAULT_CACHE_SIZE,
+            DynamicArray< uint32_t >* pClusterStarts = NULL );
+        static void OptimizeOverdraw(
+            uint32_t* pIndices, size_t indexCount, const StaticMeshVertex< 1 >* pVertices, size_t vertexCount,
+            const DynamicArray< uint32_t >& rClusterStarts );
+        static void OptimizeVertexFetch(
+            uint32_t* pIndices, size_t indexCount, size_t vertexCount, DynamicArray< uint32_t >& rRemap );
+
+        template< typename T > static void RemapVertices(
+            T* pVertices, size_t vertexCount, const DynamicArray< uint32_t >& rRemap );
+        //@}
+
+        /// @name Simplification
+        //@{
+        static size_t SimplifyMesh(
+            uint32_t* pIndices, size_t indexCount, const StaticMeshVertex< 1 >* pVertices, size_t vertexCount,
+            size_t targetIndexCount );
+        //@}
+    };
+}
+
+#include "EditorSupport/MeshProcessing.inl"
+
+#endif  // HELIUM_TOOLS
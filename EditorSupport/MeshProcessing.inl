@@ -0,0 +1,42 @@
+namespace Helium
+{
+    /// Get the position tolerance used when welding.
+    ///
+    /// @return  Size of the grid to which positions are snapped before being compared, or zero if positions must
+    ///          match exactly.
+    ///
+    /// @see SetPositionTolerance()
+    float32_t VertexWelder::GetPositionTolerance() const
+    {
+        return m_positionTolerance;
+    }
+
+    /// Get the number of unique vertices added to this welder.
+    ///
+    /// @return  Welded vertex count.
+    size_t VertexWelder::GetVertexCount() const
+    {
+        return m_keys.GetSize();
+    }
+
+    /// Reorder per-vertex data to match a vertex remap table.
+    ///
+    /// @param[in,out] pVertices    Per-vertex data to reorder (vertices, blend data, etc.).
+    /// @param[in]     vertexCount  Number of vertices.
+    /// @param[in]     rRemap       New index of each vertex, as returned by OptimizeVertexFetch().
+    template< typename T >
+    void MeshOptimizer::RemapVertices( T* pVertices, size_t vertexCount, const DynamicArray< uint32_t >& rRemap )
+    {
+        HELIUM_ASSERT( pVertices || vertexCount == 0 );
+        HELIUM_ASSERT( rRemap.GetSize() == vertexCount );
+
+        DynamicArray< T > sourceVertices;
+        sourceVertices.AddArray( pVertices, vertexCount );
+
+        for( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+        {
+            HELIUM_ASSERT( rRemap[ vertexIndex ] < vertexCount );
+            pVertices[ rRemap[ vertexIndex ] ] = sourceVertices[ vertexIndex ];
+        }
+    }
+}
@@ -11,11 +11,234 @@
 #include "PcSupport/AssetPreprocessor.h"
 #include "PcSupport/PlatformPreprocessor.h"
 #include "EditorSupport/FbxSupport.h"
+#include "EditorSupport/MeshProcessing.h"
 
 HELIUM_IMPLEMENT_ASSET( Helium::MeshResourceHandler, EditorSupport, 0 );
 
 using namespace Helium;
 
+/// Reorder the triangles and vertices of each mesh section for GPU efficiency.
+///
+/// Sections are optimized independently, as each is drawn separately and addresses its own vertex range.
+///
+/// @param[in,out] rVertices              Mesh vertices.
+/// @param[in,out] rIndices               Mesh indices (relative to the start of each section).
+/// @param[in,out] rVertexBlendData       Per-vertex blend data (empty for static meshes).
+/// @param[in]     rSectionVertexCounts   Number of vertices in each section.
+/// @param[in]     rSectionTriangleCounts Number of triangles in each section.
+/// @param[in]     rSourceFilePath        Source file path (for logging).
+static void OptimizeMeshSections(
+	DynamicArray< StaticMeshVertex< 1 > >& rVertices,
+	DynamicArray< uint32_t >& rIndices,
+	DynamicArray< FbxSupport::BlendData >& rVertexBlendData,
+	const DynamicArray< uint32_t >& rSectionVertexCounts,
+	const DynamicArray< uint32_t >& rSectionTriangleCounts,
+	const String& rSourceFilePath )
+{
+	HELIUM_ASSERT( rSectionVertexCounts.GetSize() == rSectionTriangleCounts.GetSize() );
+	HELIUM_ASSERT( rVertexBlendData.IsEmpty() || rVertexBlendData.GetSize() == rVertices.GetSize() );
+
+	float32_t acmrBefore = 0.0f;
+	float32_t acmrAfter = 0.0f;
+
+	DynamicArray< uint32_t > clusterStarts;
+	DynamicArray< uint32_t > remap;
+
+	size_t vertexOffset = 0;
+	size_t indexOffset = 0;
+	size_t sectionCount = rSectionVertexCounts.GetSize();
+	for( size_t sectionIndex = 0; sectionIndex < sectionCount; ++sectionIndex )
+	{
+		size_t vertexCount = rSectionVertexCounts[ sectionIndex ];
+		size_t indexCount = static_cast< size_t >( rSectionTriangleCounts[ sectionIndex ] ) * 3;
+		HELIUM_ASSERT( vertexOffset + vertexCount <= rVertices.GetSize() );
+		HELIUM_ASSERT( indexOffset + indexCount <= rIndices.GetSize() );
+
+		StaticMeshVertex< 1 >* pVertices = rVertices.GetData() + vertexOffset;
+		uint32_t* pIndices = rIndices.GetData() + indexOffset;
+
+		// Weight each section's ratio by its share of the triangles so the totals describe the whole mesh.
+		float32_t sectionWeight = static_cast< float32_t >( indexCount );
+		acmrBefore += MeshOptimizer::ComputeAcmr( pIndices, indexCount, vertexCount ) * sectionWeight;
+
+		MeshOptimizer::OptimizeVertexCache(
+			pIndices,
+			indexCount,
+			vertexCount,
+			MeshOptimizer::DEFAULT_CACHE_SIZE,
+			&clusterStarts );
+#if HELIUM_OPTIMIZE_MESH_OVERDRAW
+		MeshOptimizer::OptimizeOverdraw( pIndices, indexCount, pVertices, vertexCount, clusterStarts );
+#endif
+
+		acmrAfter += MeshOptimizer::ComputeAcmr( pIndices, indexCount, vertexCount ) * sectionWeight;
+
+		MeshOptimizer::OptimizeVertexFetch( pIndices, indexCount, vertexCount, remap );
+		MeshOptimizer::RemapVertices( pVertices, vertexCount, remap );
+		if( !rVertexBlendData.IsEmpty() )
+		{
+			MeshOptimizer::RemapVertices( rVertexBlendData.GetData() + vertexOffset, vertexCount, remap );
+		}
+
+		vertexOffset += vertexCount;
+		indexOffset += indexCount;
+	}
+
+	if( indexOffset != 0 )
+	{
+		acmrBefore /= static_cast< float32_t >( indexOffset );
+		acmrAfter /= static_cast< float32_t >( indexOffset );
+	}
+
+	HELIUM_TRACE(
+		TraceLevels::Info,
+		( TXT( "MeshResourceHandler::CacheResource(): Optimized \"%s\" for a %" ) PRIu32 TXT( "-entry vertex " )
+		TXT( "cache, ACMR %.3f -> %.3f.\n" ) ),
+		*rSourceFilePath,
+		MeshOptimizer::DEFAULT_CACHE_SIZE,
+		acmrBefore,
+		acmrAfter );
+}
+
+/// Generate coarser levels of detail for a mesh by simplifying the index list of each section.
+///
+/// Each level of detail targets half the triangles of the previous one, and reuses the vertices of the full detail
+/// mesh so that only an additional index buffer is needed at runtime.  Generation stops early once simplification no
+/// longer removes a meaningful share of the triangles (for instance, when most of the remaining vertices are on open
+/// borders or attribute seams).
+///
+/// @param[in]  rVertices                  Mesh vertices.
+/// @param[in]  rIndices                   Full detail mesh indices (relative to the start of each section).
+/// @param[in]  rSectionVertexCounts       Number of vertices in each section.
+/// @param[in]  rSectionTriangleCounts     Number of triangles in each section of the full detail mesh.
+/// @param[out] rLodIndices                Indices of each generated level of detail.
+/// @param[out] rLodSectionTriangleCounts  Number of triangles in each section of each generated level of detail.
+/// @param[out] rLodScreenSizes            Projected size below which each generated level of detail is used.
+/// @param[in]  rSourceFilePath            Source file path (for logging).
+static void GenerateMeshLods(
+	const DynamicArray< StaticMeshVertex< 1 > >& rVertices,
+	const DynamicArray< uint32_t >& rIndices,
+	const DynamicArray< uint32_t >& rSectionVertexCounts,
+	const DynamicArray< uint32_t >& rSectionTriangleCounts,
+	DynamicArray< DynamicArray< uint32_t > >& rLodIndices,
+	DynamicArray< uint32_t >& rLodSectionTriangleCounts,
+	DynamicArray< float32_t >& rLodScreenSizes,
+	const String& rSourceFilePath )
+{
+	HELIUM_ASSERT( rSectionVertexCounts.GetSize() == rSectionTriangleCounts.GetSize() );
+
+	// Sections smaller than this are kept as they are.
+	static const uint32_t MIN_SIMPLIFY_TRIANGLE_COUNT = 32;
+
+	rLodIndices.Resize( 0 );
+	rLodIndices.Reserve( HELIUM_MESH_GENERATED_LOD_COUNT );
+	rLodSectionTriangleCounts.Resize( 0 );
+	rLodScreenSizes.Resize( 0 );
+
+	size_t sectionCount = rSectionTriangleCounts.GetSize();
+
+	const DynamicArray< uint32_t >* pPreviousIndices = &rIndices;
+	const uint32_t* pPreviousTriangleCounts = rSectionTriangleCounts.GetData();
+	size_t previousTriangleCount = rIndices.GetSize() / 3;
+
+	float32_t screenSize = 0.5f;
+	for( size_t lodIndex = 1; lodIndex <= HELIUM_MESH_GENERATED_LOD_COUNT; ++lodIndex )
+	{
+		DynamicArray< uint32_t > lodIndices;
+		lodIndices.Reserve( pPreviousIndices->GetSize() );
+
+		DynamicArray< uint32_t > lodTriangleCounts;
+		lodTriangleCounts.Resize( sectionCount );
+
+		size_t vertexOffset = 0;
+		size_t previousIndexOffset = 0;
+		for( size_t sectionIndex = 0; sectionIndex < sectionCount; ++sectionIndex )
+		{
+			size_t vertexCount = rSectionVertexCounts[ sectionIndex ];
+			size_t indexCount = static_cast< size_t >( pPreviousTriangleCounts[ sectionIndex ] ) * 3;
+			HELIUM_ASSERT( vertexOffset + vertexCount <= rVertices.GetSize() );
+			HELIUM_ASSERT( previousIndexOffset + indexCount <= pPreviousIndices->GetSize() );
+
+			size_t lodIndexOffset = lodIndices.GetSize();
+			lodIndices.AddArray( pPreviousIndices->GetData() + previousIndexOffset, indexCount );
+
+			size_t targetTriangleCount = rSectionTriangleCounts[ sectionIndex ] >> lodIndex;
+			if( indexCount / 3 > MIN_SIMPLIFY_TRIANGLE_COUNT && indexCount / 3 > targetTriangleCount )
+			{
+				uint32_t* pLodIndices = lodIndices.GetData() + lodIndexOffset;
+				indexCount = MeshOptimizer::SimplifyMesh(
+					pLodIndices,
+					indexCount,
+					rVertices.GetData() + vertexOffset,
+					vertexCount,
+					Max< size_t >( targetTriangleCount, MIN_SIMPLIFY_TRIANGLE_COUNT ) * 3 );
+				MeshOptimizer::OptimizeVertexCache( pLodIndices, indexCount, vertexCount );
+
+				lodIndices.Resize( lodIndexOffset + indexCount );
+			}
+
+			lodTriangleCounts[ sectionIndex ] = static_cast< uint32_t >( indexCount / 3 );
+
+			vertexOffset += vertexCount;
+			previousIndexOffset += static_cast< size_t >( pPreviousTriangleCounts[ sectionIndex ] ) * 3;
+		}
+
+		// Stop once a level of detail would save less than a tenth of the triangles of the previous one.
+		size_t lodTriangleCount = lodIndices.GetSize() / 3;
+		if( lodTriangleCount * 10 > previousTriangleCount * 9 )
+		{
+			break;
+		}
+
+		HELIUM_TRACE(
+			TraceLevels::Info,
+			( TXT( "MeshResourceHandler::CacheResource(): Generated level of detail %" ) PRIuSZ TXT( " for \"%s\" " )
+			TXT( "with %" ) PRIuSZ TXT( " triangles (%" ) PRIuSZ TXT( " in the full detail mesh).\n" ) ),
+			lodIndex,
+			*rSourceFilePath,
+			lodTriangleCount,
+			rIndices.GetSize() / 3 );
+
+		rLodIndices.New()->Swap( lodIndices );
+		rLodSectionTriangleCounts.AddArray( lodTriangleCounts.GetData(), sectionCount );
+		rLodScreenSizes.Push( screenSize );
+
+		pPreviousIndices = &rLodIndices.GetLast();
+		pPreviousTriangleCounts = rLodSectionTriangleCounts.GetData() + ( lodIndex - 1 ) * sectionCount;
+		previousTriangleCount = lodTriangleCount;
+		screenSize *= 0.5f;
+	}
+}
+
+/// Write mesh indices to a cache sub-data buffer.
+///
+/// @param[out] rBuffer        Sub-data buffer.
+/// @param[in]  rIndices       Mesh indices.
+/// @param[in]  b32BitIndices  True to write 32-bit indices, false to write 16-bit indices.
+static void WriteIndexData(
+	DynamicArray< uint8_t >& rBuffer,
+	const DynamicArray< uint32_t >& rIndices,
+	bool b32BitIndices )
+{
+	size_t indexCount = rIndices.GetSize();
+	if( b32BitIndices )
+	{
+		size_t indexDataSize = indexCount * sizeof( uint32_t );
+		rBuffer.Resize( indexDataSize );
+		MemoryCopy( rBuffer.GetData(), rIndices.GetData(), indexDataSize );
+	}
+	else
+	{
+		rBuffer.Resize( indexCount * sizeof( uint16_t ) );
+		uint16_t* pIndices16 = reinterpret_cast< uint16_t* >( rBuffer.GetData() );
+		for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+		{
+			HELIUM_ASSERT( rIndices[ indexIndex ] <= UINT16_MAX );
+			pIndices16[ indexIndex ] = static_cast< uint16_t >( rIndices[ indexIndex ] );
+		}
+	}
+}
+
 /// Constructor.
 MeshResourceHandler::MeshResourceHandler()
 : m_rFbxSupport( FbxSupport::StaticAcquire() )
@@ -57,8 +280,8 @@ bool MeshResourceHandler::CacheResource(
 
 	// Load and parse the mesh data.
 	DynamicArray< StaticMeshVertex< 1 > > vertices;
-	DynamicArray< uint16_t > indices;
-	//DynamicArray< uint16_t > sectionVertexCounts;
+	DynamicArray< uint32_t > indices;
+	//DynamicArray< uint32_t > sectionVertexCounts;
 	//DynamicArray< uint32_t > sectionTriangleCounts;
 	DynamicArray< FbxSupport::BoneData > bones;
 	DynamicArray< FbxSupport::BlendData > vertexBlendData;
@@ -94,6 +317,49 @@ bool MeshResourceHandler::CacheResource(
 	HELIUM_ASSERT( triangleCountActual <= UINT32_MAX );
 	persistentResourceData->m_triangleCount = static_cast< uint32_t >( triangleCountActual );
 
+	OptimizeMeshSections(
+		vertices,
+		indices,
+		vertexBlendData,
+		persistentResourceData->m_sectionVertexCounts,
+		persistentResourceData->m_sectionTriangleCounts,
+		rSourceFilePath );
+
+	DynamicArray< DynamicArray< uint32_t > > lodIndices;
+	GenerateMeshLods(
+		vertices,
+		indices,
+		persistentResourceData->m_sectionVertexCounts,
+		persistentResourceData->m_sectionTriangleCounts,
+		lodIndices,
+		persistentResourceData->m_lodSectionTriangleCounts,
+		persistentResourceData->m_lodScreenSizes,
+		rSourceFilePath );
+
+	// Indices are relative to the start of their section, so 16-bit indices are enough unless a single section
+	// addresses more vertices than they can reach.  Only those meshes pay for 32-bit indices.
+	bool b32BitIndices = false;
+	size_t sectionCount = persistentResourceData->m_sectionVertexCounts.GetSize();
+	for( size_t sectionIndex = 0; sectionIndex < sectionCount; ++sectionIndex )
+	{
+		if( persistentResourceData->m_sectionVertexCounts[ sectionIndex ] > static_cast< uint32_t >( UINT16_MAX ) + 1 )
+		{
+			b32BitIndices = true;
+			break;
+		}
+	}
+
+	persistentResourceData->m_b32BitIndices = b32BitIndices;
+	if( b32BitIndices )
+	{
+		HELIUM_TRACE(
+			TraceLevels::Info,
+			( TXT( "MeshResourceHandler::CacheResource(): Using 32-bit indices for mesh \"%s\" (%" ) PRIuSZ
+			TXT( " vertices).\n" ) ),
+			*rSourceFilePath,
+			vertexCountActual );
+	}
+
 	size_t boneCountActual = bones.GetSize();
 	HELIUM_ASSERT( boneCountActual <= UINT8_MAX );
 	persistentResourceData->m_boneCount = static_cast< uint8_t >( boneCountActual );
@@ -137,8 +403,11 @@ bool MeshResourceHandler::CacheResource(
 			static_cast< Cache::EPlatform >( platformIndex ) );
 
 		DynamicArray< DynamicArray< uint8_t > >& rSubDataBuffers = rPreprocessedData.subDataBuffers;
-		rSubDataBuffers.Reserve( 2 );
-		rSubDataBuffers.Resize( 2 );
+		// The vertex and full detail index buffers are followed by the index buffer of each additional level of
+		// detail.
+		size_t lodCount = lodIndices.GetSize();
+		rSubDataBuffers.Reserve( 2 + lodCount );
+		rSubDataBuffers.Resize( 2 + lodCount );
 		rSubDataBuffers.Trim();
 
 		Cache::WriteCacheObjectToBuffer( persistentResourceData.Get(), rPreprocessedData.persistentDataBuffer);
@@ -241,9 +510,11 @@ bool MeshResourceHandler::CacheResource(
 			}
 		}
 		
-		size_t indexDataSize = indexCount * sizeof(uint16_t);
-		rSubDataBuffers[ 1 ].Resize(indexDataSize);
-		MemoryCopy(rSubDataBuffers[1].GetData(), indices.GetData(), indexDataSize);
+		WriteIndexData( rSubDataBuffers[ 1 ], indices, b32BitIndices );
+		for( size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex )
+		{
+			WriteIndexData( rSubDataBuffers[ 2 + lodIndex ], lodIndices[ lodIndex ], b32BitIndices );
+		}
 
 		// Platform data is now loaded.
 		rPreprocessedData.bLoaded = true;
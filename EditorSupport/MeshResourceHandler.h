@@ -8,6 +8,12 @@
 
 #include "Graphics/Mesh.h"
 
+// Non-zero to reorder each mesh section's triangle clusters to reduce overdraw after optimizing for the vertex cache.
+#define HELIUM_OPTIMIZE_MESH_OVERDRAW 1
+
+// Maximum number of coarser levels of detail generated for each mesh, in addition to the full detail mesh.
+#define HELIUM_MESH_GENERATED_LOD_COUNT 3
+
 namespace Helium
 {
     class FbxSupport;
@@ -33,7 +33,13 @@ static const uint32_t TOC_MAGIC = 0xcac4e70c;
 /// TOC header magic number (byte-swapped).
 static const uint32_t TOC_MAGIC_SWAPPED = 0x0ce7c4ca;
 /// Cache format version number.
-const uint32_t Cache::sm_Version = 0;
+///
+/// This must be bumped whenever the layout of cached data changes (including the persistent resource data of any
+/// resource type), so that stale caches are discarded instead of being misread.
+///
+/// - 1: 32-bit mesh section vertex counts and 32-bit index flag.
+/// - 2: Per-LOD mesh screen sizes and triangle counts.
+const uint32_t Cache::sm_Version = 2;
 
 /// Constructor.
 Cache::Cache()
@@ -587,6 +593,18 @@ bool Cache::FinalizeTocLoad()
 		return false;
 	}
 
+	if( version < sm_Version )
+	{
+		HELIUM_TRACE(
+			TraceLevels::Warning,
+			( TXT( "Cache::FinalizeTocLoad(): Cache version number (%" ) PRIu32 TXT( ") is older than the current " )
+			TXT( "version (%" ) PRIu32 TXT( "), so its contents will be discarded and rebuilt.\n" ) ),
+			version,
+			sm_Version );
+
+		return false;
+	}
+
 	if( version > sm_Version )
 	{
 		HELIUM_TRACE(
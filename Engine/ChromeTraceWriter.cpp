@@ -0,0 +1,132 @@
+#include "EnginePch.h"
+#include "Engine/ChromeTraceWriter.h"
+
+#include "Platform/Timer.h"
+#include "Foundation/FileStream.h"
+
+using namespace Helium;
+
+/// Constructor.
+///
+/// @param[in] processId  Process identifier given to all events, used to keep traces from different profilers apart.
+/// @param[in] baseTicks  Tick count written as time zero (usually the earliest recorded tick count).
+ChromeTraceWriter::ChromeTraceWriter( uint32_t processId, uint64_t baseTicks )
+: m_processId( processId )
+, m_baseTicks( baseTicks )
+, m_microsecondsPerTick( Timer::GetSecondsPerTick() * 1000000.0 )
+{
+}
+
+/// Write the display name of a thread track.
+///
+/// @param[in] threadId     Thread identifier.
+/// @param[in] pThreadName  Name to display for the thread.
+void ChromeTraceWriter::WriteThreadName( uint32_t threadId, const tchar_t* pThreadName )
+{
+    HELIUM_ASSERT( pThreadName );
+
+    m_line.Format(
+        TXT( "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%" ) PRIu32 TXT( ",\"tid\":%" ) PRIu32
+        TXT( ",\"args\":{\"name\":\"%s\"}}" ),
+        ( m_events.IsEmpty() ? TXT( "" ) : TXT( ",\n" ) ),
+        m_processId,
+        threadId,
+        pThreadName );
+    m_events += m_line;
+}
+
+/// Write a complete (begin and end) event.
+///
+/// @param[in] pName       Event name.
+/// @param[in] pCategory   Event category.
+/// @param[in] threadId    Identifier of the thread on whose track the event is shown.
+/// @param[in] beginTicks  Tick count at which the event began.
+/// @param[in] endTicks    Tick count at which the event ended.
+/// @param[in] pArgs       JSON object members to write as the event's "args", or null for none.
+void ChromeTraceWriter::WriteCompleteEvent(
+    const tchar_t* pName,
+    const tchar_t* pCategory,
+    uint32_t threadId,
+    uint64_t beginTicks,
+    uint64_t endTicks,
+    const tchar_t* pArgs )
+{
+    HELIUM_ASSERT( pName );
+    HELIUM_ASSERT( pCategory );
+
+    m_line.Format(
+        TXT( "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%" ) PRIu32 TXT( ",\"tid\":%" ) PRIu32
+        TXT( ",\"ts\":%.3f,\"dur\":%.3f%s%s%s}" ),
+        ( m_events.IsEmpty() ? TXT( "" ) : TXT( ",\n" ) ),
+        pName,
+        pCategory,
+        m_processId,
+        threadId,
+        static_cast< float64_t >( beginTicks - m_baseTicks ) * m_microsecondsPerTick,
+        static_cast< float64_t >( endTicks - beginTicks ) * m_microsecondsPerTick,
+        ( pArgs ? TXT( ",\"args\":{" ) : TXT( "" ) ),
+        ( pArgs ? pArgs : TXT( "" ) ),
+        ( pArgs ? TXT( "}" ) : TXT( "" ) ) );
+    m_events += m_line;
+}
+
+/// Set the JSON object members to write as the trace's "otherData" metadata.
+///
+/// @param[in] rOtherData  Object members, or an empty string for none.
+void ChromeTraceWriter::SetOtherData( const String& rOtherData )
+{
+    m_otherData = rOtherData;
+}
+
+/// Write the trace to a file.
+///
+/// @param[in] rFileName   Name of the file to write.
+/// @param[in] pOwnerName  Name of the profiler writing the trace, used in error messages.
+///
+/// @return  True if the file was written successfully, false if not.
+bool ChromeTraceWriter::WriteFile( const String& rFileName, const tchar_t* pOwnerName ) const
+{
+    HELIUM_ASSERT( pOwnerName );
+
+    String trace( TXT( "{\"traceEvents\":[\n" ) );
+    trace += m_events;
+    trace += TXT( "\n]" );
+
+    if( !m_otherData.IsEmpty() )
+    {
+        trace += TXT( ",\n\"otherData\":{" );
+        trace += m_otherData;
+        trace += TXT( "}" );
+    }
+
+    trace += TXT( "}\n" );
+
+    FileStream* pStream = FileStream::OpenFileStream( rFileName, FileStream::MODE_WRITE, true );
+    if( !pStream )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Error,
+            TXT( "%s: Failed to open \"%s\" for writing.\n" ),
+            pOwnerName,
+            *rFileName );
+
+        return false;
+    }
+
+    size_t size = trace.GetSize();
+    size_t writeSize = pStream->Write( *trace, sizeof( tchar_t ), size );
+    delete pStream;
+
+    if( writeSize != size )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Error,
+            TXT( "%s: Failed to write trace to \"%s\".\n" ),
+            pOwnerName,
+            *rFileName );
+
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Engine/Engine.h"
+
+#include "Foundation/String.h"
+
+namespace Helium
+{
+    /// Builder for files in the Chrome trace event format.
+    ///
+    /// The resulting files can be loaded in "chrome://tracing" (or any compatible viewer).  Each writer emits events
+    /// for a single process id, so traces from several profilers can be loaded side by side without their thread
+    /// tracks colliding.
+    class HELIUM_ENGINE_API ChromeTraceWriter : NonCopyable
+    {
+    public:
+        /// @name Construction/Destruction
+        //@{
+        ChromeTraceWriter( uint32_t processId, uint64_t baseTicks );
+        //@}
+
+        /// @name Event Writing
+        //@{
+        void WriteThreadName( uint32_t threadId, const tchar_t* pThreadName );
+        void WriteCompleteEvent(
+            const tchar_t* pName, const tchar_t* pCategory, uint32_t threadId, uint64_t beginTicks, uint64_t endTicks,
+            const tchar_t* pArgs = NULL );
+        void SetOtherData( const String& rOtherData );
+        //@}
+
+        /// @name Output
+        //@{
+        bool WriteFile( const String& rFileName, const tchar_t* pOwnerName ) const;
+        //@}
+
+    private:
+        /// Events written so far.
+        String m_events;
+        /// JSON object members to write as the trace's "otherData" (empty for none).
+        String m_otherData;
+        /// Line formatting buffer.
+        String m_line;
+        /// Process identifier given to all events.
+        uint32_t m_processId;
+        /// Tick count written as time zero.
+        uint64_t m_baseTicks;
+        /// Microseconds per tick.
+        float64_t m_microsecondsPerTick;
+    };
+}
@@ -38,6 +38,7 @@ namespace Helium
             HELIUM_ASSERT( pContext );
             static_cast< JobBase< ParametersType >* >( pJob )->Run( pContext );
         }
+        inline static const tchar_t* GetJobName() { return TXT( "JobBase" ); }
         //@}
         
         typedef ParametersType Parameters;
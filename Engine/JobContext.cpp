@@ -10,6 +10,11 @@ JobContext::JobContext()
 : m_pTask( NULL )
 , m_pActiveSpawner( NULL )
 , m_bAllocatedChildren( false )
+#if HELIUM_PROFILE_JOBS
+, m_profileJobId( 0 )
+, m_profileParentJobId( 0 )
+, m_profileFlags( 0 )
+#endif
 {
 }
 
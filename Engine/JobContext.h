@@ -5,6 +5,7 @@
 #include "Platform/Trace.h"
 #include "Foundation/DynamicArray.h"
 #include "Engine/JobManager.h"
+#include "Engine/JobProfiler.h"
 
 #include <tbb/task.h>
 
@@ -40,6 +41,9 @@ namespace Helium
 
             inline void* GetData() const;
             inline JOB_EXECUTE_CALLBACK* GetExecuteCallback() const;
+#if HELIUM_PROFILE_JOBS
+            inline const tchar_t* GetJobName() const;
+#endif
             //@}
 
         private:
@@ -47,6 +51,10 @@ namespace Helium
             void* m_pData;
             /// Job execution callback.
             JOB_EXECUTE_CALLBACK* m_pExecuteCallback;
+#if HELIUM_PROFILE_JOBS
+            /// Job type name for profiling.
+            const tchar_t* m_pJobName;
+#endif
         };
 
         /// Job spawner.
@@ -118,6 +126,17 @@ namespace Helium
         /// True if a continuation/child jobs have already been spawned.
         bool m_bAllocatedChildren;
 
+#if HELIUM_PROFILE_JOBS
+        /// Profiler job identifier (zero if this job was spawned while the profiler was not recording).
+        uint32_t m_profileJobId;
+        /// Profiler identifier of the job that spawned this job.
+        uint32_t m_profileParentJobId;
+        /// Profiler event flags.
+        uint32_t m_profileFlags;
+
+        friend class JobProfiler;
+#endif
+
         /// @name Construction/Destruction
         //@{
         JobContext();
@@ -72,6 +72,9 @@ namespace Helium
     JobContext::AttachData::AttachData()
         : m_pData( NULL )
         , m_pExecuteCallback( NULL )
+#if HELIUM_PROFILE_JOBS
+        , m_pJobName( NULL )
+#endif
     {
     }
 
@@ -82,6 +85,9 @@ namespace Helium
     JobContext::AttachData::AttachData( JobType* pJob )
         : m_pData( pJob )
         , m_pExecuteCallback( JobType::RunCallback )
+#if HELIUM_PROFILE_JOBS
+        , m_pJobName( JobType::GetJobName() )
+#endif
     {
         HELIUM_ASSERT( pJob );
     }
@@ -98,6 +104,9 @@ namespace Helium
 
         m_pData = pJob;
         m_pExecuteCallback = JobType::RunCallback;
+#if HELIUM_PROFILE_JOBS
+        m_pJobName = JobType::GetJobName();
+#endif
     }
 
     /// Set the job to attach.
@@ -113,6 +122,9 @@ namespace Helium
 
         m_pData = pData;
         m_pExecuteCallback = pExecuteCallback;
+#if HELIUM_PROFILE_JOBS
+        m_pJobName = NULL;
+#endif
     }
 
     /// Clear the job information.
@@ -122,6 +134,9 @@ namespace Helium
     {
         m_pData = NULL;
         m_pExecuteCallback = NULL;
+#if HELIUM_PROFILE_JOBS
+        m_pJobName = NULL;
+#endif
     }
 
     /// Get the pointer to the job data.
@@ -144,6 +159,18 @@ namespace Helium
         return m_pExecuteCallback;
     }
 
+#if HELIUM_PROFILE_JOBS
+    /// Get the name of the attached job type.
+    ///
+    /// @return  Job type name, or null if the job was attached without type information.
+    ///
+    /// @see GetData(), GetExecuteCallback()
+    const tchar_t* JobContext::AttachData::GetJobName() const
+    {
+        return m_pJobName;
+    }
+#endif
+
     /// Constructor.
     ///
     /// @param[in] pContext  Job context from which to spawn jobs, or null to spawn root jobs.  Note that continuation
@@ -226,6 +253,14 @@ namespace Helium
             HELIUM_ASSERT( pChildContext );
             new( pChildContext ) JobContext;
 
+#if HELIUM_PROFILE_JOBS
+            JobProfiler* pProfiler = JobProfiler::GetRecordingInstance();
+            if( pProfiler )
+            {
+                pProfiler->OnContextAllocated( pChildContext, m_pContext, 0 );
+            }
+#endif
+
             // Allocate jobs as children of the continuation context if one has been already allocated.
             JobContext* pSourceContext = m_pContinuationContext;
             if( !pSourceContext )
@@ -245,6 +280,14 @@ namespace Helium
             HELIUM_ASSERT( pChildContext );
             new( pChildContext ) JobContext;
 
+#if HELIUM_PROFILE_JOBS
+            JobProfiler* pProfiler = JobProfiler::GetRecordingInstance();
+            if( pProfiler )
+            {
+                pProfiler->OnContextAllocated( pChildContext, NULL, JobProfiler::FLAG_ROOT );
+            }
+#endif
+
             tbb::task* pChildTask = JobContext::AllocateRootTask( pChildContext );
             HELIUM_ASSERT( pChildTask );
 
@@ -334,6 +377,14 @@ namespace Helium
         HELIUM_ASSERT( m_pContinuationContext );
         new( m_pContinuationContext ) JobContext;
 
+#if HELIUM_PROFILE_JOBS
+        JobProfiler* pProfiler = JobProfiler::GetRecordingInstance();
+        if( pProfiler )
+        {
+            pProfiler->OnContextAllocated( m_pContinuationContext, m_pContext, JobProfiler::FLAG_CONTINUATION );
+        }
+#endif
+
         tbb::task* pContinuationTask = m_pContext->AllocateContinuationTask( m_pContinuationContext );
         HELIUM_ASSERT( pContinuationTask );
 
@@ -52,9 +52,9 @@ void JobManager::Shutdown()
             TraceLevels::Info,
             TXT( "%" ) PRIu32 TXT( "\t%" ) PRIu32 TXT( "\t%" ) PRIu32 TXT( "\t%" ) PRIu32 TXT( "\n" ),
             nodeIndex,
-            pNode->localHits,
-            pNode->stolenHits,
-            pNode->misses );
+            pNode->stats.localHits,
+            pNode->stats.stolenHits,
+            pNode->stats.misses );
         ++nodeIndex;
 #endif
 
@@ -91,7 +91,7 @@ void* JobManager::AllocateJobUninitialized( size_t size )
     if( pJob )
     {
 #if HELIUM_TRACK_JOB_POOL_HITS
-        ++pLocalNode->localHits;
+        ++pLocalNode->stats.localHits;
 #endif
 
         return pJob;
@@ -105,7 +105,7 @@ void* JobManager::AllocateJobUninitialized( size_t size )
         if( pJob )
         {
 #if HELIUM_TRACK_JOB_POOL_HITS
-            ++pLocalNode->stolenHits;
+            ++pLocalNode->stats.stolenHits;
 #endif
 
             return pJob;
@@ -119,7 +119,7 @@ void* JobManager::AllocateJobUninitialized( size_t size )
         if( pJob )
         {
 #if HELIUM_TRACK_JOB_POOL_HITS
-            ++pLocalNode->stolenHits;
+            ++pLocalNode->stats.stolenHits;
 #endif
 
             return pJob;
@@ -131,7 +131,7 @@ void* JobManager::AllocateJobUninitialized( size_t size )
     HELIUM_ASSERT( pJob );
 
 #if HELIUM_TRACK_JOB_POOL_HITS
-    ++pLocalNode->misses;
+    ++pLocalNode->stats.misses;
 #endif
 
 
@@ -160,6 +160,24 @@ void JobManager::ReleaseJobUninitialized( void* pJob, size_t size )
     pLocalNode->pool.ReleaseUninitialized( pJob, size );
 }
 
+#if HELIUM_TRACK_JOB_POOL_HITS
+/// Get a snapshot of the job pool allocation statistics for each thread.
+///
+/// Statistics are updated without synchronization, so values for threads that are actively allocating jobs may be
+/// slightly out of date.
+///
+/// @param[out] rStats  Statistics for each thread's job pool, in pool list order.
+void JobManager::GetPoolStats( DynamicArray< PoolStats >& rStats ) const
+{
+    rStats.Resize( 0 );
+
+    for( PoolNode* pNode = m_pHeadPool; pNode != NULL; pNode = pNode->pNext )
+    {
+        rStats.Push( pNode->stats );
+    }
+}
+#endif
+
 /// Get the static task manager instance, creating it if necessary.
 ///
 /// @return  Job manager instance.
@@ -203,9 +221,9 @@ JobManager::PoolNode* JobManager::GetThreadLocalPoolNode()
         m_poolTls.SetPointer( pNode );
 
 #if HELIUM_TRACK_JOB_POOL_HITS
-        pNode->localHits = 0;
-        pNode->stolenHits = 0;
-        pNode->misses = 0;
+        pNode->stats.localHits = 0;
+        pNode->stats.stolenHits = 0;
+        pNode->stats.misses = 0;
 #endif
 
         PoolNode* pTestNext;
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Engine/JobPool.h"
+#include "Engine/JobProfiler.h"
 
+#include "Foundation/DynamicArray.h"
 #include "Platform/Thread.h"
 
 #ifndef HELIUM_TRACK_JOB_POOL_HITS
@@ -16,6 +18,19 @@ namespace Helium
     class HELIUM_ENGINE_API JobManager : NonCopyable
     {
     public:
+#if HELIUM_TRACK_JOB_POOL_HITS
+        /// Job pool allocation statistics for a single thread.
+        struct PoolStats
+        {
+            /// Hits on jobs pulled from the local thread's pool.
+            uint32_t localHits;
+            /// Hits on jobs pulled from other threads' pools.
+            uint32_t stolenHits;
+            /// Misses (new jobs needed to be allocated).
+            uint32_t misses;
+        };
+#endif
+
         /// @name Initialization
         //@{
         bool Initialize();
@@ -31,6 +46,13 @@ namespace Helium
         void ReleaseJobUninitialized( void* pJob, size_t size );
         //@}
 
+#if HELIUM_TRACK_JOB_POOL_HITS
+        /// @name Statistics
+        //@{
+        void GetPoolStats( DynamicArray< PoolStats >& rStats ) const;
+        //@}
+#endif
+
         /// @name Static Access
         //@{
         static JobManager& GetStaticInstance();
@@ -46,12 +68,8 @@ namespace Helium
             /// Next pool in the list.
             PoolNode* volatile pNext;
 #if HELIUM_TRACK_JOB_POOL_HITS
-            /// Hits on jobs pulled from the local thread's pool.
-            uint32_t localHits;
-            /// Hits on jobs pulled from other threads' pools.
-            uint32_t stolenHits;
-            /// Misses (new jobs needed to be allocated).
-            uint32_t misses;
+            /// Allocation statistics (only updated by the owning thread).
+            PoolStats stats;
 #endif
         };
 
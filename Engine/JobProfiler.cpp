@@ -0,0 +1,192 @@
+#include "EnginePch.h"
+#include "Engine/JobProfiler.h"
+
+#if HELIUM_PROFILE_JOBS
+
+#include "Platform/Atomic.h"
+#include "Engine/ChromeTraceWriter.h"
+#include "Engine/JobContext.h"
+#include "Engine/JobManager.h"
+
+using namespace Helium;
+
+JobProfiler* JobProfiler::sm_pInstance = NULL;
+
+/// Constructor.
+JobProfiler::JobProfiler()
+: m_jobId( 0 )
+, m_bRecording( false )
+{
+}
+
+/// Destructor.
+JobProfiler::~JobProfiler()
+{
+    m_bRecording = false;
+}
+
+/// Start recording job events.
+///
+/// Events recorded previously are kept; call Reset() first to start a fresh timeline.
+///
+/// @see Stop(), Reset(), IsRecording()
+void JobProfiler::Start()
+{
+    m_bRecording = true;
+}
+
+/// Stop recording job events.
+///
+/// Jobs already running when this is called may still record their events.
+///
+/// @see Start(), IsRecording()
+void JobProfiler::Stop()
+{
+    m_bRecording = false;
+}
+
+/// Discard all recorded events.
+///
+/// This should only be called while no jobs are running.
+///
+/// @see Start(), Stop()
+void JobProfiler::Reset()
+{
+    m_buffers.Reset();
+}
+
+/// Assign profiling information to a newly allocated job context.
+///
+/// @param[in] pContext        Context that was allocated.
+/// @param[in] pParentContext  Context of the job that spawned the new context, or null for root jobs.
+/// @param[in] flags           Combination of EFlag values describing how the job was spawned.
+void JobProfiler::OnContextAllocated( JobContext* pContext, const JobContext* pParentContext, uint32_t flags )
+{
+    HELIUM_ASSERT( pContext );
+
+    pContext->m_profileJobId = static_cast< uint32_t >( AtomicIncrementUnsafe( m_jobId ) );
+    pContext->m_profileParentJobId = ( pParentContext ? pParentContext->m_profileJobId : 0 );
+    pContext->m_profileFlags = flags;
+}
+
+/// Record the execution of a job on the current thread.
+///
+/// @param[in] pContext    Context of the job that was executed.
+/// @param[in] beginTicks  Tick count at which the job started running.
+/// @param[in] endTicks    Tick count at which the job finished running.
+void JobProfiler::RecordJob( const JobContext* pContext, uint64_t beginTicks, uint64_t endTicks )
+{
+    HELIUM_ASSERT( pContext );
+
+    ThreadBuffer* pBuffer = m_buffers.GetThreadLocalBuffer();
+    HELIUM_ASSERT( pBuffer );
+
+    // Only the owning thread writes to its buffer, so the event can be filled in place before it is published.
+    Event& rEvent = pBuffer->BeginEvent();
+    rEvent.beginTicks = beginTicks;
+    rEvent.endTicks = endTicks;
+    rEvent.pJobName = pContext->GetAttachData().GetJobName();
+    rEvent.jobId = pContext->m_profileJobId;
+    rEvent.parentJobId = pContext->m_profileParentJobId;
+    rEvent.flags = pContext->m_profileFlags;
+
+    pBuffer->EndEvent();
+}
+
+/// Write all recorded events to a file in the Chrome trace event format.
+///
+/// The resulting file can be loaded in "chrome://tracing" (or any compatible viewer).  Each job is written as a
+/// complete event on the track of the thread that ran it, with its identifier, parent identifier, and spawn type
+/// stored in the event arguments.  Job pool statistics from the JobManager are included when available.
+///
+/// This should only be called while no jobs are running.
+///
+/// @param[in] rFileName  Name of the file to write.
+///
+/// @return  True if the file was written successfully, false if not.
+bool JobProfiler::WriteChromeTrace( const String& rFileName ) const
+{
+    // Start timestamps at the earliest event so they stay near zero.
+    ChromeTraceWriter writer( 0, m_buffers.GetEarliestBeginTicks() );
+    String text;
+
+    for( const ThreadBuffer* pBuffer = m_buffers.GetHeadBuffer(); pBuffer != NULL; pBuffer = pBuffer->pNext )
+    {
+        text.Format( TXT( "Job Thread %" ) PRIu32, pBuffer->threadIndex );
+        writer.WriteThreadName( pBuffer->threadIndex, *text );
+
+        uint32_t writeCount = pBuffer->GetWriteCount();
+        for( uint32_t eventIndex = ThreadBuffer::GetFirstRetainedIndex( writeCount );
+             eventIndex < writeCount;
+             ++eventIndex )
+        {
+            const Event& rEvent = pBuffer->GetEvent( eventIndex );
+
+            text.Format( TXT( "\"id\":%" ) PRIu32 TXT( ",\"parent\":%" ) PRIu32, rEvent.jobId, rEvent.parentJobId );
+            writer.WriteCompleteEvent(
+                ( rEvent.pJobName ? rEvent.pJobName : TXT( "Job" ) ),
+                ( ( rEvent.flags & FLAG_ROOT )
+                  ? TXT( "root" )
+                  : ( ( rEvent.flags & FLAG_CONTINUATION ) ? TXT( "continuation" ) : TXT( "child" ) ) ),
+                pBuffer->threadIndex,
+                rEvent.beginTicks,
+                rEvent.endTicks,
+                *text );
+        }
+    }
+
+#if HELIUM_TRACK_JOB_POOL_HITS
+    DynamicArray< JobManager::PoolStats > poolStats;
+    JobManager::GetStaticInstance().GetPoolStats( poolStats );
+
+    String otherData( TXT( "\"jobPools\":[" ) );
+
+    size_t poolCount = poolStats.GetSize();
+    for( size_t poolIndex = 0; poolIndex < poolCount; ++poolIndex )
+    {
+        const JobManager::PoolStats& rStats = poolStats[ poolIndex ];
+        text.Format(
+            TXT( "%s{\"localHits\":%" ) PRIu32 TXT( ",\"stolenHits\":%" ) PRIu32
+            TXT( ",\"misses\":%" ) PRIu32 TXT( "}" ),
+            ( poolIndex == 0 ? TXT( "" ) : TXT( "," ) ),
+            rStats.localHits,
+            rStats.stolenHits,
+            rStats.misses );
+        otherData += text;
+    }
+
+    otherData += TXT( "]" );
+    writer.SetOtherData( otherData );
+#endif
+
+    return writer.WriteFile( rFileName, TXT( "JobProfiler" ) );
+}
+
+/// Get the static profiler instance, creating it if necessary.
+///
+/// This should first be called from the main thread before any jobs that may be recorded are run.
+///
+/// @return  Profiler instance.
+///
+/// @see DestroyStaticInstance(), GetRecordingInstance()
+JobProfiler& JobProfiler::GetStaticInstance()
+{
+    if( !sm_pInstance )
+    {
+        sm_pInstance = new JobProfiler;
+        HELIUM_ASSERT( sm_pInstance );
+    }
+
+    return *sm_pInstance;
+}
+
+/// Destroy the static profiler instance if one exists.
+///
+/// @see GetStaticInstance()
+void JobProfiler::DestroyStaticInstance()
+{
+    delete sm_pInstance;
+    sm_pInstance = NULL;
+}
+
+#endif  // HELIUM_PROFILE_JOBS
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Engine/Engine.h"
+
+#include "Foundation/String.h"
+#include "Engine/ProfilerThreadBuffers.h"
+
+#ifndef HELIUM_PROFILE_JOBS
+/// Set to non-zero to compile in support for recording a timeline of job execution.  Recording itself is disabled
+/// until JobProfiler::Start() is called, so the runtime cost when not recording is a single pointer test per job.
+#define HELIUM_PROFILE_JOBS ( 1 )
+#endif
+
+#if HELIUM_PROFILE_JOBS
+
+namespace Helium
+{
+    class JobContext;
+
+    /// Job execution profiler.
+    ///
+    /// Each thread that executes jobs records its events into its own fixed-size ring buffer, so recording never
+    /// takes a lock or allocates after the first job on a given thread.  Only the most recent EVENT_COUNT_MAX events
+    /// per thread are kept.  Recorded events can be exported as a Chrome trace ("chrome://tracing") JSON timeline.
+    class HELIUM_ENGINE_API JobProfiler : NonCopyable
+    {
+    public:
+        /// Maximum number of events retained for each thread.
+        static const uint32_t EVENT_COUNT_MAX = 16384;
+
+        /// Event flags.
+        enum EFlag
+        {
+            /// Job was spawned as a root job.
+            FLAG_ROOT         = 1 << 0,
+            /// Job was spawned as a continuation of its parent.
+            FLAG_CONTINUATION = 1 << 1,
+        };
+
+        /// Recorded job execution.
+        struct Event
+        {
+            /// Tick count at which the job started running.
+            uint64_t beginTicks;
+            /// Tick count at which the job finished running.
+            uint64_t endTicks;
+            /// Job type name (static string provided by the job class).
+            const tchar_t* pJobName;
+            /// Unique job identifier.
+            uint32_t jobId;
+            /// Identifier of the job that spawned this job (zero for root jobs or jobs spawned while not recording).
+            uint32_t parentJobId;
+            /// Event flags.
+            uint32_t flags;
+        };
+
+        /// @name Recording Control
+        //@{
+        void Start();
+        void Stop();
+        void Reset();
+        inline bool IsRecording() const;
+        //@}
+
+        /// @name Event Recording
+        //@{
+        void OnContextAllocated( JobContext* pContext, const JobContext* pParentContext, uint32_t flags );
+        void RecordJob( const JobContext* pContext, uint64_t beginTicks, uint64_t endTicks );
+        //@}
+
+        /// @name Export
+        //@{
+        bool WriteChromeTrace( const String& rFileName ) const;
+        //@}
+
+        /// @name Static Access
+        //@{
+        static JobProfiler& GetStaticInstance();
+        static void DestroyStaticInstance();
+        inline static JobProfiler* GetRecordingInstance();
+        //@}
+
+    private:
+        /// Per-thread event ring buffer.
+        typedef ProfilerThreadBuffers< Event, EVENT_COUNT_MAX >::ThreadBuffer ThreadBuffer;
+
+        /// Per-thread event ring buffers.
+        ProfilerThreadBuffers< Event, EVENT_COUNT_MAX > m_buffers;
+        /// Last job identifier handed out.
+        volatile int32_t m_jobId;
+        /// True while recording.
+        volatile bool m_bRecording;
+
+        /// Profiler instance.
+        static JobProfiler* sm_pInstance;
+
+        /// @name Construction/Destruction
+        //@{
+        JobProfiler();
+        ~JobProfiler();
+        //@}
+    };
+}
+
+#include "Engine/JobProfiler.inl"
+
+#endif  // HELIUM_PROFILE_JOBS
@@ -0,0 +1,26 @@
+namespace Helium
+{
+    /// Get whether events are currently being recorded.
+    ///
+    /// @return  True if recording, false if not.
+    ///
+    /// @see Start(), Stop()
+    bool JobProfiler::IsRecording() const
+    {
+        return m_bRecording;
+    }
+
+    /// Get the static profiler instance if it exists and is currently recording.
+    ///
+    /// This never creates the profiler instance, so it is safe to call from any thread.
+    ///
+    /// @return  Profiler instance if recording, null if not.
+    ///
+    /// @see GetStaticInstance()
+    JobProfiler* JobProfiler::GetRecordingInstance()
+    {
+        JobProfiler* pInstance = sm_pInstance;
+
+        return ( pInstance && pInstance->m_bRecording ? pInstance : NULL );
+    }
+}
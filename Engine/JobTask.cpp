@@ -3,6 +3,8 @@
 
 #include "Engine/JobContext.h"
 
+#include "Platform/Timer.h"
+
 using namespace Helium;
 
 
@@ -30,7 +32,19 @@ tbb::task* JobTask::execute()
             JobContext::JOB_EXECUTE_CALLBACK* pExecuteCallback = rAttachData.GetExecuteCallback();
             HELIUM_ASSERT( pExecuteCallback );
 
+#if HELIUM_PROFILE_JOBS
+            JobProfiler* pProfiler = JobProfiler::GetRecordingInstance();
+            uint64_t beginTicks = ( pProfiler ? Timer::GetTickCount() : 0 );
+#endif
+
             pExecuteCallback( pData, m_pContext );
+
+#if HELIUM_PROFILE_JOBS
+            if( pProfiler )
+            {
+                pProfiler->RecordJob( m_pContext, beginTicks, Timer::GetTickCount() );
+            }
+#endif
         }
 
         // Delete the job context object, as it is no longer needed.
@@ -0,0 +1,166 @@
+#include "EnginePch.h"
+#include "Engine/ParallelFor.h"
+
+#include "Engine/JobBase.h"
+#include "Engine/JobContext.h"
+#include "Engine/JobManager.h"
+
+using namespace Helium;
+
+/// Maximum number of child jobs to spawn at once.
+static const size_t PARALLEL_FOR_CHILD_JOB_MAX = 64;
+
+namespace Helium
+{
+    /// Parameters for the job running a single slice of a parallel-for range.
+    struct ParallelForJobParameters
+    {
+        /// Slice callback.
+        PARALLEL_FOR_CALLBACK* pCallback;
+        /// User data to pass to the callback.
+        void* pUserData;
+        /// Index of the first item in the slice.
+        size_t begin;
+        /// One past the index of the last item in the slice.
+        size_t end;
+    };
+
+    /// Parameters for the job splitting a parallel-for range into slices.
+    struct ParallelForJobSpawnerParameters
+    {
+        /// Slice callback.
+        PARALLEL_FOR_CALLBACK* pCallback;
+        /// User data to pass to the callback.
+        void* pUserData;
+        /// Index of the first item in the range.
+        size_t begin;
+        /// One past the index of the last item in the range.
+        size_t end;
+        /// Maximum number of items to give to each slice.
+        size_t sliceSizeMax;
+    };
+
+    typedef JobBase< ParallelForJobParameters > ParallelForJob;
+    typedef JobBase< ParallelForJobSpawnerParameters > ParallelForJobSpawner;
+
+    template<>
+    inline const tchar_t* JobBase< ParallelForJobParameters >::GetJobName()
+    {
+        return TXT( "ParallelForJob" );
+    }
+
+    template<>
+    inline const tchar_t* JobBase< ParallelForJobSpawnerParameters >::GetJobName()
+    {
+        return TXT( "ParallelForJobSpawner" );
+    }
+
+    /// Run a single slice.
+    ///
+    /// @param[in] pContext  Context in which this job is running.
+    template<>
+    inline void JobBase< ParallelForJobParameters >::Run( JobContext* /*pContext*/ )
+    {
+        m_parameters.pCallback( m_parameters.pUserData, m_parameters.begin, m_parameters.end );
+
+        JobManager& rJobManager = JobManager::GetStaticInstance();
+        rJobManager.ReleaseJob( this );
+    }
+
+    /// Split the range into child jobs, continuing with whatever is left over.
+    ///
+    /// @param[in] pContext  Context in which this job is running.
+    template<>
+    inline void JobBase< ParallelForJobSpawnerParameters >::Run( JobContext* pContext )
+    {
+        HELIUM_ASSERT( pContext );
+
+        size_t begin = m_parameters.begin;
+        size_t end = m_parameters.end;
+        size_t sliceSizeMax = m_parameters.sliceSizeMax;
+        HELIUM_ASSERT( sliceSizeMax != 0 );
+
+        size_t count = end - begin;
+        size_t jobCount = Min( ( count + sliceSizeMax - 1 ) / sliceSizeMax, PARALLEL_FOR_CHILD_JOB_MAX );
+
+        // The continuation takes whatever the child jobs can't cover, and must be allocated before them.
+        size_t childEnd = begin + Min( count, jobCount * sliceSizeMax );
+
+        {
+            JobContext::Spawner< PARALLEL_FOR_CHILD_JOB_MAX > childSpawner( pContext );
+
+            if( end > childEnd )
+            {
+                JobContext* pContinuationContext = childSpawner.AllocateContinuation();
+                HELIUM_ASSERT( pContinuationContext );
+                ParallelForJobSpawner* pContinuationJob = pContinuationContext->Create< ParallelForJobSpawner >();
+                HELIUM_ASSERT( pContinuationJob );
+
+                ParallelForJobSpawner::Parameters& rParameters = pContinuationJob->GetParameters();
+                rParameters = m_parameters;
+                rParameters.begin = childEnd;
+            }
+
+            for( size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex )
+            {
+                JobContext* pChildContext = childSpawner.Allocate();
+                HELIUM_ASSERT( pChildContext );
+                ParallelForJob* pJob = pChildContext->Create< ParallelForJob >();
+                HELIUM_ASSERT( pJob );
+
+                size_t sliceEnd = Min( begin + sliceSizeMax, childEnd );
+                HELIUM_ASSERT( sliceEnd > begin );
+
+                ParallelForJob::Parameters& rParameters = pJob->GetParameters();
+                rParameters.pCallback = m_parameters.pCallback;
+                rParameters.pUserData = m_parameters.pUserData;
+                rParameters.begin = begin;
+                rParameters.end = sliceEnd;
+
+                begin = sliceEnd;
+            }
+        }
+
+        JobManager& rJobManager = JobManager::GetStaticInstance();
+        rJobManager.ReleaseJob( this );
+    }
+}
+
+/// Run a callback over a range of items, split into slices that run as jobs.
+///
+/// This does not return until every slice has been run.  A range no larger than a single slice is run inline on the
+/// calling thread, so callers should only use this once a range is large enough to be worth the job overhead.
+///
+/// @param[in] pCallback     Callback to run on each slice.
+/// @param[in] pUserData     User data to pass to the callback.
+/// @param[in] count         Number of items in the range.
+/// @param[in] sliceSizeMax  Maximum number of items to give to each slice.
+void Helium::ParallelFor( PARALLEL_FOR_CALLBACK* pCallback, void* pUserData, size_t count, size_t sliceSizeMax )
+{
+    HELIUM_ASSERT( pCallback );
+    HELIUM_ASSERT( sliceSizeMax != 0 );
+
+    if( count <= sliceSizeMax )
+    {
+        if( count != 0 )
+        {
+            pCallback( pUserData, 0, count );
+        }
+
+        return;
+    }
+
+    JobContext::Spawner< 1 > rootSpawner;
+
+    JobContext* pContext = rootSpawner.Allocate();
+    HELIUM_ASSERT( pContext );
+    ParallelForJobSpawner* pJob = pContext->Create< ParallelForJobSpawner >();
+    HELIUM_ASSERT( pJob );
+
+    ParallelForJobSpawner::Parameters& rParameters = pJob->GetParameters();
+    rParameters.pCallback = pCallback;
+    rParameters.pUserData = pUserData;
+    rParameters.begin = 0;
+    rParameters.end = count;
+    rParameters.sliceSizeMax = sliceSizeMax;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Engine/Engine.h"
+
+namespace Helium
+{
+    /// Parallel-for slice callback type.
+    ///
+    /// Called with a contiguous slice of the range given to ParallelFor().  Slices never overlap, and may run on any
+    /// worker thread concurrently with other slices of the same range.
+    ///
+    /// @param[in] pUserData  User data given to ParallelFor().
+    /// @param[in] begin      Index of the first item in the slice.
+    /// @param[in] end        One past the index of the last item in the slice.
+    typedef void ( PARALLEL_FOR_CALLBACK )( void* pUserData, size_t begin, size_t end );
+
+    HELIUM_ENGINE_API void ParallelFor(
+        PARALLEL_FOR_CALLBACK* pCallback, void* pUserData, size_t count, size_t sliceSizeMax );
+}
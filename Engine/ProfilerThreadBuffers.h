@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Engine/Engine.h"
+
+#include "Platform/Thread.h"
+
+namespace Helium
+{
+    /// Per-thread event rings shared by the profilers.
+    ///
+    /// Each thread that records events gets its own fixed-size ring buffer the first time it records, so recording
+    /// never takes a lock or allocates after that.  Only the most recent EventCountMax events per thread are retained.
+    /// Events are written only by the owning thread and published with a release store of the write count, so other
+    /// threads can read everything up to the count they observe.  EventType must have a uint64_t beginTicks member.
+    template< typename EventType, uint32_t EventCountMax >
+    class ProfilerThreadBuffers : NonCopyable
+    {
+    public:
+        /// Event ring for a single thread.
+        struct ThreadBuffer
+        {
+            /// Event ring.
+            EventType events[ EventCountMax ];
+            /// Total number of events written (the write position is this modulo EventCountMax).
+            volatile int32_t writeCount;
+            /// Number of events consumed by the owning profiler's reader, if it has one.
+            uint32_t readCount;
+            /// Index of the owning thread, in order of first recorded event.
+            uint32_t threadIndex;
+            /// Next buffer in the list.
+            ThreadBuffer* volatile pNext;
+
+            /// @name Event Access
+            //@{
+            inline EventType& BeginEvent();
+            inline void EndEvent();
+            inline uint32_t GetWriteCount() const;
+            inline static uint32_t GetFirstRetainedIndex( uint32_t writeCount );
+            inline const EventType& GetEvent( uint32_t eventIndex ) const;
+            //@}
+        };
+
+        /// @name Construction/Destruction
+        //@{
+        ProfilerThreadBuffers();
+        ~ProfilerThreadBuffers();
+        //@}
+
+        /// @name Buffer Access
+        //@{
+        ThreadBuffer* GetThreadLocalBuffer();
+        inline ThreadBuffer* GetHeadBuffer() const;
+        //@}
+
+        /// @name Maintenance
+        //@{
+        void Reset();
+        uint64_t GetEarliestBeginTicks() const;
+        //@}
+
+    private:
+        /// List of buffers for each thread.
+        ThreadBuffer* volatile m_pHeadBuffer;
+        /// Thread-local storage for buffer data.
+        ThreadLocalPointer m_bufferTls;
+        /// Number of thread buffers allocated.
+        volatile int32_t m_threadCount;
+    };
+}
+
+#include "Engine/ProfilerThreadBuffers.inl"
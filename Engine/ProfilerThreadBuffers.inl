@@ -0,0 +1,163 @@
+#include "Platform/Atomic.h"
+
+namespace Helium
+{
+    /// Get the slot for the next event.
+    ///
+    /// Only the owning thread may call this.  The event is not visible to readers until EndEvent() is called.
+    ///
+    /// @return  Event to fill in.
+    ///
+    /// @see EndEvent()
+    template< typename EventType, uint32_t EventCountMax >
+    EventType& ProfilerThreadBuffers< EventType, EventCountMax >::ThreadBuffer::BeginEvent()
+    {
+        return events[ static_cast< uint32_t >( writeCount ) % EventCountMax ];
+    }
+
+    /// Publish the event filled in since the last call to BeginEvent().
+    ///
+    /// @see BeginEvent()
+    template< typename EventType, uint32_t EventCountMax >
+    void ProfilerThreadBuffers< EventType, EventCountMax >::ThreadBuffer::EndEvent()
+    {
+        AtomicExchangeRelease( writeCount, writeCount + 1 );
+    }
+
+    /// Get the total number of events published to this buffer.
+    ///
+    /// @return  Event count, including events that have since been overwritten.
+    template< typename EventType, uint32_t EventCountMax >
+    uint32_t ProfilerThreadBuffers< EventType, EventCountMax >::ThreadBuffer::GetWriteCount() const
+    {
+        return static_cast< uint32_t >( writeCount );
+    }
+
+    /// Get the index of the oldest event still retained in a buffer.
+    ///
+    /// @param[in] writeCount  Write count of the buffer, as returned by GetWriteCount().
+    ///
+    /// @return  Index of the oldest retained event.  Events from this index up to the write count can be read with
+    ///          GetEvent().
+    template< typename EventType, uint32_t EventCountMax >
+    uint32_t ProfilerThreadBuffers< EventType, EventCountMax >::ThreadBuffer::GetFirstRetainedIndex(
+        uint32_t writeCount )
+    {
+        return writeCount - Min( writeCount, EventCountMax );
+    }
+
+    /// Get a retained event.
+    ///
+    /// @param[in] eventIndex  Index of the event, counting every event ever written to this buffer.
+    ///
+    /// @return  Event.
+    template< typename EventType, uint32_t EventCountMax >
+    const EventType& ProfilerThreadBuffers< EventType, EventCountMax >::ThreadBuffer::GetEvent(
+        uint32_t eventIndex ) const
+    {
+        return events[ eventIndex % EventCountMax ];
+    }
+
+    /// Constructor.
+    template< typename EventType, uint32_t EventCountMax >
+    ProfilerThreadBuffers< EventType, EventCountMax >::ProfilerThreadBuffers()
+        : m_pHeadBuffer( NULL )
+        , m_threadCount( 0 )
+    {
+    }
+
+    /// Destructor.
+    template< typename EventType, uint32_t EventCountMax >
+    ProfilerThreadBuffers< EventType, EventCountMax >::~ProfilerThreadBuffers()
+    {
+        m_bufferTls.SetPointer( NULL );
+
+        ThreadBuffer* pBuffer = m_pHeadBuffer;
+        while( pBuffer )
+        {
+            ThreadBuffer* pNext = pBuffer->pNext;
+            delete pBuffer;
+            pBuffer = pNext;
+        }
+
+        m_pHeadBuffer = NULL;
+    }
+
+    /// Get the event buffer for the current thread, allocating it if necessary.
+    ///
+    /// @return  Pointer to the current thread's event buffer.
+    template< typename EventType, uint32_t EventCountMax >
+    typename ProfilerThreadBuffers< EventType, EventCountMax >::ThreadBuffer*
+        ProfilerThreadBuffers< EventType, EventCountMax >::GetThreadLocalBuffer()
+    {
+        ThreadBuffer* pBuffer = static_cast< ThreadBuffer* >( m_bufferTls.GetPointer() );
+        if( !pBuffer )
+        {
+            // Buffer does not yet exist, so allocate one and add it to the global list of buffers.
+            pBuffer = new ThreadBuffer;
+            HELIUM_ASSERT( pBuffer );
+            m_bufferTls.SetPointer( pBuffer );
+
+            pBuffer->writeCount = 0;
+            pBuffer->readCount = 0;
+            pBuffer->threadIndex = static_cast< uint32_t >( AtomicIncrementUnsafe( m_threadCount ) - 1 );
+
+            ThreadBuffer* pTestNext;
+            ThreadBuffer* pNext = m_pHeadBuffer;
+            do
+            {
+                pTestNext = pNext;
+                pBuffer->pNext = pTestNext;
+
+                pNext = AtomicCompareExchangeRelease( m_pHeadBuffer, pBuffer, pTestNext );
+            } while( pNext != pTestNext );
+        }
+
+        return pBuffer;
+    }
+
+    /// Get the first buffer in the list of thread buffers.
+    ///
+    /// @return  First buffer, or null if no thread has recorded an event yet.  Use ThreadBuffer::pNext to walk the
+    ///          rest of the list.
+    template< typename EventType, uint32_t EventCountMax >
+    typename ProfilerThreadBuffers< EventType, EventCountMax >::ThreadBuffer*
+        ProfilerThreadBuffers< EventType, EventCountMax >::GetHeadBuffer() const
+    {
+        return m_pHeadBuffer;
+    }
+
+    /// Discard all recorded events.
+    ///
+    /// This should only be called while no thread is recording.
+    template< typename EventType, uint32_t EventCountMax >
+    void ProfilerThreadBuffers< EventType, EventCountMax >::Reset()
+    {
+        for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+        {
+            AtomicExchangeRelease( pBuffer->writeCount, 0 );
+            pBuffer->readCount = 0;
+        }
+    }
+
+    /// Find the earliest begin tick count of any retained event.
+    ///
+    /// @return  Earliest begin tick count, or UINT64_MAX if no events are retained.
+    template< typename EventType, uint32_t EventCountMax >
+    uint64_t ProfilerThreadBuffers< EventType, EventCountMax >::GetEarliestBeginTicks() const
+    {
+        uint64_t earliestTicks = UINT64_MAX;
+        for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+        {
+            uint32_t writeCount = pBuffer->GetWriteCount();
+            for( uint32_t eventIndex = ThreadBuffer::GetFirstRetainedIndex( writeCount );
+                 eventIndex < writeCount;
+                 ++eventIndex )
+            {
+                earliestTicks = Min( earliestTicks, pBuffer->GetEvent( eventIndex ).beginTicks );
+            }
+        }
+
+        return earliestTicks;
+    }
+}
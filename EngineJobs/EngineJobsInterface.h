@@ -15,7 +15,7 @@ namespace Helium
 namespace Helium
 {
 
-/// Parallel array quick sort.
+/// Parallel array introspective sort.
 template< typename T, typename CompareFunction = Less< T > >
 class SortJob : Helium::NonCopyable
 {
@@ -29,8 +29,10 @@ public:
         size_t count;
         /// [in] Function object for checking whether the first element should be sorted before the second element.
         CompareFunction compare;
-        /// [in] Sub-division size at which to run the remainder of the sort within a single job.
+        /// [in] Sub-division size at which to run the remainder of the sort within a single job (zero to choose automatically).
         size_t singleJobCount;
+        /// [in] Number of partitioning passes remaining before falling back to heap sort (zero to compute from the element count).
+        size_t depthLimit;
 
         /// @name Construction/Destruction
         //@{
@@ -55,6 +57,58 @@ public:
     //@{
     void Run( JobContext* pContext );
     inline static void RunCallback( void* pJob, JobContext* pContext );
+    inline static const tchar_t* GetJobName();
+    //@}
+
+private:
+    Parameters m_parameters;
+};
+
+/// Parallel stable radix sort on unsigned integer keys.
+template< typename T, typename KeyFunction = RadixSortKey< T > >
+class RadixSortJob : Helium::NonCopyable
+{
+public:
+    class Parameters
+    {
+    public:
+        /// [inout] Pointer to the first element to sort.
+        T* pBase;
+        /// [inout] Scratch buffer with space for at least as many elements as are being sorted.
+        T* pScratch;
+        /// [in] Number of elements to sort.
+        size_t count;
+        /// [in] Function object returning the unsigned integer sort key for an element.
+        KeyFunction key;
+        /// [in] Number of low-order key bytes to sort on (zero to sort on the full key).
+        size_t digitCount;
+        /// [in] Sub-division size at which to run the remainder of the sort within a single job (zero to choose automatically).
+        size_t singleJobCount;
+
+        /// @name Construction/Destruction
+        //@{
+        inline Parameters();
+        //@}
+    };
+
+    /// @name Construction/Destruction
+    //@{
+    inline RadixSortJob();
+    inline ~RadixSortJob();
+    //@}
+
+    /// @name Parameters
+    //@{
+    inline Parameters& GetParameters();
+    inline const Parameters& GetParameters() const;
+    inline void SetParameters( const Parameters& rParameters );
+    //@}
+
+    /// @name Job Execution
+    //@{
+    void Run( JobContext* pContext );
+    inline static void RunCallback( void* pJob, JobContext* pContext );
+    inline static const tchar_t* GetJobName();
     //@}
 
 private:
@@ -58,10 +58,94 @@ namespace Helium
 		static_cast< SortJob* >( pJob )->Run( pContext );
 	}
 
+	/// Get the name of this job type for profiling.
+	///
+	/// @return  Job type name.
+	template< typename T, typename CompareFunction >
+	const tchar_t* SortJob< T, CompareFunction >::GetJobName()
+	{
+		return TXT( "SortJob" );
+	}
+
 	/// Constructor.
 	template< typename T, typename CompareFunction >
 	SortJob< T, CompareFunction >::Parameters::Parameters()
-		: singleJobCount(24)
+		: singleJobCount(0)
+		, depthLimit(0)
+	{
+	}
+
+	/// Constructor.
+	template< typename T, typename KeyFunction >
+	RadixSortJob< T, KeyFunction >::RadixSortJob()
+	{
+	}
+
+	/// Destructor.
+	template< typename T, typename KeyFunction >
+	RadixSortJob< T, KeyFunction >::~RadixSortJob()
+	{
+	}
+
+	/// Get the parameters for this job.
+	///
+	/// @return  Reference to the structure containing the job parameters.
+	///
+	/// @see SetParameters()
+	template< typename T, typename KeyFunction >
+	typename RadixSortJob< T, KeyFunction >::Parameters& RadixSortJob< T, KeyFunction >::GetParameters()
+	{
+		return m_parameters;
+	}
+
+	/// Get the parameters for this job.
+	///
+	/// @return  Constant reference to the structure containing the job parameters.
+	///
+	/// @see SetParameters()
+	template< typename T, typename KeyFunction >
+	const typename RadixSortJob< T, KeyFunction >::Parameters& RadixSortJob< T, KeyFunction >::GetParameters() const
+	{
+		return m_parameters;
+	}
+
+	/// Set the job parameters.
+	///
+	/// @param[in] rParameters  MetaStruct containing the job parameters.
+	///
+	/// @see GetParameters()
+	template< typename T, typename KeyFunction >
+	void RadixSortJob< T, KeyFunction >::SetParameters( const Parameters& rParameters )
+	{
+		m_parameters = rParameters;
+	}
+
+	/// Callback executed to run the job.
+	///
+	/// @param[in] pJob      Job to run.
+	/// @param[in] pContext  Context associated with the running job instance.
+	template< typename T, typename KeyFunction >
+	void RadixSortJob< T, KeyFunction >::RunCallback( void* pJob, JobContext* pContext )
+	{
+		HELIUM_ASSERT( pJob );
+		HELIUM_ASSERT( pContext );
+		static_cast< RadixSortJob* >( pJob )->Run( pContext );
+	}
+
+	/// Get the name of this job type for profiling.
+	///
+	/// @return  Job type name.
+	template< typename T, typename KeyFunction >
+	const tchar_t* RadixSortJob< T, KeyFunction >::GetJobName()
+	{
+		return TXT( "RadixSortJob" );
+	}
+
+	/// Constructor.
+	template< typename T, typename KeyFunction >
+	RadixSortJob< T, KeyFunction >::Parameters::Parameters()
+		: digitCount(0)
+		, singleJobCount(0)
 	{
 	}
 
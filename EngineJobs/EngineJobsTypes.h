@@ -19,4 +19,28 @@ namespace Helium
     /// @param[in] pElement0  First element to swap.
     /// @param[in] pElement1  Second element to swap.
     typedef void ( *SORT_SWAP_FUNC )( void* pElement0, void* pElement1 );
+
+    /// Default key function for RadixSortJob, using each element directly as its own sort key.
+    ///
+    /// Custom key functions must provide the same interface: a KeyType typedef naming an unsigned integer type, and a
+    /// constant function call operator returning the key for an element.
+    template< typename T >
+    class RadixSortKey
+    {
+    public:
+        /// Sort key type.
+        typedef T KeyType;
+
+        /// Get the sort key for an element.
+        ///
+        /// @param[in] rElement  Element.
+        ///
+        /// @return  Sort key.
+        inline KeyType operator()( const T& rElement ) const
+        {
+            return rElement;
+        }
+    };
+
+    HELIUM_ENGINE_JOBS_API size_t GetSortJobSingleJobCount( size_t count );
 }
@@ -1,7 +1,43 @@
 #include "EngineJobsPch.h"
 #include "EngineJobs/EngineJobsInterface.h"
 
+#include "Platform/Atomic.h"
 #include "Platform/Trace.h"
 #include "Engine/JobContext.h"
 
+#include "tbb/task_scheduler_init.h"
+
 using namespace Helium;
+
+/// Number of leaf jobs to aim for per worker thread when choosing a sort grain size automatically.
+static const size_t SORT_JOB_LEAF_JOBS_PER_THREAD = 4;
+/// Minimum grain size chosen automatically (smaller leaf jobs cost more to schedule than they save).
+static const size_t SORT_JOB_SINGLE_JOB_COUNT_MIN = 512;
+
+/// Cached TBB worker thread count (zero until first queried).
+static volatile int32_t s_sortJobThreadCount = 0;
+
+/// Choose the sub-division size at which SortJob and RadixSortJob stop spawning child jobs.
+///
+/// The grain is chosen so that an array of the given size is split into a few leaf jobs for each worker thread,
+/// giving the scheduler room to balance uneven partitions without drowning small arrays in job overhead.
+///
+/// @param[in] count  Total number of elements being sorted.
+///
+/// @return  Number of elements at or below which the remainder of a sort should run within a single job.
+size_t Helium::GetSortJobSingleJobCount( size_t count )
+{
+    // Sort jobs can query this from any worker thread.  Racing threads all compute the same value, so publishing it
+    // with an atomic exchange is enough to keep the cache consistent.
+    int32_t threadCount = s_sortJobThreadCount;
+    if( threadCount == 0 )
+    {
+        threadCount = Max< int32_t >( tbb::task_scheduler_init::default_num_threads(), 1 );
+        AtomicExchangeRelease( s_sortJobThreadCount, threadCount );
+    }
+
+    size_t leafJobCount = static_cast< size_t >( threadCount ) * SORT_JOB_LEAF_JOBS_PER_THREAD;
+    size_t singleJobCount = ( count + leafJobCount - 1 ) / leafJobCount;
+
+    return Max( singleJobCount, SORT_JOB_SINGLE_JOB_COUNT_MIN );
+}
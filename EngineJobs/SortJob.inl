@@ -1,71 +1,238 @@
 namespace Helium
 {
+    /// Partition size at or below which sorting is finished with an insertion sort.
+    static const size_t SORT_JOB_INSERTION_COUNT_MAX = 16;
+    /// Partition size at or above which the pivot is chosen using Tukey's ninther instead of a median of three.
+    static const size_t SORT_JOB_NINTHER_COUNT_MIN = 128;
+    /// Partition size at or below which RadixSortJob finishes with an insertion sort on the key.
+    static const size_t RADIX_SORT_JOB_INSERTION_COUNT_MAX = 32;
+    /// Number of bits sorted in each radix pass.
+    static const size_t RADIX_SORT_JOB_DIGIT_BITS = 8;
+    /// Number of buckets in each radix pass.
+    static const size_t RADIX_SORT_JOB_BUCKET_COUNT = 1 << RADIX_SORT_JOB_DIGIT_BITS;
+
+    /// Compute the number of partitioning passes allowed before falling back to heap sort.
+    ///
+    /// @param[in] count  Number of elements to sort.
+    ///
+    /// @return  Partition depth limit (twice the base-2 logarithm of the element count).
+    inline size_t _SortDepthLimit( size_t count )
+    {
+        size_t depthLimit = 0;
+        for( ; count > 1; count >>= 1 )
+        {
+            depthLimit += 2;
+        }
+
+        return Max< size_t >( depthLimit, 1 );
+    }
+
+    /// Insertion sort for small partitions.
+    template< typename T, typename CompareFunction >
+    static void _InsertionSort( T* pBase, size_t count, CompareFunction& rCompare )
+    {
+        HELIUM_ASSERT( pBase || count == 0 );
+
+        for( size_t index = 1; index < count; ++index )
+        {
+            if( !rCompare( pBase[ index ], pBase[ index - 1 ] ) )
+            {
+                continue;
+            }
+
+            T value = pBase[ index ];
+            size_t holeIndex = index;
+            do
+            {
+                pBase[ holeIndex ] = pBase[ holeIndex - 1 ];
+                --holeIndex;
+            } while( holeIndex != 0 && rCompare( value, pBase[ holeIndex - 1 ] ) );
+
+            pBase[ holeIndex ] = value;
+        }
+    }
+
+    /// Restore the max-heap property for the subtree rooted at the given index.
+    template< typename T, typename CompareFunction >
+    static void _SiftDown( T* pBase, size_t rootIndex, size_t count, CompareFunction& rCompare )
+    {
+        T value = pBase[ rootIndex ];
+
+        size_t childIndex;
+        while( ( childIndex = rootIndex * 2 + 1 ) < count )
+        {
+            if( childIndex + 1 < count && rCompare( pBase[ childIndex ], pBase[ childIndex + 1 ] ) )
+            {
+                ++childIndex;
+            }
+
+            if( !rCompare( value, pBase[ childIndex ] ) )
+            {
+                break;
+            }
+
+            pBase[ rootIndex ] = pBase[ childIndex ];
+            rootIndex = childIndex;
+        }
+
+        pBase[ rootIndex ] = value;
+    }
+
+    /// Heap sort, used once a partition exceeds its depth limit to guarantee O(n log n) behavior.
+    template< typename T, typename CompareFunction >
+    static void _HeapSort( T* pBase, size_t count, CompareFunction& rCompare )
+    {
+        HELIUM_ASSERT( pBase || count == 0 );
+
+        if( count <= 1 )
+        {
+            return;
+        }
+
+        for( size_t rootIndex = count / 2; rootIndex-- != 0; )
+        {
+            _SiftDown( pBase, rootIndex, count, rCompare );
+        }
+
+        for( size_t endIndex = count - 1; endIndex != 0; --endIndex )
+        {
+            Swap( pBase[ 0 ], pBase[ endIndex ] );
+            _SiftDown( pBase, 0, endIndex, rCompare );
+        }
+    }
+
+    /// Get the median of three elements.
+    template< typename T, typename CompareFunction >
+    static T* _MedianOfThree( T* pElement0, T* pElement1, T* pElement2, CompareFunction& rCompare )
+    {
+        if( rCompare( *pElement0, *pElement1 ) )
+        {
+            if( rCompare( *pElement1, *pElement2 ) )
+            {
+                return pElement1;
+            }
+
+            return ( rCompare( *pElement0, *pElement2 ) ? pElement2 : pElement0 );
+        }
+
+        if( rCompare( *pElement0, *pElement2 ) )
+        {
+            return pElement0;
+        }
+
+        return ( rCompare( *pElement1, *pElement2 ) ? pElement2 : pElement1 );
+    }
+
     /// Quick sort partition step.
+    ///
+    /// The pivot is the median of the first, middle, and last elements, or Tukey's ninther (median of three medians
+    /// of three) for larger partitions, which keeps sorted, reverse-sorted, and organ-pipe inputs from degenerating.
+    /// Elements equal to the pivot are split between both sides so that runs of equal keys still partition evenly.
+    ///
+    /// @return  Final index of the pivot element.  All elements before it are not greater than the pivot, and all
+    ///          elements after it are not less than the pivot.
     template< typename T, typename CompareFunction >
     static size_t _Partition( T* pBase, size_t count, CompareFunction& rCompare )
     {
         HELIUM_ASSERT( pBase );
         HELIUM_ASSERT( count > 2 );
 
-        // Select the element closest to the middle of the array as our pivot (should hopefully help create a more even
-        // distribution of work for each child job, particularly if the array is already sorted or nearly sorted).
-        T& rPivotOriginal = pBase[ count / 2 ];
-        T pivotValue = rPivotOriginal;
+        size_t lastIndex = count - 1;
+        size_t middleIndex = count / 2;
 
-        T* pPivotAddress = pBase + count - 1;
-        rPivotOriginal = *pPivotAddress;
+        T* pPivot;
+        if( count >= SORT_JOB_NINTHER_COUNT_MIN )
+        {
+            size_t step = count / 8;
+            pPivot = _MedianOfThree(
+                _MedianOfThree( pBase, pBase + step, pBase + step * 2, rCompare ),
+                _MedianOfThree( pBase + middleIndex - step, pBase + middleIndex, pBase + middleIndex + step, rCompare ),
+                _MedianOfThree( pBase + lastIndex - step * 2, pBase + lastIndex - step, pBase + lastIndex, rCompare ),
+                rCompare );
+        }
+        else
+        {
+            pPivot = _MedianOfThree( pBase, pBase + middleIndex, pBase + lastIndex, rCompare );
+        }
 
-        T* pStore = pBase;
+        Swap( pBase[ 0 ], *pPivot );
+        T pivotValue = pBase[ 0 ];
 
-        for( T* pTest = pBase; pTest < pPivotAddress; ++pTest )
+        size_t leftIndex = 1;
+        size_t rightIndex = lastIndex;
+        for( ; ; )
         {
-            if( rCompare( *pTest, pivotValue ) )
+            while( leftIndex <= rightIndex && rCompare( pBase[ leftIndex ], pivotValue ) )
+            {
+                ++leftIndex;
+            }
+
+            while( leftIndex <= rightIndex && rCompare( pivotValue, pBase[ rightIndex ] ) )
             {
-                Swap( *pTest, *pStore );
-                ++pStore;
-                HELIUM_ASSERT( pStore <= pPivotAddress );
+                --rightIndex;
             }
+
+            if( leftIndex >= rightIndex )
+            {
+                break;
+            }
+
+            Swap( pBase[ leftIndex ], pBase[ rightIndex ] );
+            ++leftIndex;
+            --rightIndex;
         }
 
-        *pPivotAddress = *pStore;
-        *pStore = pivotValue;
+        Swap( pBase[ 0 ], pBase[ rightIndex ] );
 
-        return static_cast< size_t >( pStore - pBase );
+        return rightIndex;
     }
 
-    /// Single-threaded recursive quicksort.
+    /// Single-threaded introspective sort.
+    ///
+    /// Partitions with quick sort, recursing only into the smaller side so that stack usage stays logarithmic, and
+    /// falls back to heap sort for any partition that exceeds the depth limit.  Small partitions are finished with an
+    /// insertion sort.
     template< typename T, typename CompareFunction >
-    static void _Quicksort( T* pBase, size_t count, CompareFunction& rCompare )
+    static void _Introsort( T* pBase, size_t count, CompareFunction& rCompare, size_t depthLimit )
     {
-        HELIUM_ASSERT( pBase );
+        HELIUM_ASSERT( pBase || count == 0 );
 
-        if( count == 2 )
+        while( count > SORT_JOB_INSERTION_COUNT_MAX )
         {
-            if( rCompare( pBase[ 1 ], pBase[ 0 ] ) )
+            if( depthLimit == 0 )
             {
-                Swap( pBase[ 0 ], pBase[ 1 ] );
+                _HeapSort( pBase, count, rCompare );
+
+                return;
             }
 
-            return;
-        }
+            --depthLimit;
 
-        size_t pivotIndex = _Partition( pBase, count, rCompare );
-        if( pivotIndex > 1 )
-        {
-            _Quicksort( pBase, pivotIndex, rCompare );
+            size_t pivotIndex = _Partition( pBase, count, rCompare );
+            size_t startIndex = pivotIndex + 1;
+            size_t partitionSize = count - startIndex;
+            if( pivotIndex < partitionSize )
+            {
+                _Introsort( pBase, pivotIndex, rCompare, depthLimit );
+                pBase += startIndex;
+                count = partitionSize;
+            }
+            else
+            {
+                _Introsort( pBase + startIndex, partitionSize, rCompare, depthLimit );
+                count = pivotIndex;
+            }
         }
 
-        size_t startIndex = pivotIndex + 1;
-        HELIUM_ASSERT( startIndex <= count );
-        size_t partitionSize = count - startIndex;
-        if( partitionSize > 1 )
-        {
-            _Quicksort( pBase + startIndex, partitionSize, rCompare );
-        }
+        _InsertionSort( pBase, count, rCompare );
     }
 
     /// Recursively sort an array of elements.
     ///
+    /// Each job partitions its range once and spawns child jobs for the sides still larger than the single job count,
+    /// sorting smaller sides itself after the children have been spawned.  The partition depth budget is passed down
+    /// to the children, so adversarial inputs fall back to heap sort instead of recursing without bound.
+    ///
     /// @param[in] pContext  Context in which this job is running.
     template< typename T, typename CompareFunction >
     void SortJob< T, CompareFunction >::Run( JobContext* pContext )
@@ -84,23 +251,44 @@ namespace Helium
         T* pBase = m_parameters.pBase;
         HELIUM_ASSERT( pBase );
 
-        CompareFunction& rCompare = m_parameters.compare;
+        CompareFunction compare = m_parameters.compare;
 
-        size_t singleJobCount = Max< size_t >( m_parameters.singleJobCount, 2 );
-        if( count <= singleJobCount )
+        size_t singleJobCount = m_parameters.singleJobCount;
+        if( singleJobCount == 0 )
         {
-            _Quicksort( pBase, count, rCompare );
-            //std::sort( pBase, pBase + count, rLess );
-            rJobManager.ReleaseJob( this );
+            singleJobCount = GetSortJobSingleJobCount( count );
+        }
+
+        singleJobCount = Max( singleJobCount, SORT_JOB_INSERTION_COUNT_MAX );
+
+        size_t depthLimit = m_parameters.depthLimit;
+        if( depthLimit == 0 )
+        {
+            depthLimit = _SortDepthLimit( count );
+        }
+
+        rJobManager.ReleaseJob( this );
+
+        if( count <= singleJobCount || depthLimit <= 1 )
+        {
+            _Introsort( pBase, count, compare, depthLimit );
 
             return;
         }
 
+        size_t pivotIndex = _Partition( pBase, count, compare );
+
+        size_t startIndex = pivotIndex + 1;
+        HELIUM_ASSERT( startIndex <= count );
+        size_t partitionSize = count - startIndex;
+
+        bool bSpawnLower = ( pivotIndex > singleJobCount );
+        bool bSpawnUpper = ( partitionSize > singleJobCount );
+
         {
             JobContext::Spawner< 2 > childSpawner( pContext );
 
-            size_t pivotIndex = _Partition( pBase, count, rCompare );
-            if( pivotIndex > 1 )
+            if( bSpawnLower )
             {
                 JobContext* pChildContext = childSpawner.Allocate();
                 HELIUM_ASSERT( pChildContext );
@@ -110,14 +298,12 @@ namespace Helium
                 SortJob::Parameters& rParameters = pChildJob->GetParameters();
                 rParameters.pBase = pBase;
                 rParameters.count = pivotIndex;
-                rParameters.compare = rCompare;
+                rParameters.compare = compare;
                 rParameters.singleJobCount = singleJobCount;
+                rParameters.depthLimit = depthLimit - 1;
             }
 
-            size_t startIndex = pivotIndex + 1;
-            HELIUM_ASSERT( startIndex <= count );
-            size_t partitionSize = count - startIndex;
-            if( partitionSize > 1 )
+            if( bSpawnUpper )
             {
                 JobContext* pChildContext = childSpawner.Allocate();
                 HELIUM_ASSERT( pChildContext );
@@ -127,11 +313,230 @@ namespace Helium
                 SortJob::Parameters& rParameters = pChildJob->GetParameters();
                 rParameters.pBase = pBase + startIndex;
                 rParameters.count = partitionSize;
-                rParameters.compare = rCompare;
+                rParameters.compare = compare;
                 rParameters.singleJobCount = singleJobCount;
+                rParameters.depthLimit = depthLimit - 1;
+            }
+        }
+
+        // Sort any small sides here while the child jobs run.
+        if( !bSpawnLower )
+        {
+            _Introsort( pBase, pivotIndex, compare, depthLimit - 1 );
+        }
+
+        if( !bSpawnUpper )
+        {
+            _Introsort( pBase + startIndex, partitionSize, compare, depthLimit - 1 );
+        }
+    }
+
+    /// Insertion sort on radix keys for small buckets.
+    template< typename T, typename KeyFunction >
+    static void _RadixInsertionSort( T* pBase, size_t count, const KeyFunction& rKey )
+    {
+        typedef typename KeyFunction::KeyType KeyType;
+
+        for( size_t index = 1; index < count; ++index )
+        {
+            KeyType key = rKey( pBase[ index ] );
+            if( !( key < rKey( pBase[ index - 1 ] ) ) )
+            {
+                continue;
+            }
+
+            T value = pBase[ index ];
+            size_t holeIndex = index;
+            do
+            {
+                pBase[ holeIndex ] = pBase[ holeIndex - 1 ];
+                --holeIndex;
+            } while( holeIndex != 0 && key < rKey( pBase[ holeIndex - 1 ] ) );
+
+            pBase[ holeIndex ] = value;
+        }
+    }
+
+    /// Single-threaded least-significant-digit radix sort over the lowest digits of each key.
+    ///
+    /// Passes over digits that are the same for every element are skipped.  The sorted result is always left in the
+    /// source array.
+    template< typename T, typename KeyFunction >
+    static void _RadixSort( T* pBase, T* pScratch, size_t count, const KeyFunction& rKey, size_t digitCount )
+    {
+        HELIUM_ASSERT( pBase || count == 0 );
+        HELIUM_ASSERT( pScratch || count == 0 );
+
+        if( count <= RADIX_SORT_JOB_INSERTION_COUNT_MAX )
+        {
+            _RadixInsertionSort( pBase, count, rKey );
+
+            return;
+        }
+
+        T* pSource = pBase;
+        T* pDest = pScratch;
+
+        size_t bucketOffsets[ RADIX_SORT_JOB_BUCKET_COUNT ];
+
+        for( size_t digitIndex = 0; digitIndex < digitCount; ++digitIndex )
+        {
+            size_t shift = digitIndex * RADIX_SORT_JOB_DIGIT_BITS;
+
+            MemoryZero( bucketOffsets, sizeof( bucketOffsets ) );
+            for( size_t elementIndex = 0; elementIndex < count; ++elementIndex )
+            {
+                ++bucketOffsets[ ( rKey( pSource[ elementIndex ] ) >> shift ) & ( RADIX_SORT_JOB_BUCKET_COUNT - 1 ) ];
+            }
+
+            size_t offset = 0;
+            bool bSingleBucket = false;
+            for( size_t bucketIndex = 0; bucketIndex < RADIX_SORT_JOB_BUCKET_COUNT; ++bucketIndex )
+            {
+                size_t bucketSize = bucketOffsets[ bucketIndex ];
+                if( bucketSize == count )
+                {
+                    bSingleBucket = true;
+                    break;
+                }
+
+                bucketOffsets[ bucketIndex ] = offset;
+                offset += bucketSize;
+            }
+
+            if( bSingleBucket )
+            {
+                continue;
+            }
+
+            for( size_t elementIndex = 0; elementIndex < count; ++elementIndex )
+            {
+                const T& rElement = pSource[ elementIndex ];
+                size_t bucketIndex = ( rKey( rElement ) >> shift ) & ( RADIX_SORT_JOB_BUCKET_COUNT - 1 );
+                pDest[ bucketOffsets[ bucketIndex ]++ ] = rElement;
+            }
+
+            Swap( pSource, pDest );
+        }
+
+        if( pSource != pBase )
+        {
+            for( size_t elementIndex = 0; elementIndex < count; ++elementIndex )
+            {
+                pBase[ elementIndex ] = pSource[ elementIndex ];
             }
         }
+    }
+
+    /// Recursively radix sort an array of elements.
+    ///
+    /// Large ranges are bucketed on their most significant remaining key digit within this job, and a child job is
+    /// spawned to sort each bucket on the remaining digits.  Ranges at or below the single job count are finished
+    /// with a least-significant-digit radix sort.  The sort is stable.
+    ///
+    /// @param[in] pContext  Context in which this job is running.
+    template< typename T, typename KeyFunction >
+    void RadixSortJob< T, KeyFunction >::Run( JobContext* pContext )
+    {
+        HELIUM_ASSERT( pContext );
+
+        typedef typename KeyFunction::KeyType KeyType;
+
+        JobManager& rJobManager = JobManager::GetStaticInstance();
+
+        size_t count = m_parameters.count;
+        size_t digitCount = m_parameters.digitCount;
+        if( digitCount == 0 )
+        {
+            digitCount = ( sizeof( KeyType ) * 8 + RADIX_SORT_JOB_DIGIT_BITS - 1 ) / RADIX_SORT_JOB_DIGIT_BITS;
+        }
+
+        if( count <= 1 )
+        {
+            rJobManager.ReleaseJob( this );
+            return;
+        }
+
+        T* pBase = m_parameters.pBase;
+        HELIUM_ASSERT( pBase );
+        T* pScratch = m_parameters.pScratch;
+        HELIUM_ASSERT( pScratch );
+
+        KeyFunction key = m_parameters.key;
+
+        size_t singleJobCount = m_parameters.singleJobCount;
+        if( singleJobCount == 0 )
+        {
+            singleJobCount = GetSortJobSingleJobCount( count );
+        }
 
         rJobManager.ReleaseJob( this );
+
+        if( count <= singleJobCount || digitCount == 1 )
+        {
+            _RadixSort( pBase, pScratch, count, key, digitCount );
+
+            return;
+        }
+
+        // Bucket on the most significant remaining digit.
+        size_t shift = ( digitCount - 1 ) * RADIX_SORT_JOB_DIGIT_BITS;
+
+        size_t bucketSizes[ RADIX_SORT_JOB_BUCKET_COUNT ];
+        size_t bucketOffsets[ RADIX_SORT_JOB_BUCKET_COUNT ];
+
+        MemoryZero( bucketSizes, sizeof( bucketSizes ) );
+        for( size_t elementIndex = 0; elementIndex < count; ++elementIndex )
+        {
+            ++bucketSizes[ ( key( pBase[ elementIndex ] ) >> shift ) & ( RADIX_SORT_JOB_BUCKET_COUNT - 1 ) ];
+        }
+
+        size_t offset = 0;
+        for( size_t bucketIndex = 0; bucketIndex < RADIX_SORT_JOB_BUCKET_COUNT; ++bucketIndex )
+        {
+            bucketOffsets[ bucketIndex ] = offset;
+            offset += bucketSizes[ bucketIndex ];
+        }
+
+        // Skip the scatter if every element shares this digit.
+        if( bucketSizes[ ( key( pBase[ 0 ] ) >> shift ) & ( RADIX_SORT_JOB_BUCKET_COUNT - 1 ) ] != count )
+        {
+            for( size_t elementIndex = 0; elementIndex < count; ++elementIndex )
+            {
+                const T& rElement = pBase[ elementIndex ];
+                size_t bucketIndex = ( key( rElement ) >> shift ) & ( RADIX_SORT_JOB_BUCKET_COUNT - 1 );
+                pScratch[ bucketOffsets[ bucketIndex ]++ ] = rElement;
+            }
+
+            for( size_t elementIndex = 0; elementIndex < count; ++elementIndex )
+            {
+                pBase[ elementIndex ] = pScratch[ elementIndex ];
+            }
+        }
+
+        JobContext::Spawner< RADIX_SORT_JOB_BUCKET_COUNT > childSpawner( pContext );
+
+        offset = 0;
+        for( size_t bucketIndex = 0; bucketIndex < RADIX_SORT_JOB_BUCKET_COUNT; ++bucketIndex )
+        {
+            size_t bucketSize = bucketSizes[ bucketIndex ];
+            if( bucketSize > 1 )
+            {
+                JobContext* pChildContext = childSpawner.Allocate();
+                HELIUM_ASSERT( pChildContext );
+                RadixSortJob* pChildJob = pChildContext->Create< RadixSortJob >();
+                HELIUM_ASSERT( pChildJob );
+
+                RadixSortJob::Parameters& rParameters = pChildJob->GetParameters();
+                rParameters.pBase = pBase + offset;
+                rParameters.pScratch = pScratch + offset;
+                rParameters.count = bucketSize;
+                rParameters.key = key;
+                rParameters.digitCount = digitCount - 1;
+                rParameters.singleJobCount = singleJobCount;
+            }
+
+            offset += bucketSize;
+        }
     }
 }
@@ -42,16 +42,16 @@ void DamageOnContactComponentDefinition::PopulateMetaType( Reflect::MetaStruct&
 
 void ApplyDamage( HasPhysicalContactsComponent *pHasPhysicalContacts, DamageOnContactComponent *pDamageOnContact )
 {
-	for (Set<EntityWPtr>::Iterator iter = pHasPhysicalContacts->m_EverTouchedThisFrame.Begin();
-		iter != pHasPhysicalContacts->m_EverTouchedThisFrame.End(); ++iter)
+	const PhysicalContact *pContacts = pHasPhysicalContacts->GetContacts();
+	for (size_t i = 0; i < pHasPhysicalContacts->GetContactCount(); ++i)
 	{
-		Entity *pOtherEntity = *iter;
-
-		if (!pOtherEntity)
+		if (!pContacts[i].WasTouchedThisFrame())
 		{
 			continue;
 		}
 
+		Entity *pOtherEntity = pContacts[i].m_pOtherEntity;
+
 		HealthComponent *pOtherHealthComponent = pOtherEntity->GetComponents().GetFirst<HealthComponent>();
 		if ( pOtherHealthComponent )
 		{
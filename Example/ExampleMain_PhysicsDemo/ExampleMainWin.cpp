@@ -170,11 +170,14 @@ int main( int argc, const char* argv[] )
 					pWorld->GetRootSlice()->CreateEntity(spCubeDefinition, locatedParamSet.Get());
 				}
 
-				void *windowHandle = rendererInitialization.GetMainWindow()->GetHandle();
-				Input::Initialize(&windowHandle, true);
-				Input::SetWindowSize( 
-					rendererInitialization.GetMainWindow()->GetWidth(),
-					rendererInitialization.GetMainWindow()->GetHeight());
+				// Dedicated servers ("-server") run without a window
+				Window *pMainWindow = rendererInitialization.GetMainWindow();
+				if ( pMainWindow )
+				{
+					void *windowHandle = pMainWindow->GetHandle();
+					Input::Initialize(&windowHandle, true);
+					Input::SetWindowSize( pMainWindow->GetWidth(), pMainWindow->GetHeight() );
+				}
 
 				// Run the application.
 				result = pGameSystem->Run();
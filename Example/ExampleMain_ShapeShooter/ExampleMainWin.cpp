@@ -102,11 +102,14 @@ int main( int argc, const char* argv[] )
 
 		if( bSystemInitSuccess )
 		{
-			void *windowHandle = rendererInitialization.GetMainWindow()->GetHandle();
-			Input::Initialize(&windowHandle, false);
-			Input::SetWindowSize( 
-				rendererInitialization.GetMainWindow()->GetWidth(),
-				rendererInitialization.GetMainWindow()->GetHeight());
+			// Dedicated servers ("-server") run without a window
+			Window *pMainWindow = rendererInitialization.GetMainWindow();
+			if ( pMainWindow )
+			{
+				void *windowHandle = pMainWindow->GetHandle();
+				Input::Initialize(&windowHandle, false);
+				Input::SetWindowSize( pMainWindow->GetWidth(), pMainWindow->GetHeight() );
+			}
 
 			// Run the application.
 			result = pGameSystem->Run();
@@ -0,0 +1,351 @@
+#include "FrameworkPch.h"
+#include "Framework/FrameProfiler.h"
+
+#if HELIUM_PROFILE_FRAMES
+
+#include "Foundation/FileStream.h"
+#include "Engine/ChromeTraceWriter.h"
+
+#include <algorithm>
+
+using namespace Helium;
+
+FrameProfiler* FrameProfiler::sm_pInstance = NULL;
+const tchar_t* const FrameProfiler::FRAME_SCOPE_NAME = TXT( "Frame" );
+
+/// Constructor.
+FrameProfiler::FrameProfiler()
+: m_bRecording( false )
+, m_frameBeginTicks( 0 )
+{
+}
+
+/// Destructor.
+FrameProfiler::~FrameProfiler()
+{
+	m_bRecording = false;
+
+	size_t scopeCount = m_scopeHistories.GetSize();
+	for( size_t scopeIndex = 0; scopeIndex < scopeCount; ++scopeIndex )
+	{
+		delete m_scopeHistories[ scopeIndex ];
+	}
+}
+
+/// Start recording.
+///
+/// Timings recorded previously are kept; call Reset() first to start fresh.
+///
+/// @see Stop(), Reset(), IsRecording()
+void FrameProfiler::Start()
+{
+	m_frameBeginTicks = Timer::GetTickCount();
+	m_bRecording = true;
+}
+
+/// Stop recording.
+///
+/// Scopes already entered when this is called may still record their timings.
+///
+/// @see Start(), IsRecording()
+void FrameProfiler::Stop()
+{
+	m_bRecording = false;
+}
+
+/// Discard all recorded timings and statistics.
+///
+/// This should only be called from the thread ending frames while no other thread is recording.
+///
+/// @see Start(), Stop()
+void FrameProfiler::Reset()
+{
+	m_buffers.Reset();
+
+	size_t scopeCount = m_scopeHistories.GetSize();
+	for( size_t scopeIndex = 0; scopeIndex < scopeCount; ++scopeIndex )
+	{
+		ScopeHistory* pHistory = m_scopeHistories[ scopeIndex ];
+		pHistory->frameTicks = 0;
+		pHistory->bRanThisFrame = false;
+		pHistory->frameCount = 0;
+	}
+
+	m_frameBeginTicks = Timer::GetTickCount();
+}
+
+/// Record the execution of a scope on the current thread.
+///
+/// @param[in] pName       Scope name (must have static storage duration).
+/// @param[in] beginTicks  Tick count at which the scope was entered.
+/// @param[in] endTicks    Tick count at which the scope was left.
+void FrameProfiler::RecordScope( const tchar_t* pName, uint64_t beginTicks, uint64_t endTicks )
+{
+	HELIUM_ASSERT( pName );
+
+	ThreadBuffer* pBuffer = m_buffers.GetThreadLocalBuffer();
+	HELIUM_ASSERT( pBuffer );
+
+	// Only the owning thread writes to its buffer, so the event can be filled in place before it is published.
+	Event& rEvent = pBuffer->BeginEvent();
+	rEvent.beginTicks = beginTicks;
+	rEvent.endTicks = endTicks;
+	rEvent.pName = pName;
+
+	pBuffer->EndEvent();
+}
+
+/// Finish the current frame, recording its duration and folding the timings recorded since the previous frame into
+/// the per-scope statistics.
+///
+/// This should be called once per frame by the thread running the application loop.
+void FrameProfiler::EndFrame()
+{
+	if( !m_bRecording )
+	{
+		return;
+	}
+
+	uint64_t frameEndTicks = Timer::GetTickCount();
+	RecordScope( FRAME_SCOPE_NAME, m_frameBeginTicks, frameEndTicks );
+	m_frameBeginTicks = frameEndTicks;
+
+	// Accumulate the time spent in each scope this frame.  Scopes that complete on other threads (such as the render
+	// thread) count towards the frame in which they finished.
+	for( ThreadBuffer* pBuffer = m_buffers.GetHeadBuffer(); pBuffer != NULL; pBuffer = pBuffer->pNext )
+	{
+		uint32_t writeCount = pBuffer->GetWriteCount();
+		uint32_t readCount = Max( pBuffer->readCount, ThreadBuffer::GetFirstRetainedIndex( writeCount ) );
+		for( ; readCount < writeCount; ++readCount )
+		{
+			const Event& rEvent = pBuffer->GetEvent( readCount );
+
+			ScopeHistory* pHistory = GetScopeHistory( rEvent.pName );
+			HELIUM_ASSERT( pHistory );
+			pHistory->frameTicks += rEvent.endTicks - rEvent.beginTicks;
+			pHistory->bRanThisFrame = true;
+		}
+
+		pBuffer->readCount = writeCount;
+	}
+
+	float64_t millisecondsPerTick = Timer::GetSecondsPerTick() * 1000.0;
+
+	size_t scopeCount = m_scopeHistories.GetSize();
+	for( size_t scopeIndex = 0; scopeIndex < scopeCount; ++scopeIndex )
+	{
+		ScopeHistory* pHistory = m_scopeHistories[ scopeIndex ];
+		if( !pHistory->bRanThisFrame )
+		{
+			continue;
+		}
+
+		pHistory->frameMilliseconds[ pHistory->frameCount % FRAME_COUNT_MAX ] =
+			static_cast< float32_t >( static_cast< float64_t >( pHistory->frameTicks ) * millisecondsPerTick );
+		++pHistory->frameCount;
+
+		pHistory->frameTicks = 0;
+		pHistory->bRanThisFrame = false;
+	}
+}
+
+/// Compute statistics for each recorded scope over the most recent FRAME_COUNT_MAX frames it ran in.
+///
+/// This should only be called from the thread ending frames.
+///
+/// @param[out] rStatistics  Statistics for each scope, in the order scopes were first recorded.
+void FrameProfiler::GetStatistics( DynamicArray< Statistics >& rStatistics ) const
+{
+	rStatistics.Resize( 0 );
+
+	DynamicArray< float32_t > sortedMilliseconds;
+
+	size_t scopeCount = m_scopeHistories.GetSize();
+	for( size_t scopeIndex = 0; scopeIndex < scopeCount; ++scopeIndex )
+	{
+		const ScopeHistory* pHistory = m_scopeHistories[ scopeIndex ];
+		uint32_t frameCount = Min( pHistory->frameCount, FRAME_COUNT_MAX );
+		if( frameCount == 0 )
+		{
+			continue;
+		}
+
+		sortedMilliseconds.Resize( 0 );
+		sortedMilliseconds.AddArray( pHistory->frameMilliseconds, frameCount );
+		std::sort( sortedMilliseconds.GetData(), sortedMilliseconds.GetData() + frameCount );
+
+		float64_t totalMilliseconds = 0.0;
+		for( uint32_t frameIndex = 0; frameIndex < frameCount; ++frameIndex )
+		{
+			totalMilliseconds += sortedMilliseconds[ frameIndex ];
+		}
+
+		// Nearest-rank percentile.
+		uint32_t p99Index = ( frameCount * 99 + 99 ) / 100 - 1;
+
+		Statistics* pStatistics = rStatistics.New();
+		HELIUM_ASSERT( pStatistics );
+		pStatistics->pName = pHistory->pName;
+		pStatistics->frameCount = frameCount;
+		pStatistics->minMilliseconds = sortedMilliseconds[ 0 ];
+		pStatistics->avgMilliseconds = static_cast< float32_t >( totalMilliseconds / static_cast< float64_t >( frameCount ) );
+		pStatistics->p99Milliseconds = sortedMilliseconds[ p99Index ];
+		pStatistics->maxMilliseconds = sortedMilliseconds[ frameCount - 1 ];
+	}
+}
+
+/// Write all retained scope timings to a file in the Chrome trace event format.
+///
+/// The resulting file can be loaded in "chrome://tracing" (or any compatible viewer).  Each scope is written as a
+/// complete event on the track of the thread that ran it, with whole frames on the track of the thread that ended
+/// them.
+///
+/// This should only be called from the thread ending frames.
+///
+/// @param[in] rFileName  Name of the file to write.
+///
+/// @return  True if the file was written successfully, false if not.
+bool FrameProfiler::WriteChromeTrace( const String& rFileName ) const
+{
+	// Start timestamps at the earliest event so they stay near zero.  Frames use a separate process id from the
+	// JobProfiler so both traces can be loaded together.
+	ChromeTraceWriter writer( 1, m_buffers.GetEarliestBeginTicks() );
+	String threadName;
+
+	for( const ThreadBuffer* pBuffer = m_buffers.GetHeadBuffer(); pBuffer != NULL; pBuffer = pBuffer->pNext )
+	{
+		threadName.Format( TXT( "Frame Thread %" ) PRIu32, pBuffer->threadIndex );
+		writer.WriteThreadName( pBuffer->threadIndex, *threadName );
+
+		uint32_t writeCount = pBuffer->GetWriteCount();
+		for( uint32_t eventIndex = ThreadBuffer::GetFirstRetainedIndex( writeCount );
+			eventIndex < writeCount;
+			++eventIndex )
+		{
+			const Event& rEvent = pBuffer->GetEvent( eventIndex );
+			writer.WriteCompleteEvent(
+				rEvent.pName,
+				( CompareString( rEvent.pName, FRAME_SCOPE_NAME ) == 0 ? TXT( "frame" ) : TXT( "scope" ) ),
+				pBuffer->threadIndex,
+				rEvent.beginTicks,
+				rEvent.endTicks );
+		}
+	}
+
+	return writer.WriteFile( rFileName, TXT( "FrameProfiler" ) );
+}
+
+/// Write the current per-scope statistics to a CSV file.
+///
+/// This should only be called from the thread ending frames.
+///
+/// @param[in] rFileName  Name of the file to write.
+///
+/// @return  True if the file was written successfully, false if not.
+///
+/// @see GetStatistics()
+bool FrameProfiler::WriteCsv( const String& rFileName ) const
+{
+	DynamicArray< Statistics > statistics;
+	GetStatistics( statistics );
+
+	String csv( TXT( "scope,frames,min_ms,avg_ms,p99_ms,max_ms\n" ) );
+	String line;
+
+	size_t scopeCount = statistics.GetSize();
+	for( size_t scopeIndex = 0; scopeIndex < scopeCount; ++scopeIndex )
+	{
+		const Statistics& rStatistics = statistics[ scopeIndex ];
+		line.Format(
+			TXT( "%s,%" ) PRIu32 TXT( ",%.4f,%.4f,%.4f,%.4f\n" ),
+			rStatistics.pName,
+			rStatistics.frameCount,
+			rStatistics.minMilliseconds,
+			rStatistics.avgMilliseconds,
+			rStatistics.p99Milliseconds,
+			rStatistics.maxMilliseconds );
+		csv += line;
+	}
+
+	FileStream* pStream = FileStream::OpenFileStream( rFileName, FileStream::MODE_WRITE, true );
+	if( !pStream )
+	{
+		HELIUM_TRACE( TraceLevels::Error, TXT( "FrameProfiler: Failed to open \"%s\" for writing.\n" ), *rFileName );
+
+		return false;
+	}
+
+	size_t size = csv.GetSize();
+	size_t writeSize = pStream->Write( *csv, sizeof( tchar_t ), size );
+	delete pStream;
+
+	if( writeSize != size )
+	{
+		HELIUM_TRACE( TraceLevels::Error, TXT( "FrameProfiler: Failed to write statistics to \"%s\".\n" ), *rFileName );
+
+		return false;
+	}
+
+	return true;
+}
+
+/// Get the static profiler instance, creating it if necessary.
+///
+/// This should first be called from the main thread before any scopes that may be recorded are run.
+///
+/// @return  Profiler instance.
+///
+/// @see DestroyStaticInstance(), GetRecordingInstance()
+FrameProfiler& FrameProfiler::GetStaticInstance()
+{
+	if( !sm_pInstance )
+	{
+		sm_pInstance = new FrameProfiler;
+		HELIUM_ASSERT( sm_pInstance );
+	}
+
+	return *sm_pInstance;
+}
+
+/// Destroy the static profiler instance if one exists.
+///
+/// @see GetStaticInstance()
+void FrameProfiler::DestroyStaticInstance()
+{
+	delete sm_pInstance;
+	sm_pInstance = NULL;
+}
+
+/// Get the history of the scope with the given name, creating it if necessary.
+///
+/// Scopes are identified by the contents of their name, so the same name passed from different modules (each with
+/// its own copy of the string literal) still shares a single history.  The address is checked first, as that is how
+/// names from the same module almost always match.
+///
+/// @param[in] pName  Scope name.
+///
+/// @return  Scope history.
+FrameProfiler::ScopeHistory* FrameProfiler::GetScopeHistory( const tchar_t* pName )
+{
+	size_t scopeCount = m_scopeHistories.GetSize();
+	for( size_t scopeIndex = 0; scopeIndex < scopeCount; ++scopeIndex )
+	{
+		ScopeHistory* pHistory = m_scopeHistories[ scopeIndex ];
+		if( pHistory->pName == pName || CompareString( pHistory->pName, pName ) == 0 )
+		{
+			return pHistory;
+		}
+	}
+
+	ScopeHistory* pHistory = new ScopeHistory;
+	HELIUM_ASSERT( pHistory );
+	pHistory->pName = pName;
+	pHistory->frameTicks = 0;
+	pHistory->bRanThisFrame = false;
+	pHistory->frameCount = 0;
+	m_scopeHistories.Push( pHistory );
+
+	return pHistory;
+}
+
+#endif  // HELIUM_PROFILE_FRAMES
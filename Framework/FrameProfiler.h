@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Framework/Framework.h"
+
+#include "Platform/Timer.h"
+#include "Foundation/DynamicArray.h"
+#include "Foundation/String.h"
+#include "Engine/ProfilerThreadBuffers.h"
+
+#ifndef HELIUM_PROFILE_FRAMES
+/// Set to non-zero to compile in support for timing frames, tasks, and subsystems.  Recording itself is disabled
+/// until FrameProfiler::Start() is called, so the runtime cost when not recording is a single pointer test per scope.
+#define HELIUM_PROFILE_FRAMES ( 1 )
+#endif
+
+#if HELIUM_PROFILE_FRAMES
+
+/// Time the rest of the enclosing scope under the given name (which must be a TXT() string with static storage
+/// duration).
+#define HELIUM_PROFILE_FRAME_SCOPE( NAME ) Helium::FrameProfiler::Scope frameProfilerScope( NAME )
+
+namespace Helium
+{
+	/// Frame profiler.
+	///
+	/// Records how long each task in the TaskScheduler schedule and each instrumented subsystem takes every frame.
+	/// Like the JobProfiler, each thread records its timings into its own fixed-size ring buffer, so recording never
+	/// takes a lock or allocates after the first scope on a given thread.  At the end of each frame, the timings are
+	/// folded into a rolling window of per-scope frame totals from which min/avg/p99/max statistics are computed on
+	/// demand.  The recorded timeline can be exported as a Chrome trace ("chrome://tracing") and the statistics as CSV.
+	class HELIUM_FRAMEWORK_API FrameProfiler : NonCopyable
+	{
+	public:
+		/// Maximum number of events retained for each thread.
+		static const uint32_t EVENT_COUNT_MAX = 16384;
+		/// Number of frames over which statistics are kept.
+		static const uint32_t FRAME_COUNT_MAX = 300;
+
+		/// Name under which whole frames are recorded.
+		static const tchar_t* const FRAME_SCOPE_NAME;
+
+		/// Rolling statistics for a profiled scope, in milliseconds per frame.
+		struct Statistics
+		{
+			/// Scope name.
+			const tchar_t* pName;
+			/// Number of frames in the window the scope ran in.
+			uint32_t frameCount;
+			/// Shortest frame total.
+			float32_t minMilliseconds;
+			/// Average frame total.
+			float32_t avgMilliseconds;
+			/// 99th percentile frame total.
+			float32_t p99Milliseconds;
+			/// Longest frame total.
+			float32_t maxMilliseconds;
+		};
+
+		/// Scoped timer, used through HELIUM_PROFILE_FRAME_SCOPE.
+		class HELIUM_FRAMEWORK_API Scope : NonCopyable
+		{
+		public:
+			inline explicit Scope( const tchar_t* pName );
+			inline ~Scope();
+
+		private:
+			/// Profiler recording the scope, or null if not recording.
+			FrameProfiler* m_pProfiler;
+			/// Scope name.
+			const tchar_t* m_pName;
+			/// Tick count at which the scope was entered.
+			uint64_t m_beginTicks;
+		};
+
+		/// @name Recording Control
+		//@{
+		void Start();
+		void Stop();
+		void Reset();
+		inline bool IsRecording() const;
+		//@}
+
+		/// @name Event Recording
+		//@{
+		void RecordScope( const tchar_t* pName, uint64_t beginTicks, uint64_t endTicks );
+		void EndFrame();
+		//@}
+
+		/// @name Statistics and Export
+		//@{
+		void GetStatistics( DynamicArray< Statistics >& rStatistics ) const;
+		bool WriteChromeTrace( const String& rFileName ) const;
+		bool WriteCsv( const String& rFileName ) const;
+		//@}
+
+		/// @name Static Access
+		//@{
+		static FrameProfiler& GetStaticInstance();
+		static void DestroyStaticInstance();
+		inline static FrameProfiler* GetRecordingInstance();
+		//@}
+
+	private:
+		/// Recorded scope execution.
+		struct Event
+		{
+			/// Tick count at which the scope was entered.
+			uint64_t beginTicks;
+			/// Tick count at which the scope was left.
+			uint64_t endTicks;
+			/// Scope name.
+			const tchar_t* pName;
+		};
+
+		/// Per-frame totals of a scope over the statistics window.
+		struct ScopeHistory
+		{
+			/// Scope name.
+			const tchar_t* pName;
+			/// Ticks accumulated during the current frame.
+			uint64_t frameTicks;
+			/// True if the scope ran during the current frame.
+			bool bRanThisFrame;
+			/// Total number of frames recorded (the write position is this modulo FRAME_COUNT_MAX).
+			uint32_t frameCount;
+			/// Frame total ring, in milliseconds.
+			float32_t frameMilliseconds[ FRAME_COUNT_MAX ];
+		};
+
+		/// Per-thread event ring buffer.
+		typedef ProfilerThreadBuffers< Event, EVENT_COUNT_MAX >::ThreadBuffer ThreadBuffer;
+
+		/// Per-thread event ring buffers (the read count tracks the events folded into the statistics by EndFrame()).
+		ProfilerThreadBuffers< Event, EVENT_COUNT_MAX > m_buffers;
+		/// True while recording.
+		volatile bool m_bRecording;
+
+		/// Per-scope history (only accessed by the thread ending frames).
+		DynamicArray< ScopeHistory* > m_scopeHistories;
+		/// Tick count at which the current frame started.
+		uint64_t m_frameBeginTicks;
+
+		/// Profiler instance.
+		static FrameProfiler* sm_pInstance;
+
+		/// @name Construction/Destruction
+		//@{
+		FrameProfiler();
+		~FrameProfiler();
+		//@}
+
+		/// @name Private Utility Functions
+		//@{
+		ScopeHistory* GetScopeHistory( const tchar_t* pName );
+		//@}
+	};
+}
+
+#include "Framework/FrameProfiler.inl"
+
+#else  // HELIUM_PROFILE_FRAMES
+
+#define HELIUM_PROFILE_FRAME_SCOPE( NAME )
+
+#endif  // HELIUM_PROFILE_FRAMES
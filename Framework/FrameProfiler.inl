@@ -0,0 +1,45 @@
+namespace Helium
+{
+	/// Get whether scopes are currently being recorded.
+	///
+	/// @return  True if recording, false if not.
+	///
+	/// @see Start(), Stop()
+	bool FrameProfiler::IsRecording() const
+	{
+		return m_bRecording;
+	}
+
+	/// Get the static profiler instance if it exists and is currently recording.
+	///
+	/// This never creates the profiler instance, so it is safe to call from any thread.
+	///
+	/// @return  Profiler instance if recording, null if not.
+	///
+	/// @see GetStaticInstance()
+	FrameProfiler* FrameProfiler::GetRecordingInstance()
+	{
+		FrameProfiler* pInstance = sm_pInstance;
+
+		return ( pInstance && pInstance->m_bRecording ? pInstance : NULL );
+	}
+
+	/// Constructor.
+	///
+	/// @param[in] pName  Scope name (must have static storage duration).
+	FrameProfiler::Scope::Scope( const tchar_t* pName )
+		: m_pProfiler( FrameProfiler::GetRecordingInstance() )
+		, m_pName( pName )
+		, m_beginTicks( m_pProfiler ? Timer::GetTickCount() : 0 )
+	{
+	}
+
+	/// Destructor.
+	FrameProfiler::Scope::~Scope()
+	{
+		if( m_pProfiler )
+		{
+			m_pProfiler->RecordScope( m_pName, m_beginTicks, Timer::GetTickCount() );
+		}
+	}
+}
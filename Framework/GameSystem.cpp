@@ -6,6 +6,7 @@
 #include "Foundation/FilePath.h"
 #include "Reflect/Registry.h"
 #include "Platform/Timer.h"
+#include "Platform/Thread.h"
 #include "Engine/Config.h"
 #include "Engine/JobManager.h"
 #include "Engine/CacheManager.h"
@@ -19,13 +20,18 @@
 #include "Framework/WorldManager.h"
 #include "Framework/SceneDefinition.h"
 #include "Framework/TaskScheduler.h"
+#include "Framework/RenderThread.h"
+#include "Framework/FrameProfiler.h"
 
 using namespace Helium;
 
 /// Constructor.
 GameSystem::GameSystem()
 : m_pAssetLoaderInitialization( NULL )
+, m_pRendererInitialization( NULL )
 , m_bStopRunning( false )
+, m_bPipelinedRendering( false )
+, m_serverTickRate( 0 )
 {
 }
 
@@ -80,6 +86,31 @@ bool GameSystem::Initialize(
 	}
 #endif
 
+	// Rendering can be pipelined with the simulation, dedicated servers run headless, and frame and job profiling
+	// can be started from the command line as well as by the game.
+	for( size_t argumentIndex = 0; argumentIndex < m_arguments.GetSize(); ++argumentIndex )
+	{
+		if( m_arguments[ argumentIndex ] == TXT( "-pipeline_render" ) )
+		{
+			m_bPipelinedRendering = true;
+		}
+		else if( m_arguments[ argumentIndex ] == TXT( "-server" ) && m_serverTickRate == 0 )
+		{
+			m_serverTickRate = HELIUM_DEFAULT_SERVER_TICK_RATE;
+		}
+#if HELIUM_PROFILE_FRAMES
+		else if( m_arguments[ argumentIndex ] == TXT( "-profile_frames" ) )
+		{
+			FrameProfiler::GetStaticInstance().Start();
+		}
+#endif
+#if HELIUM_PROFILE_JOBS
+		else if( m_arguments[ argumentIndex ] == TXT( "-profile_jobs" ) )
+		{
+			JobProfiler::GetStaticInstance().Start();
+		}
+#endif
+	}
 
 	// Initialize the async loading thread.
 	bool bAsyncLoaderInitSuccess = AsyncLoader::GetStaticInstance().Initialize();
@@ -156,29 +187,37 @@ bool GameSystem::Initialize(
 		return false;
 	}
 
-	// Create and initialize the window manager (note that we need a window manager for message loop processing, so
-	// the instance cannot be left null).
-	bool bWindowManagerInitSuccess = rWindowManagerInitialization.Initialize();
-	HELIUM_ASSERT( bWindowManagerInitSuccess );
-	if( !bWindowManagerInitSuccess )
+	// Dedicated servers run headless, so they get neither a window nor a renderer.
+	if( m_serverTickRate == 0 )
 	{
-		HELIUM_TRACE( TraceLevels::Error, TXT( "GameSystem::Initialize(): Window manager initialization failed.\n" ) );
+		// Create and initialize the window manager (note that we need a window manager for message loop processing,
+		// so the instance cannot be left null).
+		bool bWindowManagerInitSuccess = rWindowManagerInitialization.Initialize();
+		HELIUM_ASSERT( bWindowManagerInitSuccess );
+		if( !bWindowManagerInitSuccess )
+		{
+			HELIUM_TRACE(
+				TraceLevels::Error,
+				TXT( "GameSystem::Initialize(): Window manager initialization failed.\n" ) );
 
-		return false;
-	}
-	
-	// Create and initialize the renderer.
-	bool bRendererInitSuccess = rRendererInitialization.Initialize();
-	HELIUM_ASSERT( bRendererInitSuccess );
-	if( !bRendererInitSuccess )
-	{
-		HELIUM_TRACE( TraceLevels::Error, TXT( "GameSystem::Initialize(): Renderer initialization failed.\n" ) );
+			return false;
+		}
 
-		return false;
+		// Create and initialize the renderer.  A pipelined renderer is called from the render thread while the main
+		// and loading threads keep creating and updating resources, so it has to be created thread safe.
+		rRendererInitialization.SetMultithreaded( m_bPipelinedRendering );
+		bool bRendererInitSuccess = rRendererInitialization.Initialize();
+		HELIUM_ASSERT( bRendererInitSuccess );
+		if( !bRendererInitSuccess )
+		{
+			HELIUM_TRACE( TraceLevels::Error, TXT( "GameSystem::Initialize(): Renderer initialization failed.\n" ) );
+
+			return false;
+		}
+
+		m_pRendererInitialization = &rRendererInitialization;
 	}
 
-	m_pRendererInitialization = &rRendererInitialization;
-	
 	// Initialize the world manager and main game world.
 	WorldManager& rWorldManager = WorldManager::GetStaticInstance();
 	bool bWorldManagerInitSuccess = rWorldManager.Initialize();
@@ -201,6 +240,26 @@ void GameSystem::Shutdown()
 {
 	WorldManager::DestroyStaticInstance();
 
+#if HELIUM_PROFILE_FRAMES
+	FrameProfiler* pFrameProfiler = FrameProfiler::GetRecordingInstance();
+	if( pFrameProfiler )
+	{
+		pFrameProfiler->Stop();
+		pFrameProfiler->WriteChromeTrace( TXT( "FrameProfile.json" ) );
+		pFrameProfiler->WriteCsv( TXT( "FrameProfile.csv" ) );
+	}
+#endif
+
+#if HELIUM_PROFILE_JOBS
+	// Job pool statistics are written along with the trace, so this must happen before the job manager goes away.
+	JobProfiler* pJobProfiler = JobProfiler::GetRecordingInstance();
+	if( pJobProfiler )
+	{
+		pJobProfiler->Stop();
+		pJobProfiler->WriteChromeTrace( TXT( "JobProfile.json" ) );
+	}
+#endif
+
 	if( m_pRendererInitialization )
 	{
 		m_pRendererInitialization->Shutdown();
@@ -208,6 +267,12 @@ void GameSystem::Shutdown()
 	}
 
 	JobManager::DestroyStaticInstance();
+#if HELIUM_PROFILE_JOBS
+	JobProfiler::DestroyStaticInstance();
+#endif
+#if HELIUM_PROFILE_FRAMES
+	FrameProfiler::DestroyStaticInstance();
+#endif
 
 	Components::Cleanup();
 
@@ -249,14 +314,161 @@ void GameSystem::Shutdown()
 /// @return  Result code of application execution.
 int32_t GameSystem::Run()
 {
+	if( m_serverTickRate != 0 )
+	{
+		return RunServer();
+	}
+
+	// When pipelined, each world update hands its graphics scenes over to the render thread (see
+	// GraphicsManagerComponent), which then renders that frame while the next one simulates.
+	RenderThread* pRenderThread = NULL;
+	if( m_bPipelinedRendering && !( m_pRendererInitialization && m_pRendererInitialization->IsMultithreaded() ) )
+	{
+		HELIUM_TRACE(
+			TraceLevels::Warning,
+			TXT( "GameSystem::Run(): Renderer was not created for pipelining, falling back to lockstep rendering.\n" ) );
+	}
+	else if( m_bPipelinedRendering )
+	{
+		pRenderThread = RenderThread::CreateStaticInstance();
+		HELIUM_ASSERT( pRenderThread );
+		if( !pRenderThread->Initialize() )
+		{
+			HELIUM_TRACE( TraceLevels::Warning, TXT( "GameSystem::Run(): Falling back to lockstep rendering.\n" ) );
+			RenderThread::DestroyStaticInstance();
+			pRenderThread = NULL;
+		}
+	}
+
 	while ( !m_bStopRunning )
 	{
-		AssetLoader::GetStaticInstance()->Tick();
+		{
+			HELIUM_PROFILE_FRAME_SCOPE( TXT( "AssetLoader::Tick" ) );
+			AssetLoader::GetStaticInstance()->Tick();
+		}
 
 		WorldManager& rWorldManager = WorldManager::GetStaticInstance();
 		rWorldManager.Update();
+
+		if( pRenderThread )
+		{
+			HELIUM_PROFILE_FRAME_SCOPE( TXT( "RenderThread::Kick" ) );
+			pRenderThread->Kick();
+		}
+
+#if HELIUM_PROFILE_FRAMES
+		FrameProfiler* pFrameProfiler = FrameProfiler::GetRecordingInstance();
+		if( pFrameProfiler )
+		{
+			pFrameProfiler->EndFrame();
+		}
+#endif
+	}
+
+	// Worlds (and their graphics scenes) must not be torn down while a frame is still rendering.
+	RenderThread::DestroyStaticInstance();
+
+	m_bStopRunning = false;
+
+	return 0;
+}
+
+/// Run the application loop headless at the fixed server tick rate.
+///
+/// Tasks requiring graphics are skipped, the world timer advances by exactly one tick interval per update, and the
+/// thread sleeps between ticks instead of spinning.  Ticks that run past the start of the next one are reported; if
+/// the loop falls more than a full tick behind, the missed ticks are dropped rather than run back-to-back.
+///
+/// @return  Result code of application execution.
+///
+/// @see SetServerTickRate()
+int32_t GameSystem::RunServer()
+{
+	HELIUM_ASSERT( m_serverTickRate != 0 );
+
+	const uint64_t ticksPerSecond = Timer::GetTicksPerSecond();
+	const uint64_t tickInterval = Max< uint64_t >( ticksPerSecond / m_serverTickRate, 1 );
+	const uint64_t ticksPerMillisecond = Max< uint64_t >( ticksPerSecond / 1000, 1 );
+	const float64_t millisecondsPerTick = Timer::GetSecondsPerTick() * 1000.0;
+
+	WorldManager& rWorldManager = WorldManager::GetStaticInstance();
+	rWorldManager.SetHeadless( true );
+	rWorldManager.SetFixedFrameDeltaTickCount( tickInterval );
+
+	HELIUM_TRACE(
+		TraceLevels::Info,
+		TXT( "GameSystem::RunServer(): Running headless at %" ) PRIu32 TXT( " ticks per second.\n" ),
+		m_serverTickRate );
+
+	uint64_t updateCount = 0;
+	uint64_t overrunCount = 0;
+	uint64_t nextTickCount = Timer::GetTickCount();
+
+	while ( !m_bStopRunning )
+	{
+		{
+			HELIUM_PROFILE_FRAME_SCOPE( TXT( "AssetLoader::Tick" ) );
+			AssetLoader::GetStaticInstance()->Tick();
+		}
+
+		rWorldManager.Update();
+		++updateCount;
+
+#if HELIUM_PROFILE_FRAMES
+		// Frames end before waiting for the next tick, so the "Frame" scope measures the previous wait plus this
+		// update; the per-task scopes measure the update alone.
+		FrameProfiler* pFrameProfiler = FrameProfiler::GetRecordingInstance();
+		if( pFrameProfiler )
+		{
+			pFrameProfiler->EndFrame();
+		}
+#endif
+
+		nextTickCount += tickInterval;
+
+		uint64_t tickCount = Timer::GetTickCount();
+		if( tickCount > nextTickCount )
+		{
+			++overrunCount;
+
+			uint64_t lateTickCount = tickCount - nextTickCount;
+			HELIUM_TRACE(
+				TraceLevels::Warning,
+				TXT( "GameSystem::RunServer(): Update %" ) PRIu64 TXT( " overran its tick by %.2f ms.\n" ),
+				updateCount,
+				static_cast< float64_t >( lateTickCount ) * millisecondsPerTick );
+
+			if( lateTickCount >= tickInterval )
+			{
+				nextTickCount = tickCount;
+			}
+
+			continue;
+		}
+
+		// Sleep through most of the wait, then yield for the remainder since sleeps are only accurate to about a
+		// millisecond (or worse, depending on the OS scheduler).
+		uint64_t remainingTickCount = nextTickCount - tickCount;
+		if( remainingTickCount > 2 * ticksPerMillisecond )
+		{
+			Thread::Sleep( static_cast< uint32_t >( remainingTickCount / ticksPerMillisecond - 1 ) );
+		}
+
+		while ( !m_bStopRunning && Timer::GetTickCount() < nextTickCount )
+		{
+			Thread::Yield();
+		}
 	}
 
+	HELIUM_TRACE(
+		TraceLevels::Info,
+		TXT( "GameSystem::RunServer(): Stopped after %" ) PRIu64 TXT( " updates, %" ) PRIu64 TXT( " of which overran.\n" ),
+		updateCount,
+		overrunCount );
+
+	rWorldManager.SetHeadless( false );
+	rWorldManager.SetFixedFrameDeltaTickCount( 0 );
+
 	m_bStopRunning = false;
 
 	return 0;
@@ -292,4 +504,52 @@ World *GameSystem::LoadScene( SceneDefinition *pSceneDefinition )
 void GameSystem::StopRunning()
 {
 	m_bStopRunning = true;
-}
\ No newline at end of file
+}
+
+/// Set whether each frame should render on a separate thread while the next frame simulates.
+///
+/// Pipelining is off by default.  It must be enabled before Initialize(), so that the renderer is created for use
+/// from the render thread, and takes effect the next time Run() is called.  Pipelining adds a frame of latency
+/// between simulation and display in exchange for overlapping the two.
+///
+/// @param[in] bPipelined  True to pipeline rendering, false to render in lockstep with the simulation.
+///
+/// @see IsPipelinedRendering()
+void GameSystem::SetPipelinedRendering( bool bPipelined )
+{
+	m_bPipelinedRendering = bPipelined;
+}
+
+/// Get whether each frame renders on a separate thread while the next frame simulates.
+///
+/// @return  True if rendering is pipelined, false if it runs in lockstep with the simulation.
+///
+/// @see SetPipelinedRendering()
+bool GameSystem::IsPipelinedRendering() const
+{
+	return m_bPipelinedRendering;
+}
+
+/// Set the fixed rate at which Run() updates a headless dedicated server.
+///
+/// This only takes effect the next time Run() is called.  Servers are also started at
+/// HELIUM_DEFAULT_SERVER_TICK_RATE by the "-server" command-line argument.  Setting a rate before Initialize() also
+/// skips creating the window manager and renderer.
+///
+/// @param[in] ticksPerSecond  Updates per second, or zero to run the regular client loop.
+///
+/// @see GetServerTickRate()
+void GameSystem::SetServerTickRate( uint32_t ticksPerSecond )
+{
+	m_serverTickRate = ticksPerSecond;
+}
+
+/// Get the fixed rate at which Run() updates a headless dedicated server.
+///
+/// @return  Updates per second, or zero if the regular client loop is run.
+///
+/// @see SetServerTickRate()
+uint32_t GameSystem::GetServerTickRate() const
+{
+	return m_serverTickRate;
+}
@@ -5,6 +5,9 @@
 
 #define NO_GFX (1)
 
+/// Default update rate of dedicated servers started with "-server", in ticks per second.
+#define HELIUM_DEFAULT_SERVER_TICK_RATE (30)
+
 namespace Helium
 {
 	class AssetType;
@@ -56,11 +59,32 @@ namespace Helium
 
 		virtual void StopRunning();
 
+		/// @name Rendering
+		//@{
+		void SetPipelinedRendering( bool bPipelined );
+		bool IsPipelinedRendering() const;
+		//@}
+
+		/// @name Dedicated Server Support
+		//@{
+		void SetServerTickRate( uint32_t ticksPerSecond );
+		uint32_t GetServerTickRate() const;
+		//@}
+
 	protected:
 		/// AssetLoader initialization interface.
 		AssetLoaderInitialization* m_pAssetLoaderInitialization;
 		RendererInitialization*    m_pRendererInitialization;
 		SystemDefinitionPtr        m_spSystemDefinition;
 		bool                       m_bStopRunning;
+		/// True to render each frame on a RenderThread while the next one simulates.
+		bool                       m_bPipelinedRendering;
+		/// Fixed headless update rate in ticks per second, or zero to run a regular client loop.
+		uint32_t                   m_serverTickRate;
+
+		/// @name Application Loop Implementation
+		//@{
+		int32_t RunServer();
+		//@}
 	};
 }
@@ -0,0 +1,189 @@
+#include "FrameworkPch.h"
+#include "Framework/RenderThread.h"
+
+#include "Platform/Atomic.h"
+
+using namespace Helium;
+
+RenderThread* RenderThread::sm_pInstance = NULL;
+
+/// Constructor.
+RenderThread::RenderThread()
+: m_kickCondition( false, false )
+, m_idleCondition( true, true )
+, m_stopCounter( 0 )
+, m_pThread( NULL )
+{
+}
+
+/// Destructor.
+RenderThread::~RenderThread()
+{
+	Shutdown();
+}
+
+/// Start the render thread.
+///
+/// @return  True if the thread was started successfully, false if not.
+///
+/// @see Shutdown()
+bool RenderThread::Initialize()
+{
+	HELIUM_ASSERT( !m_pThread );
+
+	m_stopCounter = 0;
+	m_idleCondition.Signal();
+
+	m_pThread = new RunnableThread( this );
+	HELIUM_ASSERT( m_pThread );
+	if( !m_pThread->Start( TXT( "Render" ) ) )
+	{
+		HELIUM_TRACE( TraceLevels::Error, TXT( "RenderThread::Initialize(): Failed to start the render thread.\n" ) );
+
+		delete m_pThread;
+		m_pThread = NULL;
+
+		return false;
+	}
+
+	return true;
+}
+
+/// Finish rendering any frame in flight and stop the render thread.
+///
+/// @see Initialize()
+void RenderThread::Shutdown()
+{
+	if( !m_pThread )
+	{
+		return;
+	}
+
+	Sync();
+
+	AtomicExchangeRelease( m_stopCounter, 1 );
+	m_kickCondition.Signal();
+
+	m_pThread->Join();
+	delete m_pThread;
+	m_pThread = NULL;
+
+	m_pendingRequests.Clear();
+	m_activeRequests.Clear();
+}
+
+/// Queue work for rendering the next frame.
+///
+/// This may only be called from the simulation thread, and the data passed must not be modified until the next
+/// Sync() after the frame is kicked.
+///
+/// @param[in] pFunction  Function to call on the render thread.
+/// @param[in] pData      Data to pass to the function.
+///
+/// @see Kick(), Sync()
+void RenderThread::Enqueue( RenderFunction pFunction, void* pData )
+{
+	HELIUM_ASSERT( pFunction );
+
+	Request* pRequest = m_pendingRequests.New();
+	HELIUM_ASSERT( pRequest );
+	pRequest->pFunction = pFunction;
+	pRequest->pData = pData;
+}
+
+/// Start rendering the work queued since the last kick.
+///
+/// Waits for the previous frame to finish first if it has not already been synced.
+///
+/// @see Enqueue(), Sync()
+void RenderThread::Kick()
+{
+	HELIUM_ASSERT( m_pThread );
+
+	Sync();
+
+	if( m_pendingRequests.IsEmpty() )
+	{
+		return;
+	}
+
+	m_activeRequests.Swap( m_pendingRequests );
+	m_pendingRequests.RemoveAll();
+
+	m_idleCondition.Reset();
+	m_kickCondition.Signal();
+}
+
+/// Block until the frame in flight, if any, has finished rendering.
+///
+/// @see Kick()
+void RenderThread::Sync()
+{
+	m_idleCondition.Wait();
+}
+
+/// Render each kicked frame.
+void RenderThread::Run()
+{
+	for( ;; )
+	{
+		m_kickCondition.Wait();
+
+		if( m_stopCounter != 0 )
+		{
+			break;
+		}
+
+		size_t requestCount = m_activeRequests.GetSize();
+		for( size_t requestIndex = 0; requestIndex < requestCount; ++requestIndex )
+		{
+			const Request& rRequest = m_activeRequests[ requestIndex ];
+			rRequest.pFunction( rRequest.pData );
+		}
+
+		m_activeRequests.RemoveAll();
+
+		m_idleCondition.Signal();
+	}
+}
+
+/// Get the singleton RenderThread instance.
+///
+/// @return  Pointer to the RenderThread instance, or null if rendering is not pipelined.
+///
+/// @see CreateStaticInstance(), DestroyStaticInstance()
+RenderThread* RenderThread::GetStaticInstance()
+{
+	return sm_pInstance;
+}
+
+/// Create the singleton RenderThread instance if one does not already exist.
+///
+/// @return  Pointer to the newly created instance, or null if an instance already exists.
+///
+/// @see GetStaticInstance(), DestroyStaticInstance()
+RenderThread* RenderThread::CreateStaticInstance()
+{
+	if( sm_pInstance )
+	{
+		return NULL;
+	}
+
+	sm_pInstance = new RenderThread;
+	HELIUM_ASSERT( sm_pInstance );
+
+	return sm_pInstance;
+}
+
+/// Destroy the singleton RenderThread instance, waiting for any frame in flight.
+///
+/// @see GetStaticInstance(), CreateStaticInstance()
+void RenderThread::DestroyStaticInstance()
+{
+	if( sm_pInstance )
+	{
+		sm_pInstance->Shutdown();
+		delete sm_pInstance;
+		sm_pInstance = NULL;
+	}
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Framework/Framework.h"
+
+#include "Foundation/DynamicArray.h"
+#include "Platform/Condition.h"
+#include "Platform/Thread.h"
+
+namespace Helium
+{
+	/// Dedicated thread for rendering one frame while the next one simulates.
+	///
+	/// Each frame, the simulation waits for the previous frame to finish rendering with Sync() at the point where it
+	/// hands over scene state (each graphics scene takes a snapshot there), queues the work needed to render that
+	/// snapshot with Enqueue(), then starts rendering it with Kick() once the frame's tasks are done.  Nothing may
+	/// touch state being rendered between Kick() and the next Sync().
+	///
+	/// The instance only exists while rendering is pipelined; when GetStaticInstance() returns null, scenes render in
+	/// lockstep on the thread that updates them.  Other threads keep creating and locking render resources while a
+	/// frame renders, so the renderer must have been created multithreaded (see RendererInitialization).
+	class HELIUM_FRAMEWORK_API RenderThread : public Runnable, NonCopyable
+	{
+	public:
+		/// Function called on the render thread to render queued work.
+		typedef void ( *RenderFunction )( void* pData );
+
+		/// @name Initialization
+		//@{
+		bool Initialize();
+		void Shutdown();
+		//@}
+
+		/// @name Frame Control
+		//@{
+		void Enqueue( RenderFunction pFunction, void* pData );
+		void Kick();
+		void Sync();
+		//@}
+
+		/// @name Runnable Interface
+		//@{
+		virtual void Run();
+		//@}
+
+		/// @name Static Access
+		//@{
+		static RenderThread* GetStaticInstance();
+		static RenderThread* CreateStaticInstance();
+		static void DestroyStaticInstance();
+		//@}
+
+	private:
+		/// Queued render work.
+		struct Request
+		{
+			/// Function to call.
+			RenderFunction pFunction;
+			/// Data to pass to the function.
+			void* pData;
+		};
+
+		/// Work queued for the next frame (simulation side).
+		DynamicArray< Request > m_pendingRequests;
+		/// Work for the frame being rendered (render thread side).
+		DynamicArray< Request > m_activeRequests;
+
+		/// Condition signaled to start rendering a frame (or to shut down).
+		Condition m_kickCondition;
+		/// Condition signaled while no frame is being rendered.
+		Condition m_idleCondition;
+
+		/// Non-zero if the thread should stop when next possible.
+		volatile int32_t m_stopCounter;
+
+		/// Render thread.
+		RunnableThread* m_pThread;
+
+		/// Singleton instance.
+		static RenderThread* sm_pInstance;
+
+		/// @name Construction/Destruction
+		//@{
+		RenderThread();
+		~RenderThread();
+		//@}
+	};
+}
@@ -3,11 +3,40 @@
 
 using namespace Helium;
 
+/// Constructor.
+RendererInitialization::RendererInitialization()
+: m_bMultithreaded( false )
+{
+}
+
 /// Destructor.
 RendererInitialization::~RendererInitialization()
 {
 }
 
+/// Set whether the renderer will be called from more than one thread at once.
+///
+/// This must be set before Initialize() is called.  Multithreaded renderers serialize access to the device, which
+/// has a cost, so this should only be enabled when it is needed (such as when rendering is pipelined).
+///
+/// @param[in] bMultithreaded  True if the renderer will be used from multiple threads, false if not.
+///
+/// @see IsMultithreaded()
+void RendererInitialization::SetMultithreaded( bool bMultithreaded )
+{
+	m_bMultithreaded = bMultithreaded;
+}
+
+/// Get whether the renderer will be called from more than one thread at once.
+///
+/// @return  True if the renderer is created for use from multiple threads, false if not.
+///
+/// @see SetMultithreaded()
+bool RendererInitialization::IsMultithreaded() const
+{
+	return m_bMultithreaded;
+}
+
 /// @fn bool RendererInitialization::Initialize()
 /// Create an initialize a new Renderer instance.
 ///
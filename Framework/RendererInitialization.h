@@ -12,14 +12,22 @@ namespace Helium
 	public:
 		/// @name Construction/Destruction
 		//@{
+		RendererInitialization();
 		virtual ~RendererInitialization();
 		//@}
 
 		/// @name Renderer Initialization
 		//@{
 		virtual bool Initialize() = 0;
+
+		void SetMultithreaded( bool bMultithreaded );
+		bool IsMultithreaded() const;
 		//@}
 
 		virtual void Shutdown() = 0;
+
+	protected:
+		/// True if the renderer will be called from more than one thread at once.
+		bool m_bMultithreaded;
 	};
 }
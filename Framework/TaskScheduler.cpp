@@ -2,6 +2,7 @@
 #include "FrameworkPch.h"
 #include "TaskScheduler.h"
 #include "Foundation/Map.h"
+#include "Framework/FrameProfiler.h"
 
 using namespace Helium;
 
@@ -30,10 +31,18 @@ bool TaskScheduler::CalculateSchedule()
 	task = TaskDefinition::s_FirstTaskDefinition;
 	while (task)
 	{
+		task->m_RequiresGraphics = task->m_Contract.m_RequiresGraphics;
+
 		// Look at all of its dependencies
 		for (DynamicArray<const TaskDefinition *>::Iterator dependency_iter = task->m_Contract.m_ContributedDependencies.Begin();
 			dependency_iter != task->m_Contract.m_ContributedDependencies.End(); ++dependency_iter)
 		{
+			// Anything that is part of rendering has no reason to run headless
+			if (*dependency_iter == &StandardDependencies::Render::m_This)
+			{
+				task->m_RequiresGraphics = true;
+			}
+
 			// And for each of those dependencies, insert an entry into the dependency map
 			M_DependencyTaskMap::Iterator map_entry = dependencyContributingTaskMap.Find(*dependency_iter);
 			if (map_entry == dependencyContributingTaskMap.End())
@@ -278,13 +287,32 @@ bool InsertToTaskList(A_TaskDefinitionPtr &rTaskInfoList, DynamicArray<TaskFunc>
 	return true;
 }
 
-void TaskScheduler::ExecuteSchedule( DynamicArray< WorldPtr > &rWorlds )
+void TaskScheduler::ExecuteSchedule( DynamicArray< WorldPtr > &rWorlds, bool bHeadless )
 {
 	int i = 0;
 	for (DynamicArray<TaskFunc>::Iterator iter = m_ScheduleFunc.Begin(); iter != m_ScheduleFunc.End(); ++iter)
 	{
+		const TaskDefinition *pTask = m_ScheduleInfo[i++];
+		HELIUM_ASSERT(pTask->m_Func == *iter);
+
+		if (bHeadless && pTask->m_RequiresGraphics)
+		{
+			continue;
+		}
+
+#if HELIUM_PROFILE_FRAMES
+		FrameProfiler* pProfiler = FrameProfiler::GetRecordingInstance();
+		if (pProfiler)
+		{
+			uint64_t beginTicks = Timer::GetTickCount();
+			(*iter)( rWorlds );
+			pProfiler->RecordScope( pTask->m_Name, beginTicks, Timer::GetTickCount() );
+
+			continue;
+		}
+#endif
+
 		(*iter)( rWorlds );
-		HELIUM_ASSERT(m_ScheduleInfo[i++]->m_Func == *iter);
 	}
 }
 
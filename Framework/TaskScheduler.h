@@ -14,7 +14,7 @@
 #define HELIUM_DEFINE_TASK(__Type, __Function)              \
 	__Type __Type::m_This;                                  \
 	__Type::__Type()                                        \
-		: TaskDefinition(m_This, __Function, #__Type) \
+		: TaskDefinition(m_This, __Function, TXT( #__Type )) \
 	{                                                       \
 															\
 	}
@@ -28,7 +28,7 @@
 #define HELIUM_DEFINE_ABSTRACT_TASK(__Type)                 \
 	__Type __Type::m_This;                                  \
 	__Type::__Type()                                        \
-		: TaskDefinition(m_This, 0, #__Type)          \
+		: TaskDefinition(m_This, 0, TXT( #__Type ))    \
 	{                                                       \
 															\
 	}
@@ -57,6 +57,12 @@ namespace Helium
 	// Defines what the task expects and what it provides
 	struct TaskContract
 	{
+		TaskContract()
+			: m_RequiresGraphics(false)
+		{
+
+		}
+
 		// Task T must execute before this task
 		template <class T>
 		void ExecuteBefore()
@@ -96,11 +102,21 @@ namespace Helium
 			m_ContributedDependencies.Push(&rDependency);
 		}
 
+		// This task only produces output for display (or needs a window), so it is skipped when running headless.
+		// Tasks that execute within StandardDependencies::Render are treated this way implicitly.
+		void RequiresGraphics()
+		{
+			m_RequiresGraphics = true;
+		}
+
 		// Every requirement to be before or after another dependency goes here
 		DynamicArray<OrderRequirement> m_OrderRequirements;
 
 		// All dependencies we contribute to fulfilling
 		DynamicArray<const TaskDefinition *> m_ContributedDependencies;
+
+		// True if the task is skipped when running headless
+		bool m_RequiresGraphics;
 	};
 
 	class World;
@@ -109,13 +125,12 @@ namespace Helium
 
 	struct HELIUM_FRAMEWORK_API TaskDefinition
 	{
-		TaskDefinition(const TaskDefinition &rDependency, TaskFunc pFunc, const char *pName)
+		TaskDefinition(const TaskDefinition &rDependency, TaskFunc pFunc, const tchar_t *pName)
 			: m_DependencyReverseLookup(rDependency)
 			, m_Func(pFunc)
 			, m_Next(s_FirstTaskDefinition)
-#if HELIUM_TOOLS
 			, m_Name(pName)
-#endif
+			, m_RequiresGraphics(false)
 		{
 			m_Contract.ExecutesWithin(rDependency);
 
@@ -132,10 +147,8 @@ namespace Helium
 		// We build this list of tasks that must execute before us in TaskScheduler::CalculateSchedule()
 		mutable DynamicArray<const TaskDefinition *> m_RequiredTasks;
 
-#if HELIUM_TOOLS
-		// Task name useful for debug purposes
-		const char *m_Name;
-#endif
+		// Task name useful for debug purposes and frame profiling
+		const tchar_t *m_Name;
 
 		// Our contract to be filled out by subclass
 		TaskContract m_Contract;
@@ -148,6 +161,9 @@ namespace Helium
 		// Support for maintaining a linked list of all created task definitions (only one per type should ever exist)
 		TaskDefinition *m_Next;
 		static TaskDefinition *s_FirstTaskDefinition;
+
+		// Resolved from our contract in TaskScheduler::CalculateSchedule(), true if we are skipped when running headless
+		bool m_RequiresGraphics;
 	};
 	typedef DynamicArray<const TaskDefinition *> A_TaskDefinitionPtr;
 
@@ -155,7 +171,8 @@ namespace Helium
 	{
 	public:
 		static bool CalculateSchedule();
-		static void ExecuteSchedule( DynamicArray< WorldPtr > &rWorlds );
+		// Headless execution (dedicated servers) skips every task that requires graphics
+		static void ExecuteSchedule( DynamicArray< WorldPtr > &rWorlds, bool bHeadless = false );
 
 		static A_TaskDefinitionPtr m_ScheduleInfo;
 		static DynamicArray<TaskFunc> m_ScheduleFunc; // Compact version of our schedule
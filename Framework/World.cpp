@@ -7,6 +7,8 @@
 #include "Framework/SceneDefinition.h"
 #include "Framework/Slice.h"
 #include "Framework/Entity.h"
+#include "Engine/AssetLoader.h"
+#include "Platform/Timer.h"
 
 namespace Helium
 {
@@ -60,6 +62,21 @@ bool World::Initialize()
 /// @see Initialize()
 void World::Shutdown()
 {
+	// Abandon any streaming, waiting on outstanding scene definition loads so their requests are released.
+	AssetLoader* pAssetLoader = AssetLoader::GetStaticInstance();
+	for( size_t streamingIndex = 0; streamingIndex < m_StreamingSlices.GetSize(); ++streamingIndex )
+	{
+		StreamingSlice& rStreamingSlice = m_StreamingSlices[ streamingIndex ];
+		if( IsValid( rStreamingSlice.loadRequestId ) )
+		{
+			HELIUM_ASSERT( pAssetLoader );
+			AssetPtr spAsset;
+			pAssetLoader->FinishLoad( rStreamingSlice.loadRequestId, spAsset );
+		}
+	}
+
+	m_StreamingSlices.Clear();
+
 	// Remove all slices first.
 	while( !m_Slices.IsEmpty() )
 	{
@@ -311,3 +328,227 @@ Slice* World::GetSlice( size_t index ) const
 
 	return m_Slices[ index ];
 }
+
+/// Begin streaming a slice into this world.
+///
+/// The slice is added to the world right away, but empty.  Its scene definition (along with the entity definitions it
+/// references) is loaded in the background, after which its entities are instantiated a few at a time by
+/// UpdateSliceStreaming() so that no single frame pays for the entire slice.
+///
+/// @param[in] rSceneDefinitionPath  Path of the scene definition to instantiate.
+///
+/// @return  Slice being streamed in, or null if the load could not be started.
+///
+/// @see StreamOutSlice(), IsSliceStreaming(), UpdateSliceStreaming()
+Slice* World::StreamInSlice( const AssetPath& rSceneDefinitionPath )
+{
+	AssetLoader* pAssetLoader = AssetLoader::GetStaticInstance();
+	HELIUM_ASSERT( pAssetLoader );
+
+	size_t loadRequestId = pAssetLoader->BeginLoadObject( rSceneDefinitionPath );
+	if( IsInvalid( loadRequestId ) )
+	{
+		HELIUM_TRACE(
+			TraceLevels::Error,
+			TXT( "World::StreamInSlice(): Failed to begin loading scene definition \"%s\".\n" ),
+			*rSceneDefinitionPath.ToString() );
+
+		return NULL;
+	}
+
+	SlicePtr spSlice( Reflect::AssertCast< Slice >( Slice::CreateObject() ) );
+	HELIUM_ASSERT( spSlice );
+	HELIUM_VERIFY( AddSlice( spSlice ) );
+
+	StreamingSlice* pStreamingSlice = m_StreamingSlices.New();
+	HELIUM_ASSERT( pStreamingSlice );
+	pStreamingSlice->spSlice = spSlice;
+	pStreamingSlice->loadRequestId = loadRequestId;
+	pStreamingSlice->nextEntityDefinitionIndex = 0;
+	pStreamingSlice->bStreamingOut = false;
+
+	return spSlice;
+}
+
+/// Begin streaming a slice out of this world.
+///
+/// The slice's entities are destroyed a few at a time by UpdateSliceStreaming(), after which the slice is removed from
+/// the world.  Slices still being streamed in are streamed back out from wherever they got to.
+///
+/// @param[in] pSlice  Slice to stream out.
+///
+/// @return  True if the slice will be streamed out, false if it is not part of this world.
+///
+/// @see StreamInSlice(), IsSliceStreaming(), UpdateSliceStreaming()
+bool World::StreamOutSlice( Slice* pSlice )
+{
+	HELIUM_ASSERT( pSlice );
+
+	if( pSlice->GetWorld() != this || pSlice == m_RootSlice )
+	{
+		HELIUM_TRACE( TraceLevels::Error, TXT( "World::StreamOutSlice(): Slice is not a streamable slice of this world.\n" ) );
+
+		return false;
+	}
+
+	for( size_t streamingIndex = 0; streamingIndex < m_StreamingSlices.GetSize(); ++streamingIndex )
+	{
+		StreamingSlice& rStreamingSlice = m_StreamingSlices[ streamingIndex ];
+		if( rStreamingSlice.spSlice == pSlice )
+		{
+			rStreamingSlice.bStreamingOut = true;
+
+			return true;
+		}
+	}
+
+	StreamingSlice* pStreamingSlice = m_StreamingSlices.New();
+	HELIUM_ASSERT( pStreamingSlice );
+	pStreamingSlice->spSlice = pSlice;
+	SetInvalid( pStreamingSlice->loadRequestId );
+	pStreamingSlice->nextEntityDefinitionIndex = 0;
+	pStreamingSlice->bStreamingOut = true;
+
+	return true;
+}
+
+/// Get whether a slice is still being streamed in or out of this world.
+///
+/// @param[in] pSlice  Slice to check.
+///
+/// @return  True if the slice is still streaming, false if it is fully resident (or fully removed).
+///
+/// @see StreamInSlice(), StreamOutSlice(), IsStreaming()
+bool World::IsSliceStreaming( const Slice* pSlice ) const
+{
+	for( size_t streamingIndex = 0; streamingIndex < m_StreamingSlices.GetSize(); ++streamingIndex )
+	{
+		if( m_StreamingSlices[ streamingIndex ].spSlice == pSlice )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/// Advance slice streaming for the current frame.
+///
+/// Slices are streamed in the order they were requested.  Entity instantiation and destruction stops once the entity
+/// budget runs out.  The deadline is only checked after each entity, so a non-zero budget always buys at least one
+/// entity of progress, and passing the deadline zeroes the budget so callers sharing it across worlds stop as well.
+///
+/// @param[in]     deadlineTickCount  Timer tick count after which no more entities should be processed this frame.
+/// @param[in,out] rEntityBudget      Number of entities that may still be processed this frame, decremented for each
+///                                   one processed.
+///
+/// @see StreamInSlice(), StreamOutSlice()
+void World::UpdateSliceStreaming( uint64_t deadlineTickCount, uint32_t& rEntityBudget )
+{
+	size_t streamingIndex = 0;
+	while( streamingIndex < m_StreamingSlices.GetSize() )
+	{
+		if( TickStreamingSlice( m_StreamingSlices[ streamingIndex ], deadlineTickCount, rEntityBudget ) )
+		{
+			m_StreamingSlices.Remove( streamingIndex );
+			continue;
+		}
+
+		// Slices still loading don't hold up the ones behind them, anything else stopped for lack of budget.
+		if( IsInvalid( m_StreamingSlices[ streamingIndex ].loadRequestId ) )
+		{
+			break;
+		}
+
+		++streamingIndex;
+	}
+}
+
+/// Advance streaming of a single slice.
+///
+/// @param[in]     rStreamingSlice    Slice streaming state.
+/// @param[in]     deadlineTickCount  Timer tick count after which no more entities should be processed.
+/// @param[in,out] rEntityBudget      Number of entities that may still be processed this frame.
+///
+/// @return  True if the slice has finished streaming, false if not.
+bool World::TickStreamingSlice( StreamingSlice& rStreamingSlice, uint64_t deadlineTickCount, uint32_t& rEntityBudget )
+{
+	Slice* pSlice = rStreamingSlice.spSlice;
+	HELIUM_ASSERT( pSlice );
+
+	// Wait for the scene definition and its dependencies to finish loading in the background.
+	if( IsValid( rStreamingSlice.loadRequestId ) )
+	{
+		AssetLoader* pAssetLoader = AssetLoader::GetStaticInstance();
+		HELIUM_ASSERT( pAssetLoader );
+
+		AssetPtr spAsset;
+		if( !pAssetLoader->TryFinishLoad( rStreamingSlice.loadRequestId, spAsset ) )
+		{
+			return false;
+		}
+
+		SetInvalid( rStreamingSlice.loadRequestId );
+
+		SceneDefinition* pSceneDefinition = Reflect::SafeCast< SceneDefinition >( spAsset.Get() );
+		if( !pSceneDefinition )
+		{
+			HELIUM_TRACE( TraceLevels::Error, TXT( "World::UpdateSliceStreaming(): Failed to load a streamed slice's scene definition.\n" ) );
+
+			HELIUM_VERIFY( RemoveSlice( pSlice ) );
+
+			return true;
+		}
+
+		pSlice->Initialize( pSceneDefinition );
+	}
+
+	if( rStreamingSlice.bStreamingOut )
+	{
+		// Destroy from the back so no other entity has to be moved to fill the gap.
+		for( size_t entityCount = pSlice->GetEntityCount(); entityCount != 0; --entityCount )
+		{
+			if( rEntityBudget == 0 )
+			{
+				return false;
+			}
+
+			HELIUM_VERIFY( pSlice->DestroyEntity( pSlice->GetEntity( entityCount - 1 ) ) );
+
+			--rEntityBudget;
+			if( Timer::GetTickCount() > deadlineTickCount )
+			{
+				rEntityBudget = 0;
+			}
+		}
+
+		HELIUM_VERIFY( RemoveSlice( pSlice ) );
+
+		return true;
+	}
+
+	SceneDefinition* pSceneDefinition = pSlice->GetSceneDefinition();
+	HELIUM_ASSERT( pSceneDefinition );
+
+	size_t entityDefinitionCount = pSceneDefinition->GetEntityDefinitionCount();
+	for( ; rStreamingSlice.nextEntityDefinitionIndex < entityDefinitionCount; ++rStreamingSlice.nextEntityDefinitionIndex )
+	{
+		if( rEntityBudget == 0 )
+		{
+			return false;
+		}
+
+		EntityDefinition* pEntityDefinition =
+			pSceneDefinition->GetEntityDefinition( rStreamingSlice.nextEntityDefinitionIndex );
+		HELIUM_ASSERT( pEntityDefinition );
+		pSlice->CreateEntity( pEntityDefinition );
+
+		--rEntityBudget;
+		if( Timer::GetTickCount() > deadlineTickCount )
+		{
+			rEntityBudget = 0;
+		}
+	}
+
+	return true;
+}
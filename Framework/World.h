@@ -65,6 +65,16 @@ namespace Helium
 		Slice* GetSlice( size_t index ) const;
 		//@}
 
+		/// @name Slice Streaming
+		//@{
+		Slice* StreamInSlice( const AssetPath& rSceneDefinitionPath );
+		bool StreamOutSlice( Slice* pSlice );
+		bool IsSliceStreaming( const Slice* pSlice ) const;
+		inline bool IsStreaming() const;
+
+		void UpdateSliceStreaming( uint64_t deadlineTickCount, uint32_t& rEntityBudget );
+		//@}
+
 		/// @name Scene Access
 		//@{
 		SceneDefinition* GetSceneDefinition() { return m_spSceneDefinition.Get(); }
@@ -82,9 +92,27 @@ namespace Helium
 
 		ComponentCollection m_Components;
 
+		/// Slice being streamed in or out over several frames.
+		struct StreamingSlice
+		{
+			/// Slice being streamed.
+			SlicePtr spSlice;
+			/// AssetLoader request for the slice's scene definition (invalid once loaded).
+			size_t loadRequestId;
+			/// Index of the next entity definition to instantiate.
+			size_t nextEntityDefinitionIndex;
+			/// True if the slice is being streamed out.
+			bool bStreamingOut;
+		};
+
 		/// Active slices.
 		DynamicArray< SlicePtr > m_Slices;
 		SlicePtr m_RootSlice;
+
+		/// Slices being streamed, in the order they were requested.
+		DynamicArray< StreamingSlice > m_StreamingSlices;
+
+		bool TickStreamingSlice( StreamingSlice& rStreamingSlice, uint64_t deadlineTickCount, uint32_t& rEntityBudget );
 	};
 
 	typedef Helium::StrongPtr< World > WorldPtr;
@@ -19,4 +19,14 @@ namespace Helium
     {
         return m_Slices.GetSize();
     }
+
+    /// Get whether any slices are still being streamed in or out of this world.
+    ///
+    /// @return  True if streaming is in progress, false if not.
+    ///
+    /// @see StreamInSlice(), StreamOutSlice(), IsSliceStreaming()
+    bool World::IsStreaming() const
+    {
+        return !m_StreamingSlices.IsEmpty();
+    }
 }
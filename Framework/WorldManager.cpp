@@ -8,6 +8,7 @@
 #include "Framework/Entity.h"
 #include "Framework/SceneDefinition.h"
 #include "Framework/TaskScheduler.h"
+#include "Framework/FrameProfiler.h"
 
 using namespace Helium;
 
@@ -19,6 +20,10 @@ WorldManager::WorldManager()
 , m_frameTickCount( 0 )
 , m_frameDeltaTickCount( 0 )
 , m_frameDeltaSeconds( 0.0f )
+, m_fixedFrameDeltaTickCount( 0 )
+, m_bHeadless( false )
+, m_sliceStreamingBudgetMilliseconds( 2.0f )
+, m_sliceStreamingBudgetEntityCount( 64 )
 , m_bProcessedFirstFrame( false )
 {
 }
@@ -180,10 +185,29 @@ void WorldManager::Update()
 {
 	// Update the world time.
 	UpdateTime();
+
+	// Stream slices in and out under the per-frame budget before anything simulates.
+	{
+		HELIUM_PROFILE_FRAME_SCOPE( TXT( "WorldManager::UpdateSliceStreaming" ) );
+		uint64_t deadlineTickCount = Timer::GetTickCount() + static_cast< uint64_t >(
+			static_cast< float64_t >( m_sliceStreamingBudgetMilliseconds ) * 0.001 *
+			static_cast< float64_t >( Timer::GetTicksPerSecond() ) );
+		uint32_t entityBudget = Max< uint32_t >( m_sliceStreamingBudgetEntityCount, 1 );
+		for ( DynamicArray< WorldPtr >::Iterator worldIter = m_worlds.Begin(); worldIter != m_worlds.End(); ++worldIter )
+		{
+			if ( (*worldIter)->IsStreaming() )
+			{
+				(*worldIter)->UpdateSliceStreaming( deadlineTickCount, entityBudget );
+			}
+		}
+	}
 	
-	Helium::TaskScheduler::ExecuteSchedule( m_worlds );
+	Helium::TaskScheduler::ExecuteSchedule( m_worlds, m_bHeadless );
 	
-	Components::Tick();
+	{
+		HELIUM_PROFILE_FRAME_SCOPE( TXT( "Components::Tick" ) );
+		Components::Tick();
+	}
 
 	// TODO: I plan to do a "flag system" - components that are super lightweight.. like bitflags.. that carry no data
 	// but mark an object. This data would be kept parallel with slices/worlds so that they would be far faster to query
@@ -260,7 +284,11 @@ void WorldManager::UpdateTime()
 	m_actualFrameTickCount = newFrameTickCount;
 
 	// Clamp the timer delta based on the timer limit settings.
-	if( deltaTickCount == 0 )
+	if( m_fixedFrameDeltaTickCount != 0 )
+	{
+		deltaTickCount = m_fixedFrameDeltaTickCount;
+	}
+	else if( deltaTickCount == 0 )
 	{
 		deltaTickCount = 1;
 	}
@@ -31,10 +31,20 @@ namespace Helium
         /// @name Updating
         //@{
         void Update();
+
+        inline void SetHeadless( bool bHeadless );
+        inline bool IsHeadless() const;
+
+        inline void SetSliceStreamingBudget( float32_t milliseconds, uint32_t entityCount );
+        inline float32_t GetSliceStreamingBudgetMilliseconds() const;
+        inline uint32_t GetSliceStreamingBudgetEntityCount() const;
         //@}
 
         /// @name Timing
         //@{
+        inline void SetFixedFrameDeltaTickCount( uint64_t tickCount );
+        inline uint64_t GetFixedFrameDeltaTickCount() const;
+
         inline uint64_t GetFrameTickCount() const;
         inline uint64_t GetFrameDeltaTickCount() const;
         inline float32_t GetFrameDeltaSeconds() const;
@@ -60,6 +70,16 @@ namespace Helium
         uint64_t m_frameDeltaTickCount;
         /// Seconds elapsed since the previous frame (adjusted for frame rate limits).
         float32_t m_frameDeltaSeconds;
+        /// Ticks to advance each frame regardless of the actual elapsed time (zero to use the actual time).
+        uint64_t m_fixedFrameDeltaTickCount;
+
+        /// True if tasks requiring graphics should be skipped during updates.
+        bool m_bHeadless;
+
+        /// Time each frame may spend streaming slice entities in or out across all worlds, in milliseconds.
+        float32_t m_sliceStreamingBudgetMilliseconds;
+        /// Number of slice entities that may be streamed in or out each frame across all worlds.
+        uint32_t m_sliceStreamingBudgetEntityCount;
 
         /// True if the first frame has been processed.
         bool m_bProcessedFirstFrame;
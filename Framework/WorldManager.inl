@@ -1,5 +1,83 @@
 namespace Helium
 {
+    /// Set whether world updates should skip every task that requires graphics (for dedicated servers).
+    ///
+    /// @param[in] bHeadless  True to skip rendering and other graphics-only tasks, false to run all tasks.
+    ///
+    /// @see IsHeadless(), TaskContract::RequiresGraphics()
+    void WorldManager::SetHeadless( bool bHeadless )
+    {
+        m_bHeadless = bHeadless;
+    }
+
+    /// Get whether world updates skip every task that requires graphics.
+    ///
+    /// @return  True if running headless, false if not.
+    ///
+    /// @see SetHeadless()
+    bool WorldManager::IsHeadless() const
+    {
+        return m_bHeadless;
+    }
+
+    /// Set how much slice streaming may be done each frame, shared across all worlds.
+    ///
+    /// Streaming stops for the frame once either limit is reached, though at least one entity is always processed so
+    /// streaming keeps making progress.
+    ///
+    /// @param[in] milliseconds  Time that may be spent instantiating or destroying slice entities each frame.
+    /// @param[in] entityCount   Number of slice entities that may be instantiated or destroyed each frame.
+    ///
+    /// @see World::StreamInSlice(), World::StreamOutSlice()
+    void WorldManager::SetSliceStreamingBudget( float32_t milliseconds, uint32_t entityCount )
+    {
+        m_sliceStreamingBudgetMilliseconds = milliseconds;
+        m_sliceStreamingBudgetEntityCount = entityCount;
+    }
+
+    /// Get the time each frame may spend streaming slice entities.
+    ///
+    /// @return  Per-frame slice streaming time budget, in milliseconds.
+    ///
+    /// @see SetSliceStreamingBudget()
+    float32_t WorldManager::GetSliceStreamingBudgetMilliseconds() const
+    {
+        return m_sliceStreamingBudgetMilliseconds;
+    }
+
+    /// Get the number of slice entities that may be streamed in or out each frame.
+    ///
+    /// @return  Per-frame slice streaming entity budget.
+    ///
+    /// @see SetSliceStreamingBudget()
+    uint32_t WorldManager::GetSliceStreamingBudgetEntityCount() const
+    {
+        return m_sliceStreamingBudgetEntityCount;
+    }
+
+    /// Set a fixed number of timer ticks to advance the world timer by each frame.
+    ///
+    /// This is used when frames are paced to a fixed tick rate, so simulation stays deterministic even when a frame
+    /// runs late.
+    ///
+    /// @param[in] tickCount  Ticks to advance each frame, or zero to advance by the actual elapsed time.
+    ///
+    /// @see GetFixedFrameDeltaTickCount()
+    void WorldManager::SetFixedFrameDeltaTickCount( uint64_t tickCount )
+    {
+        m_fixedFrameDeltaTickCount = tickCount;
+    }
+
+    /// Get the fixed number of timer ticks the world timer advances by each frame.
+    ///
+    /// @return  Ticks advanced each frame, or zero if the actual elapsed time is used.
+    ///
+    /// @see SetFixedFrameDeltaTickCount()
+    uint64_t WorldManager::GetFixedFrameDeltaTickCount() const
+    {
+        return m_fixedFrameDeltaTickCount;
+    }
+
     /// Get the elapsed world timer tick count for the start of the current frame, adjusted for frame rate limits.
     ///
     /// Ticks are expressed in units determined by the Timer class.  Conversion between ticks and seconds can be
@@ -84,6 +84,7 @@ bool RendererInitializationImpl::Initialize()
 	contextInitParams.displayHeight = displayHeight;
 	contextInitParams.bFullscreen = bFullscreen;
 	contextInitParams.bVsync = bVsync;
+	contextInitParams.bMultithreaded = m_bMultithreaded;
 
 	bool bContextCreateResult = pRenderer->CreateMainContext( contextInitParams );
 	HELIUM_ASSERT( bContextCreateResult );
@@ -1,6 +1,7 @@
 #include "GraphicsPch.h"
 #include "Graphics/BufferedDrawer.h"
 
+#include "Platform/Atomic.h"
 #include "MathSimd/Matrix44.h"
 #include "Foundation/StringConverter.h"
 #include "Rendering/Renderer.h"
@@ -18,9 +19,38 @@
 
 using namespace Helium;
 
+/// Append draw calls buffered by one thread to a merged draw call list.
+///
+/// @param[in] rDest         Merged draw call list.
+/// @param[in] rSource       Draw calls from a single thread buffer.
+/// @param[in] vertexOffset  Offset of the thread's vertices in the merged vertex data.
+/// @param[in] indexOffset   Offset of the thread's indices in the merged index data.
+template< typename DrawCall >
+static void AppendDrawCalls(
+	DynamicArray< DrawCall >& rDest,
+	const DynamicArray< DrawCall >& rSource,
+	uint32_t vertexOffset,
+	uint32_t indexOffset )
+{
+	size_t destStart = rDest.GetSize();
+	size_t drawCallCount = rSource.GetSize();
+	rDest.AddArray( rSource.GetData(), drawCallCount );
+
+	for( size_t drawCallIndex = 0; drawCallIndex < drawCallCount; ++drawCallIndex )
+	{
+		DrawCall& rDrawCall = rDest[ destStart + drawCallIndex ];
+		rDrawCall.baseVertexIndex += vertexOffset;
+		if( IsValid( rDrawCall.startIndex ) )
+		{
+			rDrawCall.startIndex += indexOffset;
+		}
+	}
+}
+
 /// Constructor.
 BufferedDrawer::BufferedDrawer()
-	: m_instanceVertexConstantTransform( Simd::Matrix44::IDENTITY )
+	: m_pHeadBuffer( NULL )
+	, m_instanceVertexConstantTransform( Simd::Matrix44::IDENTITY )
 	, m_instanceVertexConstantBufferIndex( Invalid< uint32_t >() )
 	, m_instancePixelConstantBlendColor( Color( 0xffffffff ) )
 	, m_instancePixelConstantBufferIndex( Invalid< uint32_t >() )
@@ -42,6 +72,17 @@ BufferedDrawer::BufferedDrawer()
 /// Destructor.
 BufferedDrawer::~BufferedDrawer()
 {
+	m_bufferTls.SetPointer( NULL );
+
+	ThreadBuffer* pBuffer = m_pHeadBuffer;
+	while( pBuffer )
+	{
+		ThreadBuffer* pNext = pBuffer->pNext;
+		delete pBuffer;
+		pBuffer = pNext;
+	}
+
+	m_pHeadBuffer = NULL;
 }
 
 /// Initialize this buffered drawing interface.
@@ -156,11 +197,11 @@ bool BufferedDrawer::Initialize()
 /// @see Initialize()
 void BufferedDrawer::Shutdown()
 {
-	m_untexturedVertices.Clear();
-	m_texturedVertices.Clear();
-
-	m_untexturedIndices.Clear();
-	m_texturedIndices.Clear();
+	// Thread buffers are kept (threads may still hold them in thread-local storage), but their memory is released.
+	for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+	{
+		pBuffer->Clear();
+	}
 
 	for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( m_untexturedDrawCalls ); ++stateIndex )
 	{
@@ -182,6 +223,7 @@ void BufferedDrawer::Shutdown()
 	m_screenTextDrawCalls.Clear();
 	m_projectedTextDrawCalls.Clear();
 	m_screenTextGlyphIndices.Clear();
+	m_projectedTextGlyphIndices.Clear();
 
 	m_spQuadVertexBuffer.Release();
 	m_spScreenSpaceTextIndexBuffer.Release();
@@ -265,30 +307,30 @@ void BufferedDrawer::DrawUntextured(
 		static_cast< size_t >( depthStencilState ) <
 		static_cast< size_t >( RenderResourceManager::DEPTH_STENCIL_STATE_MAX ) );
 
-	// Cannot add draw calls while rendering.
-	HELIUM_ASSERT( !m_bDrawing );
-
 	// Don't buffer any drawing information if we have no renderer.
 	if( !Renderer::GetStaticInstance() )
 	{
 		return;
 	}
 
-	uint32_t baseVertexIndex = static_cast< uint32_t >( m_untexturedVertices.GetSize() );
-	m_untexturedVertices.AddArray( pVertices, vertexCount );
+	ThreadBuffer* pBuffer = GetThreadLocalBuffer();
+	HELIUM_ASSERT( pBuffer );
+
+	uint32_t baseVertexIndex = static_cast< uint32_t >( pBuffer->untexturedVertices.GetSize() );
+	pBuffer->untexturedVertices.AddArray( pVertices, vertexCount );
 
 	uint32_t startIndex;
 	SetInvalid( startIndex );
 	if( pIndices )
 	{
-		startIndex = static_cast< uint32_t >( m_untexturedIndices.GetSize() );
-		m_untexturedIndices.AddArray(
+		startIndex = static_cast< uint32_t >( pBuffer->untexturedIndices.GetSize() );
+		pBuffer->untexturedIndices.AddArray(
 			pIndices,
 			RendererUtil::PrimitiveCountToIndexCount( primitiveType, primitiveCount ) );
 	}
 
 	size_t stateIndex = GetStateIndex( rasterizerState, depthStencilState );
-	UntexturedDrawCall* pDrawCall = m_untexturedDrawCalls[ stateIndex ].New();
+	UntexturedDrawCall* pDrawCall = pBuffer->untexturedDrawCalls[ stateIndex ].New();
 	HELIUM_ASSERT( pDrawCall );
 	pDrawCall->transform = rTransform;
 	pDrawCall->primitiveType = primitiveType;
@@ -341,17 +383,17 @@ void BufferedDrawer::DrawUntextured(
 		static_cast< size_t >( depthStencilState ) <
 		static_cast< size_t >( RenderResourceManager::DEPTH_STENCIL_STATE_MAX ) );
 
-	// Cannot add draw calls while rendering.
-	HELIUM_ASSERT( !m_bDrawing );
-
 	// Don't buffer any drawing information if we have no renderer.
 	if( !Renderer::GetStaticInstance() )
 	{
 		return;
 	}
 
+	ThreadBuffer* pBuffer = GetThreadLocalBuffer();
+	HELIUM_ASSERT( pBuffer );
+
 	size_t stateIndex = GetStateIndex( rasterizerState, depthStencilState );
-	UntexturedBufferDrawCall* pDrawCall = m_untexturedBufferDrawCalls[ stateIndex ].New();
+	UntexturedBufferDrawCall* pDrawCall = pBuffer->untexturedBufferDrawCalls[ stateIndex ].New();
 	HELIUM_ASSERT( pDrawCall );
 	pDrawCall->primitiveType = primitiveType;
 	pDrawCall->baseVertexIndex = baseVertexIndex;
@@ -402,30 +444,30 @@ void BufferedDrawer::DrawTextured(
 		static_cast< size_t >( depthStencilState ) <
 		static_cast< size_t >( RenderResourceManager::DEPTH_STENCIL_STATE_MAX ) );
 
-	// Cannot add draw calls while rendering.
-	HELIUM_ASSERT( !m_bDrawing );
-
 	// Don't buffer any drawing information if we have no renderer.
 	if( !Renderer::GetStaticInstance() )
 	{
 		return;
 	}
 
-	uint32_t baseVertexIndex = static_cast< uint32_t >( m_texturedVertices.GetSize() );
-	m_texturedVertices.AddArray( pVertices, vertexCount );
+	ThreadBuffer* pBuffer = GetThreadLocalBuffer();
+	HELIUM_ASSERT( pBuffer );
+
+	uint32_t baseVertexIndex = static_cast< uint32_t >( pBuffer->texturedVertices.GetSize() );
+	pBuffer->texturedVertices.AddArray( pVertices, vertexCount );
 
 	uint32_t startIndex;
 	SetInvalid( startIndex );
 	if( pIndices )
 	{
-		startIndex = static_cast< uint32_t >( m_texturedIndices.GetSize() );
-		m_texturedIndices.AddArray(
+		startIndex = static_cast< uint32_t >( pBuffer->texturedIndices.GetSize() );
+		pBuffer->texturedIndices.AddArray(
 			pIndices,
 			RendererUtil::PrimitiveCountToIndexCount( primitiveType, primitiveCount ) );
 	}
 
 	size_t stateIndex = GetStateIndex( rasterizerState, depthStencilState );
-	TexturedDrawCall* pDrawCall = m_texturedDrawCalls[ stateIndex ].New();
+	TexturedDrawCall* pDrawCall = pBuffer->texturedDrawCalls[ stateIndex ].New();
 	HELIUM_ASSERT( pDrawCall );
 	pDrawCall->transform = rTransform;
 	pDrawCall->primitiveType = primitiveType;
@@ -482,17 +524,17 @@ void BufferedDrawer::DrawTextured(
 		static_cast< size_t >( depthStencilState ) <
 		static_cast< size_t >( RenderResourceManager::DEPTH_STENCIL_STATE_MAX ) );
 
-	// Cannot add draw calls while rendering.
-	HELIUM_ASSERT( !m_bDrawing );
-
 	// Don't buffer any drawing information if we have no renderer.
 	if( !Renderer::GetStaticInstance() )
 	{
 		return;
 	}
 
+	ThreadBuffer* pBuffer = GetThreadLocalBuffer();
+	HELIUM_ASSERT( pBuffer );
+
 	size_t stateIndex = GetStateIndex( rasterizerState, depthStencilState );
-	TexturedBufferDrawCall* pDrawCall = m_texturedBufferDrawCalls[ stateIndex ].New();
+	TexturedBufferDrawCall* pDrawCall = pBuffer->texturedBufferDrawCalls[ stateIndex ].New();
 	HELIUM_ASSERT( pDrawCall );
 	pDrawCall->primitiveType = primitiveType;
 	pDrawCall->baseVertexIndex = baseVertexIndex;
@@ -526,19 +568,19 @@ void BufferedDrawer::DrawPoints(
 		static_cast< size_t >( depthStencilState ) <
 		static_cast< size_t >( RenderResourceManager::DEPTH_STENCIL_STATE_MAX ) );
 
-	// Cannot add draw calls while rendering.
-	HELIUM_ASSERT( !m_bDrawing );
-
 	// Don't buffer any drawing information if we have no renderer.
 	if( !Renderer::GetStaticInstance() )
 	{
 		return;
 	}
 
-	uint32_t baseVertexIndex = static_cast< uint32_t >( m_untexturedVertices.GetSize() );
-	m_untexturedVertices.AddArray( pVertices, pointCount );
+	ThreadBuffer* pBuffer = GetThreadLocalBuffer();
+	HELIUM_ASSERT( pBuffer );
 
-	UntexturedDrawCall* pDrawCall = m_pointDrawCalls[ depthStencilState ].New();
+	uint32_t baseVertexIndex = static_cast< uint32_t >( pBuffer->untexturedVertices.GetSize() );
+	pBuffer->untexturedVertices.AddArray( pVertices, pointCount );
+
+	UntexturedDrawCall* pDrawCall = pBuffer->pointDrawCalls[ depthStencilState ].New();
 	HELIUM_ASSERT( pDrawCall );
 	pDrawCall->primitiveType = RENDERER_PRIMITIVE_TYPE_POINT_LIST;
 	pDrawCall->baseVertexIndex = baseVertexIndex;
@@ -573,16 +615,16 @@ void BufferedDrawer::DrawPoints(
 		static_cast< size_t >( depthStencilState ) <
 		static_cast< size_t >( RenderResourceManager::DEPTH_STENCIL_STATE_MAX ) );
 
-	// Cannot add draw calls while rendering.
-	HELIUM_ASSERT( !m_bDrawing );
-
 	// Don't buffer any drawing information if we have no renderer.
 	if( !Renderer::GetStaticInstance() )
 	{
 		return;
 	}
 
-	UntexturedBufferDrawCall* pDrawCall = m_pointBufferDrawCalls[ depthStencilState ].New();
+	ThreadBuffer* pBuffer = GetThreadLocalBuffer();
+	HELIUM_ASSERT( pBuffer );
+
+	UntexturedBufferDrawCall* pDrawCall = pBuffer->pointBufferDrawCalls[ depthStencilState ].New();
 	HELIUM_ASSERT( pDrawCall );
 	pDrawCall->primitiveType = RENDERER_PRIMITIVE_TYPE_POINT_LIST;
 	pDrawCall->baseVertexIndex = baseVertexIndex;
@@ -622,9 +664,6 @@ void BufferedDrawer::DrawWorldText(
 		static_cast< size_t >( depthStencilState ) <
 		static_cast< size_t >( RenderResourceManager::DEPTH_STENCIL_STATE_MAX ) );
 
-	// Cannot add draw calls while rendering.
-	HELIUM_ASSERT( !m_bDrawing );
-
 	// Don't buffer any drawing information if we have no renderer.
 	if( !Renderer::GetStaticInstance() )
 	{
@@ -640,7 +679,7 @@ void BufferedDrawer::DrawWorldText(
 	}
 
 	// Render the text.
-	WorldSpaceTextGlyphHandler glyphHandler( this, pFont, color, rasterizerState, depthStencilState, rTransform );
+	WorldSpaceTextGlyphHandler glyphHandler( GetThreadLocalBuffer(), pFont, color, rasterizerState, depthStencilState, rTransform );
 	pFont->ProcessText( rText, glyphHandler );
 }
 
@@ -663,9 +702,6 @@ void BufferedDrawer::DrawScreenText(
 	HELIUM_ASSERT(
 		static_cast< size_t >( size ) < static_cast< size_t >( RenderResourceManager::DEBUG_FONT_SIZE_MAX ) );
 
-	// Cannot add draw calls while rendering.
-	HELIUM_ASSERT( !m_bDrawing );
-
 	// Don't buffer any drawing information if we have no renderer.
 	if( !Renderer::GetStaticInstance() )
 	{
@@ -681,7 +717,7 @@ void BufferedDrawer::DrawScreenText(
 	}
 
 	// Store the information needed for drawing the text later.
-	ScreenSpaceTextGlyphHandler glyphHandler( this, pFont, x, y, color, size );
+	ScreenSpaceTextGlyphHandler glyphHandler( GetThreadLocalBuffer(), pFont, x, y, color, size );
 	pFont->ProcessText( rText, glyphHandler );
 }
 
@@ -706,9 +742,6 @@ void BufferedDrawer::DrawProjectedText(
 	HELIUM_ASSERT(
 		static_cast< size_t >( size ) < static_cast< size_t >( RenderResourceManager::DEBUG_FONT_SIZE_MAX ) );
 
-	// Cannot add draw calls while rendering.
-	HELIUM_ASSERT( !m_bDrawing );
-
 	// Don't buffer any drawing information if we have no renderer.
 	if( !Renderer::GetStaticInstance() )
 	{
@@ -724,42 +757,68 @@ void BufferedDrawer::DrawProjectedText(
 	}
 
 	// Store the information needed for drawing the text later.
-	ProjectedTextGlyphHandler glyphHandler( this, pFont, rWorldOffset, screenOffsetX, screenOffsetY, color, size );
+	ProjectedTextGlyphHandler glyphHandler( GetThreadLocalBuffer(), pFont, rWorldOffset, screenOffsetX, screenOffsetY, color, size );
 	pFont->ProcessText( rText, glyphHandler );
 }
 
-/// Push buffered draw command data into vertex and index buffers for rendering.
+/// Hand the draw calls buffered so far over to the next BeginDrawing() call.
+///
+/// No other thread may be buffering draw calls, and no drawing may be in progress, when this is called.  Anything
+/// submitted earlier that was never drawn is discarded.  Threads may start buffering draw calls for the next frame as
+/// soon as this returns, even while the submitted set is being drawn.
+///
+/// @see BeginDrawing()
+void BufferedDrawer::SubmitDrawing()
+{
+	HELIUM_ASSERT( !m_bDrawing );
+
+	// Drop any submitted set that was never drawn (i.e. the renderer was not ready).
+	ClearMergedDrawCalls();
+
+	// Gather the draw calls from each thread into a single set for rendering.
+	MergeThreadBuffers();
+
+	// Hand over the vertex and index data without copying it, leaving the recording buffers empty.
+	for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+	{
+		pBuffer->Submit();
+	}
+}
+
+/// Push submitted draw command data into vertex and index buffers for rendering.
 ///
 /// This must be called prior to calling DrawWorldElements() or DrawScreenElements().  EndDrawing() should be called
-/// when rendering is complete.  No new draw calls can be added between a BeginDrawing() and EndDrawing() call pair.
+/// when rendering is complete.  Only draw calls handed over by the last SubmitDrawing() call are drawn, so other
+/// threads may keep buffering draw calls for the next frame in the meantime.
 ///
-/// @see EndDrawing(), DrawWorldElements(), DrawScreenElements()
+/// @see SubmitDrawing(), EndDrawing(), DrawWorldElements(), DrawScreenElements()
 void BufferedDrawer::BeginDrawing()
 {
 	// Flag that we have begun drawing.
 	HELIUM_ASSERT( !m_bDrawing );
 	m_bDrawing = true;
 
-	// If a renderer is not initialized, we don't need to do anything.
+	// If a renderer is not initialized, we don't need to do anything (nothing will have been buffered).
 	Renderer* pRenderer = Renderer::GetStaticInstance();
 	if( !pRenderer )
 	{
-		HELIUM_ASSERT( m_untexturedVertices.IsEmpty() );
-		HELIUM_ASSERT( m_untexturedIndices.IsEmpty() );
-		HELIUM_ASSERT( m_texturedVertices.IsEmpty() );
-		HELIUM_ASSERT( m_texturedIndices.IsEmpty() );
-		HELIUM_ASSERT( m_screenTextGlyphIndices.IsEmpty() );
-
 		return;
 	}
 
 	// Prepare the vertex and index buffers with the buffered data.
 	ResourceSet& rResourceSet = m_resourceSets[ m_currentResourceSetIndex ];
 
-	uint_fast32_t untexturedVertexCount = static_cast< uint_fast32_t >( m_untexturedVertices.GetSize() );
-	uint_fast32_t untexturedIndexCount = static_cast< uint_fast32_t >( m_untexturedIndices.GetSize() );
-	uint_fast32_t texturedVertexCount = static_cast< uint_fast32_t >( m_texturedVertices.GetSize() );
-	uint_fast32_t texturedIndexCount = static_cast< uint_fast32_t >( m_texturedIndices.GetSize() );
+	uint_fast32_t untexturedVertexCount = 0;
+	uint_fast32_t untexturedIndexCount = 0;
+	uint_fast32_t texturedVertexCount = 0;
+	uint_fast32_t texturedIndexCount = 0;
+	for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+	{
+		untexturedVertexCount += static_cast< uint_fast32_t >( pBuffer->submittedUntexturedVertices.GetSize() );
+		untexturedIndexCount += static_cast< uint_fast32_t >( pBuffer->submittedUntexturedIndices.GetSize() );
+		texturedVertexCount += static_cast< uint_fast32_t >( pBuffer->submittedTexturedVertices.GetSize() );
+		texturedIndexCount += static_cast< uint_fast32_t >( pBuffer->submittedTexturedIndices.GetSize() );
+	}
 
 	uint_fast32_t screenTextGlyphIndexCount = static_cast< uint_fast32_t >( m_screenTextGlyphIndices.GetSize() );
 	uint_fast32_t screenTextVertexCount = screenTextGlyphIndexCount * 4;
@@ -901,47 +960,63 @@ void BufferedDrawer::BeginDrawing()
 		}
 	}
 
-	// Fill the vertex and index buffers for rendering.
+	// Fill the vertex and index buffers for rendering, streaming each thread's data into place in a single map of
+	// each buffer.  Indices are relative to the base vertex of their draw call, so they are copied unchanged.
 	if( untexturedVertexCount && rResourceSet.spUntexturedVertexBuffer )
 	{
-		void* pMappedVertexBuffer = rResourceSet.spUntexturedVertexBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD );
-		HELIUM_ASSERT( pMappedVertexBuffer );
-		MemoryCopy(
-			pMappedVertexBuffer,
-			m_untexturedVertices.GetData(),
-			untexturedVertexCount * sizeof( SimpleVertex ) );
+		SimpleVertex* pMappedVertices = static_cast< SimpleVertex* >(
+			rResourceSet.spUntexturedVertexBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD ) );
+		HELIUM_ASSERT( pMappedVertices );
+		for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+		{
+			size_t vertexCount = pBuffer->submittedUntexturedVertices.GetSize();
+			MemoryCopy( pMappedVertices, pBuffer->submittedUntexturedVertices.GetData(), vertexCount * sizeof( SimpleVertex ) );
+			pMappedVertices += vertexCount;
+		}
 		rResourceSet.spUntexturedVertexBuffer->Unmap();
 
 		if ( untexturedIndexCount && rResourceSet.spUntexturedIndexBuffer )
 		{
-			void* pMappedIndexBuffer = rResourceSet.spUntexturedIndexBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD );
-			HELIUM_ASSERT( pMappedIndexBuffer );
-			MemoryCopy(
-				pMappedIndexBuffer,
-				m_untexturedIndices.GetData(),
-				untexturedIndexCount * sizeof( uint16_t ) );
+			uint16_t* pMappedIndices = static_cast< uint16_t* >(
+				rResourceSet.spUntexturedIndexBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD ) );
+			HELIUM_ASSERT( pMappedIndices );
+			for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+			{
+				size_t indexCount = pBuffer->submittedUntexturedIndices.GetSize();
+				MemoryCopy( pMappedIndices, pBuffer->submittedUntexturedIndices.GetData(), indexCount * sizeof( uint16_t ) );
+				pMappedIndices += indexCount;
+			}
 			rResourceSet.spUntexturedIndexBuffer->Unmap();
 		}
 	}
 
 	if( texturedVertexCount && rResourceSet.spTexturedVertexBuffer )
 	{
-		void* pMappedVertexBuffer = rResourceSet.spTexturedVertexBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD );
-		HELIUM_ASSERT( pMappedVertexBuffer );
-		MemoryCopy(
-			pMappedVertexBuffer,
-			m_texturedVertices.GetData(),
-			texturedVertexCount * sizeof( SimpleTexturedVertex ) );
+		SimpleTexturedVertex* pMappedVertices = static_cast< SimpleTexturedVertex* >(
+			rResourceSet.spTexturedVertexBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD ) );
+		HELIUM_ASSERT( pMappedVertices );
+		for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+		{
+			size_t vertexCount = pBuffer->submittedTexturedVertices.GetSize();
+			MemoryCopy(
+				pMappedVertices,
+				pBuffer->submittedTexturedVertices.GetData(),
+				vertexCount * sizeof( SimpleTexturedVertex ) );
+			pMappedVertices += vertexCount;
+		}
 		rResourceSet.spTexturedVertexBuffer->Unmap();
 
 		if ( texturedIndexCount && rResourceSet.spTexturedIndexBuffer )
 		{
-			void* pMappedIndexBuffer = rResourceSet.spTexturedIndexBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD );
-			HELIUM_ASSERT( pMappedIndexBuffer );
-			MemoryCopy(
-				pMappedIndexBuffer,
-				m_texturedIndices.GetData(),
-				texturedIndexCount * sizeof( uint16_t ) );
+			uint16_t* pMappedIndices = static_cast< uint16_t* >(
+				rResourceSet.spTexturedIndexBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD ) );
+			HELIUM_ASSERT( pMappedIndices );
+			for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+			{
+				size_t indexCount = pBuffer->submittedTexturedIndices.GetSize();
+				MemoryCopy( pMappedIndices, pBuffer->submittedTexturedIndices.GetData(), indexCount * sizeof( uint16_t ) );
+				pMappedIndices += indexCount;
+			}
 			rResourceSet.spTexturedIndexBuffer->Unmap();
 		}
 	}
@@ -1205,12 +1280,6 @@ void BufferedDrawer::BeginDrawing()
 		rResourceSet.spProjectedTextVertexBuffer->Unmap();
 	}
 
-	// Clear the buffered vertex and index data, as it is no longer needed.
-	m_untexturedVertices.RemoveAll();
-	m_texturedVertices.RemoveAll();
-	m_untexturedIndices.RemoveAll();
-	m_texturedIndices.RemoveAll();
-
 	// Per-instance shader constant management data should already be reset (either from Initialize() or the last
 	// EndDrawing() call).
 	HELIUM_ASSERT( IsInvalid( m_instanceVertexConstantBufferIndex ) );
@@ -1232,36 +1301,11 @@ void BufferedDrawer::EndDrawing()
 	Renderer* pRenderer = Renderer::GetStaticInstance();
 	if( !pRenderer )
 	{
-		HELIUM_ASSERT( m_untexturedVertices.IsEmpty() );
-		HELIUM_ASSERT( m_untexturedIndices.IsEmpty() );
-		HELIUM_ASSERT( m_texturedVertices.IsEmpty() );
-		HELIUM_ASSERT( m_texturedIndices.IsEmpty() );
-		HELIUM_ASSERT( m_screenTextGlyphIndices.IsEmpty() );
-
 		return;
 	}
 
-	// Clear all buffered draw call data.
-	m_screenTextGlyphIndices.RemoveAll();
-	m_projectedTextDrawCalls.RemoveAll();
-	m_screenTextDrawCalls.RemoveAll();
-
-	for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( m_untexturedDrawCalls ); ++stateIndex )
-	{
-		m_worldTextDrawCalls[ stateIndex ].RemoveAll();
-
-		m_texturedBufferDrawCalls[ stateIndex ].RemoveAll();
-		m_untexturedBufferDrawCalls[ stateIndex ].RemoveAll();
-
-		m_texturedDrawCalls[ stateIndex ].RemoveAll();
-		m_untexturedDrawCalls[ stateIndex ].RemoveAll();
-	}
-
-	for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( m_pointDrawCalls ); ++stateIndex )
-	{
-		m_pointBufferDrawCalls[ stateIndex ].RemoveAll();
-		m_pointDrawCalls[ stateIndex ].RemoveAll();
-	}
+	// Clear all merged draw call data.
+	ClearMergedDrawCalls();
 
 	// Release all fences used to block the usage lifetime of various instance-specific shader constant buffers.
 	for( size_t fenceIndex = 0; fenceIndex < HELIUM_ARRAY_COUNT( m_instanceVertexConstantFences ); ++fenceIndex )
@@ -1302,11 +1346,6 @@ void BufferedDrawer::DrawWorldElements( const Simd::Matrix44& rInverseViewProjec
 	Renderer* pRenderer = Renderer::GetStaticInstance();
 	if( !pRenderer )
 	{
-		HELIUM_ASSERT( m_untexturedVertices.IsEmpty() );
-		HELIUM_ASSERT( m_untexturedIndices.IsEmpty() );
-		HELIUM_ASSERT( m_texturedVertices.IsEmpty() );
-		HELIUM_ASSERT( m_texturedIndices.IsEmpty() );
-
 		return;
 	}
 
@@ -1476,11 +1515,6 @@ void BufferedDrawer::DrawScreenElements()
 	Renderer* pRenderer = Renderer::GetStaticInstance();
 	if( !pRenderer )
 	{
-		HELIUM_ASSERT( m_untexturedVertices.IsEmpty() );
-		HELIUM_ASSERT( m_untexturedIndices.IsEmpty() );
-		HELIUM_ASSERT( m_texturedVertices.IsEmpty() );
-		HELIUM_ASSERT( m_texturedIndices.IsEmpty() );
-
 		return;
 	}
 
@@ -1627,9 +1661,9 @@ void BufferedDrawer::DrawScreenElements()
 
 		uint_fast32_t glyphIndexOffset = 0;
 
-		for( size_t drawIndex = 0; drawIndex < screenTextDrawCount; ++drawIndex )
+		for( size_t drawIndex = 0; drawIndex < projectedTextDrawCount; ++drawIndex )
 		{
-			const ScreenTextDrawCall& rDrawCall = m_screenTextDrawCalls[ drawIndex ];
+			const ProjectedTextDrawCall& rDrawCall = m_projectedTextDrawCalls[ drawIndex ];
 
 			uint_fast32_t drawCallGlyphCount = rDrawCall.glyphCount;
 
@@ -1645,7 +1679,7 @@ void BufferedDrawer::DrawScreenElements()
 
 			for( uint_fast32_t drawCallGlyphIndex = 0; drawCallGlyphIndex < drawCallGlyphCount; ++drawCallGlyphIndex )
 			{
-				uint32_t glyphIndex = m_screenTextGlyphIndices[ glyphIndexOffset ];
+				uint32_t glyphIndex = m_projectedTextGlyphIndices[ glyphIndexOffset ];
 				if( glyphIndex < fontCharacterCount )
 				{
 					const Font::Character& rCharacter = pFont->GetCharacter( glyphIndex );
@@ -2171,6 +2205,142 @@ void BufferedDrawer::DrawDepthStencilStateWorldElements(
 	}
 }
 
+/// Get the draw call buffer for the current thread, allocating it if necessary.
+///
+/// @return  Pointer to the current thread's draw call buffer.
+BufferedDrawer::ThreadBuffer* BufferedDrawer::GetThreadLocalBuffer()
+{
+	ThreadBuffer* pBuffer = static_cast< ThreadBuffer* >( m_bufferTls.GetPointer() );
+	if( !pBuffer )
+	{
+		// Buffer does not yet exist, so allocate one and add it to the global list of buffers.
+		pBuffer = new ThreadBuffer;
+		HELIUM_ASSERT( pBuffer );
+		m_bufferTls.SetPointer( pBuffer );
+
+		ThreadBuffer* pTestNext;
+		ThreadBuffer* pNext = m_pHeadBuffer;
+		do
+		{
+			pTestNext = pNext;
+			pBuffer->pNext = pTestNext;
+
+			pNext = AtomicCompareExchangeRelease( m_pHeadBuffer, pBuffer, pTestNext );
+		} while( pNext != pTestNext );
+	}
+
+	return pBuffer;
+}
+
+/// Remove all merged draw call data.
+///
+/// @see MergeThreadBuffers()
+void BufferedDrawer::ClearMergedDrawCalls()
+{
+	m_screenTextGlyphIndices.RemoveAll();
+	m_projectedTextGlyphIndices.RemoveAll();
+	m_projectedTextDrawCalls.RemoveAll();
+	m_screenTextDrawCalls.RemoveAll();
+
+	for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( m_untexturedDrawCalls ); ++stateIndex )
+	{
+		m_worldTextDrawCalls[ stateIndex ].RemoveAll();
+
+		m_texturedBufferDrawCalls[ stateIndex ].RemoveAll();
+		m_untexturedBufferDrawCalls[ stateIndex ].RemoveAll();
+
+		m_texturedDrawCalls[ stateIndex ].RemoveAll();
+		m_untexturedDrawCalls[ stateIndex ].RemoveAll();
+	}
+
+	for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( m_pointDrawCalls ); ++stateIndex )
+	{
+		m_pointBufferDrawCalls[ stateIndex ].RemoveAll();
+		m_pointDrawCalls[ stateIndex ].RemoveAll();
+	}
+}
+
+/// Merge the draw calls buffered by each thread into the draw call lists used for rendering.
+///
+/// Vertex and index offsets are adjusted to match the layout of the vertex and index buffers filled by BeginDrawing(),
+/// which places the data from each thread one after the other in list order.
+///
+/// @see BeginDrawing()
+void BufferedDrawer::MergeThreadBuffers()
+{
+	uint32_t untexturedVertexOffset = 0;
+	uint32_t untexturedIndexOffset = 0;
+	uint32_t texturedVertexOffset = 0;
+	uint32_t texturedIndexOffset = 0;
+
+	for( ThreadBuffer* pBuffer = m_pHeadBuffer; pBuffer != NULL; pBuffer = pBuffer->pNext )
+	{
+		for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( m_untexturedDrawCalls ); ++stateIndex )
+		{
+			AppendDrawCalls(
+				m_untexturedDrawCalls[ stateIndex ],
+				pBuffer->untexturedDrawCalls[ stateIndex ],
+				untexturedVertexOffset,
+				untexturedIndexOffset );
+			AppendDrawCalls(
+				m_texturedDrawCalls[ stateIndex ],
+				pBuffer->texturedDrawCalls[ stateIndex ],
+				texturedVertexOffset,
+				texturedIndexOffset );
+			AppendDrawCalls(
+				m_worldTextDrawCalls[ stateIndex ],
+				pBuffer->worldTextDrawCalls[ stateIndex ],
+				texturedVertexOffset,
+				texturedIndexOffset );
+
+			const DynamicArray< UntexturedBufferDrawCall >& rUntexturedBufferDrawCalls =
+				pBuffer->untexturedBufferDrawCalls[ stateIndex ];
+			m_untexturedBufferDrawCalls[ stateIndex ].AddArray(
+				rUntexturedBufferDrawCalls.GetData(),
+				rUntexturedBufferDrawCalls.GetSize() );
+
+			const DynamicArray< TexturedBufferDrawCall >& rTexturedBufferDrawCalls =
+				pBuffer->texturedBufferDrawCalls[ stateIndex ];
+			m_texturedBufferDrawCalls[ stateIndex ].AddArray(
+				rTexturedBufferDrawCalls.GetData(),
+				rTexturedBufferDrawCalls.GetSize() );
+		}
+
+		for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( m_pointDrawCalls ); ++stateIndex )
+		{
+			AppendDrawCalls(
+				m_pointDrawCalls[ stateIndex ],
+				pBuffer->pointDrawCalls[ stateIndex ],
+				untexturedVertexOffset,
+				untexturedIndexOffset );
+
+			const DynamicArray< UntexturedBufferDrawCall >& rPointBufferDrawCalls =
+				pBuffer->pointBufferDrawCalls[ stateIndex ];
+			m_pointBufferDrawCalls[ stateIndex ].AddArray(
+				rPointBufferDrawCalls.GetData(),
+				rPointBufferDrawCalls.GetSize() );
+		}
+
+		// Glyph indices are consumed in draw call order, so appending both lists for each thread keeps them in step.
+		m_screenTextDrawCalls.AddArray( pBuffer->screenTextDrawCalls.GetData(), pBuffer->screenTextDrawCalls.GetSize() );
+		m_screenTextGlyphIndices.AddArray(
+			pBuffer->screenTextGlyphIndices.GetData(),
+			pBuffer->screenTextGlyphIndices.GetSize() );
+
+		m_projectedTextDrawCalls.AddArray(
+			pBuffer->projectedTextDrawCalls.GetData(),
+			pBuffer->projectedTextDrawCalls.GetSize() );
+		m_projectedTextGlyphIndices.AddArray(
+			pBuffer->projectedTextGlyphIndices.GetData(),
+			pBuffer->projectedTextGlyphIndices.GetSize() );
+
+		untexturedVertexOffset += static_cast< uint32_t >( pBuffer->untexturedVertices.GetSize() );
+		untexturedIndexOffset += static_cast< uint32_t >( pBuffer->untexturedIndices.GetSize() );
+		texturedVertexOffset += static_cast< uint32_t >( pBuffer->texturedVertices.GetSize() );
+		texturedIndexOffset += static_cast< uint32_t >( pBuffer->texturedIndices.GetSize() );
+	}
+}
+
 /// Set the vertex shader constant data for the current draw instance.
 ///
 /// @param[in] pCommandProxy           Interface through which render commands should be issued.
@@ -2349,6 +2519,96 @@ void BufferedDrawer::GetStatesFromIndex(
 		stateIndex % RenderResourceManager::DEPTH_STENCIL_STATE_MAX );
 }
 
+/// Move the recorded vertex and index data to the submitted arrays and reset the recorded draw call data.
+///
+/// @see RemoveAll()
+void BufferedDrawer::ThreadBuffer::Submit()
+{
+	submittedUntexturedVertices.Swap( untexturedVertices );
+	submittedTexturedVertices.Swap( texturedVertices );
+
+	submittedUntexturedIndices.Swap( untexturedIndices );
+	submittedTexturedIndices.Swap( texturedIndices );
+
+	RemoveAll();
+}
+
+/// Remove all buffered data, keeping allocated memory for reuse.
+///
+/// @see Clear()
+void BufferedDrawer::ThreadBuffer::RemoveAll()
+{
+	untexturedVertices.RemoveAll();
+	texturedVertices.RemoveAll();
+
+	untexturedIndices.RemoveAll();
+	texturedIndices.RemoveAll();
+
+	for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( untexturedDrawCalls ); ++stateIndex )
+	{
+		untexturedDrawCalls[ stateIndex ].RemoveAll();
+		texturedDrawCalls[ stateIndex ].RemoveAll();
+
+		untexturedBufferDrawCalls[ stateIndex ].RemoveAll();
+		texturedBufferDrawCalls[ stateIndex ].RemoveAll();
+
+		worldTextDrawCalls[ stateIndex ].RemoveAll();
+	}
+
+	for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( pointDrawCalls ); ++stateIndex )
+	{
+		pointDrawCalls[ stateIndex ].RemoveAll();
+		pointBufferDrawCalls[ stateIndex ].RemoveAll();
+	}
+
+	screenTextDrawCalls.RemoveAll();
+	screenTextGlyphIndices.RemoveAll();
+
+	projectedTextDrawCalls.RemoveAll();
+	projectedTextGlyphIndices.RemoveAll();
+}
+
+/// Remove all buffered data and free all allocated memory.
+///
+/// @see RemoveAll()
+void BufferedDrawer::ThreadBuffer::Clear()
+{
+	untexturedVertices.Clear();
+	texturedVertices.Clear();
+
+	untexturedIndices.Clear();
+	texturedIndices.Clear();
+
+	submittedUntexturedVertices.Clear();
+	submittedTexturedVertices.Clear();
+
+	submittedUntexturedIndices.Clear();
+	submittedTexturedIndices.Clear();
+
+	for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( untexturedDrawCalls ); ++stateIndex )
+	{
+		untexturedDrawCalls[ stateIndex ].Clear();
+		texturedDrawCalls[ stateIndex ].Clear();
+
+		untexturedBufferDrawCalls[ stateIndex ].Clear();
+		texturedBufferDrawCalls[ stateIndex ].Clear();
+
+		worldTextDrawCalls[ stateIndex ].Clear();
+	}
+
+	for( size_t stateIndex = 0; stateIndex < HELIUM_ARRAY_COUNT( pointDrawCalls ); ++stateIndex )
+	{
+		pointDrawCalls[ stateIndex ].Clear();
+		pointBufferDrawCalls[ stateIndex ].Clear();
+	}
+
+	screenTextDrawCalls.Clear();
+	screenTextGlyphIndices.Clear();
+
+	projectedTextDrawCalls.Clear();
+	projectedTextGlyphIndices.Clear();
+}
+
 /// Constructor.
 ///
 /// @param[in] pCommandProxy  Render command proxy interface to use when issuing state changes.
@@ -2556,21 +2816,21 @@ void BufferedDrawer::StateCache::ResetStateCache()
 
 /// Constructor.
 ///
-/// @param[in] pDrawer            Buffered drawer instance being used to perform the rendering.
+/// @param[in] pBuffer            Buffer of the thread drawing the text.
 /// @param[in] pFont              Font being used for rendering.
 /// @param[in] color              Text color.
 /// @param[in] rasterizerState    Rasterizer state to use during rendering.
 /// @param[in] depthStencilState  Depth-stencil state to use during rendering.
 /// @param[in] rTransform         World-space transform matrix.
 BufferedDrawer::WorldSpaceTextGlyphHandler::WorldSpaceTextGlyphHandler(
-	BufferedDrawer* pDrawer,
+	ThreadBuffer* pBuffer,
 	Font* pFont,
 	Color color,
 	RenderResourceManager::ERasterizerState rasterizerState,
 	RenderResourceManager::EDepthStencilState depthStencilState,
 	const Simd::Matrix44& rTransform )
 	: m_rTransform( rTransform )
-	, m_pDrawer( pDrawer )
+	, m_pBuffer( pBuffer )
 	, m_pFont( pFont )
 	, m_stateIndex( GetStateIndex( rasterizerState, depthStencilState ) )
 	, m_color( color )
@@ -2638,13 +2898,13 @@ void BufferedDrawer::WorldSpaceTextGlyphHandler::operator()( const Font::Charact
 		SimpleTexturedVertex( corners[ 3 ], Simd::Vector2( texCoordMinX, texCoordMaxY ), m_color )
 	};
 
-	uint32_t baseVertexIndex = static_cast< uint32_t >( m_pDrawer->m_texturedVertices.GetSize() );
-	uint32_t startIndex = static_cast< uint32_t >( m_pDrawer->m_texturedIndices.GetSize() );
+	uint32_t baseVertexIndex = static_cast< uint32_t >( m_pBuffer->texturedVertices.GetSize() );
+	uint32_t startIndex = static_cast< uint32_t >( m_pBuffer->texturedIndices.GetSize() );
 
-	m_pDrawer->m_texturedVertices.AddArray( vertices, 4 );
-	m_pDrawer->m_texturedIndices.AddArray( m_quadIndices, 6 );
+	m_pBuffer->texturedVertices.AddArray( vertices, 4 );
+	m_pBuffer->texturedIndices.AddArray( m_quadIndices, 6 );
 
-	TexturedDrawCall* pDrawCall = m_pDrawer->m_worldTextDrawCalls[ m_stateIndex ].New();
+	TexturedDrawCall* pDrawCall = m_pBuffer->worldTextDrawCalls[ m_stateIndex ].New();
 	HELIUM_ASSERT( pDrawCall );
 	pDrawCall->primitiveType = RENDERER_PRIMITIVE_TYPE_TRIANGLE_LIST;
 	pDrawCall->baseVertexIndex = baseVertexIndex;
@@ -2659,20 +2919,20 @@ void BufferedDrawer::WorldSpaceTextGlyphHandler::operator()( const Font::Charact
 
 /// Constructor.
 ///
-/// @param[in] pDrawer  Buffered drawer instance being used to perform the rendering.
+/// @param[in] pBuffer  Buffer of the thread drawing the text.
 /// @param[in] pFont    Font being used for rendering.
 /// @param[in] x        Pixel x-coordinate at which to begin rendering the text.
 /// @param[in] y        Pixel y-coordinate at which to begin rendering the text.
 /// @param[in] color    Color with which to render the text.
 /// @param[in] size     Size at which to render the text.
 BufferedDrawer::ScreenSpaceTextGlyphHandler::ScreenSpaceTextGlyphHandler(
-	BufferedDrawer* pDrawer,
+	ThreadBuffer* pBuffer,
 	Font* pFont,
 	int32_t x,
 	int32_t y,
 	Color color,
 	RenderResourceManager::EDebugFontSize size )
-	: m_pDrawer( pDrawer )
+	: m_pBuffer( pBuffer )
 	, m_pFont( pFont )
 	, m_pDrawCall( NULL )
 	, m_x( x )
@@ -2691,11 +2951,11 @@ void BufferedDrawer::ScreenSpaceTextGlyphHandler::operator()( const Font::Charac
 
 	uint32_t characterIndex = m_pFont->GetCharacterIndex( pCharacter );
 
-	m_pDrawer->m_screenTextGlyphIndices.Push( characterIndex );
+	m_pBuffer->screenTextGlyphIndices.Push( characterIndex );
 
 	if( !m_pDrawCall )
 	{
-		m_pDrawCall = m_pDrawer->m_screenTextDrawCalls.New();
+		m_pDrawCall = m_pBuffer->screenTextDrawCalls.New();
 		HELIUM_ASSERT( m_pDrawCall );
 		m_pDrawCall->x = m_x;
 		m_pDrawCall->y = m_y;
@@ -2709,7 +2969,7 @@ void BufferedDrawer::ScreenSpaceTextGlyphHandler::operator()( const Font::Charac
 
 /// Constructor.
 ///
-/// @param[in] pDrawer        Buffered drawer instance being used to perform the rendering.
+/// @param[in] pBuffer        Buffer of the thread drawing the text.
 /// @param[in] pFont          Font being used for rendering.
 /// @param[in] rWorldOffset   World-space offset at which to begin rendering the text.
 /// @param[in] screenOffsetX  Horizontal pixel offset at which to begin rendering the text.
@@ -2717,14 +2977,14 @@ void BufferedDrawer::ScreenSpaceTextGlyphHandler::operator()( const Font::Charac
 /// @param[in] color          Color with which to render the text.
 /// @param[in] size           Size at which to render the text.
 BufferedDrawer::ProjectedTextGlyphHandler::ProjectedTextGlyphHandler(
-	BufferedDrawer* pDrawer,
+	ThreadBuffer* pBuffer,
 	Font* pFont,
 	const Simd::Vector3& rWorldOffset,
 	int32_t screenOffsetX,
 	int32_t screenOffsetY,
 	Color color,
 	RenderResourceManager::EDebugFontSize size )
-	: m_pDrawer( pDrawer )
+	: m_pBuffer( pBuffer )
 	, m_pFont( pFont )
 	, m_pDrawCall( NULL )
 	, m_worldOffsetX( rWorldOffset.GetElement( 0 ) )
@@ -2746,11 +3006,11 @@ void BufferedDrawer::ProjectedTextGlyphHandler::operator()( const Font::Characte
 
 	uint32_t characterIndex = m_pFont->GetCharacterIndex( pCharacter );
 
-	m_pDrawer->m_screenTextGlyphIndices.Push( characterIndex );
+	m_pBuffer->projectedTextGlyphIndices.Push( characterIndex );
 
 	if( !m_pDrawCall )
 	{
-		m_pDrawCall = m_pDrawer->m_projectedTextDrawCalls.New();
+		m_pDrawCall = m_pBuffer->projectedTextDrawCalls.New();
 		HELIUM_ASSERT( m_pDrawCall );
 		m_pDrawCall->x = m_screenOffsetX;
 		m_pDrawCall->y = m_screenOffsetY;
@@ -2,6 +2,7 @@
 
 #include "Graphics/Graphics.h"
 
+#include "Platform/Thread.h"
 #include "MathSimd/Matrix44.h"
 #include "Rendering/RRenderResource.h"
 #include "GraphicsTypes/VertexTypes.h"
@@ -22,6 +23,11 @@ namespace Helium
 	HELIUM_DECLARE_RPTR( RVertexShader );
 
 	/// Buffered drawing interface.
+	///
+	/// Draw calls can be buffered from any number of threads at once.  Each thread records into its own buffer, so
+	/// recording never takes a lock.  SubmitDrawing() merges the recorded buffers into the set drawn by the next
+	/// BeginDrawing()/EndDrawing() pair, after which threads may record the following frame while the submitted one
+	/// is rendered (possibly on another thread).
 	class HELIUM_GRAPHICS_API BufferedDrawer : NonCopyable
 	{
 	public:
@@ -30,9 +36,6 @@ namespace Helium
 		/// Number of constant buffers to cycle through for pixel shader blend color parameters.
 		static const size_t INSTANCE_PIXEL_CONSTANT_BUFFER_COUNT = 16;
 
-		/// Maximum number of characters to convert for rendered text strings (including null terminator).
-		static const size_t TEXT_CHARACTER_COUNT_MAX = 1024;
-
 		/// @name Construction/Destruction
 		//@{
 		BufferedDrawer();
@@ -154,6 +157,7 @@ namespace Helium
 
 		/// @name Rendering
 		//@{
+		void SubmitDrawing();
 		void BeginDrawing();
 		void EndDrawing();
 
@@ -226,6 +230,66 @@ namespace Helium
 			float32_t worldPosition[ 3 ];
 		};
 
+		/// Draw call data buffered by a single thread.
+		struct ThreadBuffer
+		{
+			/// Untextured draw call vertices.
+			DynamicArray< SimpleVertex > untexturedVertices;
+			/// Textured draw call vertices.
+			DynamicArray< SimpleTexturedVertex > texturedVertices;
+
+			/// Untextured draw call indices.
+			DynamicArray< uint16_t > untexturedIndices;
+			/// Textured draw call indices.
+			DynamicArray< uint16_t > texturedIndices;
+
+			/// Untextured draw call vertices submitted for rendering.
+			DynamicArray< SimpleVertex > submittedUntexturedVertices;
+			/// Textured draw call vertices submitted for rendering.
+			DynamicArray< SimpleTexturedVertex > submittedTexturedVertices;
+			/// Untextured draw call indices submitted for rendering.
+			DynamicArray< uint16_t > submittedUntexturedIndices;
+			/// Textured draw call indices submitted for rendering.
+			DynamicArray< uint16_t > submittedTexturedIndices;
+
+			/// Untextured draw call data, with vertex and index offsets relative to this buffer.
+			DynamicArray< UntexturedDrawCall > untexturedDrawCalls[ RenderResourceManager::RASTERIZER_STATE_MAX * RenderResourceManager::DEPTH_STENCIL_STATE_MAX ];
+			/// Textured draw call data, with vertex and index offsets relative to this buffer.
+			DynamicArray< TexturedDrawCall > texturedDrawCalls[ RenderResourceManager::RASTERIZER_STATE_MAX * RenderResourceManager::DEPTH_STENCIL_STATE_MAX ];
+			/// Point draw call data, with vertex offsets relative to this buffer.
+			DynamicArray< UntexturedDrawCall > pointDrawCalls[ RenderResourceManager::DEPTH_STENCIL_STATE_MAX ];
+
+			/// Untextured draw call data using external vertex/index buffers.
+			DynamicArray< UntexturedBufferDrawCall > untexturedBufferDrawCalls[ RenderResourceManager::RASTERIZER_STATE_MAX * RenderResourceManager::DEPTH_STENCIL_STATE_MAX ];
+			/// Textured draw call data using external vertex/index buffers.
+			DynamicArray< TexturedBufferDrawCall > texturedBufferDrawCalls[ RenderResourceManager::RASTERIZER_STATE_MAX * RenderResourceManager::DEPTH_STENCIL_STATE_MAX ];
+			/// Point draw call data using external vertex/index buffers.
+			DynamicArray< UntexturedBufferDrawCall > pointBufferDrawCalls[ RenderResourceManager::DEPTH_STENCIL_STATE_MAX ];
+
+			/// World-space text draw call data, with vertex and index offsets relative to this buffer.
+			DynamicArray< TexturedDrawCall > worldTextDrawCalls[ RenderResourceManager::RASTERIZER_STATE_MAX * RenderResourceManager::DEPTH_STENCIL_STATE_MAX ];
+
+			/// Screen-space text draw call data.
+			DynamicArray< ScreenTextDrawCall > screenTextDrawCalls;
+			/// Screen-space text draw call glyph indices.
+			DynamicArray< uint32_t > screenTextGlyphIndices;
+
+			/// Projected text draw call data.
+			DynamicArray< ProjectedTextDrawCall > projectedTextDrawCalls;
+			/// Projected text draw call glyph indices.
+			DynamicArray< uint32_t > projectedTextGlyphIndices;
+
+			/// Next buffer in the list.
+			ThreadBuffer* volatile pNext;
+
+			/// @name Buffered Data Management
+			//@{
+			void Submit();
+			void RemoveAll();
+			void Clear();
+			//@}
+		};
+
 		/// Vertex and index buffer set for primitive drawing.
 		struct ResourceSet
 		{
@@ -382,7 +446,7 @@ namespace Helium
 			/// @name Construction/Destruction
 			//@{
 			WorldSpaceTextGlyphHandler(
-				BufferedDrawer* pDrawer, Font* pFont, Color color,
+				ThreadBuffer* pBuffer, Font* pFont, Color color,
 				RenderResourceManager::ERasterizerState rasterizerState,
 				RenderResourceManager::EDepthStencilState depthStencilState, const Simd::Matrix44& rTransform );
 			//@}
@@ -395,8 +459,8 @@ namespace Helium
 		private:
 			/// Reference to the rendering transform matrix.
 			const Simd::Matrix44& m_rTransform;
-			/// Pointer to the BufferedDrawer instance performing the rendering.
-			BufferedDrawer* m_pDrawer;
+			/// Buffer of the thread drawing the text.
+			ThreadBuffer* m_pBuffer;
 			/// Font resource being used for rendering.
 			Font* m_pFont;
 			/// Draw call set index for the desired rasterizer and depth-stencil state.
@@ -423,7 +487,7 @@ namespace Helium
 			/// @name Construction/Destruction
 			//@{
 			ScreenSpaceTextGlyphHandler(
-				BufferedDrawer* pDrawer, Font* pFont, int32_t x, int32_t y, Color color,
+				ThreadBuffer* pBuffer, Font* pFont, int32_t x, int32_t y, Color color,
 				RenderResourceManager::EDebugFontSize size );
 			//@}
 
@@ -433,8 +497,8 @@ namespace Helium
 			//@}
 
 		private:
-			/// Pointer to the BufferedDrawer instance performing the rendering.
-			BufferedDrawer* m_pDrawer;
+			/// Buffer of the thread drawing the text.
+			ThreadBuffer* m_pBuffer;
 			/// Font resource being used for rendering.
 			Font* m_pFont;
 			/// Text draw call to update.
@@ -457,7 +521,7 @@ namespace Helium
 			/// @name Construction/Destruction
 			//@{
 			ProjectedTextGlyphHandler(
-				BufferedDrawer* pDrawer, Font* pFont, const Simd::Vector3& rWorldOffset, int32_t screenOffsetX,
+				ThreadBuffer* pBuffer, Font* pFont, const Simd::Vector3& rWorldOffset, int32_t screenOffsetX,
 				int32_t screenOffsetY, Color color, RenderResourceManager::EDebugFontSize size );
 			//@}
 
@@ -467,8 +531,8 @@ namespace Helium
 			//@}
 
 		private:
-			/// Pointer to the BufferedDrawer instance performing the rendering.
-			BufferedDrawer* m_pDrawer;
+			/// Buffer of the thread drawing the text.
+			ThreadBuffer* m_pBuffer;
 			/// Font resource being used for rendering.
 			Font* m_pFont;
 			/// Text draw call to update.
@@ -492,15 +556,12 @@ namespace Helium
 			RenderResourceManager::EDebugFontSize m_size;
 		};
 
-		/// Untextured draw call vertices.
-		DynamicArray< SimpleVertex > m_untexturedVertices;
-		/// Textured draw call vertices.
-		DynamicArray< SimpleTexturedVertex > m_texturedVertices;
+		/// List of buffers for each thread that has buffered draw calls.
+		ThreadBuffer* volatile m_pHeadBuffer;
+		/// Thread-local storage for buffer data.
+		ThreadLocalPointer m_bufferTls;
 
-		/// Untextured draw call indices.
-		DynamicArray< uint16_t > m_untexturedIndices;
-		/// Textured draw call indices.
-		DynamicArray< uint16_t > m_texturedIndices;
+		// Draw call data from all thread buffers, merged by BeginDrawing() for rendering.
 
 		/// Untextured draw call data using internal vertex/index buffers.
 		DynamicArray< UntexturedDrawCall > m_untexturedDrawCalls[ RenderResourceManager::RASTERIZER_STATE_MAX * RenderResourceManager::DEPTH_STENCIL_STATE_MAX ];
@@ -573,6 +634,13 @@ namespace Helium
 			RenderResourceManager::EDepthStencilState depthStencilState );
 		//@}
 
+		/// @name Draw Call Buffering Utility Functions
+		//@{
+		ThreadBuffer* GetThreadLocalBuffer();
+		void MergeThreadBuffers();
+		void ClearMergedDrawCalls();
+		//@}
+
 		/// @name Static Utility Functions
 		//@{
 		static size_t GetStateIndex(
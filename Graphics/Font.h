@@ -4,6 +4,7 @@
 #include "Engine/Resource.h"
 
 #include "Platform/Trace.h"
+#include "Foundation/DynamicArray.h"
 #include "Foundation/StringConverter.h"
 #include "Rendering/RRenderResource.h"
 #include "Reflect/MetaEnum.h"
@@ -250,10 +250,22 @@ void Helium::Font::ProcessText( const CharType* pString, size_t characterCount,
 {
     HELIUM_ASSERT( pString || characterCount == 0 );
 
-    // Convert the text to wide characters if necessary.
+    // Convert the text to wide characters if necessary.  Conversion never produces more code units than the source
+    // has, so short strings use a stack buffer and longer ones get a heap buffer sized to fit rather than being cut off.
     const size_t STRING_LENGTH_MAX = 1024;
-    wchar_t pWideString[ STRING_LENGTH_MAX ];
-    characterCount = Helium::StringConverter< CharType, wchar_t >::Convert( pWideString, STRING_LENGTH_MAX, pString );
+    wchar_t stackWideString[ STRING_LENGTH_MAX ];
+    DynamicArray< wchar_t > heapWideString;
+
+    wchar_t* pWideString = stackWideString;
+    size_t wideStringSize = STRING_LENGTH_MAX;
+    if( characterCount >= STRING_LENGTH_MAX )
+    {
+        wideStringSize = characterCount + 1;
+        heapWideString.Resize( wideStringSize );
+        pWideString = heapWideString.GetData();
+    }
+
+    characterCount = Helium::StringConverter< CharType, wchar_t >::Convert( pWideString, wideStringSize, pString );
     HELIUM_ASSERT( pWideString || characterCount == 0 );
 
     // Process each individual code point encountered in the given string (remember to check for surrogate pairs for
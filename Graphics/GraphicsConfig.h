@@ -81,6 +81,8 @@ namespace Helium
         inline EShadowMode GetShadowMode() const;
         inline uint32_t GetShadowBufferSize() const;
 
+        inline float32_t GetLodBias() const;
+
         inline bool GetFullscreen() const;
         inline bool GetVsync() const;
         //@}
@@ -101,6 +103,10 @@ namespace Helium
         /// Shadow buffer size (width/height, in texels).
         uint32_t m_shadowBufferSize;
 
+        /// Mesh level of detail bias (each positive unit halves the projected size used to select the level of
+        /// detail, favoring coarser levels; negative values favor finer levels).
+        float32_t m_lodBias;
+
         /// True to run in fullscreen mode, false to run in windowed mode.
         bool m_bFullscreen;
         /// True to enable vsync.
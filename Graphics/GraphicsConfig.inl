@@ -52,6 +52,14 @@ namespace Helium
         return m_shadowBufferSize;
     }
 
+    /// Get the mesh level of detail bias.
+    ///
+    /// @return  Level of detail bias (positive values favor coarser levels of detail).
+    float32_t GraphicsConfig::GetLodBias() const
+    {
+        return m_lodBias;
+    }
+
     /// Get whether fullscreen mode is enabled.
     ///
     /// @return  True if fullscreen mode is enabled, false if not.
@@ -5,6 +5,7 @@
 #include "Graphics/RenderResourceManager.h"
 #include "Rendering/Renderer.h"
 #include "Framework/TaskScheduler.h"
+#include "Framework/RenderThread.h"
 
 using namespace Helium;
 
@@ -64,12 +65,32 @@ void GraphicsManagerComponent::Initialize( const GraphicsManagerComponentDefinit
 	}
 }
 
+static void RenderGraphicsScene( void* pData )
+{
+	static_cast< GraphicsScene* >( pData )->Render();
+}
+
 void DrawGraphics( World *pWorld )
 {
 	GraphicsManagerComponent *pGraphicsManager = pWorld->GetComponents().GetFirst<GraphicsManagerComponent>();
 	HELIUM_ASSERT( pGraphicsManager );
 
-	pGraphicsManager->GetGraphicsScene()->Update( pWorld );
+	GraphicsScene *pGraphicsScene = pGraphicsManager->GetGraphicsScene();
+	HELIUM_ASSERT( pGraphicsScene );
+
+	// When pipelined, hand the scene over once the previous frame is done with it and let the render thread draw it
+	// while the next frame simulates.
+	RenderThread *pRenderThread = RenderThread::GetStaticInstance();
+	if ( pRenderThread )
+	{
+		pRenderThread->Sync();
+		pGraphicsScene->Synchronize( pWorld );
+		pRenderThread->Enqueue( RenderGraphicsScene, pGraphicsScene );
+	}
+	else
+	{
+		pGraphicsScene->Update( pWorld );
+	}
 }
 
 HELIUM_DEFINE_TASK( GraphicsManagerDrawTask, ForEachWorld< DrawGraphics > )
@@ -7,6 +7,7 @@
 #include "Engine/JobContext.h"
 #include "EngineJobs/EngineJobsInterface.h"
 #include "Rendering/RConstantBuffer.h"
+#include "Rendering/RFence.h"
 #include "Rendering/RIndexBuffer.h"
 #include "Rendering/RPixelShader.h"
 #include "Rendering/RRenderCommandProxy.h"
@@ -27,6 +28,8 @@
 #include "Framework/Slice.h"
 #include "Framework/EntityDefinition.h"
 #include "Framework/WorldDefinition.h"
+#include "Framework/RenderThread.h"
+#include "Framework/FrameProfiler.h"
 
 HELIUM_DEFINE_CLASS( Helium::GraphicsScene );
 
@@ -38,6 +41,13 @@ HELIUM_DEFINE_COMPONENT(Helium::SceneObjectTransform, 32);
 static const size_t SCENE_VIEW_BUFFERED_DRAWER_POOL_BLOCK_SIZE = 4;
 #endif // GRAPHICS_SCENE_BUFFERED_DRAWER
 
+/// Size of each page of the per-frame instance vertex constant data ring, in bytes.
+static const size_t INSTANCE_VERTEX_GLOBAL_DATA_PAGE_SIZE = 256 * 1024;
+/// Size of the instance vertex constant data for a static (non-skinned) mesh, in bytes.
+static const size_t STATIC_INSTANCE_VERTEX_GLOBAL_DATA_SIZE = sizeof( float32_t ) * 12;
+/// Size of the instance vertex constant data for a skinned mesh, in bytes.
+static const size_t SKINNED_INSTANCE_VERTEX_GLOBAL_DATA_SIZE = sizeof( float32_t ) * 12 * BONE_COUNT_MAX;
+
 namespace Helium
 {
     HELIUM_DECLARE_RPTR( RRenderCommandProxy );
@@ -58,6 +68,9 @@ GraphicsScene::GraphicsScene()
     , m_directionalLightColor( 0xffffffff )
     , m_directionalLightBrightness( 1.0f )
     , m_activeViewId( Invalid< uint32_t >() )
+    , m_pRenderSceneViews( NULL )
+    , m_pRenderSceneObjects( NULL )
+    , m_pRenderSceneObjectSubMeshes( NULL )
     , m_constantBufferSetIndex( 0 )
 {
 #if GRAPHICS_SCENE_BUFFERED_DRAWER
@@ -68,31 +81,181 @@ GraphicsScene::GraphicsScene()
 /// Destructor.
 GraphicsScene::~GraphicsScene()
 {
+    // Don't pull the scene out from under a frame still being rendered.
+    RenderThread* pRenderThread = RenderThread::GetStaticInstance();
+    if( pRenderThread )
+    {
+        pRenderThread->Sync();
+    }
 }
 
-/// Update this graphics scene for the current frame.
+/// Update and render this graphics scene for the current frame in lockstep.
+///
+/// @param[in] pWorld  World owning this scene.
+///
+/// @see Synchronize(), Render()
 void GraphicsScene::Update( World *pWorld )
 {
-    // Check for lost devices.
+    Synchronize( pWorld );
+    Render();
+}
+
+/// Update scene state from the simulation and hand it over for rendering.
+///
+/// When rendering is pipelined (a RenderThread exists), the caller must have synced with the render thread first; the
+/// scene views, objects, sub-meshes, bone palettes, and lighting are then copied so the simulation can keep modifying
+/// them while Render() draws the copy.  Otherwise, Render() reads the live scene state directly.
+///
+/// This also resets the renderer if its device was lost, as that has to happen on the thread owning the device.
+///
+/// @param[in] pWorld  World owning this scene.
+///
+/// @see Render(), Update()
+void GraphicsScene::Synchronize( World *pWorld )
+{
+    HELIUM_PROFILE_FRAME_SCOPE( TXT( "GraphicsScene::Synchronize" ) );
+
+    // Reset lost devices before anything is handed over for rendering.
     Renderer* pRenderer = Renderer::GetStaticInstance();
-    if( !pRenderer )
+    if( pRenderer && pRenderer->GetStatus() == Renderer::STATUS_NOT_RESET )
     {
-        return;
+        pRenderer->Reset();
     }
 
-    Renderer::EStatus rendererStatus = pRenderer->GetStatus();
-    if( rendererStatus != Renderer::STATUS_READY )
+    // Update each scene view as necessary.
+    size_t sceneViewCount = m_sceneViews.GetSize();
+    for( size_t viewIndex = 0; viewIndex < sceneViewCount; ++viewIndex )
     {
-        if( rendererStatus == Renderer::STATUS_NOT_RESET )
+        if( m_sceneViews.IsElementValid( viewIndex ) )
         {
-            rendererStatus = pRenderer->Reset();
+            m_sceneViews[ viewIndex ].ConditionalUpdate();
         }
+    }
+
+    // Update each scene object as necessary.
+    for (ImplementingComponentIterator<SceneObjectTransform> iter( *pWorld->m_ComponentManager ); *iter; iter.Advance())
+    {
+        iter->GraphicsSceneObjectUpdate(this);
+    }
 
-        if( rendererStatus != Renderer::STATUS_READY )
+    if( RenderThread::GetStaticInstance() )
+    {
+        m_renderSceneViews = m_sceneViews;
+        m_renderSceneObjects = m_sceneObjects;
+        m_renderSceneObjectSubMeshes = m_sceneObjectSubMeshes;
+
+        // The bone palettes belong to the animating components, so they are copied as well.
+        CopyRenderBonePalettes();
+
+        m_pRenderSceneViews = &m_renderSceneViews;
+        m_pRenderSceneObjects = &m_renderSceneObjects;
+        m_pRenderSceneObjectSubMeshes = &m_renderSceneObjectSubMeshes;
+    }
+    else
+    {
+        m_pRenderSceneViews = &m_sceneViews;
+        m_pRenderSceneObjects = &m_sceneObjects;
+        m_pRenderSceneObjectSubMeshes = &m_sceneObjectSubMeshes;
+    }
+
+    m_renderLighting.ambientLightTopColor = m_ambientLightTopColor;
+    m_renderLighting.ambientLightTopBrightness = m_ambientLightTopBrightness;
+    m_renderLighting.ambientLightBottomColor = m_ambientLightBottomColor;
+    m_renderLighting.ambientLightBottomBrightness = m_ambientLightBottomBrightness;
+    m_renderLighting.directionalLightDirection = m_directionalLightDirection;
+    m_renderLighting.directionalLightColor = m_directionalLightColor;
+    m_renderLighting.directionalLightBrightness = m_directionalLightBrightness;
+
+#if GRAPHICS_SCENE_BUFFERED_DRAWER
+    // Hand the draw calls recorded since the last frame over for rendering.
+    m_sceneBufferedDrawer.SubmitDrawing();
+
+    m_renderViewBufferedDrawers = m_viewBufferedDrawers;
+    size_t viewBufferedDrawerCount = m_renderViewBufferedDrawers.GetSize();
+    for( size_t viewIndex = 0; viewIndex < viewBufferedDrawerCount; ++viewIndex )
+    {
+        BufferedDrawer* pDrawer = m_renderViewBufferedDrawers[ viewIndex ];
+        if( pDrawer )
         {
-            return;
+            pDrawer->SubmitDrawing();
         }
     }
+#endif // GRAPHICS_SCENE_BUFFERED_DRAWER
+}
+
+/// Copy the bone palette of each scene object in the render copy of the scene object list into scene-owned storage.
+///
+/// Bone palettes are owned by the components animating them, so the render copy of each scene object is pointed at
+/// the copied palette instead of the one the simulation will update for the next frame.
+void GraphicsScene::CopyRenderBonePalettes()
+{
+    size_t sceneObjectCount = m_renderSceneObjects.GetSize();
+
+    // Size the storage first so that the palette addresses don't change while they are being handed out.
+    size_t boneTotal = 0;
+    for( size_t objectIndex = 0; objectIndex < sceneObjectCount; ++objectIndex )
+    {
+        if( m_renderSceneObjects.IsElementValid( objectIndex ) &&
+            m_renderSceneObjects[ objectIndex ].GetBonePalette() )
+        {
+            boneTotal += m_renderSceneObjects[ objectIndex ].GetBoneCount();
+        }
+    }
+
+    m_renderBonePalettes.Reserve( boneTotal );
+    m_renderBonePalettes.Resize( boneTotal );
+
+    size_t boneOffset = 0;
+    for( size_t objectIndex = 0; objectIndex < sceneObjectCount; ++objectIndex )
+    {
+        if( !m_renderSceneObjects.IsElementValid( objectIndex ) )
+        {
+            continue;
+        }
+
+        GraphicsSceneObject& rSceneObject = m_renderSceneObjects[ objectIndex ];
+        const Simd::Matrix44* pBonePalette = rSceneObject.GetBonePalette();
+        if( !pBonePalette )
+        {
+            continue;
+        }
+
+        size_t boneCount = rSceneObject.GetBoneCount();
+        Simd::Matrix44* pRenderBonePalette = m_renderBonePalettes.GetData() + boneOffset;
+        for( size_t boneIndex = 0; boneIndex < boneCount; ++boneIndex )
+        {
+            pRenderBonePalette[ boneIndex ] = pBonePalette[ boneIndex ];
+        }
+
+        rSceneObject.SetBonePalette( pRenderBonePalette );
+        boneOffset += boneCount;
+    }
+
+    HELIUM_ASSERT( boneOffset == boneTotal );
+}
+
+/// Render the scene state handed over by the last call to Synchronize().
+///
+/// This only reads the handed-over state, so it may run on the render thread while the simulation updates the next
+/// frame.
+///
+/// @see Synchronize(), Update()
+void GraphicsScene::Render()
+{
+    HELIUM_PROFILE_FRAME_SCOPE( TXT( "GraphicsScene::Render" ) );
+
+    // Nothing has been handed over yet.
+    if( !m_pRenderSceneViews )
+    {
+        return;
+    }
+
+    // Skip the frame if the device is lost (Synchronize() resets it once it can be).
+    Renderer* pRenderer = Renderer::GetStaticInstance();
+    if( !pRenderer || pRenderer->GetStatus() != Renderer::STATUS_READY )
+    {
+        return;
+    }
 
     // No need to update anything if we have no scene render texture or scene views.
     RenderResourceManager& rRenderResourceManager = RenderResourceManager::GetStaticInstance();
@@ -103,7 +266,9 @@ void GraphicsScene::Update( World *pWorld )
         return;
     }
 
-    size_t sceneViewCount = m_sceneViews.GetSize();
+    SparseArray< GraphicsSceneView >& rSceneViews = *m_pRenderSceneViews;
+
+    size_t sceneViewCount = rSceneViews.GetSize();
     if( sceneViewCount == 0 )
     {
         return;
@@ -116,34 +281,18 @@ void GraphicsScene::Update( World *pWorld )
         m_shadowViewInverseViewProjectionMatrices.Resize( sceneViewCount );
     }
 
-    // Update each scene view as necessary and compute their inverse view/projection matrices.
+    // Compute the inverse view/projection matrices of each view.
     for( size_t viewIndex = 0; viewIndex < sceneViewCount; ++viewIndex )
     {
-        if( !m_sceneViews.IsElementValid( viewIndex ) )
+        if( !rSceneViews.IsElementValid( viewIndex ) )
         {
             continue;
         }
 
-        m_sceneViews[ viewIndex ].ConditionalUpdate();
         UpdateShadowInverseViewProjectionMatrixSimple( viewIndex );
     }
 
-    // Update each scene object as necessary.
-     size_t sceneObjectCount = m_sceneObjects.GetSize();
-     //for( size_t objectIndex = 0; objectIndex < sceneObjectCount; ++objectIndex )
-     //{
-     //    if( !m_sceneObjects.IsElementValid( objectIndex ) )
-     //    {
-     //        continue;
-     //    }
- 
-     //    m_sceneObjects[ objectIndex ].ConditionalUpdate( this );
-     //}
-
-    for (ImplementingComponentIterator<SceneObjectTransform> iter( *pWorld->m_ComponentManager ); *iter; iter.Advance())
-    {
-        iter->GraphicsSceneObjectUpdate(this);
-    }
+    size_t sceneObjectCount = m_pRenderSceneObjects->GetSize();
 
     // Swap dynamic constant buffers and update their contents.
     SwapDynamicConstantBuffers();
@@ -151,6 +300,8 @@ void GraphicsScene::Update( World *pWorld )
     // Resize the visible object bit array as necessary.
     m_visibleSceneObjects.Reserve( sceneObjectCount );
     m_visibleSceneObjects.Resize( sceneObjectCount );
+    m_sceneObjectLods.Reserve( sceneObjectCount );
+    m_sceneObjectLods.Resize( sceneObjectCount );
 
 #if GRAPHICS_SCENE_BUFFERED_DRAWER
     // Set up the scene's buffered drawer for the current frame.
@@ -163,9 +314,9 @@ void GraphicsScene::Update( World *pWorld )
 #if GRAPHICS_SCENE_BUFFERED_DRAWER
         // Set up the current view's buffered drawer for the current frame.
         BufferedDrawer* pDrawer = NULL;
-        if( viewIndex < m_viewBufferedDrawers.GetSize() )
+        if( viewIndex < m_renderViewBufferedDrawers.GetSize() )
         {
-            pDrawer = m_viewBufferedDrawers[ viewIndex ];
+            pDrawer = m_renderViewBufferedDrawers[ viewIndex ];
             if( pDrawer )
             {
                 pDrawer->BeginDrawing();
@@ -188,6 +339,19 @@ void GraphicsScene::Update( World *pWorld )
     // Finish drawing with the scene's buffered drawer.
     m_sceneBufferedDrawer.EndDrawing();
 #endif // GRAPHICS_SCENE_BUFFERED_DRAWER
+
+    // Fence the instance data ring pages used this frame so they aren't overwritten while still in use.
+    HELIUM_ASSERT( !m_instanceVertexGlobalDataFences[ m_constantBufferSetIndex ] );
+    if( !m_mappedInstanceVertexGlobalDataPages.IsEmpty() )
+    {
+        RFence* pFence = pRenderer->CreateFence();
+        HELIUM_ASSERT( pFence );
+        m_instanceVertexGlobalDataFences[ m_constantBufferSetIndex ] = pFence;
+
+        RRenderCommandProxyPtr spCommandProxy = pRenderer->GetImmediateCommandProxy();
+        HELIUM_ASSERT( spCommandProxy );
+        spCommandProxy->SetFence( pFence );
+    }
 }
 
 /// Allocate a new scene view.
@@ -213,6 +377,13 @@ void GraphicsScene::ReleaseSceneView( uint32_t id )
     HELIUM_ASSERT( id < m_sceneViews.GetSize() );
     HELIUM_ASSERT( m_sceneViews.IsElementValid( id ) );
 
+    // The view's buffered drawer is released below, so it must not be in use for rendering.
+    RenderThread* pRenderThread = RenderThread::GetStaticInstance();
+    if( pRenderThread )
+    {
+        pRenderThread->Sync();
+    }
+
     m_sceneViews.Remove( id );
 
     if( m_activeViewId == id )
@@ -426,12 +597,14 @@ Name GraphicsScene::GetShadowMapTextureName()
 /// @param[in] viewIndex  Index of the scene view for which to update the shadow depth pass transform matrix.
 void GraphicsScene::UpdateShadowInverseViewProjectionMatrixSimple( size_t viewIndex )
 {
-    HELIUM_ASSERT( viewIndex < m_sceneViews.GetSize() );
-    HELIUM_ASSERT( m_sceneViews.IsElementValid( viewIndex ) );
+    SparseArray< GraphicsSceneView >& rSceneViews = *m_pRenderSceneViews;
+
+    HELIUM_ASSERT( viewIndex < rSceneViews.GetSize() );
+    HELIUM_ASSERT( rSceneViews.IsElementValid( viewIndex ) );
     HELIUM_ASSERT( viewIndex < m_shadowViewInverseViewProjectionMatrices.GetSize() );
 
     // Compute the scene directional light's view basis for shadow calculation.
-    Simd::Vector3 shadowViewForward = m_directionalLightDirection;
+    Simd::Vector3 shadowViewForward = m_renderLighting.directionalLightDirection;
     Simd::Vector3 shadowViewUp( 0.0f, 1.0f, 0.0f );
 
     Simd::Vector3 shadowViewRight;
@@ -441,7 +614,7 @@ void GraphicsScene::UpdateShadowInverseViewProjectionMatrixSimple( size_t viewIn
     shadowViewUp.CrossSet( shadowViewForward, shadowViewRight );
 
     // Compute the corners of the view frustum region affected by shadowing.
-    GraphicsSceneView& rView = m_sceneViews[ viewIndex ];
+    GraphicsSceneView& rView = rSceneViews[ viewIndex ];
 
     float32_t shadowCutoffDistance = rView.GetShadowCutoffDistance();
 
@@ -564,8 +737,8 @@ void GraphicsScene::UpdateShadowInverseViewProjectionMatrixSimple( size_t viewIn
 /// @param[in] viewIndex  Index of the scene view for which to update the shadow depth pass transform matrix.
 void GraphicsScene::UpdateShadowInverseViewProjectionMatrixLspsm( size_t viewIndex )
 {
-    HELIUM_ASSERT( viewIndex < m_sceneViews.GetSize() );
-    HELIUM_ASSERT( m_sceneViews.IsElementValid( viewIndex ) );
+    HELIUM_ASSERT( viewIndex < m_pRenderSceneViews->GetSize() );
+    HELIUM_ASSERT( m_pRenderSceneViews->IsElementValid( viewIndex ) );
     HELIUM_ASSERT( viewIndex < m_shadowViewInverseViewProjectionMatrices.GetSize() );
 
     // XXX TMC TODO: Implement!!
@@ -576,6 +749,10 @@ void GraphicsScene::UpdateShadowInverseViewProjectionMatrixLspsm( size_t viewInd
 /// buffers.
 void GraphicsScene::SwapDynamicConstantBuffers()
 {
+    SparseArray< GraphicsSceneView >& rSceneViews = *m_pRenderSceneViews;
+    SparseArray< GraphicsSceneObject >& rSceneObjects = *m_pRenderSceneObjects;
+    SparseArray< GraphicsSceneObject::SubMeshData >& rSubMeshes = *m_pRenderSceneObjectSubMeshes;
+
     // No need to update any rendering data if we have no active renderer.
     Renderer* pRenderer = Renderer::GetStaticInstance();
     if( !pRenderer )
@@ -626,7 +803,7 @@ void GraphicsScene::SwapDynamicConstantBuffers()
     DynamicArray< RConstantBufferPtr >& rViewPixelBasePassDataBuffers = m_viewPixelBasePassDataBuffers[ bufferSetIndex ];
     DynamicArray< RConstantBufferPtr >& rShadowViewVertexDataBuffers = m_shadowViewVertexDataBuffers[ bufferSetIndex ];
 
-    size_t sceneViewCount = m_sceneViews.GetSize();
+    size_t sceneViewCount = rSceneViews.GetSize();
     size_t viewBufferCount = rViewVertexGlobalDataBuffers.GetSize();
     HELIUM_ASSERT( rViewVertexBasePassDataBuffers.GetSize() == viewBufferCount );
     HELIUM_ASSERT( rViewVertexScreenDataBuffers.GetSize() == viewBufferCount );
@@ -644,7 +821,7 @@ void GraphicsScene::SwapDynamicConstantBuffers()
 
     for( size_t viewIndex = 0; viewIndex < sceneViewCount; ++viewIndex )
     {
-        if( !m_sceneViews.IsElementValid( viewIndex ) )
+        if( !rSceneViews.IsElementValid( viewIndex ) )
         {
             continue;
         }
@@ -670,7 +847,7 @@ void GraphicsScene::SwapDynamicConstantBuffers()
             float32_t* pMappedData = static_cast< float32_t* >( spBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD ) );
             HELIUM_ASSERT( pMappedData );
 
-            GraphicsSceneView& rView = m_sceneViews[ viewIndex ];
+            GraphicsSceneView& rView = rSceneViews[ viewIndex ];
             const Simd::Matrix44& rInverseViewProjectionMatrix = rView.GetInverseViewProjectionMatrix();
             const Simd::Matrix44& rInverseViewMatrix = rView.GetInverseViewMatrix();
 
@@ -738,10 +915,10 @@ void GraphicsScene::SwapDynamicConstantBuffers()
                 m_shadowViewInverseViewProjectionMatrices[ viewIndex ],
                 shadowMapUvTransform );
 
-            GraphicsSceneView& rView = m_sceneViews[ viewIndex ];
+            GraphicsSceneView& rView = rSceneViews[ viewIndex ];
             const Simd::Matrix44& rInverseViewMatrix = rView.GetInverseViewMatrix();
 
-            Simd::Vector3 lightDir = -m_directionalLightDirection;
+            Simd::Vector3 lightDir = -m_renderLighting.directionalLightDirection;
             lightDir = rInverseViewMatrix.TransformVector( lightDir );
 
             *( pMappedData++ ) = shadowViewInvViewProj.GetElement( 0 );
@@ -795,7 +972,7 @@ void GraphicsScene::SwapDynamicConstantBuffers()
             float32_t* pMappedData = static_cast< float32_t* >( spBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD ) );
             HELIUM_ASSERT( pMappedData );
 
-            GraphicsSceneView& rView = m_sceneViews[ viewIndex ];
+            GraphicsSceneView& rView = rSceneViews[ viewIndex ];
 
             float32_t invWidth = 1.0f / static_cast< float32_t >( rView.GetViewportWidth() );
             float32_t invHeight = 1.0f / static_cast< float32_t >( rView.GetViewportHeight() );
@@ -848,19 +1025,19 @@ void GraphicsScene::SwapDynamicConstantBuffers()
             float32_t* pMappedData = static_cast< float32_t* >( spBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD ) );
             HELIUM_ASSERT( pMappedData );
 
-            *( pMappedData++ ) = m_ambientLightTopColor.GetFloatR() * m_ambientLightTopBrightness;
-            *( pMappedData++ ) = m_ambientLightTopColor.GetFloatG() * m_ambientLightTopBrightness;
-            *( pMappedData++ ) = m_ambientLightTopColor.GetFloatB() * m_ambientLightTopBrightness;
+            *( pMappedData++ ) = m_renderLighting.ambientLightTopColor.GetFloatR() * m_renderLighting.ambientLightTopBrightness;
+            *( pMappedData++ ) = m_renderLighting.ambientLightTopColor.GetFloatG() * m_renderLighting.ambientLightTopBrightness;
+            *( pMappedData++ ) = m_renderLighting.ambientLightTopColor.GetFloatB() * m_renderLighting.ambientLightTopBrightness;
             *( pMappedData++ ) = 1.0f;
 
-            *( pMappedData++ ) = m_ambientLightBottomColor.GetFloatR() * m_ambientLightBottomBrightness;
-            *( pMappedData++ ) = m_ambientLightBottomColor.GetFloatG() * m_ambientLightBottomBrightness;
-            *( pMappedData++ ) = m_ambientLightBottomColor.GetFloatB() * m_ambientLightBottomBrightness;
+            *( pMappedData++ ) = m_renderLighting.ambientLightBottomColor.GetFloatR() * m_renderLighting.ambientLightBottomBrightness;
+            *( pMappedData++ ) = m_renderLighting.ambientLightBottomColor.GetFloatG() * m_renderLighting.ambientLightBottomBrightness;
+            *( pMappedData++ ) = m_renderLighting.ambientLightBottomColor.GetFloatB() * m_renderLighting.ambientLightBottomBrightness;
             *( pMappedData++ ) = 1.0f;
 
-            *( pMappedData++ ) = m_directionalLightColor.GetFloatR() * m_directionalLightBrightness;
-            *( pMappedData++ ) = m_directionalLightColor.GetFloatG() * m_directionalLightBrightness;
-            *( pMappedData++ ) = m_directionalLightColor.GetFloatB() * m_directionalLightBrightness;
+            *( pMappedData++ ) = m_renderLighting.directionalLightColor.GetFloatR() * m_renderLighting.directionalLightBrightness;
+            *( pMappedData++ ) = m_renderLighting.directionalLightColor.GetFloatG() * m_renderLighting.directionalLightBrightness;
+            *( pMappedData++ ) = m_renderLighting.directionalLightColor.GetFloatB() * m_renderLighting.directionalLightBrightness;
             *( pMappedData++ ) = 1.0f;
 
             *( pMappedData++ ) = inverseShadowMapResolutionX;
@@ -916,177 +1093,122 @@ void GraphicsScene::SwapDynamicConstantBuffers()
         }
     }
 
-    // Map each instance constant buffer for updating.
-    DynamicArray< RConstantBufferPtr >& rStaticInstanceVertexGlobalDataBufferPool =
-        m_staticInstanceVertexGlobalDataBufferPool[ bufferSetIndex ];
-    DynamicArray< RConstantBufferPtr >& rSkinnedInstanceVertexGlobalDataBufferPool =
-        m_skinnedInstanceVertexGlobalDataBufferPool[ bufferSetIndex ];
-    HELIUM_UNREF( rSkinnedInstanceVertexGlobalDataBufferPool );
-
-    size_t sceneObjectCount = m_sceneObjects.GetSize();
-    size_t instanceBufferCount = m_objectVertexGlobalDataBuffers.GetSize();
-    if( instanceBufferCount < sceneObjectCount )
-    {
-        MemoryZero( m_objectVertexGlobalDataBuffers.GetData(), instanceBufferCount * sizeof( RConstantBuffer* ) );
-        m_objectVertexGlobalDataBuffers.Add( NULL, sceneObjectCount - instanceBufferCount );
-    }
-    else
+    // Make sure the GPU is no longer reading from the instance data ring pages we are about to overwrite.
+    RFencePtr& rspInstanceFence = m_instanceVertexGlobalDataFences[ bufferSetIndex ];
+    if( rspInstanceFence )
     {
-        MemoryZero( m_objectVertexGlobalDataBuffers.GetData(), sceneObjectCount * sizeof( RConstantBuffer* ) );
+        pRenderer->SyncFence( rspInstanceFence );
+        rspInstanceFence.Release();
     }
 
-    size_t mappedBufferCount = m_mappedObjectVertexGlobalDataBuffers.GetSize();
-    if( mappedBufferCount < sceneObjectCount )
-    {
-        MemoryZero( m_mappedObjectVertexGlobalDataBuffers.GetData(), mappedBufferCount * sizeof( float32_t* ) );
-        m_mappedObjectVertexGlobalDataBuffers.Add( NULL, sceneObjectCount - mappedBufferCount );
-    }
-    else
+    // Reset the per-object and per-sub-mesh instance data assignments.
+    size_t sceneObjectCount = rSceneObjects.GetSize();
+    if( m_objectVertexGlobalDataBuffers.GetSize() < sceneObjectCount )
     {
-        MemoryZero( m_mappedObjectVertexGlobalDataBuffers.GetData(), sceneObjectCount * sizeof( float32_t* ) );
+        m_objectVertexGlobalDataBuffers.Resize( sceneObjectCount );
+        m_objectVertexGlobalDataOffsets.Resize( sceneObjectCount );
+        m_mappedObjectVertexGlobalDataBuffers.Resize( sceneObjectCount );
     }
 
-    size_t subMeshCount = m_sceneObjectSubMeshes.GetSize();
-    instanceBufferCount = m_subMeshVertexGlobalDataBuffers.GetSize();
-    if( instanceBufferCount < subMeshCount )
-    {
-        MemoryZero( m_subMeshVertexGlobalDataBuffers.GetData(), instanceBufferCount * sizeof( RConstantBuffer* ) );
-        m_subMeshVertexGlobalDataBuffers.Add( NULL, subMeshCount - instanceBufferCount );
-    }
-    else
-    {
-        MemoryZero( m_subMeshVertexGlobalDataBuffers.GetData(), subMeshCount * sizeof( RConstantBuffer* ) );
-    }
+    MemoryZero( m_objectVertexGlobalDataBuffers.GetData(), sceneObjectCount * sizeof( RConstantBuffer* ) );
+    MemoryZero( m_mappedObjectVertexGlobalDataBuffers.GetData(), sceneObjectCount * sizeof( float32_t* ) );
 
-    mappedBufferCount = m_mappedSubMeshVertexGlobalDataBuffers.GetSize();
-    if( mappedBufferCount < subMeshCount )
+    size_t subMeshCount = rSubMeshes.GetSize();
+    if( m_subMeshVertexGlobalDataBuffers.GetSize() < subMeshCount )
     {
-        MemoryZero( m_mappedSubMeshVertexGlobalDataBuffers.GetData(), mappedBufferCount * sizeof( float32_t* ) );
-        m_mappedSubMeshVertexGlobalDataBuffers.Add( NULL, subMeshCount - mappedBufferCount );
-    }
-    else
-    {
-        MemoryZero( m_mappedSubMeshVertexGlobalDataBuffers.GetData(), subMeshCount * sizeof( float32_t* ) );
+        m_subMeshVertexGlobalDataBuffers.Resize( subMeshCount );
+        m_subMeshVertexGlobalDataOffsets.Resize( subMeshCount );
+        m_mappedSubMeshVertexGlobalDataBuffers.Resize( subMeshCount );
     }
 
-    size_t staticBufferIndex = 0;
-    size_t skinnedBufferIndex = 0;
-    HELIUM_UNREF( skinnedBufferIndex );
+    MemoryZero( m_subMeshVertexGlobalDataBuffers.GetData(), subMeshCount * sizeof( RConstantBuffer* ) );
+    MemoryZero( m_mappedSubMeshVertexGlobalDataBuffers.GetData(), subMeshCount * sizeof( float32_t* ) );
+
+    // Sub-allocate instance data for each scene object and sub-mesh from the current frame's upload ring.  Each ring
+    // page is mapped once on first use, and the update jobs write directly to the precomputed offsets within it.
+    DynamicArray< RConstantBufferPtr >& rInstancePages = m_instanceVertexGlobalDataPages[ bufferSetIndex ];
+    m_mappedInstanceVertexGlobalDataPages.Resize( 0 );
+
+    size_t pageOffset = INSTANCE_VERTEX_GLOBAL_DATA_PAGE_SIZE;
 
     for( size_t subMeshIndex = 0; subMeshIndex < subMeshCount; ++subMeshIndex )
     {
-        if( !m_sceneObjectSubMeshes.IsElementValid( subMeshIndex ) )
+        if( !rSubMeshes.IsElementValid( subMeshIndex ) )
         {
             continue;
         }
 
-        GraphicsSceneObject::SubMeshData& rSubMesh = m_sceneObjectSubMeshes[ subMeshIndex ];
+        GraphicsSceneObject::SubMeshData& rSubMesh = rSubMeshes[ subMeshIndex ];
 
         size_t sceneObjectIndex = rSubMesh.GetSceneObjectId();
         HELIUM_ASSERT( sceneObjectIndex < sceneObjectCount );
 
-        // If the main scene object for the sub mesh already has a constant buffer assigned, we know it is a static
-        // mesh that has already been processed, so we can skip it.
+        // If the main scene object for the sub mesh already has instance data assigned, we know it is a static mesh
+        // that has already been processed, so we can skip it.
         if( m_objectVertexGlobalDataBuffers[ sceneObjectIndex ] )
         {
             continue;
         }
 
-        // Determine whether the object should be rendered as a static mesh (vertex constant buffer per scene
-        // object) or skinned mesh (vertex constant buffer per sub-mesh).
-        HELIUM_ASSERT( m_sceneObjects.IsElementValid( sceneObjectIndex ) );
-        GraphicsSceneObject& rSceneObject = m_sceneObjects[ sceneObjectIndex ];
+        // Determine whether the object should be rendered as a static mesh (instance data per scene object) or
+        // skinned mesh (instance data per sub-mesh).
+        HELIUM_ASSERT( rSceneObjects.IsElementValid( sceneObjectIndex ) );
+        GraphicsSceneObject& rSceneObject = rSceneObjects[ sceneObjectIndex ];
 
-        RConstantBuffer* pBuffer = NULL;
+        bool bSkinned =
+            rSceneObject.GetBoneCount() != 0 && rSceneObject.GetBonePalette() && rSubMesh.GetSkinningPaletteMap();
+        size_t instanceDataSize =
+            ( bSkinned ? SKINNED_INSTANCE_VERTEX_GLOBAL_DATA_SIZE : STATIC_INSTANCE_VERTEX_GLOBAL_DATA_SIZE );
 
-        uint_fast8_t boneCount = rSceneObject.GetBoneCount();
-        if( boneCount != 0 )
+        // Advance to the next ring page if the instance data won't fit in the current one.
+        if( pageOffset + instanceDataSize > INSTANCE_VERTEX_GLOBAL_DATA_PAGE_SIZE )
         {
-            const Simd::Matrix44* pBonePalette = rSceneObject.GetBonePalette();
-            if( pBonePalette )
+            size_t pageIndex = m_mappedInstanceVertexGlobalDataPages.GetSize();
+            if( pageIndex >= rInstancePages.GetSize() )
             {
-                const uint8_t* pSkinningPaletteMap = rSubMesh.GetSkinningPaletteMap();
-                if( pSkinningPaletteMap )
-                {
-                    RConstantBuffer* pBuffer;
-                    if( skinnedBufferIndex < rSkinnedInstanceVertexGlobalDataBufferPool.GetSize() )
-                    {
-                        pBuffer = rSkinnedInstanceVertexGlobalDataBufferPool[ skinnedBufferIndex ];
-                        HELIUM_ASSERT( pBuffer );
-                    }
-                    else
-                    {
-                        HELIUM_ASSERT( skinnedBufferIndex == rSkinnedInstanceVertexGlobalDataBufferPool.GetSize() );
+                HELIUM_ASSERT( pageIndex == rInstancePages.GetSize() );
 
-                        pBuffer = pRenderer->CreateConstantBuffer(
-                            sizeof( float32_t ) * 12 * BONE_COUNT_MAX,
-                            RENDERER_BUFFER_USAGE_DYNAMIC );
-                        if( !pBuffer )
-                        {
-                            HELIUM_TRACE(
-                                TraceLevels::Error,
-                                ( TXT( "GraphicsScene::SwapDynamicConstantBuffers(): Skinned mesh instance " )
-                                TXT( "vertex constant global data buffer creation failed!\n" ) ) );
-                        }
-                        else
-                        {
-                            rSkinnedInstanceVertexGlobalDataBufferPool.Push( pBuffer );
-                        }
-                    }
+                RConstantBuffer* pPage = pRenderer->CreateConstantBuffer(
+                    INSTANCE_VERTEX_GLOBAL_DATA_PAGE_SIZE,
+                    RENDERER_BUFFER_USAGE_DYNAMIC );
+                if( !pPage )
+                {
+                    HELIUM_TRACE(
+                        TraceLevels::Error,
+                        ( TXT( "GraphicsScene::SwapDynamicConstantBuffers(): Instance vertex constant global " )
+                        TXT( "data ring page creation failed.\n" ) ) );
 
-                    if( pBuffer )
-                    {
-                        ++skinnedBufferIndex;
+                    break;
+                }
 
-                        m_subMeshVertexGlobalDataBuffers[ subMeshIndex ] = pBuffer;
+                rInstancePages.Push( pPage );
+            }
 
-                        void* pMappedData = pBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD );
-                        HELIUM_ASSERT( pMappedData );
-                        m_mappedSubMeshVertexGlobalDataBuffers[ subMeshIndex ] =
-                            static_cast< float32_t* >( pMappedData );
+            void* pMappedPage = rInstancePages[ pageIndex ]->Map( RENDERER_BUFFER_MAP_HINT_DISCARD );
+            HELIUM_ASSERT( pMappedPage );
+            m_mappedInstanceVertexGlobalDataPages.Push( static_cast< float32_t* >( pMappedPage ) );
 
-                        continue;
-                    }
-                }
-            }
+            pageOffset = 0;
         }
 
-        // Instance data not mapped as a skinned mesh, so map as a static mesh.
-        if( staticBufferIndex < rStaticInstanceVertexGlobalDataBufferPool.GetSize() )
+        size_t pageIndex = m_mappedInstanceVertexGlobalDataPages.GetSize() - 1;
+        RConstantBuffer* pPage = rInstancePages[ pageIndex ];
+        float32_t* pMappedData = m_mappedInstanceVertexGlobalDataPages[ pageIndex ] + pageOffset / sizeof( float32_t );
+
+        if( bSkinned )
         {
-            pBuffer = rStaticInstanceVertexGlobalDataBufferPool[ staticBufferIndex ];
-            HELIUM_ASSERT( pBuffer );
+            m_subMeshVertexGlobalDataBuffers[ subMeshIndex ] = pPage;
+            m_subMeshVertexGlobalDataOffsets[ subMeshIndex ] = pageOffset;
+            m_mappedSubMeshVertexGlobalDataBuffers[ subMeshIndex ] = pMappedData;
         }
         else
         {
-            HELIUM_ASSERT( staticBufferIndex == rStaticInstanceVertexGlobalDataBufferPool.GetSize() );
-
-            pBuffer = pRenderer->CreateConstantBuffer(
-                sizeof( float32_t ) * 12,
-                RENDERER_BUFFER_USAGE_DYNAMIC );
-            if( !pBuffer )
-            {
-                HELIUM_TRACE(
-                    TraceLevels::Error,
-                    ( TXT( "GraphicsScene::SwapDynamicConstantBuffers(): Static mesh instance vertex " )
-                    TXT( "constant global data buffer creation failed!\n" ) ) );
-            }
-            else
-            {
-                rStaticInstanceVertexGlobalDataBufferPool.Push( pBuffer );
-            }
+            m_objectVertexGlobalDataBuffers[ sceneObjectIndex ] = pPage;
+            m_objectVertexGlobalDataOffsets[ sceneObjectIndex ] = pageOffset;
+            m_mappedObjectVertexGlobalDataBuffers[ sceneObjectIndex ] = pMappedData;
         }
 
-        if( pBuffer )
-        {
-            ++staticBufferIndex;
-
-            m_objectVertexGlobalDataBuffers[ sceneObjectIndex ] = pBuffer;
-
-            void* pMappedData = pBuffer->Map( RENDERER_BUFFER_MAP_HINT_DISCARD );
-            HELIUM_ASSERT( pMappedData );
-            m_mappedObjectVertexGlobalDataBuffers[ sceneObjectIndex ] = static_cast< float32_t* >( pMappedData );
-        }
+        pageOffset += instanceDataSize;
     }
 
     // Update each constant buffer in parallel.
@@ -1101,32 +1223,58 @@ void GraphicsScene::SwapDynamicConstantBuffers()
         UpdateGraphicsSceneConstantBuffersJobSpawner::Parameters& rParameters = pSpawnerJob->GetParameters();
         rParameters.sceneObjectCount = static_cast< uint32_t >( sceneObjectCount );
         rParameters.subMeshCount = static_cast< uint32_t >( subMeshCount );
-        rParameters.pSceneObjects = m_sceneObjects.GetData();
+        rParameters.pSceneObjects = rSceneObjects.GetData();
         rParameters.ppSceneObjectConstantBufferData = m_mappedObjectVertexGlobalDataBuffers.GetData();
-        rParameters.pSubMeshes = m_sceneObjectSubMeshes.GetData();
+        rParameters.pSubMeshes = rSubMeshes.GetData();
         rParameters.ppSubMeshConstantBufferData = m_mappedSubMeshVertexGlobalDataBuffers.GetData();
     }
 
-    // Unmap the constant buffers.
-    for( size_t objectIndex = 0; objectIndex < sceneObjectCount; ++objectIndex )
+    // Unmap the ring pages used this frame.
+    size_t mappedPageCount = m_mappedInstanceVertexGlobalDataPages.GetSize();
+    for( size_t pageIndex = 0; pageIndex < mappedPageCount; ++pageIndex )
     {
-        if( m_mappedObjectVertexGlobalDataBuffers[ objectIndex ] )
-        {
-            RConstantBuffer* pBuffer = m_objectVertexGlobalDataBuffers[ objectIndex ];
-            HELIUM_ASSERT( pBuffer );
-            pBuffer->Unmap();
-        }
+        rInstancePages[ pageIndex ]->Unmap();
     }
+}
 
-    for( size_t subMeshIndex = 0; subMeshIndex < subMeshCount; ++subMeshIndex )
+/// Get the instance vertex constant data range to bind when drawing a given sub-mesh.
+///
+/// @param[in]  subMeshIndex  Index of the sub-mesh being drawn.
+/// @param[out] rpBuffer      Instance data ring page containing the sub-mesh's constant data.
+/// @param[out] rOffset       Byte offset of the sub-mesh's constant data within the ring page.
+/// @param[out] rSize         Size of the sub-mesh's constant data, in bytes.
+///
+/// @return  True if instance data was assigned for the sub-mesh this frame, false if not.
+bool GraphicsScene::GetInstanceVertexGlobalData(
+    size_t subMeshIndex,
+    RConstantBuffer*& rpBuffer,
+    size_t& rOffset,
+    size_t& rSize ) const
+{
+    SparseArray< GraphicsSceneObject::SubMeshData >& rSubMeshes = *m_pRenderSceneObjectSubMeshes;
+
+    HELIUM_ASSERT( subMeshIndex < m_subMeshVertexGlobalDataBuffers.GetSize() );
+    rpBuffer = m_subMeshVertexGlobalDataBuffers[ subMeshIndex ];
+    if( rpBuffer )
     {
-        if( m_mappedSubMeshVertexGlobalDataBuffers[ subMeshIndex ] )
-        {
-            RConstantBuffer* pBuffer = m_subMeshVertexGlobalDataBuffers[ subMeshIndex ];
-            HELIUM_ASSERT( pBuffer );
-            pBuffer->Unmap();
-        }
+        rOffset = m_subMeshVertexGlobalDataOffsets[ subMeshIndex ];
+        rSize = SKINNED_INSTANCE_VERTEX_GLOBAL_DATA_SIZE;
+
+        return true;
+    }
+
+    size_t sceneObjectId = rSubMeshes[ subMeshIndex ].GetSceneObjectId();
+    HELIUM_ASSERT( sceneObjectId < m_objectVertexGlobalDataBuffers.GetSize() );
+    rpBuffer = m_objectVertexGlobalDataBuffers[ sceneObjectId ];
+    if( rpBuffer )
+    {
+        rOffset = m_objectVertexGlobalDataOffsets[ sceneObjectId ];
+        rSize = STATIC_INSTANCE_VERTEX_GLOBAL_DATA_SIZE;
+
+        return true;
     }
+
+    return false;
 }
 
 /// Render the specified scene view.
@@ -1135,9 +1283,13 @@ void GraphicsScene::SwapDynamicConstantBuffers()
 ///                       of the scene view sparse array).
 void GraphicsScene::DrawSceneView( uint_fast32_t viewIndex )
 {
-    HELIUM_ASSERT( viewIndex < m_sceneViews.GetSize() );
+    SparseArray< GraphicsSceneView >& rSceneViews = *m_pRenderSceneViews;
+    SparseArray< GraphicsSceneObject >& rSceneObjects = *m_pRenderSceneObjects;
+    SparseArray< GraphicsSceneObject::SubMeshData >& rSubMeshes = *m_pRenderSceneObjectSubMeshes;
+
+    HELIUM_ASSERT( viewIndex < rSceneViews.GetSize() );
 
-    if( !m_sceneViews.IsElementValid( viewIndex ) )
+    if( !rSceneViews.IsElementValid( viewIndex ) )
     {
         return;
     }
@@ -1149,7 +1301,7 @@ void GraphicsScene::DrawSceneView( uint_fast32_t viewIndex )
         return;
     }
 
-    GraphicsSceneView& rView = m_sceneViews[ viewIndex ];
+    GraphicsSceneView& rView = rSceneViews[ viewIndex ];
     RRenderContext* pRenderContext = rView.GetRenderContext();
     if( !pRenderContext )
     {
@@ -1161,16 +1313,49 @@ void GraphicsScene::DrawSceneView( uint_fast32_t viewIndex )
 
     const Simd::Frustum& rViewFrustum = rView.GetFrustum();
 
-    size_t sceneObjectCount = m_sceneObjects.GetSize();
+    // Levels of detail are selected using the bounding sphere diameter projected onto the view, as a fraction of the
+    // view width (the sphere radius divided by the half-width of the view at the sphere's distance).  The configured
+    // bias halves the projected size for each positive unit.  Orthographic views always use full detail.
+    float32_t lodSizeScale = 0.0f;
+    float32_t horizontalFov = rView.GetHorizontalFov();
+    if( horizontalFov >= HELIUM_EPSILON )
+    {
+        float32_t halfFovTangent = Tan( static_cast< float32_t >( HELIUM_DEG_TO_RAD ) * horizontalFov * 0.5f );
+        float32_t lodBias = RenderResourceManager::GetStaticInstance().GetLodBias();
+        lodSizeScale = 1.0f / ( Max( halfFovTangent, HELIUM_EPSILON ) * Pow( 2.0f, lodBias ) );
+    }
+
+    const Simd::Vector3& rViewOrigin = rView.GetOrigin();
+
+    size_t sceneObjectCount = rSceneObjects.GetSize();
+    HELIUM_ASSERT( sceneObjectCount <= m_sceneObjectLods.GetSize() );
     for( size_t sceneObjectIndex = 0; sceneObjectIndex < sceneObjectCount; ++sceneObjectIndex )
     {
-        if( m_sceneObjects.IsElementValid( sceneObjectIndex ) )
+        m_sceneObjectLods[ sceneObjectIndex ] = 0;
+
+        if( rSceneObjects.IsElementValid( sceneObjectIndex ) )
         {
-            //const AaBox& rObjectBounds = m_sceneObjects[ sceneObjectIndex ].GetWorldBox();
-            const Simd::Sphere& rObjectBounds = m_sceneObjects[ sceneObjectIndex ].GetWorldSphere();
+            const GraphicsSceneObject& rSceneObject = rSceneObjects[ sceneObjectIndex ];
+
+            //const AaBox& rObjectBounds = rSceneObject.GetWorldBox();
+            const Simd::Sphere& rObjectBounds = rSceneObject.GetWorldSphere();
             if( rViewFrustum.Intersects( rObjectBounds ) )
             {
                 m_visibleSceneObjects.SetElement( sceneObjectIndex );
+
+                if( lodSizeScale > 0.0f && rSceneObject.GetLodCount() > 1 )
+                {
+                    float32_t radius = rObjectBounds.GetRadius();
+                    float32_t distance = ( rObjectBounds.GetCenter() - rViewOrigin ).GetMagnitude();
+
+                    // Objects surrounding the camera are always drawn at full detail.
+                    if( distance > radius )
+                    {
+                        float32_t projectedSize = radius * lodSizeScale / distance;
+                        m_sceneObjectLods[ sceneObjectIndex ] =
+                            static_cast< uint8_t >( rSceneObject.SelectLod( projectedSize ) );
+                    }
+                }
             }
         }
     }
@@ -1178,12 +1363,12 @@ void GraphicsScene::DrawSceneView( uint_fast32_t viewIndex )
     // Build a list of indices for each visible sub-mesh for sorting.
     m_sceneObjectSubMeshIndices.Resize( 0 );
 
-    size_t subMeshCount = m_sceneObjectSubMeshes.GetSize();
+    size_t subMeshCount = rSubMeshes.GetSize();
     for( size_t subMeshIndex = 0; subMeshIndex < subMeshCount; ++subMeshIndex )
     {
-        if( m_sceneObjectSubMeshes.IsElementValid( subMeshIndex ) )
+        if( rSubMeshes.IsElementValid( subMeshIndex ) )
         {
-            size_t sceneObjectId = m_sceneObjectSubMeshes[ subMeshIndex ].GetSceneObjectId();
+            size_t sceneObjectId = rSubMeshes[ subMeshIndex ].GetSceneObjectId();
             HELIUM_ASSERT( sceneObjectId < m_visibleSceneObjects.GetSize() );
             if( m_visibleSceneObjects[ sceneObjectId ] )
             {
@@ -1251,9 +1436,9 @@ void GraphicsScene::DrawSceneView( uint_fast32_t viewIndex )
     const Simd::Matrix44& rInverseViewProjectionMatrix = rView.GetInverseViewProjectionMatrix();
     m_sceneBufferedDrawer.DrawWorldElements( rInverseViewProjectionMatrix );
 
-    if( viewIndex < m_viewBufferedDrawers.GetSize() )
+    if( viewIndex < m_renderViewBufferedDrawers.GetSize() )
     {
-        BufferedDrawer* pDrawer = m_viewBufferedDrawers[ viewIndex ];
+        BufferedDrawer* pDrawer = m_renderViewBufferedDrawers[ viewIndex ];
         if( pDrawer )
         {
             pDrawer->DrawWorldElements( rInverseViewProjectionMatrix );
@@ -1329,9 +1514,9 @@ void GraphicsScene::DrawSceneView( uint_fast32_t viewIndex )
 
         m_sceneBufferedDrawer.DrawScreenElements();
 
-        if( viewIndex < m_viewBufferedDrawers.GetSize() )
+        if( viewIndex < m_renderViewBufferedDrawers.GetSize() )
         {
-            BufferedDrawer* pDrawer = m_viewBufferedDrawers[ viewIndex ];
+            BufferedDrawer* pDrawer = m_renderViewBufferedDrawers[ viewIndex ];
             if( pDrawer )
             {
                 pDrawer->DrawScreenElements();
@@ -1358,8 +1543,13 @@ void GraphicsScene::DrawSceneView( uint_fast32_t viewIndex )
 /// @see DrawDepthPrePass(), DrawBasePass()
 void GraphicsScene::DrawShadowDepthPass( uint_fast32_t viewIndex )
 {
-    HELIUM_ASSERT( viewIndex < m_sceneViews.GetSize() );
-    HELIUM_ASSERT( m_sceneViews.IsElementValid( viewIndex ) );
+    HELIUM_PROFILE_FRAME_SCOPE( TXT( "GraphicsScene::DrawShadowDepthPass" ) );
+
+    SparseArray< GraphicsSceneObject >& rSceneObjects = *m_pRenderSceneObjects;
+    SparseArray< GraphicsSceneObject::SubMeshData >& rSubMeshes = *m_pRenderSceneObjectSubMeshes;
+
+    HELIUM_ASSERT( viewIndex < m_pRenderSceneViews->GetSize() );
+    HELIUM_ASSERT( m_pRenderSceneViews->IsElementValid( viewIndex ) );
 
     RenderResourceManager& rRenderResourceManager = RenderResourceManager::GetStaticInstance();
 
@@ -1448,10 +1638,9 @@ void GraphicsScene::DrawShadowDepthPass( uint_fast32_t viewIndex )
         rParameters.pBase = m_sceneObjectSubMeshIndices.GetData();
         rParameters.count = subMeshIndexCount;
         rParameters.compare = SubMeshFrontToBackCompare(
-            m_directionalLightDirection,
-            m_sceneObjects,
-            m_sceneObjectSubMeshes );
-        rParameters.singleJobCount = 100;
+            m_renderLighting.directionalLightDirection,
+            rSceneObjects,
+            rSubMeshes );
     }
 
     // Prepare the shadow depth pass scene for rendering.
@@ -1489,28 +1678,29 @@ void GraphicsScene::DrawShadowDepthPass( uint_fast32_t viewIndex )
     for( size_t meshIndexIndex = 0; meshIndexIndex < subMeshIndexCount; ++meshIndexIndex )
     {
         size_t meshIndex = m_sceneObjectSubMeshIndices[ meshIndexIndex ];
-        HELIUM_ASSERT( m_sceneObjectSubMeshes.IsElementValid( meshIndex ) );
+        HELIUM_ASSERT( rSubMeshes.IsElementValid( meshIndex ) );
 
-        GraphicsSceneObject::SubMeshData& rSubMeshData = m_sceneObjectSubMeshes[ meshIndex ];
+        GraphicsSceneObject::SubMeshData& rSubMeshData = rSubMeshes[ meshIndex ];
 
         size_t sceneObjectId = rSubMeshData.GetSceneObjectId();
         HELIUM_ASSERT( IsValid( sceneObjectId ) );
-        HELIUM_ASSERT( sceneObjectId < m_sceneObjects.GetSize() );
-        HELIUM_ASSERT( m_sceneObjects.IsElementValid( sceneObjectId ) );
-
-        HELIUM_ASSERT( meshIndex < m_subMeshVertexGlobalDataBuffers.GetSize() );
-        RConstantBuffer* pInstanceVertexGlobalDataBuffer = m_subMeshVertexGlobalDataBuffers[ meshIndex ];
-        if( !pInstanceVertexGlobalDataBuffer )
+        HELIUM_ASSERT( sceneObjectId < rSceneObjects.GetSize() );
+        HELIUM_ASSERT( rSceneObjects.IsElementValid( sceneObjectId ) );
+
+        RConstantBuffer* pInstanceVertexGlobalDataBuffer;
+        size_t instanceVertexGlobalDataOffset;
+        size_t instanceVertexGlobalDataSize;
+        if( !GetInstanceVertexGlobalData(
+            meshIndex,
+            pInstanceVertexGlobalDataBuffer,
+            instanceVertexGlobalDataOffset,
+            instanceVertexGlobalDataSize ) )
         {
-            HELIUM_ASSERT( sceneObjectId < m_objectVertexGlobalDataBuffers.GetSize() );
-            pInstanceVertexGlobalDataBuffer = m_objectVertexGlobalDataBuffers[ sceneObjectId ];
-            if( !pInstanceVertexGlobalDataBuffer )
-            {
-                continue;
-            }
+            continue;
         }
 
-        GraphicsSceneObject& rSceneObject = m_sceneObjects[ sceneObjectId ];
+        GraphicsSceneObject& rSceneObject = rSceneObjects[ sceneObjectId ];
+        size_t lodIndex = m_sceneObjectLods[ sceneObjectId ];
 
         RVertexBuffer* pVertexBuffer = rSceneObject.GetVertexBuffer();
         if( !pVertexBuffer )
@@ -1524,8 +1714,8 @@ void GraphicsScene::DrawShadowDepthPass( uint_fast32_t viewIndex )
             continue;
         }
 
-        RIndexBuffer* pIndexBuffer = rSceneObject.GetIndexBuffer();
-        if( !pIndexBuffer )
+        RIndexBuffer* pIndexBuffer = rSceneObject.GetIndexBuffer( lodIndex );
+        if( !pIndexBuffer || rSubMeshData.GetPrimitiveCount( lodIndex ) == 0 )
         {
             continue;
         }
@@ -1551,10 +1741,10 @@ void GraphicsScene::DrawShadowDepthPass( uint_fast32_t viewIndex )
         uint32_t offset = 0;
 
         ERendererPrimitiveType primitiveType = rSubMeshData.GetPrimitiveType();
-        uint32_t primitiveCount = rSubMeshData.GetPrimitiveCount();
+        uint32_t primitiveCount = rSubMeshData.GetPrimitiveCount( lodIndex );
         uint32_t startVertex = rSubMeshData.GetStartVertex();
         uint32_t vertexRange = rSubMeshData.GetVertexRange();
-        uint32_t startIndex = rSubMeshData.GetStartIndex();
+        uint32_t startIndex = rSubMeshData.GetStartIndex( lodIndex );
 
         if( pPreviousVertexShader != pVertexShader )
         {
@@ -1562,7 +1752,12 @@ void GraphicsScene::DrawShadowDepthPass( uint_fast32_t viewIndex )
             pPreviousVertexShader = pVertexShader;
         }
 
-        spCommandProxy->SetVertexConstantBuffers( 1, 1, &pInstanceVertexGlobalDataBuffer );
+        spCommandProxy->SetVertexConstantBuffers(
+            1,
+            1,
+            &pInstanceVertexGlobalDataBuffer,
+            &instanceVertexGlobalDataSize,
+            &instanceVertexGlobalDataOffset );
         spCommandProxy->SetVertexBuffers( 0, 1, &pVertexBuffer, &vertexStride, &offset );
         spCommandProxy->SetIndexBuffer( pIndexBuffer );
         spCommandProxy->SetVertexInputLayout( pInputLayout );
@@ -1592,8 +1787,14 @@ void GraphicsScene::DrawShadowDepthPass( uint_fast32_t viewIndex )
 /// @see DrawShadowDepthPass(), DrawBasePass()
 void GraphicsScene::DrawDepthPrePass( uint_fast32_t viewIndex )
 {
-    HELIUM_ASSERT( viewIndex < m_sceneViews.GetSize() );
-    HELIUM_ASSERT( m_sceneViews.IsElementValid( viewIndex ) );
+    HELIUM_PROFILE_FRAME_SCOPE( TXT( "GraphicsScene::DrawDepthPrePass" ) );
+
+    SparseArray< GraphicsSceneView >& rSceneViews = *m_pRenderSceneViews;
+    SparseArray< GraphicsSceneObject >& rSceneObjects = *m_pRenderSceneObjects;
+    SparseArray< GraphicsSceneObject::SubMeshData >& rSubMeshes = *m_pRenderSceneObjectSubMeshes;
+
+    HELIUM_ASSERT( viewIndex < rSceneViews.GetSize() );
+    HELIUM_ASSERT( rSceneViews.IsElementValid( viewIndex ) );
 
     // Make sure the pre-pass vertex shader resources exist.
     RenderResourceManager& rRenderResourceManager = RenderResourceManager::GetStaticInstance();
@@ -1641,7 +1842,7 @@ void GraphicsScene::DrawDepthPrePass( uint_fast32_t viewIndex )
     RVertexShader* pPrePassSmoothSkinningVertexShader = static_cast< RVertexShader* >( pPrePassShaderResource );
 
     // Sort meshes based on distance from front to back in order to reduce overdraw.
-    GraphicsSceneView& rView = m_sceneViews[ viewIndex ];
+    GraphicsSceneView& rView = rSceneViews[ viewIndex ];
     const Simd::Vector3& rViewDirection = rView.GetForward();
 
     size_t subMeshIndexCount = m_sceneObjectSubMeshIndices.GetSize();
@@ -1658,8 +1859,7 @@ void GraphicsScene::DrawDepthPrePass( uint_fast32_t viewIndex )
         SortJob< size_t, SubMeshFrontToBackCompare >::Parameters& rParameters = pJob->GetParameters();
         rParameters.pBase = m_sceneObjectSubMeshIndices.GetData();
         rParameters.count = subMeshIndexCount;
-        rParameters.compare = SubMeshFrontToBackCompare( rViewDirection, m_sceneObjects, m_sceneObjectSubMeshes );
-        rParameters.singleJobCount = 100;
+        rParameters.compare = SubMeshFrontToBackCompare( rViewDirection, rSceneObjects, rSubMeshes );
     }
 
     // Initialize the blend state and shaders for performing no color writes.
@@ -1681,28 +1881,29 @@ void GraphicsScene::DrawDepthPrePass( uint_fast32_t viewIndex )
     for( size_t meshIndexIndex = 0; meshIndexIndex < subMeshIndexCount; ++meshIndexIndex )
     {
         size_t meshIndex = m_sceneObjectSubMeshIndices[ meshIndexIndex ];
-        HELIUM_ASSERT( m_sceneObjectSubMeshes.IsElementValid( meshIndex ) );
+        HELIUM_ASSERT( rSubMeshes.IsElementValid( meshIndex ) );
 
-        GraphicsSceneObject::SubMeshData& rSubMeshData = m_sceneObjectSubMeshes[ meshIndex ];
+        GraphicsSceneObject::SubMeshData& rSubMeshData = rSubMeshes[ meshIndex ];
 
         size_t sceneObjectId = rSubMeshData.GetSceneObjectId();
         HELIUM_ASSERT( IsValid( sceneObjectId ) );
-        HELIUM_ASSERT( sceneObjectId < m_sceneObjects.GetSize() );
-        HELIUM_ASSERT( m_sceneObjects.IsElementValid( sceneObjectId ) );
-
-        HELIUM_ASSERT( meshIndex < m_subMeshVertexGlobalDataBuffers.GetSize() );
-        RConstantBuffer* pInstanceVertexGlobalDataBuffer = m_subMeshVertexGlobalDataBuffers[ meshIndex ];
-        if( !pInstanceVertexGlobalDataBuffer )
+        HELIUM_ASSERT( sceneObjectId < rSceneObjects.GetSize() );
+        HELIUM_ASSERT( rSceneObjects.IsElementValid( sceneObjectId ) );
+
+        RConstantBuffer* pInstanceVertexGlobalDataBuffer;
+        size_t instanceVertexGlobalDataOffset;
+        size_t instanceVertexGlobalDataSize;
+        if( !GetInstanceVertexGlobalData(
+            meshIndex,
+            pInstanceVertexGlobalDataBuffer,
+            instanceVertexGlobalDataOffset,
+            instanceVertexGlobalDataSize ) )
         {
-            HELIUM_ASSERT( sceneObjectId < m_objectVertexGlobalDataBuffers.GetSize() );
-            pInstanceVertexGlobalDataBuffer = m_objectVertexGlobalDataBuffers[ sceneObjectId ];
-            if( !pInstanceVertexGlobalDataBuffer )
-            {
-                continue;
-            }
+            continue;
         }
 
-        GraphicsSceneObject& rSceneObject = m_sceneObjects[ sceneObjectId ];
+        GraphicsSceneObject& rSceneObject = rSceneObjects[ sceneObjectId ];
+        size_t lodIndex = m_sceneObjectLods[ sceneObjectId ];
 
         RVertexBuffer* pVertexBuffer = rSceneObject.GetVertexBuffer();
         if( !pVertexBuffer )
@@ -1716,8 +1917,8 @@ void GraphicsScene::DrawDepthPrePass( uint_fast32_t viewIndex )
             continue;
         }
 
-        RIndexBuffer* pIndexBuffer = rSceneObject.GetIndexBuffer();
-        if( !pIndexBuffer )
+        RIndexBuffer* pIndexBuffer = rSceneObject.GetIndexBuffer( lodIndex );
+        if( !pIndexBuffer || rSubMeshData.GetPrimitiveCount( lodIndex ) == 0 )
         {
             continue;
         }
@@ -1743,10 +1944,10 @@ void GraphicsScene::DrawDepthPrePass( uint_fast32_t viewIndex )
         uint32_t offset = 0;
 
         ERendererPrimitiveType primitiveType = rSubMeshData.GetPrimitiveType();
-        uint32_t primitiveCount = rSubMeshData.GetPrimitiveCount();
+        uint32_t primitiveCount = rSubMeshData.GetPrimitiveCount( lodIndex );
         uint32_t startVertex = rSubMeshData.GetStartVertex();
         uint32_t vertexRange = rSubMeshData.GetVertexRange();
-        uint32_t startIndex = rSubMeshData.GetStartIndex();
+        uint32_t startIndex = rSubMeshData.GetStartIndex( lodIndex );
 
         if( pPreviousVertexShader != pVertexShader )
         {
@@ -1754,7 +1955,12 @@ void GraphicsScene::DrawDepthPrePass( uint_fast32_t viewIndex )
             pPreviousVertexShader = pVertexShader;
         }
 
-        spCommandProxy->SetVertexConstantBuffers( 1, 1, &pInstanceVertexGlobalDataBuffer );
+        spCommandProxy->SetVertexConstantBuffers(
+            1,
+            1,
+            &pInstanceVertexGlobalDataBuffer,
+            &instanceVertexGlobalDataSize,
+            &instanceVertexGlobalDataOffset );
         spCommandProxy->SetVertexBuffers( 0, 1, &pVertexBuffer, &vertexStride, &offset );
         spCommandProxy->SetIndexBuffer( pIndexBuffer );
         spCommandProxy->SetVertexInputLayout( pInputLayout );
@@ -1784,8 +1990,13 @@ void GraphicsScene::DrawDepthPrePass( uint_fast32_t viewIndex )
 /// @see DrawShadowDepthPass(), DrawDepthPrePass()
 void GraphicsScene::DrawBasePass( uint_fast32_t viewIndex )
 {
-    HELIUM_ASSERT( viewIndex < m_sceneViews.GetSize() );
-    HELIUM_ASSERT( m_sceneViews.IsElementValid( viewIndex ) );
+    HELIUM_PROFILE_FRAME_SCOPE( TXT( "GraphicsScene::DrawBasePass" ) );
+
+    SparseArray< GraphicsSceneObject >& rSceneObjects = *m_pRenderSceneObjects;
+    SparseArray< GraphicsSceneObject::SubMeshData >& rSubMeshes = *m_pRenderSceneObjectSubMeshes;
+
+    HELIUM_ASSERT( viewIndex < m_pRenderSceneViews->GetSize() );
+    HELIUM_ASSERT( m_pRenderSceneViews->IsElementValid( viewIndex ) );
 
     // Make sure per-view constant buffers for the base pass exist.
     RConstantBuffer* pViewVertexBasePassDataBuffer =
@@ -1845,8 +2056,7 @@ void GraphicsScene::DrawBasePass( uint_fast32_t viewIndex )
         SortJob< size_t, SubMeshMaterialCompare >::Parameters& rParameters = pJob->GetParameters();
         rParameters.pBase = m_sceneObjectSubMeshIndices.GetData();
         rParameters.count = subMeshIndexCount;
-        rParameters.compare = SubMeshMaterialCompare( m_sceneObjectSubMeshes );
-        rParameters.singleJobCount = 100;
+        rParameters.compare = SubMeshMaterialCompare( rSubMeshes );
     }
 
     // Set the opaque rendering blend state and per-view constant buffers for this pass.
@@ -1885,28 +2095,29 @@ void GraphicsScene::DrawBasePass( uint_fast32_t viewIndex )
     for( size_t meshIndexIndex = 0; meshIndexIndex < subMeshIndexCount; ++meshIndexIndex )
     {
         size_t meshIndex = m_sceneObjectSubMeshIndices[ meshIndexIndex ];
-        HELIUM_ASSERT( m_sceneObjectSubMeshes.IsElementValid( meshIndex ) );
+        HELIUM_ASSERT( rSubMeshes.IsElementValid( meshIndex ) );
 
-        GraphicsSceneObject::SubMeshData& rSubMeshData = m_sceneObjectSubMeshes[ meshIndex ];
+        GraphicsSceneObject::SubMeshData& rSubMeshData = rSubMeshes[ meshIndex ];
 
         size_t sceneObjectId = rSubMeshData.GetSceneObjectId();
         HELIUM_ASSERT( IsValid( sceneObjectId ) );
-        HELIUM_ASSERT( sceneObjectId < m_sceneObjects.GetSize() );
-        HELIUM_ASSERT( m_sceneObjects.IsElementValid( sceneObjectId ) );
-
-        HELIUM_ASSERT( meshIndex < m_subMeshVertexGlobalDataBuffers.GetSize() );
-        RConstantBuffer* pInstanceVertexGlobalDataBuffer = m_subMeshVertexGlobalDataBuffers[ meshIndex ];
-        if( !pInstanceVertexGlobalDataBuffer )
+        HELIUM_ASSERT( sceneObjectId < rSceneObjects.GetSize() );
+        HELIUM_ASSERT( rSceneObjects.IsElementValid( sceneObjectId ) );
+
+        RConstantBuffer* pInstanceVertexGlobalDataBuffer;
+        size_t instanceVertexGlobalDataOffset;
+        size_t instanceVertexGlobalDataSize;
+        if( !GetInstanceVertexGlobalData(
+            meshIndex,
+            pInstanceVertexGlobalDataBuffer,
+            instanceVertexGlobalDataOffset,
+            instanceVertexGlobalDataSize ) )
         {
-            HELIUM_ASSERT( sceneObjectId < m_objectVertexGlobalDataBuffers.GetSize() );
-            pInstanceVertexGlobalDataBuffer = m_objectVertexGlobalDataBuffers[ sceneObjectId ];
-            if( !pInstanceVertexGlobalDataBuffer )
-            {
-                continue;
-            }
+            continue;
         }
 
-        GraphicsSceneObject& rSceneObject = m_sceneObjects[ sceneObjectId ];
+        GraphicsSceneObject& rSceneObject = rSceneObjects[ sceneObjectId ];
+        size_t lodIndex = m_sceneObjectLods[ sceneObjectId ];
 
         RVertexBuffer* pVertexBuffer = rSceneObject.GetVertexBuffer();
         if( !pVertexBuffer )
@@ -1920,8 +2131,8 @@ void GraphicsScene::DrawBasePass( uint_fast32_t viewIndex )
             continue;
         }
 
-        RIndexBuffer* pIndexBuffer = rSceneObject.GetIndexBuffer();
-        if( !pIndexBuffer )
+        RIndexBuffer* pIndexBuffer = rSceneObject.GetIndexBuffer( lodIndex );
+        if( !pIndexBuffer || rSubMeshData.GetPrimitiveCount( lodIndex ) == 0 )
         {
             continue;
         }
@@ -2003,12 +2214,17 @@ void GraphicsScene::DrawBasePass( uint_fast32_t viewIndex )
         uint32_t offset = 0;
 
         ERendererPrimitiveType primitiveType = rSubMeshData.GetPrimitiveType();
-        uint32_t primitiveCount = rSubMeshData.GetPrimitiveCount();
+        uint32_t primitiveCount = rSubMeshData.GetPrimitiveCount( lodIndex );
         uint32_t startVertex = rSubMeshData.GetStartVertex();
         uint32_t vertexRange = rSubMeshData.GetVertexRange();
-        uint32_t startIndex = rSubMeshData.GetStartIndex();
-
-        spCommandProxy->SetVertexConstantBuffers( 2, 1, &pInstanceVertexGlobalDataBuffer );
+        uint32_t startIndex = rSubMeshData.GetStartIndex( lodIndex );
+
+        spCommandProxy->SetVertexConstantBuffers(
+            2,
+            1,
+            &pInstanceVertexGlobalDataBuffer,
+            &instanceVertexGlobalDataSize,
+            &instanceVertexGlobalDataOffset );
 
         if( pMaterialVertexConstantBuffer != pPreviousMaterialVertexConstantBuffer )
         {
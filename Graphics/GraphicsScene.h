@@ -17,6 +17,7 @@
 namespace Helium
 {
     HELIUM_DECLARE_RPTR( RConstantBuffer );
+    HELIUM_DECLARE_RPTR( RFence );
 
     class HELIUM_GRAPHICS_API SceneObjectTransform : public Helium::Component
     {
@@ -40,6 +41,9 @@ namespace Helium
         /// @name Updating
         //@{
         virtual void Update( World *pWorld );
+
+        void Synchronize( World *pWorld );
+        void Render();
         //@}
 
         /// @name Scene View Management
@@ -142,6 +146,26 @@ namespace Helium
             const SparseArray< GraphicsSceneObject::SubMeshData >* m_pSubMeshes;
         };
 
+        /// Lighting state handed over for rendering.
+        struct RenderLighting
+        {
+            /// Ambient light top color.
+            Color ambientLightTopColor;
+            /// Ambient light top brightness.
+            float32_t ambientLightTopBrightness;
+            /// Ambient light bottom color.
+            Color ambientLightBottomColor;
+            /// Ambient light bottom brightness.
+            float32_t ambientLightBottomBrightness;
+
+            /// Directional light direction.
+            Simd::Vector3 directionalLightDirection;
+            /// Directional light color.
+            Color directionalLightColor;
+            /// Directional light brightness.
+            float32_t directionalLightBrightness;
+        };
+
         /// Scene view list.
         SparseArray< GraphicsSceneView > m_sceneViews;
         /// Scene object list.
@@ -156,10 +180,14 @@ namespace Helium
         ObjectPool< BufferedDrawer > m_viewBufferedDrawerPool;
         /// Buffered drawing objects for each scene view.
         DynamicArray< BufferedDrawer* > m_viewBufferedDrawers;
+        /// Buffered drawing objects for each scene view as of the last Synchronize() call.
+        DynamicArray< BufferedDrawer* > m_renderViewBufferedDrawers;
 #endif // GRAPHICS_SCENE_BUFFERED_DRAWER
 
         /// Visible scene objects for the current view.
         BitArray<> m_visibleSceneObjects;
+        /// Level of detail selected for each scene object in the current view.
+        DynamicArray< uint8_t > m_sceneObjectLods;
         /// Scene object sub-data index list (for sorting during rendering).
         DynamicArray< size_t > m_sceneObjectSubMeshIndices;
 
@@ -182,6 +210,24 @@ namespace Helium
         /// ID of the currently active scene view.
         uint32_t m_activeViewId;
 
+        /// Copy of the scene view list being rendered (if rendering is pipelined).
+        SparseArray< GraphicsSceneView > m_renderSceneViews;
+        /// Copy of the scene object list being rendered (if rendering is pipelined).
+        SparseArray< GraphicsSceneObject > m_renderSceneObjects;
+        /// Copy of the scene object sub-data list being rendered (if rendering is pipelined).
+        SparseArray< GraphicsSceneObject::SubMeshData > m_renderSceneObjectSubMeshes;
+        /// Copy of the bone palettes of the scene objects being rendered (if rendering is pipelined).
+        DynamicArray< Simd::Matrix44 > m_renderBonePalettes;
+
+        /// Scene view list to render (either the live list or its copy).
+        SparseArray< GraphicsSceneView >* m_pRenderSceneViews;
+        /// Scene object list to render (either the live list or its copy).
+        SparseArray< GraphicsSceneObject >* m_pRenderSceneObjects;
+        /// Scene object sub-data list to render (either the live list or its copy).
+        SparseArray< GraphicsSceneObject::SubMeshData >* m_pRenderSceneObjectSubMeshes;
+        /// Lighting to render.
+        RenderLighting m_renderLighting;
+
         /// Pre-computed shadow depth pass inverse view/projection matrices.
         DynamicArray< Simd::Matrix44 > m_shadowViewInverseViewProjectionMatrices;
 
@@ -198,30 +244,43 @@ namespace Helium
         /// Per-view vertex constant buffers for shadow depth rendering.
         DynamicArray< RConstantBufferPtr > m_shadowViewVertexDataBuffers[ 2 ];
 
-        /// Pool of per-instance vertex constant buffers for non-skinned meshes.
-        DynamicArray< RConstantBufferPtr > m_staticInstanceVertexGlobalDataBufferPool[ 2 ];
-        /// Pool of per-instance vertex constant buffers for skinned meshes.
-        DynamicArray< RConstantBufferPtr > m_skinnedInstanceVertexGlobalDataBufferPool[ 2 ];
+        /// Pages of the per-frame instance vertex constant data upload ring.
+        DynamicArray< RConstantBufferPtr > m_instanceVertexGlobalDataPages[ 2 ];
+        /// Fences guarding reuse of each set of instance data ring pages.
+        RFencePtr m_instanceVertexGlobalDataFences[ 2 ];
+        /// Mapped addresses of the instance data ring pages in use for the current frame.
+        DynamicArray< float32_t* > m_mappedInstanceVertexGlobalDataPages;
 
-        /// Scene object global vertex constant buffers.
+        /// Scene object global vertex constant data ring pages.
         DynamicArray< RConstantBuffer* > m_objectVertexGlobalDataBuffers;
-        /// Mapped scene object global vertex constant buffer addresses.
+        /// Byte offsets of scene object global vertex constant data within their ring pages.
+        DynamicArray< size_t > m_objectVertexGlobalDataOffsets;
+        /// Mapped scene object global vertex constant data addresses.
         DynamicArray< float32_t* > m_mappedObjectVertexGlobalDataBuffers;
 
-        /// Sub-mesh global vertex constant buffers.
+        /// Sub-mesh global vertex constant data ring pages.
         DynamicArray< RConstantBuffer* > m_subMeshVertexGlobalDataBuffers;
-        /// Mapped sub-mesh global veretex constant buffer addresses.
+        /// Byte offsets of sub-mesh global vertex constant data within their ring pages.
+        DynamicArray< size_t > m_subMeshVertexGlobalDataOffsets;
+        /// Mapped sub-mesh global vertex constant data addresses.
         DynamicArray< float32_t* > m_mappedSubMeshVertexGlobalDataBuffers;
 
         /// Current dynamic constant buffer set index.
         size_t m_constantBufferSetIndex;
 
+        /// @name Synchronization
+        //@{
+        void CopyRenderBonePalettes();
+        //@}
+
         /// @name Rendering
         //@{
         void UpdateShadowInverseViewProjectionMatrixSimple( size_t viewIndex );
         void UpdateShadowInverseViewProjectionMatrixLspsm( size_t viewIndex );
 
         void SwapDynamicConstantBuffers();
+        bool GetInstanceVertexGlobalData(
+            size_t subMeshIndex, RConstantBuffer*& rpBuffer, size_t& rOffset, size_t& rSize ) const;
 
         void DrawSceneView( uint_fast32_t viewIndex );
 
@@ -32,6 +32,7 @@ Mesh::~Mesh()
     HELIUM_ASSERT( !m_spIndexBuffer );
     HELIUM_ASSERT( IsInvalid( m_vertexBufferLoadId ) );
     HELIUM_ASSERT( IsInvalid( m_indexBufferLoadId ) );
+    HELIUM_ASSERT( m_lodIndexBuffers.IsEmpty() );
 }
 
 /// @copydoc Asset::PreDestroy()
@@ -43,6 +44,15 @@ void Mesh::PreDestroy()
     m_spVertexBuffer.Release();
     m_spIndexBuffer.Release();
 
+    size_t lodCount = m_lodIndexBufferLoadIds.GetSize();
+    for( size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex )
+    {
+        HELIUM_ASSERT( IsInvalid( m_lodIndexBufferLoadIds[ lodIndex ] ) );
+    }
+
+    m_lodIndexBuffers.Clear();
+    m_lodIndexBufferLoadIds.Clear();
+
     Base::PreDestroy();
 }
 
@@ -126,65 +136,149 @@ bool Mesh::BeginPrecacheResourceData()
 
     if( m_persistentResourceData.m_triangleCount != 0 )
     {
-        size_t indexDataSize = GetSubDataSize( 1 );
-        if( IsInvalid( indexDataSize ) )
+        BeginLoadIndexBuffer(
+            pRenderer,
+            1,
+            m_persistentResourceData.m_triangleCount,
+            m_spIndexBuffer,
+            m_indexBufferLoadId );
+    }
+
+    // Additional levels of detail each have their own index buffer, addressing the same vertices.
+    size_t lodCount = m_persistentResourceData.m_lodScreenSizes.GetSize();
+    size_t sectionCount = m_persistentResourceData.m_sectionTriangleCounts.GetSize();
+    if( m_persistentResourceData.m_lodSectionTriangleCounts.GetSize() != lodCount * sectionCount )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Error,
+            TXT( "Mesh::BeginPrecacheResourceData(): Level of detail data for mesh \"%s\" is inconsistent.\n" ),
+            *GetPath().ToString() );
+
+        lodCount = 0;
+    }
+
+    m_lodIndexBuffers.Resize( lodCount );
+    m_lodIndexBufferLoadIds.Resize( lodCount );
+    for( size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex )
+    {
+        SetInvalid( m_lodIndexBufferLoadIds[ lodIndex ] );
+
+        uint32_t lodTriangleCount = 0;
+        for( size_t sectionIndex = 0; sectionIndex < sectionCount; ++sectionIndex )
         {
-            HELIUM_TRACE(
-                TraceLevels::Error,
-                ( TXT( "Mesh::BeginPrecacheResourceData(): Failed to locate cached index buffer data for mesh " )
-                TXT( "\"%s\".\n" ) ),
-                *GetPath().ToString() );
+            lodTriangleCount += GetSectionTriangleCount( sectionIndex, lodIndex + 1 );
         }
-        else
-        {
-            m_spIndexBuffer = pRenderer->CreateIndexBuffer(
-                indexDataSize,
-                RENDERER_BUFFER_USAGE_STATIC,
-                RENDERER_INDEX_FORMAT_UINT16 );
-            if( !m_spIndexBuffer )
-            {
-                HELIUM_TRACE(
-                    TraceLevels::Error,
-                    ( TXT( "Mesh::BeginPrecacheResourceData(): Failed to create an index buffer of %" ) PRIuSZ
-                    TXT( " bytes for mesh \"%s\".\n" ) ),
-                    indexDataSize,
-                    *GetPath().ToString() );
-            }
-            else
-            {
-                void* pData = m_spIndexBuffer->Map();
-                if( !pData )
-                {
-                    HELIUM_TRACE(
-                        TraceLevels::Error,
-                        ( TXT( "Mesh::BeginPrecacheResourceData(): Failed to map index buffer for loading for " )
-                        TXT( "mesh \"%s\".\n" ) ),
-                        *GetPath().ToString() );
-
-                    m_spIndexBuffer.Release();
-                }
-                else
-                {
-                    m_indexBufferLoadId = BeginLoadSubData( pData, 1 );
-                    if( IsInvalid( m_indexBufferLoadId ) )
-                    {
-                        HELIUM_TRACE(
-                            TraceLevels::Error,
-                            ( TXT( "Mesh::BeginPrecacheResourceData(): Failed to queue async load request for " )
-                            TXT( "index buffer data for mesh \"%s\".\n" ) ),
-                            *GetPath().ToString() );
 
-                        m_spIndexBuffer->Unmap();
-                        m_spIndexBuffer.Release();
-                    }
-                }
-            }
+        if( lodTriangleCount != 0 )
+        {
+            BeginLoadIndexBuffer(
+                pRenderer,
+                static_cast< uint32_t >( 2 + lodIndex ),
+                lodTriangleCount,
+                m_lodIndexBuffers[ lodIndex ],
+                m_lodIndexBufferLoadIds[ lodIndex ] );
         }
     }
 
     return true;
 }
 
+/// Create an index buffer and queue the asynchronous load of its cached data.
+///
+/// @param[in]  pRenderer       Renderer used to create the buffer.
+/// @param[in]  subDataIndex    Index of the cached sub-data holding the indices.
+/// @param[in]  triangleCount   Number of triangles expected in the cached data.
+/// @param[out] rspIndexBuffer  Index buffer (released if creation or loading fails).
+/// @param[out] rLoadId         Asynchronous load ID (invalid if creation or loading fails).
+void Mesh::BeginLoadIndexBuffer(
+    Renderer* pRenderer,
+    uint32_t subDataIndex,
+    uint32_t triangleCount,
+    RIndexBufferPtr& rspIndexBuffer,
+    size_t& rLoadId )
+{
+    HELIUM_ASSERT( pRenderer );
+    HELIUM_ASSERT( IsInvalid( rLoadId ) );
+
+    // The cache stores 16-bit indices unless a mesh section addresses more vertices than they can reach.
+    ERendererIndexFormat indexFormat = RENDERER_INDEX_FORMAT_UINT16;
+    size_t indexSize = sizeof( uint16_t );
+    if( m_persistentResourceData.m_b32BitIndices )
+    {
+        indexFormat = RENDERER_INDEX_FORMAT_UINT32;
+        indexSize = sizeof( uint32_t );
+    }
+
+    size_t indexDataSize = GetSubDataSize( subDataIndex );
+    if( IsInvalid( indexDataSize ) )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Error,
+            ( TXT( "Mesh::BeginPrecacheResourceData(): Failed to locate cached index buffer data (sub-data %" )
+            PRIu32 TXT( ") for mesh \"%s\".\n" ) ),
+            subDataIndex,
+            *GetPath().ToString() );
+
+        return;
+    }
+
+    if( indexDataSize != static_cast< size_t >( triangleCount ) * 3 * indexSize )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Error,
+            ( TXT( "Mesh::BeginPrecacheResourceData(): Cached index buffer data (sub-data %" ) PRIu32
+            TXT( ") for mesh \"%s\" is %" ) PRIuSZ TXT( " bytes, which does not match %" ) PRIu32
+            TXT( " triangles of %" ) PRIuSZ TXT( "-byte indices.\n" ) ),
+            subDataIndex,
+            *GetPath().ToString(),
+            indexDataSize,
+            triangleCount,
+            indexSize );
+
+        return;
+    }
+
+    rspIndexBuffer = pRenderer->CreateIndexBuffer( indexDataSize, RENDERER_BUFFER_USAGE_STATIC, indexFormat );
+    if( !rspIndexBuffer )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Error,
+            ( TXT( "Mesh::BeginPrecacheResourceData(): Failed to create an index buffer of %" ) PRIuSZ
+            TXT( " bytes for mesh \"%s\".\n" ) ),
+            indexDataSize,
+            *GetPath().ToString() );
+
+        return;
+    }
+
+    void* pData = rspIndexBuffer->Map();
+    if( !pData )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Error,
+            ( TXT( "Mesh::BeginPrecacheResourceData(): Failed to map index buffer for loading for " )
+            TXT( "mesh \"%s\".\n" ) ),
+            *GetPath().ToString() );
+
+        rspIndexBuffer.Release();
+
+        return;
+    }
+
+    rLoadId = BeginLoadSubData( pData, subDataIndex );
+    if( IsInvalid( rLoadId ) )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Error,
+            ( TXT( "Mesh::BeginPrecacheResourceData(): Failed to queue async load request for " )
+            TXT( "index buffer data for mesh \"%s\".\n" ) ),
+            *GetPath().ToString() );
+
+        rspIndexBuffer->Unmap();
+        rspIndexBuffer.Release();
+    }
+}
+
 /// @copydoc Asset::TryFinishPrecacheResourceData()
 bool Mesh::TryFinishPrecacheResourceData()
 {
@@ -214,12 +308,31 @@ bool Mesh::TryFinishPrecacheResourceData()
         m_spIndexBuffer->Unmap();
     }
 
+    size_t lodCount = m_lodIndexBufferLoadIds.GetSize();
+    for( size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex )
+    {
+        size_t& rLoadId = m_lodIndexBufferLoadIds[ lodIndex ];
+        if( IsValid( rLoadId ) )
+        {
+            if( !TryFinishLoadSubData( rLoadId ) )
+            {
+                return false;
+            }
+
+            SetInvalid( rLoadId );
+
+            HELIUM_ASSERT( m_lodIndexBuffers[ lodIndex ] );
+            m_lodIndexBuffers[ lodIndex ]->Unmap();
+        }
+    }
+
     return true;
 }
 
 Mesh::PersistentResourceData::PersistentResourceData()
 : m_vertexCount( 0 )
 , m_triangleCount( 0 )
+, m_b32BitIndices( false )
 #if !HELIUM_USE_GRANNY_ANIMATION
 , m_boneCount( 0 )
 #endif
@@ -234,6 +347,9 @@ void Mesh::PersistentResourceData::PopulateMetaType( Reflect::MetaStruct& comp )
     comp.AddField( &PersistentResourceData::m_skinningPaletteMap,       TXT( "m_skinningPaletteMap" ) );
     comp.AddField( &PersistentResourceData::m_vertexCount,              TXT( "m_vertexCount" ) );
     comp.AddField( &PersistentResourceData::m_triangleCount,            TXT( "m_triangleCount" ) );
+    comp.AddField( &PersistentResourceData::m_b32BitIndices,            TXT( "m_b32BitIndices" ) );
+    comp.AddField( &PersistentResourceData::m_lodScreenSizes,           TXT( "m_lodScreenSizes" ) );
+    comp.AddField( &PersistentResourceData::m_lodSectionTriangleCounts, TXT( "m_lodSectionTriangleCounts" ) );
     comp.AddField( &PersistentResourceData::m_bounds,                   TXT( "m_bounds" ) );
 #if !HELIUM_USE_GRANNY_ANIMATION
     comp.AddField( &PersistentResourceData::m_boneCount,                TXT( "m_boneCount" ) );
@@ -247,6 +363,8 @@ bool Helium::Mesh::LoadPersistentResourceObject( Reflect::ObjectPtr &_object )
 {    
     m_spVertexBuffer.Release();
     m_spIndexBuffer.Release();
+    m_lodIndexBuffers.Clear();
+    m_lodIndexBufferLoadIds.Clear();
 
     HELIUM_ASSERT(_object.ReferencesObject());
     if (!_object.ReferencesObject())
@@ -25,6 +25,8 @@ namespace Helium
     HELIUM_DECLARE_RPTR( RVertexBuffer );
     HELIUM_DECLARE_RPTR( RIndexBuffer );
 
+    class Renderer;
+
     class Material;
     typedef Helium::StrongPtr< Material > MaterialPtr;
     typedef Helium::StrongPtr< const Material > ConstMaterialPtr;
@@ -45,9 +47,15 @@ namespace Helium
             static void PopulateMetaType( Reflect::MetaStruct& comp );
             
             /// Number of vertices used by each mesh section.
-            DynamicArray< uint16_t > m_sectionVertexCounts;
+            DynamicArray< uint32_t > m_sectionVertexCounts;
             /// Number of triangles in each mesh section.
             DynamicArray< uint32_t > m_sectionTriangleCounts;
+            /// Number of triangles in each mesh section for each additional level of detail (all sections of the first
+            /// additional level, followed by all sections of the next, and so on).
+            DynamicArray< uint32_t > m_lodSectionTriangleCounts;
+            /// Projected size (bounding sphere diameter as a fraction of the view width) below which each additional
+            /// level of detail is used, from the most to the least detailed.
+            DynamicArray< float32_t > m_lodScreenSizes;
             /// Skinning palette map (split by mesh section).
             DynamicArray< uint8_t > m_skinningPaletteMap;
         
@@ -55,6 +63,8 @@ namespace Helium
             uint32_t m_vertexCount;
             /// Triangle count.
             uint32_t m_triangleCount;
+            /// True if the cached index buffer holds 32-bit indices, false if it holds 16-bit indices.
+            bool m_b32BitIndices;
         
             /// Mesh bounds.
             Simd::AaBox m_bounds;
@@ -109,7 +119,7 @@ namespace Helium
         //@{
         inline size_t GetSectionCount() const;
         inline uint32_t GetSectionVertexCount( size_t sectionIndex ) const;
-        inline uint32_t GetSectionTriangleCount( size_t sectionIndex ) const;
+        inline uint32_t GetSectionTriangleCount( size_t sectionIndex, size_t lodIndex = 0 ) const;
         const uint8_t* GetSectionSkinningPaletteMap( size_t sectionIndex ) const;
 
         inline bool IsSkinned() const;
@@ -127,11 +137,15 @@ namespace Helium
 
         inline uint32_t GetVertexCount() const;
         inline uint32_t GetTriangleCount() const;
+        inline bool Has32BitIndices() const;
 
         inline const Simd::AaBox& GetBounds() const;
 
+        inline size_t GetLodCount() const;
+        inline float32_t GetLodScreenSize( size_t lodIndex ) const;
+
         inline RVertexBuffer* GetVertexBuffer() const;
-        inline RIndexBuffer* GetIndexBuffer() const;
+        inline RIndexBuffer* GetIndexBuffer( size_t lodIndex = 0 ) const;
         //@}
 
     private:
@@ -154,6 +168,18 @@ namespace Helium
         /// Asynchronous load ID for the index buffer data.
         size_t m_indexBufferLoadId;
 
+        /// Index buffers for each additional level of detail.
+        DynamicArray< RIndexBufferPtr > m_lodIndexBuffers;
+        /// Asynchronous load IDs for the index buffer data of each additional level of detail.
+        DynamicArray< size_t > m_lodIndexBufferLoadIds;
+
+        /// @name Private Utility Functions
+        //@{
+        void BeginLoadIndexBuffer(
+            Renderer* pRenderer, uint32_t subDataIndex, uint32_t triangleCount, RIndexBufferPtr& rspIndexBuffer,
+            size_t& rLoadId );
+        //@}
+
     };
 }
 
@@ -35,15 +35,26 @@ namespace Helium
     /// stored contiguously in the index buffer, with each section stored in sequence.
     ///
     /// @param[in] sectionIndex  Mesh section index.
+    /// @param[in] lodIndex      Level of detail (0 for the full detail mesh).
     ///
     /// @return  Number of triangles in the section associated with the specified index.
     ///
-    /// @see GetSectionVertexCount(), GetSectionSkinningPaletteMap(), GetSectionCount()
-    uint32_t Mesh::GetSectionTriangleCount( size_t sectionIndex ) const
+    /// @see GetSectionVertexCount(), GetSectionSkinningPaletteMap(), GetSectionCount(), GetLodCount()
+    uint32_t Mesh::GetSectionTriangleCount( size_t sectionIndex, size_t lodIndex ) const
     {
         HELIUM_ASSERT( sectionIndex <m_persistentResourceData. m_sectionTriangleCounts.GetSize() );
+        HELIUM_ASSERT( lodIndex < GetLodCount() );
 
-        return m_persistentResourceData.m_sectionTriangleCounts[ sectionIndex ];
+        if( lodIndex == 0 )
+        {
+            return m_persistentResourceData.m_sectionTriangleCounts[ sectionIndex ];
+        }
+
+        size_t sectionCount = m_persistentResourceData.m_sectionTriangleCounts.GetSize();
+        size_t lodSectionIndex = ( lodIndex - 1 ) * sectionCount + sectionIndex;
+        HELIUM_ASSERT( lodSectionIndex < m_persistentResourceData.m_lodSectionTriangleCounts.GetSize() );
+
+        return m_persistentResourceData.m_lodSectionTriangleCounts[ lodSectionIndex ];
     }
 
     /// Get whether this mesh is a skinned mesh.
@@ -163,6 +174,17 @@ namespace Helium
         return m_persistentResourceData.m_triangleCount;
     }
 
+    /// Get whether the index buffer for this mesh uses 32-bit indices.
+    ///
+    /// Section indices are relative to the first vertex of their section, so meshes only need 32-bit indices when a
+    /// single section addresses more than 65536 vertices.
+    ///
+    /// @return  True if the mesh uses 32-bit indices, false if it uses 16-bit indices.
+    bool Mesh::Has32BitIndices() const
+    {
+        return m_persistentResourceData.m_b32BitIndices;
+    }
+
     /// Get the bounds of this mesh.
     ///
     /// @return  Axis-aligned bounding box encompassing this mesh.
@@ -171,6 +193,34 @@ namespace Helium
         return m_persistentResourceData.m_bounds;
     }
 
+    /// Get the number of levels of detail available for this mesh.
+    ///
+    /// All levels of detail share the same vertex buffer and section vertex ranges, and only differ in their index
+    /// buffers and section triangle counts.
+    ///
+    /// @return  Level of detail count, including the full detail mesh.
+    ///
+    /// @see GetLodScreenSize(), GetIndexBuffer(), GetSectionTriangleCount()
+    size_t Mesh::GetLodCount() const
+    {
+        return 1 + m_persistentResourceData.m_lodScreenSizes.GetSize();
+    }
+
+    /// Get the projected size below which a level of detail should be used.
+    ///
+    /// @param[in] lodIndex  Level of detail.
+    ///
+    /// @return  Bounding sphere diameter, as a fraction of the view width, below which the level of detail should be
+    ///          used (always 0 for the full detail mesh).
+    ///
+    /// @see GetLodCount()
+    float32_t Mesh::GetLodScreenSize( size_t lodIndex ) const
+    {
+        HELIUM_ASSERT( lodIndex < GetLodCount() );
+
+        return ( lodIndex == 0 ? 0.0f : m_persistentResourceData.m_lodScreenSizes[ lodIndex - 1 ] );
+    }
+
     /// Get the vertex buffer for this mesh.
     ///
     /// @return  Vertex buffer.
@@ -181,13 +231,23 @@ namespace Helium
         return m_spVertexBuffer;
     }
 
-    /// Get the index buffer for this mesh.
+    /// Get the index buffer for a level of detail of this mesh.
+    ///
+    /// @param[in] lodIndex  Level of detail (0 for the full detail mesh).
     ///
     /// @return  Index buffer.
     ///
-    /// @see GetVertexBuffer()
-    RIndexBuffer* Mesh::GetIndexBuffer() const
+    /// @see GetVertexBuffer(), GetLodCount()
+    RIndexBuffer* Mesh::GetIndexBuffer( size_t lodIndex ) const
     {
-        return m_spIndexBuffer;
+        if( lodIndex == 0 )
+        {
+            return m_spIndexBuffer;
+        }
+
+        HELIUM_ASSERT( lodIndex < GetLodCount() );
+
+        // Buffers for additional levels of detail are only created once the resource data has been precached.
+        return ( lodIndex - 1 < m_lodIndexBuffers.GetSize() ? m_lodIndexBuffers[ lodIndex - 1 ].Get() : NULL );
     }
 }
@@ -24,6 +24,7 @@ RenderResourceManager::RenderResourceManager()
     , m_viewportWidthMax( 0 )
     , m_viewportHeightMax( 0 )
     , m_shadowDepthTextureUsableSize( 0 )
+    , m_lodBias( 0.0f )
 {
 }
 
@@ -515,6 +516,7 @@ void RenderResourceManager::PostConfigUpdate()
 
     m_shadowMode = GraphicsConfig::EShadowMode::NONE;
     m_shadowDepthTextureUsableSize = 0;
+    m_lodBias = 0.0f;
 
     // Get the renderer and graphics configuration.
     Renderer* pRenderer = Renderer::GetStaticInstance();
@@ -591,6 +593,9 @@ void RenderResourceManager::PostConfigUpdate()
     m_shadowMode = shadowMode;
     m_shadowDepthTextureUsableSize = shadowBufferUsableSize;
 
+    // Store level of detail settings.
+    m_lodBias = spGraphicsConfig->GetLodBias();
+
     // Recreate render and depth targets.
     UpdateMaxViewportSize( spGraphicsConfig->m_width, spGraphicsConfig->m_height );
 	
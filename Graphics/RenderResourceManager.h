@@ -171,6 +171,8 @@ namespace Helium
 
         inline GraphicsConfig::EShadowMode GetShadowMode() const;
         inline uint32_t GetShadowDepthTextureUsableSize() const;
+
+        inline float32_t GetLodBias() const;
         //@}
 
         /// @name Static Access
@@ -239,6 +241,9 @@ namespace Helium
         /// Shadow depth texture usable size (cached from graphics config object value).
         uint32_t m_shadowDepthTextureUsableSize;
 
+        /// Mesh level of detail bias (cached from graphics config object value).
+        float32_t m_lodBias;
+
         /// Singleton instance.
         static RenderResourceManager* sm_pInstance;
 
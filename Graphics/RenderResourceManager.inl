@@ -18,4 +18,13 @@ namespace Helium
     {
         return m_shadowDepthTextureUsableSize;
     }
+
+    /// Get the mesh level of detail bias.
+    ///
+    /// @return  Level of detail bias (positive values favor coarser levels of detail).  This is cached from the
+    ///          graphics configuration settings for easy access.
+    float32_t RenderResourceManager::GetLodBias() const
+    {
+        return m_lodBias;
+    }
 }
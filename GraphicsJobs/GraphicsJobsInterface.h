@@ -55,6 +55,7 @@ public:
     //@{
     void Run( JobContext* pContext );
     inline static void RunCallback( void* pJob, JobContext* pContext );
+    inline static const tchar_t* GetJobName();
     //@}
 
 private:
@@ -98,6 +99,7 @@ public:
     //@{
     void Run( JobContext* pContext );
     inline static void RunCallback( void* pJob, JobContext* pContext );
+    inline static const tchar_t* GetJobName();
     //@}
 
 private:
@@ -143,6 +145,7 @@ public:
     //@{
     void Run( JobContext* pContext );
     inline static void RunCallback( void* pJob, JobContext* pContext );
+    inline static const tchar_t* GetJobName();
     //@}
 
 private:
@@ -186,6 +189,7 @@ public:
     //@{
     void Run( JobContext* pContext );
     inline static void RunCallback( void* pJob, JobContext* pContext );
+    inline static const tchar_t* GetJobName();
     //@}
 
 private:
@@ -231,6 +235,7 @@ public:
     //@{
     void Run( JobContext* pContext );
     inline static void RunCallback( void* pJob, JobContext* pContext );
+    inline static const tchar_t* GetJobName();
     //@}
 
 private:
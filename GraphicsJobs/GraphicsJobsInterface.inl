@@ -52,6 +52,14 @@ namespace Helium
 		static_cast< UpdateGraphicsSceneConstantBuffersJobSpawner* >( pJob )->Run( pContext );
 	}
 
+	/// Get the name of this job type for profiling.
+	///
+	/// @return  Job type name.
+	const tchar_t* UpdateGraphicsSceneConstantBuffersJobSpawner::GetJobName()
+	{
+		return TXT( "UpdateGraphicsSceneConstantBuffersJobSpawner" );
+	}
+
 	/// Constructor.
 	UpdateGraphicsSceneConstantBuffersJobSpawner::Parameters::Parameters()
 	{
@@ -108,6 +116,14 @@ namespace Helium
 		static_cast< UpdateGraphicsSceneObjectBuffersJobSpawner* >( pJob )->Run( pContext );
 	}
 
+	/// Get the name of this job type for profiling.
+	///
+	/// @return  Job type name.
+	const tchar_t* UpdateGraphicsSceneObjectBuffersJobSpawner::GetJobName()
+	{
+		return TXT( "UpdateGraphicsSceneObjectBuffersJobSpawner" );
+	}
+
 	/// Constructor.
 	UpdateGraphicsSceneObjectBuffersJobSpawner::Parameters::Parameters()
 	{
@@ -164,6 +180,14 @@ namespace Helium
 		static_cast< UpdateGraphicsSceneSubMeshBuffersJobSpawner* >( pJob )->Run( pContext );
 	}
 
+	/// Get the name of this job type for profiling.
+	///
+	/// @return  Job type name.
+	const tchar_t* UpdateGraphicsSceneSubMeshBuffersJobSpawner::GetJobName()
+	{
+		return TXT( "UpdateGraphicsSceneSubMeshBuffersJobSpawner" );
+	}
+
 	/// Constructor.
 	UpdateGraphicsSceneSubMeshBuffersJobSpawner::Parameters::Parameters()
 	{
@@ -220,6 +244,14 @@ namespace Helium
 		static_cast< UpdateGraphicsSceneObjectBuffersJob* >( pJob )->Run( pContext );
 	}
 
+	/// Get the name of this job type for profiling.
+	///
+	/// @return  Job type name.
+	const tchar_t* UpdateGraphicsSceneObjectBuffersJob::GetJobName()
+	{
+		return TXT( "UpdateGraphicsSceneObjectBuffersJob" );
+	}
+
 	/// Constructor.
 	UpdateGraphicsSceneObjectBuffersJob::Parameters::Parameters()
 	{
@@ -276,6 +308,14 @@ namespace Helium
 		static_cast< UpdateGraphicsSceneSubMeshBuffersJob* >( pJob )->Run( pContext );
 	}
 
+	/// Get the name of this job type for profiling.
+	///
+	/// @return  Job type name.
+	const tchar_t* UpdateGraphicsSceneSubMeshBuffersJob::GetJobName()
+	{
+		return TXT( "UpdateGraphicsSceneSubMeshBuffersJob" );
+	}
+
 	/// Constructor.
 	UpdateGraphicsSceneSubMeshBuffersJob::Parameters::Parameters()
 	{
@@ -18,8 +18,13 @@ GraphicsSceneObject::GraphicsSceneObject()
 , m_pBonePalette( NULL )
 , m_vertexStride( 0 )
 , m_boneCount( 0 )
+, m_lodCount( 1 )
 , m_updateMode( static_cast< uint8_t >( UPDATE_INVALID ) )
 {
+    for( size_t lodIndex = 0; lodIndex < LOD_COUNT_MAX; ++lodIndex )
+    {
+        m_lodScreenSizes[ lodIndex ] = 0.0f;
+    }
 }
 
 /// Set the instance transform matrix.
@@ -60,14 +65,71 @@ void GraphicsSceneObject::SetVertexData(
     m_vertexStride = vertexStride;
 }
 
-/// Set the index buffer used for rendering.
+/// Set the index buffer used for rendering a level of detail.
 ///
 /// @param[in] pIndexBuffer  Sub-mesh index buffer.
+/// @param[in] lodIndex      Level of detail.
 ///
 /// @see GetIndexBuffer()
-void GraphicsSceneObject::SetIndexBuffer( RIndexBuffer* pIndexBuffer )
+void GraphicsSceneObject::SetIndexBuffer( RIndexBuffer* pIndexBuffer, size_t lodIndex )
+{
+    HELIUM_ASSERT( lodIndex < LOD_COUNT_MAX );
+
+    m_indexBuffers[ lodIndex ] = pIndexBuffer;
+}
+
+/// Set the number of levels of detail available for rendering.
+///
+/// @param[in] lodCount  Level of detail count, including the full detail level.
+///
+/// @see GetLodCount(), SetIndexBuffer(), SetLodScreenSize()
+void GraphicsSceneObject::SetLodCount( size_t lodCount )
 {
-    m_spIndexBuffer = pIndexBuffer;
+    HELIUM_ASSERT( lodCount >= 1 && lodCount <= LOD_COUNT_MAX );
+
+    m_lodCount = static_cast< uint8_t >( lodCount );
+}
+
+/// Set the projected size below which a level of detail is used.
+///
+/// @param[in] lodIndex    Level of detail.
+/// @param[in] screenSize  Bounding sphere diameter, as a fraction of the view width.
+///
+/// @see GetLodScreenSize(), SelectLod()
+void GraphicsSceneObject::SetLodScreenSize( size_t lodIndex, float32_t screenSize )
+{
+    HELIUM_ASSERT( lodIndex < LOD_COUNT_MAX );
+
+    m_lodScreenSizes[ lodIndex ] = screenSize;
+}
+
+/// Select the level of detail to render for a given projected size.
+///
+/// Levels of detail without an index buffer are skipped, so the most detailed level available at or below the
+/// requested detail is used.
+///
+/// @param[in] projectedSize  Bounding sphere diameter, as a fraction of the view width.
+///
+/// @return  Level of detail to render.
+///
+/// @see GetLodCount(), GetLodScreenSize()
+size_t GraphicsSceneObject::SelectLod( float32_t projectedSize ) const
+{
+    size_t selectedLod = 0;
+    for( size_t lodIndex = 1; lodIndex < m_lodCount; ++lodIndex )
+    {
+        if( projectedSize >= m_lodScreenSizes[ lodIndex ] )
+        {
+            break;
+        }
+
+        if( m_indexBuffers[ lodIndex ] )
+        {
+            selectedLod = lodIndex;
+        }
+    }
+
+    return selectedLod;
 }
 
 #if HELIUM_USE_GRANNY_ANIMATION
@@ -138,12 +200,16 @@ GraphicsSceneObject::SubMeshData::SubMeshData( size_t sceneObjectId )
 : m_sceneObjectId( sceneObjectId )
 , m_pSkinningPaletteMap( NULL )
 , m_primitiveType( RENDERER_PRIMITIVE_TYPE_TRIANGLE_LIST )
-, m_primitiveCount( 0 )
 , m_startVertex( 0 )
 , m_vertexRange( 0 )
-, m_startIndex( 0 )
 {
     HELIUM_ASSERT( IsValid( sceneObjectId ) );
+
+    for( size_t lodIndex = 0; lodIndex < LOD_COUNT_MAX; ++lodIndex )
+    {
+        m_primitiveCounts[ lodIndex ] = 0;
+        m_startIndices[ lodIndex ] = 0;
+    }
 }
 
 /// Set the material used for rendering.
@@ -180,12 +246,15 @@ void GraphicsSceneObject::SubMeshData::SetPrimitiveType( ERendererPrimitiveType
 
 /// Set the number of primitives to render.
 ///
-/// @param[in] count  Primitive count.
+/// @param[in] count     Primitive count.
+/// @param[in] lodIndex  Level of detail.
 ///
 /// @see GetPrimitiveCount()
-void GraphicsSceneObject::SubMeshData::SetPrimitiveCount( uint32_t count )
+void GraphicsSceneObject::SubMeshData::SetPrimitiveCount( uint32_t count, size_t lodIndex )
 {
-    m_primitiveCount = count;
+    HELIUM_ASSERT( lodIndex < LOD_COUNT_MAX );
+
+    m_primitiveCounts[ lodIndex ] = count;
 }
 
 /// Set the offset of the first vertex to use within the vertex buffer.
@@ -212,9 +281,12 @@ void GraphicsSceneObject::SubMeshData::SetVertexRange( uint32_t count )
 /// Set the offset of the first index to use within the index buffer.
 ///
 /// @param[in] startIndex  Offset of the first index.
+/// @param[in] lodIndex    Level of detail.
 ///
 /// @see GetStartIndex()
-void GraphicsSceneObject::SubMeshData::SetStartIndex( uint32_t startIndex )
+void GraphicsSceneObject::SubMeshData::SetStartIndex( uint32_t startIndex, size_t lodIndex )
 {
-    m_startIndex = startIndex;
+    HELIUM_ASSERT( lodIndex < LOD_COUNT_MAX );
+
+    m_startIndices[ lodIndex ] = startIndex;
 }
@@ -42,6 +42,9 @@ namespace Helium
             UPDATE_LAST = UPDATE_MAX - 1
         };
 
+        /// Maximum number of levels of detail (including the full detail level) per scene object.
+        static const size_t LOD_COUNT_MAX = 4;
+
         /// Data specific to sub-meshes.
         class HELIUM_GRAPHICS_TYPES_API SubMeshData
         {
@@ -56,20 +59,20 @@ namespace Helium
             void SetMaterial( Material* pMaterial );
             void SetSkinningPaletteMap( const uint8_t* pMap );
             void SetPrimitiveType( ERendererPrimitiveType type );
-            void SetPrimitiveCount( uint32_t count );
+            void SetPrimitiveCount( uint32_t count, size_t lodIndex = 0 );
             void SetStartVertex( uint32_t startVertex );
             void SetVertexRange( uint32_t count );
-            void SetStartIndex( uint32_t startIndex );
+            void SetStartIndex( uint32_t startIndex, size_t lodIndex = 0 );
 
             inline size_t GetSceneObjectId() const;
 
             inline const MaterialPtr& GetMaterial() const;
             inline const uint8_t* GetSkinningPaletteMap() const;
             inline ERendererPrimitiveType GetPrimitiveType() const;
-            inline uint32_t GetPrimitiveCount() const;
+            inline uint32_t GetPrimitiveCount( size_t lodIndex = 0 ) const;
             inline uint32_t GetStartVertex() const;
             inline uint32_t GetVertexRange() const;
-            inline uint32_t GetStartIndex() const;
+            inline uint32_t GetStartIndex( size_t lodIndex = 0 ) const;
             //@}
 
         private:
@@ -82,14 +85,14 @@ namespace Helium
             const uint8_t* m_pSkinningPaletteMap;
             /// Primitive type.
             ERendererPrimitiveType m_primitiveType;
-            /// Number of primitives to render.
-            uint32_t m_primitiveCount;
+            /// Number of primitives to render at each level of detail.
+            uint32_t m_primitiveCounts[ LOD_COUNT_MAX ];
             /// Offset of the first vertex to use within the vertex buffer.
             uint32_t m_startVertex;
             /// Total number of vertices potentially addressed, starting from the initial vertex.
             uint32_t m_vertexRange;
-            /// Offset of the first index to use within the index buffer.
-            uint32_t m_startIndex;
+            /// Offset of the first index to use within the index buffer of each level of detail.
+            uint32_t m_startIndices[ LOD_COUNT_MAX ];
         };
 
         /// @name Construction/Destruction
@@ -102,7 +105,9 @@ namespace Helium
         void SetTransform( const Simd::Matrix44& rTransform );
         void SetWorldBounds( const Simd::AaBox& rBox );
         void SetVertexData( RVertexBuffer* pVertexBuffer, RVertexDescription* pVertexDescription, uint32_t vertexStride );
-        void SetIndexBuffer( RIndexBuffer* pIndexBuffer );
+        void SetIndexBuffer( RIndexBuffer* pIndexBuffer, size_t lodIndex = 0 );
+        void SetLodCount( size_t lodCount );
+        void SetLodScreenSize( size_t lodIndex, float32_t screenSize );
 
 #if HELIUM_USE_GRANNY_ANIMATION
         void SetBoneData( const void* pBoneData, uint8_t boneCount );
@@ -117,7 +122,10 @@ namespace Helium
         inline RVertexBuffer* GetVertexBuffer() const;
         inline RVertexDescription* GetVertexDescription() const;
         inline uint32_t GetVertexStride() const;
-        inline RIndexBuffer* GetIndexBuffer() const;
+        inline RIndexBuffer* GetIndexBuffer( size_t lodIndex = 0 ) const;
+        inline size_t GetLodCount() const;
+        inline float32_t GetLodScreenSize( size_t lodIndex ) const;
+        size_t SelectLod( float32_t projectedSize ) const;
 
 #if HELIUM_USE_GRANNY_ANIMATION
         inline const void* GetBoneData() const;
@@ -145,8 +153,10 @@ namespace Helium
         RVertexBufferPtr m_spVertexBuffer;
         /// Vertex description.
         RVertexDescriptionPtr m_spVertexDescription;
-        /// Index buffer.
-        RIndexBufferPtr m_spIndexBuffer;
+        /// Index buffer for each level of detail.
+        RIndexBufferPtr m_indexBuffers[ LOD_COUNT_MAX ];
+        /// Projected size below which each level of detail is used (unused for the full detail level).
+        float32_t m_lodScreenSizes[ LOD_COUNT_MAX ];
 
 #if HELIUM_USE_GRANNY_ANIMATION
         /// Mesh bone data.
@@ -163,6 +173,8 @@ namespace Helium
 
         /// Number of bones in the bone palette.
         uint8_t m_boneCount;
+        /// Number of levels of detail.
+        uint8_t m_lodCount;
 
         /// Update mode.
         uint8_t m_updateMode;
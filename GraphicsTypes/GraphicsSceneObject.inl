@@ -60,14 +60,42 @@ namespace Helium
         return m_vertexStride;
     }
 
-    /// Get the index buffer used for rendering.
+    /// Get the index buffer used for rendering a level of detail.
+    ///
+    /// @param[in] lodIndex  Level of detail.
     ///
     /// @return  Sub-mesh index buffer.
     ///
     /// @see SetIndexBuffer()
-    RIndexBuffer* GraphicsSceneObject::GetIndexBuffer() const
+    RIndexBuffer* GraphicsSceneObject::GetIndexBuffer( size_t lodIndex ) const
+    {
+        HELIUM_ASSERT( lodIndex < LOD_COUNT_MAX );
+
+        return m_indexBuffers[ lodIndex ];
+    }
+
+    /// Get the number of levels of detail available for rendering.
+    ///
+    /// @return  Level of detail count, including the full detail level.
+    ///
+    /// @see SetLodCount(), SelectLod()
+    size_t GraphicsSceneObject::GetLodCount() const
+    {
+        return m_lodCount;
+    }
+
+    /// Get the projected size below which a level of detail is used.
+    ///
+    /// @param[in] lodIndex  Level of detail.
+    ///
+    /// @return  Bounding sphere diameter, as a fraction of the view width.
+    ///
+    /// @see SetLodScreenSize(), SelectLod()
+    float32_t GraphicsSceneObject::GetLodScreenSize( size_t lodIndex ) const
     {
-        return m_spIndexBuffer;
+        HELIUM_ASSERT( lodIndex < LOD_COUNT_MAX );
+
+        return m_lodScreenSizes[ lodIndex ];
     }
 
 #if HELIUM_USE_GRANNY_ANIMATION
@@ -179,12 +207,16 @@ namespace Helium
 
     /// Get the number of primitives to render.
     ///
+    /// @param[in] lodIndex  Level of detail.
+    ///
     /// @return  Primitive count.
     ///
     /// @see SetPrimitiveCount()
-    uint32_t GraphicsSceneObject::SubMeshData::GetPrimitiveCount() const
+    uint32_t GraphicsSceneObject::SubMeshData::GetPrimitiveCount( size_t lodIndex ) const
     {
-        return m_primitiveCount;
+        HELIUM_ASSERT( lodIndex < LOD_COUNT_MAX );
+
+        return m_primitiveCounts[ lodIndex ];
     }
 
     /// Get the offset of the first vertex to use within the vertex buffer.
@@ -210,11 +242,15 @@ namespace Helium
 
     /// Get the offset of the first index to use within the index buffer.
     ///
+    /// @param[in] lodIndex  Level of detail.
+    ///
     /// @return  Offset of the first index.
     ///
     /// @see SetStartIndex()
-    uint32_t GraphicsSceneObject::SubMeshData::GetStartIndex() const
+    uint32_t GraphicsSceneObject::SubMeshData::GetStartIndex( size_t lodIndex ) const
     {
-        return m_startIndex;
+        HELIUM_ASSERT( lodIndex < LOD_COUNT_MAX );
+
+        return m_startIndices[ lodIndex ];
     }
 }
@@ -78,6 +78,7 @@ namespace Helium
 		inline const Simd::Vector3& GetOrigin() const;
 		inline const Simd::Vector3& GetForward() const;
 		inline const Simd::Vector3& GetUp() const;
+		inline float32_t GetHorizontalFov() const;
 
 		inline const Simd::Matrix44& GetViewMatrix() const;
 		inline const Simd::Matrix44& GetInverseViewMatrix() const;
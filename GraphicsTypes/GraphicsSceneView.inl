@@ -115,6 +115,16 @@ namespace Helium
         return m_up;
     }
 
+    /// Get the horizontal field-of-view angle.
+    ///
+    /// @return  Field-of-view angle, in degrees (less than HELIUM_EPSILON for orthographic views).
+    ///
+    /// @see SetHorizontalFov()
+    float32_t GraphicsSceneView::GetHorizontalFov() const
+    {
+        return m_horizontalFov;
+    }
+
     /// Get the view matrix for this scene view.
     ///
     /// @return  View matrix.
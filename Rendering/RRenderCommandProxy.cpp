@@ -121,7 +121,7 @@ RRenderCommandProxy::~RRenderCommandProxy()
 ///
 /// @see SetVertexShader()
 
-/// @fn void RRenderCommandProxy::SetVertexConstantBuffers( size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers, const size_t* pLimitSizes )
+/// @fn void RRenderCommandProxy::SetVertexConstantBuffers( size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers, const size_t* pLimitSizes, const size_t* pOffsets )
 /// Set a range of vertex shader constant buffers to use for rendering.
 ///
 /// @param[in] startIndex   Starting vertex shader constant buffer index to set.
@@ -133,10 +133,15 @@ RRenderCommandProxy::~RRenderCommandProxy()
 ///                         should be updated.  On platforms that don't support storage of constant buffers on the
 ///                         GPU (i.e. Direct3D 9 and such, where shader constants must be passed in the command
 ///                         buffer when changing), this can provide a significant performance improvement.
+/// @param[in] pOffsets     Optional array of byte offsets within each constant buffer from which to start reading
+///                         shader constants.  This allows many small sets of shader constants to be sub-allocated
+///                         from a single large buffer.  Offsets must be aligned to the size of a single constant
+///                         register (four single-precision floats).  If offsets are specified, a valid limit size
+///                         must also be provided for each buffer, as it defines the size of the bound range.
 ///
 /// @see SetPixelConstantBuffers()
 
-/// @fn void RRenderCommandProxy::SetPixelConstantBuffers( size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers, const size_t* pLimitSizes )
+/// @fn void RRenderCommandProxy::SetPixelConstantBuffers( size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers, const size_t* pLimitSizes, const size_t* pOffsets )
 /// Set a range of pixel shader constant buffers to use for rendering.
 ///
 /// @param[in] startIndex   Starting pixel shader constant buffer index to set.
@@ -148,6 +153,11 @@ RRenderCommandProxy::~RRenderCommandProxy()
 ///                         should be updated.  On platforms that don't support storage of constant buffers on the
 ///                         GPU (i.e. Direct3D 9 and such, where shader constants must be passed in the command
 ///                         buffer when changing), this can provide a significant performance improvement.
+/// @param[in] pOffsets     Optional array of byte offsets within each constant buffer from which to start reading
+///                         shader constants.  This allows many small sets of shader constants to be sub-allocated
+///                         from a single large buffer.  Offsets must be aligned to the size of a single constant
+///                         register (four single-precision floats).  If offsets are specified, a valid limit size
+///                         must also be provided for each buffer, as it defines the size of the bound range.
 ///
 /// @see SetVertexConstantBuffers()
 
@@ -69,16 +69,16 @@ namespace Helium
 
         virtual void SetVertexConstantBuffers(
             size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers,
-            const size_t* pLimitSizes = NULL ) = 0;
+            const size_t* pLimitSizes = NULL, const size_t* pOffsets = NULL ) = 0;
         inline void SetVertexConstantBuffers(
             size_t startIndex, size_t bufferCount, RConstantBufferPtr const* pspBuffers,
-            const size_t* pLimitSizes = NULL );
+            const size_t* pLimitSizes = NULL, const size_t* pOffsets = NULL );
         virtual void SetPixelConstantBuffers(
             size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers,
-            const size_t* pLimitSizes = NULL ) = 0;
+            const size_t* pLimitSizes = NULL, const size_t* pOffsets = NULL ) = 0;
         inline void SetPixelConstantBuffers(
             size_t startIndex, size_t bufferCount, RConstantBufferPtr const* pspBuffers,
-            const size_t* pLimitSizes = NULL );
+            const size_t* pLimitSizes = NULL, const size_t* pOffsets = NULL );
 
         virtual void SetTexture( size_t samplerIndex, RTexture* pTexture ) = 0;
 
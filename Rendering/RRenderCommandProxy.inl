@@ -53,19 +53,25 @@ namespace Helium
     ///                         should be updated.  On platforms that don't support storage of constant buffers on the
     ///                         GPU (i.e. Direct3D 9 and such, where shader constants must be passed in the command
     ///                         buffer when changing), this can provide a significant performance improvement.
+    /// @param[in] pOffsets     Optional array of byte offsets within each constant buffer from which to start reading
+    ///                         shader constants.  Offsets must be aligned to the size of a single constant register
+    ///                         (four single-precision floats).  If offsets are specified, a valid limit size must
+    ///                         also be provided for each buffer, as it defines the size of the bound range.
     ///
     /// @see SetPixelConstantBuffers()
     void RRenderCommandProxy::SetVertexConstantBuffers(
         size_t startIndex,
         size_t bufferCount,
         RConstantBufferPtr const* pspBuffers,
-        const size_t* pLimitSizes )
+        const size_t* pLimitSizes,
+        const size_t* pOffsets )
     {
         SetVertexConstantBuffers(
             startIndex,
             bufferCount,
             &static_cast< RConstantBuffer* const& >( pspBuffers[ 0 ] ),
-            pLimitSizes );
+            pLimitSizes,
+            pOffsets );
     }
 
     /// Set a range of pixel shader constant buffers to use for rendering.
@@ -79,18 +85,24 @@ namespace Helium
     ///                         should be updated.  On platforms that don't support storage of constant buffers on the
     ///                         GPU (i.e. Direct3D 9 and such, where shader constants must be passed in the command
     ///                         buffer when changing), this can provide a significant performance improvement.
+    /// @param[in] pOffsets     Optional array of byte offsets within each constant buffer from which to start reading
+    ///                         shader constants.  Offsets must be aligned to the size of a single constant register
+    ///                         (four single-precision floats).  If offsets are specified, a valid limit size must
+    ///                         also be provided for each buffer, as it defines the size of the bound range.
     ///
     /// @see SetVertexConstantBuffers()
     void RRenderCommandProxy::SetPixelConstantBuffers(
         size_t startIndex,
         size_t bufferCount,
         RConstantBufferPtr const* pspBuffers,
-        const size_t* pLimitSizes )
+        const size_t* pLimitSizes,
+        const size_t* pOffsets )
     {
         SetPixelConstantBuffers(
             startIndex,
             bufferCount,
             &static_cast< RConstantBuffer* const& >( pspBuffers[ 0 ] ),
-            pLimitSizes );
+            pLimitSizes,
+            pOffsets );
     }
 }
@@ -64,6 +64,8 @@ namespace Helium
             bool bFullscreen;
             /// True to enable vsync.
             bool bVsync;
+            /// True if the context will be used from more than one thread at once.
+            bool bMultithreaded;
 
             /// @name Construction/Destruction
             //@{
@@ -47,6 +47,7 @@ namespace Helium
         , multisampleCount( 0 )
         , bFullscreen( false )
         , bVsync( false )
+        , bMultithreaded( false )
     {
     }
 }
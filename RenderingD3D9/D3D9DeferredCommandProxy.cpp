@@ -397,7 +397,8 @@ public:
         size_t startIndex,
         size_t bufferCount,
         RConstantBuffer* const* ppBuffers,
-        const size_t* pLimitSizes )
+        const size_t* pLimitSizes,
+        const size_t* pOffsets )
         : m_startIndex( startIndex )
         , m_bufferCount( bufferCount )
     {
@@ -423,6 +424,15 @@ public:
         {
             MemorySet( m_limitSizes, 0xff, bufferCount * sizeof( size_t ) );
         }
+
+        if( pOffsets )
+        {
+            MemoryCopy( m_offsets, pOffsets, bufferCount * sizeof( size_t ) );
+        }
+        else
+        {
+            MemorySet( m_offsets, 0xff, bufferCount * sizeof( size_t ) );
+        }
     }
 
     ~D3D9SetConstantBuffersCommand()
@@ -434,6 +444,7 @@ protected:
     size_t m_bufferCount;
     RConstantBufferPtr m_buffers[ D3D9ImmediateCommandProxy::CONSTANT_BUFFER_SLOT_COUNT ];
     size_t m_limitSizes[ D3D9ImmediateCommandProxy::CONSTANT_BUFFER_SLOT_COUNT ];
+    size_t m_offsets[ D3D9ImmediateCommandProxy::CONSTANT_BUFFER_SLOT_COUNT ];
 };
 
 class D3D9SetVertexConstantBuffersCommand : public D3D9SetConstantBuffersCommand
@@ -443,8 +454,9 @@ public:
         size_t startIndex,
         size_t bufferCount,
         RConstantBuffer* const* ppBuffers,
-        const size_t* pLimitSizes )
-        : D3D9SetConstantBuffersCommand( startIndex, bufferCount, ppBuffers, pLimitSizes )
+        const size_t* pLimitSizes,
+        const size_t* pOffsets )
+        : D3D9SetConstantBuffersCommand( startIndex, bufferCount, ppBuffers, pLimitSizes, pOffsets )
     {
     }
 
@@ -454,7 +466,8 @@ public:
             m_startIndex,
             m_bufferCount,
             &static_cast< RConstantBuffer* const& >( m_buffers[ 0 ] ),
-            m_limitSizes );
+            m_limitSizes,
+            m_offsets );
     }
 };
 
@@ -465,8 +478,9 @@ public:
         size_t startIndex,
         size_t bufferCount,
         RConstantBuffer* const* ppBuffers,
-        const size_t* pLimitSizes )
-        : D3D9SetConstantBuffersCommand( startIndex, bufferCount, ppBuffers, pLimitSizes )
+        const size_t* pLimitSizes,
+        const size_t* pOffsets )
+        : D3D9SetConstantBuffersCommand( startIndex, bufferCount, ppBuffers, pLimitSizes, pOffsets )
     {
     }
 
@@ -476,7 +490,8 @@ public:
             m_startIndex,
             m_bufferCount,
             &static_cast< RConstantBuffer* const& >( m_buffers[ 0 ] ),
-            m_limitSizes );
+            m_limitSizes,
+            m_offsets );
     }
 };
 
@@ -724,13 +739,15 @@ HELIUM_DEFERRED_COMMAND_PROXY_METHOD(
 
 HELIUM_DEFERRED_COMMAND_PROXY_METHOD(
     SetVertexConstantBuffers,
-    ( size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers, const size_t* pLimitSizes ),
-    ( startIndex, bufferCount, ppBuffers, pLimitSizes ) )
+    ( size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers, const size_t* pLimitSizes,
+      const size_t* pOffsets ),
+    ( startIndex, bufferCount, ppBuffers, pLimitSizes, pOffsets ) )
 
 HELIUM_DEFERRED_COMMAND_PROXY_METHOD(
     SetPixelConstantBuffers,
-    ( size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers, const size_t* pLimitSizes ),
-    ( startIndex, bufferCount, ppBuffers, pLimitSizes ) )
+    ( size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers, const size_t* pLimitSizes,
+      const size_t* pOffsets ),
+    ( startIndex, bufferCount, ppBuffers, pLimitSizes, pOffsets ) )
 
 HELIUM_DEFERRED_COMMAND_PROXY_METHOD(
     SetTexture,
@@ -566,7 +566,8 @@ void D3D9ImmediateCommandProxy::SetVertexConstantBuffers(
     size_t startIndex,
     size_t bufferCount,
     RConstantBuffer* const* ppBuffers,
-    const size_t* pLimitSizes )
+    const size_t* pLimitSizes,
+    const size_t* pOffsets )
 {
     HELIUM_ASSERT( ppBuffers || bufferCount == 0 );
 
@@ -597,25 +598,13 @@ void D3D9ImmediateCommandProxy::SetVertexConstantBuffers(
         bufferCount = availableSlots;
     }
 
-    if( pLimitSizes )
+    for( size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex )
     {
-        for( size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex )
-        {
-            m_vertexConstantManager.SetBuffer(
-                startIndex + bufferIndex,
-                static_cast< D3D9ConstantBuffer* >( ppBuffers[ bufferIndex ] ),
-                pLimitSizes[ bufferIndex ] );
-        }
-    }
-    else
-    {
-        for( size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex )
-        {
-            m_vertexConstantManager.SetBuffer(
-                startIndex + bufferIndex,
-                static_cast< D3D9ConstantBuffer* >( ppBuffers[ bufferIndex ] ),
-                Invalid< size_t >() );
-        }
+        m_vertexConstantManager.SetBuffer(
+            startIndex + bufferIndex,
+            static_cast< D3D9ConstantBuffer* >( ppBuffers[ bufferIndex ] ),
+            ( pLimitSizes ? pLimitSizes[ bufferIndex ] : Invalid< size_t >() ),
+            ( pOffsets ? pOffsets[ bufferIndex ] : Invalid< size_t >() ) );
     }
 }
 
@@ -624,7 +613,8 @@ void D3D9ImmediateCommandProxy::SetPixelConstantBuffers(
     size_t startIndex,
     size_t bufferCount,
     RConstantBuffer* const* ppBuffers,
-    const size_t* pLimitSizes )
+    const size_t* pLimitSizes,
+    const size_t* pOffsets )
 {
     HELIUM_ASSERT( ppBuffers || bufferCount == 0 );
 
@@ -655,25 +645,13 @@ void D3D9ImmediateCommandProxy::SetPixelConstantBuffers(
         bufferCount = availableSlots;
     }
 
-    if( pLimitSizes )
+    for( size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex )
     {
-        for( size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex )
-        {
-            m_pixelConstantManager.SetBuffer(
-                startIndex + bufferIndex,
-                static_cast< D3D9ConstantBuffer* >( ppBuffers[ bufferIndex ] ),
-                pLimitSizes[ bufferIndex ] );
-        }
-    }
-    else
-    {
-        for( size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex )
-        {
-            m_pixelConstantManager.SetBuffer(
-                startIndex + bufferIndex,
-                static_cast< D3D9ConstantBuffer* >( ppBuffers[ bufferIndex ] ),
-                Invalid< size_t >() );
-        }
+        m_pixelConstantManager.SetBuffer(
+            startIndex + bufferIndex,
+            static_cast< D3D9ConstantBuffer* >( ppBuffers[ bufferIndex ] ),
+            ( pLimitSizes ? pLimitSizes[ bufferIndex ] : Invalid< size_t >() ),
+            ( pOffsets ? pOffsets[ bufferIndex ] : Invalid< size_t >() ) );
     }
 }
 
@@ -861,8 +839,8 @@ void D3D9ImmediateCommandProxy::UnbindResources()
 
     for( size_t constantBufferIndex = 0; constantBufferIndex < CONSTANT_BUFFER_SLOT_COUNT; ++constantBufferIndex )
     {
-        m_vertexConstantManager.SetBuffer( constantBufferIndex, NULL, Invalid< size_t >() );
-        m_pixelConstantManager.SetBuffer( constantBufferIndex, NULL, Invalid< size_t >() );
+        m_vertexConstantManager.SetBuffer( constantBufferIndex, NULL, Invalid< size_t >(), Invalid< size_t >() );
+        m_pixelConstantManager.SetBuffer( constantBufferIndex, NULL, Invalid< size_t >(), Invalid< size_t >() );
     }
 }
 
@@ -898,6 +876,8 @@ void D3D9ImmediateCommandProxy::FinishCommandList( RRenderCommandListPtr& rspCom
 template< typename Pusher, size_t RegisterCount >
 D3D9ImmediateCommandProxy::ConstantManager< Pusher, RegisterCount >::ConstantManager()
 {
+    MemoryZero( m_bufferRegisterOffsets, sizeof( m_bufferRegisterOffsets ) );
+    MemoryZero( m_bufferRegisterCounts, sizeof( m_bufferRegisterCounts ) );
 }
 
 /// Destructor.
@@ -910,15 +890,19 @@ D3D9ImmediateCommandProxy::ConstantManager< Pusher, RegisterCount >::~ConstantMa
 ///
 /// @param[in] index      Constant buffer slot index.
 /// @param[in] pBuffer    Constant buffer to set.
-/// @param[in] limitSize  Number of bytes, starting from the beginning of the buffer, in which to limit updates to
-///                       shader constant registers.
+/// @param[in] limitSize  Number of bytes, starting from the beginning of the bound range, in which to limit updates
+///                       to shader constant registers.
+/// @param[in] offset     Byte offset of the bound range within the buffer, or an invalid index to bind the entire
+///                       buffer.  If valid, the limit size must also be valid, as it specifies the size of the bound
+///                       range.
 ///
 /// @see GetBuffer()
 template< typename Pusher, size_t RegisterCount >
 void D3D9ImmediateCommandProxy::ConstantManager< Pusher, RegisterCount >::SetBuffer(
     size_t index,
     D3D9ConstantBuffer* pBuffer,
-    size_t limitSize )
+    size_t limitSize,
+    size_t offset )
 {
     HELIUM_ASSERT( index < HELIUM_ARRAY_COUNT( m_buffers ) );
 
@@ -934,19 +918,36 @@ void D3D9ImmediateCommandProxy::ConstantManager< Pusher, RegisterCount >::SetBuf
         SetInvalid( m_bufferLimitSizes[ index ] );
     }
 
-    D3D9ConstantBuffer* pOldBuffer = m_buffers[ index ];
-    if( pOldBuffer != pBuffer )
+    // Compute the range of registers within the buffer being bound.  Sub-ranges are only mapped to as many shader
+    // registers as their limit size, allowing a single large buffer to back many small instance ranges.
+    uint_fast16_t newRegisterOffset = 0;
+    uint_fast16_t newRegisterCount = 0;
+    if( pBuffer )
     {
-        uint_fast16_t oldRegisterCount = 0;
-        if( pOldBuffer )
+        newRegisterCount = pBuffer->GetRegisterCount();
+
+        if( IsValid( offset ) )
         {
-            oldRegisterCount = pOldBuffer->GetRegisterCount();
+            HELIUM_ASSERT( offset % ( sizeof( float32_t ) * 4 ) == 0 );
+            HELIUM_ASSERT( IsValid( limitSize ) );
+
+            newRegisterOffset = static_cast< uint_fast16_t >( Min< size_t >(
+                offset / ( sizeof( float32_t ) * 4 ),
+                newRegisterCount ) );
+            newRegisterCount = static_cast< uint_fast16_t >( Min< size_t >(
+                newRegisterCount - newRegisterOffset,
+                m_bufferLimitSizes[ index ] ) );
         }
+    }
 
-        uint_fast16_t newRegisterCount = 0;
-        if( pBuffer )
+    D3D9ConstantBuffer* pOldBuffer = m_buffers[ index ];
+    if( pOldBuffer != pBuffer || m_bufferRegisterOffsets[ index ] != newRegisterOffset ||
+        m_bufferRegisterCounts[ index ] != newRegisterCount )
+    {
+        uint_fast16_t oldRegisterCount = 0;
+        if( pOldBuffer )
         {
-            newRegisterCount = pBuffer->GetRegisterCount();
+            oldRegisterCount = m_bufferRegisterCounts[ index ];
         }
 
         if( oldRegisterCount != newRegisterCount )
@@ -958,7 +959,7 @@ void D3D9ImmediateCommandProxy::ConstantManager< Pusher, RegisterCount >::SetBuf
                 D3D9ConstantBuffer* pPreviousBuffer = m_buffers[ previousIndex ];
                 if( pPreviousBuffer )
                 {
-                    invalidRegisterStart += pPreviousBuffer->GetRegisterCount();
+                    invalidRegisterStart += m_bufferRegisterCounts[ previousIndex ];
                 }
             }
 
@@ -982,6 +983,8 @@ void D3D9ImmediateCommandProxy::ConstantManager< Pusher, RegisterCount >::SetBuf
         }
 
         m_buffers[ index ] = pBuffer;
+        m_bufferRegisterOffsets[ index ] = static_cast< uint16_t >( newRegisterOffset );
+        m_bufferRegisterCounts[ index ] = static_cast< uint16_t >( newRegisterCount );
         if( pBuffer )
         {
             // Set the buffer tag as one minus its actual tag to force its contents to be updated during the next
@@ -1042,7 +1045,8 @@ void D3D9ImmediateCommandProxy::ConstantManager< Pusher, RegisterCount >::Push(
 
         // Push dirty registers.
         const float32_t* pData = static_cast< const float32_t* >( pBuffer->GetData() );
-        uint_fast16_t bufferRegisterCount = pBuffer->GetRegisterCount();
+        pData += static_cast< size_t >( m_bufferRegisterOffsets[ bufferIndex ] ) * 4;
+        uint_fast16_t bufferRegisterCount = m_bufferRegisterCounts[ bufferIndex ];
         HELIUM_ASSERT( pData || bufferRegisterCount == 0 );
 
         uint_fast16_t bufferRegisterLimit = Min< uint_fast16_t >(
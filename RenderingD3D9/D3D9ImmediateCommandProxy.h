@@ -71,10 +71,10 @@ namespace Helium
 
         void SetVertexConstantBuffers(
             size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers,
-            const size_t* pLimitSizes = NULL );
+            const size_t* pLimitSizes = NULL, const size_t* pOffsets = NULL );
         void SetPixelConstantBuffers(
             size_t startIndex, size_t bufferCount, RConstantBuffer* const* ppBuffers,
-            const size_t* pLimitSizes = NULL );
+            const size_t* pLimitSizes = NULL, const size_t* pOffsets = NULL );
 
         void SetTexture( size_t samplerIndex, RTexture* pTexture );
 
@@ -115,7 +115,7 @@ namespace Helium
 
             /// @name Constant Buffer Access
             //@{
-            void SetBuffer( size_t index, D3D9ConstantBuffer* pBuffer, size_t limitSize );
+            void SetBuffer( size_t index, D3D9ConstantBuffer* pBuffer, size_t limitSize, size_t offset );
             D3D9ConstantBuffer* GetBuffer( size_t index ) const;
             //@}
 
@@ -133,6 +133,10 @@ namespace Helium
             uint32_t m_dirtyRegisters[ ( RegisterCount + sizeof( uint32_t ) * 8 - 1 ) / ( sizeof( uint32_t ) * 8 ) ];
             /// Constant buffer update range limits.
             uint16_t m_bufferLimitSizes[ CONSTANT_BUFFER_SLOT_COUNT ];
+            /// Register offsets of the bound range within each constant buffer.
+            uint16_t m_bufferRegisterOffsets[ CONSTANT_BUFFER_SLOT_COUNT ];
+            /// Number of shader registers covered by the bound range of each constant buffer.
+            uint16_t m_bufferRegisterCounts[ CONSTANT_BUFFER_SLOT_COUNT ];
             /// Constant value pusher.
             Pusher m_pusher;
         };
@@ -268,6 +268,14 @@ bool D3D9Renderer::CreateMainContext( const ContextInitParameters& rInitParamete
         return false;
     }
 
+    // Pipelined rendering issues draw calls from the render thread while other threads create and lock resources, so
+    // the device has to serialize access itself.
+    DWORD behaviorFlags = D3DCREATE_HARDWARE_VERTEXPROCESSING;
+    if( rInitParameters.bMultithreaded )
+    {
+        behaviorFlags |= D3DCREATE_MULTITHREADED;
+    }
+
     HRESULT createResult;
     if( m_bExDevice )
     {
@@ -276,7 +284,7 @@ bool D3D9Renderer::CreateMainContext( const ContextInitParameters& rInitParamete
             D3DADAPTER_DEFAULT,
             D3DDEVTYPE_HAL,
             static_cast< HWND >( rInitParameters.pWindow ),
-            D3DCREATE_HARDWARE_VERTEXPROCESSING,
+            behaviorFlags,
             &m_presentParameters,
             ( rInitParameters.bFullscreen ? &m_fullscreenDisplayMode : NULL ),
             &pD3DDeviceEx );
@@ -289,7 +297,7 @@ bool D3D9Renderer::CreateMainContext( const ContextInitParameters& rInitParamete
             D3DADAPTER_DEFAULT,
             D3DDEVTYPE_HAL,
             static_cast< HWND >( rInitParameters.pWindow ),
-            D3DCREATE_HARDWARE_VERTEXPROCESSING,
+            behaviorFlags,
             &m_presentParameters,
             &m_pD3DDevice );
     }
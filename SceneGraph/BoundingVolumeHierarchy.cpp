@@ -0,0 +1,174 @@
+#include "SceneGraphPch.h"
+#include "SceneGraph/BoundingVolumeHierarchy.h"
+
+#include "SceneGraph/Pick.h"
+
+#include <algorithm>
+
+using namespace Helium;
+using namespace Helium::SceneGraph;
+
+static inline float32_t GetAxis( const Vector3& v, uint32_t axis )
+{
+    return axis == 0 ? v.x : ( axis == 1 ? v.y : v.z );
+}
+
+struct CenterCompare
+{
+    CenterCompare( const std::vector< Vector3 >& centers, uint32_t axis )
+        : m_Centers( centers )
+        , m_Axis( axis )
+    {
+
+    }
+
+    bool operator()( uint32_t lhs, uint32_t rhs ) const
+    {
+        return GetAxis( m_Centers[ lhs ], m_Axis ) < GetAxis( m_Centers[ rhs ], m_Axis );
+    }
+
+    const std::vector< Vector3 >& m_Centers;
+    uint32_t m_Axis;
+};
+
+struct BuildTask
+{
+    uint32_t m_Node;
+    uint32_t m_Begin;
+    uint32_t m_End;
+};
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+{
+
+}
+
+void BoundingVolumeHierarchy::Clear()
+{
+    m_Nodes.clear();
+    m_Items.clear();
+}
+
+void BoundingVolumeHierarchy::Build( const std::vector< AlignedBox >& itemBounds, uint32_t leafItemCount, float32_t slop )
+{
+    HELIUM_ASSERT( leafItemCount > 0 );
+
+    Clear();
+
+    uint32_t itemCount = (uint32_t)itemBounds.size();
+    if ( itemCount == 0 )
+    {
+        return;
+    }
+
+    m_Items.resize( itemCount );
+    m_Centers.resize( itemCount );
+    for ( uint32_t i = 0; i < itemCount; ++i )
+    {
+        m_Items[ i ] = i;
+        m_Centers[ i ] = itemBounds[ i ].Center();
+    }
+
+    Vector3 grow ( slop, slop, slop );
+
+    // a balanced tree has fewer than two nodes per leaf item
+    m_Nodes.reserve( 2 * ( ( itemCount + leafItemCount - 1 ) / leafItemCount ) );
+    m_Nodes.push_back( Node () );
+
+    std::vector< BuildTask > tasks;
+    BuildTask root = { 0, 0, itemCount };
+    tasks.push_back( root );
+
+    while ( !tasks.empty() )
+    {
+        BuildTask task = tasks.back();
+        tasks.pop_back();
+
+        AlignedBox bounds;
+        AlignedBox centerBounds;
+        bounds.Reset();
+        centerBounds.Reset();
+        for ( uint32_t i = task.m_Begin; i < task.m_End; ++i )
+        {
+            bounds.Merge( itemBounds[ m_Items[ i ] ] );
+            centerBounds.Test( m_Centers[ m_Items[ i ] ] );
+        }
+
+        bounds.minimum = bounds.minimum - grow;
+        bounds.maximum = bounds.maximum + grow;
+
+        Node& node = m_Nodes[ task.m_Node ];
+        node.m_Bounds = bounds;
+        node.m_Offset = task.m_Begin;
+        node.m_Count = task.m_End - task.m_Begin;
+
+        if ( node.m_Count <= leafItemCount )
+        {
+            continue;
+        }
+
+        // split at the median along the axis with the widest spread of centers
+        Vector3 extent = centerBounds.maximum - centerBounds.minimum;
+        uint32_t axis = ( extent.x >= extent.y && extent.x >= extent.z ) ? 0 : ( extent.y >= extent.z ? 1 : 2 );
+        if ( GetAxis( extent, axis ) <= 0.f )
+        {
+            // every center is coincident, splitting won't help
+            continue;
+        }
+
+        uint32_t middle = task.m_Begin + node.m_Count / 2;
+        std::nth_element( m_Items.begin() + task.m_Begin, m_Items.begin() + middle, m_Items.begin() + task.m_End, CenterCompare( m_Centers, axis ) );
+
+        uint32_t left = (uint32_t)m_Nodes.size();
+        node.m_Offset = left;
+        node.m_Count = 0;
+
+        // node is invalidated by these
+        m_Nodes.push_back( Node () );
+        m_Nodes.push_back( Node () );
+
+        BuildTask leftTask = { left, task.m_Begin, middle };
+        BuildTask rightTask = { left + 1, middle, task.m_End };
+        tasks.push_back( rightTask );
+        tasks.push_back( leftTask );
+    }
+
+    m_Centers.clear();
+}
+
+void BoundingVolumeHierarchy::Query( const PickVisitor* pick, std::vector< uint32_t >& items ) const
+{
+    if ( m_Nodes.empty() )
+    {
+        return;
+    }
+
+    size_t first = items.size();
+
+    m_Stack.clear();
+    m_Stack.push_back( 0 );
+
+    while ( !m_Stack.empty() )
+    {
+        const Node& node = m_Nodes[ m_Stack.back() ];
+        m_Stack.pop_back();
+
+        if ( !pick->IntersectsBox( node.m_Bounds ) )
+        {
+            continue;
+        }
+
+        if ( node.m_Count )
+        {
+            items.insert( items.end(), m_Items.begin() + node.m_Offset, m_Items.begin() + node.m_Offset + node.m_Count );
+        }
+        else
+        {
+            m_Stack.push_back( node.m_Offset + 1 );
+            m_Stack.push_back( node.m_Offset );
+        }
+    }
+
+    // callers expect the same order a linear walk would produce
+    std::sort( items.begin() + first, items.end() );
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Math/AlignedBox.h"
+
+#include "SceneGraph/API.h"
+
+#include <vector>
+
+namespace Helium
+{
+    namespace SceneGraph
+    {
+        class PickVisitor;
+
+        //
+        // Bounding Volume Hierarchy
+        //  Static binary tree of axis aligned boxes used to cull picking work.
+        //   o Built from a flat array of item bounds, items are referred to by their index in that array.
+        //   o Interior nodes store their two children next to each other in the node array.
+        //   o Queries test node bounds with the pick's IntersectsBox(), in whatever space the pick is currently in.
+        //
+
+        class HELIUM_SCENE_GRAPH_API BoundingVolumeHierarchy
+        {
+        public:
+            BoundingVolumeHierarchy();
+
+            // discard all nodes and items
+            void Clear();
+
+            bool IsEmpty() const
+            {
+                return m_Nodes.empty();
+            }
+
+            uint32_t GetItemCount() const
+            {
+                return (uint32_t)m_Items.size();
+            }
+
+            // build the tree over the given item bounds, each box is grown by the specified slop
+            void Build( const std::vector< AlignedBox >& itemBounds, uint32_t leafItemCount = 4, float32_t slop = 0.f );
+
+            // append the indices of items whose leaves intersect the pick, sorted by item index
+            void Query( const PickVisitor* pick, std::vector< uint32_t >& items ) const;
+
+        private:
+            struct Node
+            {
+                AlignedBox  m_Bounds;
+                uint32_t    m_Offset;   // first item for leaves, first of the two children for interior nodes
+                uint32_t    m_Count;    // item count for leaves, zero for interior nodes
+            };
+
+            std::vector< Node >         m_Nodes;
+            std::vector< uint32_t >     m_Items;
+
+            // scratch storage for building and traversal
+            std::vector< Vector3 >      m_Centers;
+            mutable std::vector< uint32_t > m_Stack;
+        };
+    }
+}
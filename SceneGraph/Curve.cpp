@@ -780,6 +780,12 @@ void Curve::Evaluate( GraphDirection direction )
     Base::Evaluate(direction);
 }
 
+bool Curve::IsEvaluateThreadSafe( GraphDirection direction ) const
+{
+    // evaluation updates our render buffers, which must happen on the main thread
+    return false;
+}
+
 void Curve::Render( RenderVisitor* render )
 {
     HELIUM_ASSERT( render );
@@ -135,6 +135,7 @@ namespace Helium
             virtual UndoCommandPtr CenterTransform() HELIUM_OVERRIDE;
 
             virtual void Evaluate( GraphDirection direction ) HELIUM_OVERRIDE;
+            virtual bool IsEvaluateThreadSafe( GraphDirection direction ) const HELIUM_OVERRIDE;
             float32_t CalculateCurveLength() const;
 
             virtual void Render( RenderVisitor* render ) HELIUM_OVERRIDE;
@@ -84,6 +84,12 @@ void CurveControlPoint::Evaluate( GraphDirection direction )
     }
 }
 
+bool CurveControlPoint::IsEvaluateThreadSafe( GraphDirection direction ) const
+{
+    // only writes our own bounds and visibility, reading the parent and layers evaluated at earlier levels
+    return true;
+}
+
 Matrix4 CurveControlPointTranslateManipulatorAdapter::GetFrame(ManipulatorSpace space)
 {
     // base object manip frame
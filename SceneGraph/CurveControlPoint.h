@@ -26,6 +26,7 @@ namespace Helium
             virtual void ConnectManipulator( ManiuplatorAdapterCollection* collection ) HELIUM_OVERRIDE;
             virtual bool Pick( PickVisitor* pick ) HELIUM_OVERRIDE;
             virtual void Evaluate( GraphDirection direction ) HELIUM_OVERRIDE;
+            virtual bool IsEvaluateThreadSafe( GraphDirection direction ) const HELIUM_OVERRIDE;
 
 		private:
             Vector3 m_Position;
@@ -2,6 +2,8 @@
 #include "Graph.h"
 #include "SceneGraph/SceneNode.h"
 
+#include "Engine/ParallelFor.h"
+
 #include <stack>
 
 //#define SCENE_DEBUG_EVALUATE
@@ -11,6 +13,28 @@ HELIUM_DEFINE_CLASS( Helium::SceneGraph::Graph );
 using namespace Helium;
 using namespace Helium::SceneGraph;
 
+// marks a node whose dependency level is still being computed
+static const uint32_t EVALUATION_LEVEL_PENDING = 0xffffffff;
+
+// dependency levels with fewer thread-safe nodes than this are evaluated inline
+static const size_t EVALUATE_PARALLEL_NODE_COUNT_MIN = 256;
+
+// maximum number of nodes to evaluate in each job
+static const size_t EVALUATE_JOB_NODE_COUNT_MAX = 128;
+
+namespace Helium
+{
+    namespace SceneGraph
+    {
+        // one dependency level's worth of thread-safe nodes, handed to ParallelFor
+        struct EvaluateNodesRange
+        {
+            SceneNode* const* pNodes;
+            GraphDirection direction;
+        };
+    }
+}
+
 void Graph::InitializeType()
 {
 
@@ -220,21 +244,8 @@ EvaluateResult Graph::EvaluateGraph(bool silent)
 
     m_EvaluatedNodes.clear();
 
-    for ( S_SceneNodeDumbPtr::const_iterator itr = m_TerminalNodes.begin(), end = m_TerminalNodes.end(); itr != end; ++itr )
-    {
-        if ((*itr)->GetNodeState(GraphDirections::Downstream) == NodeStates::Dirty)
-        {
-            Evaluate(*itr, GraphDirections::Downstream);
-        }
-    }
-
-    for ( S_SceneNodeDumbPtr::const_iterator itr = m_OriginalNodes.begin(), end = m_OriginalNodes.end(); itr != end; ++itr )
-    {
-        if ((*itr)->GetNodeState(GraphDirections::Upstream) == NodeStates::Dirty)
-        {
-            Evaluate(*itr, GraphDirections::Upstream);
-        }
-    }
+    Evaluate( m_TerminalNodes, GraphDirections::Downstream );
+    Evaluate( m_OriginalNodes, GraphDirections::Upstream );
 
     result.m_NodeCount = (int)m_EvaluatedNodes.size();
 
@@ -247,39 +258,196 @@ EvaluateResult Graph::EvaluateGraph(bool silent)
     return result;
 }
 
-void Graph::Evaluate(SceneGraph::SceneNode* node, GraphDirection direction)
+template< class NeighborSetType >
+void Graph::CollectDirtyNodes(const S_SceneNodeDumbPtr& roots, GraphDirection direction, const NeighborSetType& (SceneNode::*getNeighbors)() const)
 {
-    switch (direction)
+    uint32_t visitedID = AssignVisitedID();
+
+    m_EvaluationNodes.clear();
+    m_EvaluationStack.clear();
+
+    for ( S_SceneNodeDumbPtr::const_iterator itr = roots.begin(), end = roots.end(); itr != end; ++itr )
     {
-    case GraphDirections::Downstream:
+        if ((*itr)->GetNodeState(direction) == NodeStates::Dirty)
         {
-            for ( S_SceneNodeDumbPtr::const_iterator itr = node->GetAncestors().begin(), end = node->GetAncestors().end(); itr != end; ++itr )
+            m_EvaluationStack.push_back( std::make_pair( *itr, false ) );
+        }
+    }
+
+    // depth first, a node is finished once all of its dirty dependencies are finished
+    while (!m_EvaluationStack.empty())
+    {
+        SceneNode* node = m_EvaluationStack.back().first;
+        bool finish = m_EvaluationStack.back().second;
+
+        m_EvaluationStack.pop_back();
+
+        const NeighborSetType& neighbors = (node->*getNeighbors)();
+
+        if (!finish)
+        {
+            if (node->GetVisitedID() == visitedID)
             {
-                if ((*itr)->GetNodeState(direction) == NodeStates::Dirty)
+                continue;
+            }
+
+            node->SetVisitedID( visitedID );
+            node->SetEvaluationLevel( EVALUATION_LEVEL_PENDING );
+
+            m_EvaluationStack.push_back( std::make_pair( node, true ) );
+
+            for ( typename NeighborSetType::const_iterator itr = neighbors.begin(), end = neighbors.end(); itr != end; ++itr )
+            {
+                SceneNode* neighbor = *itr;
+                if (neighbor->GetNodeState(direction) == NodeStates::Dirty && neighbor->GetVisitedID() != visitedID)
                 {
-                    Evaluate(*itr, direction);
+                    m_EvaluationStack.push_back( std::make_pair( neighbor, false ) );
                 }
             }
+        }
+        else
+        {
+            // we sit one level past our deepest dirty dependency
+            uint32_t level = 0;
+
+            for ( typename NeighborSetType::const_iterator itr = neighbors.begin(), end = neighbors.end(); itr != end; ++itr )
+            {
+                SceneNode* neighbor = *itr;
+                if (neighbor->GetNodeState(direction) == NodeStates::Dirty && neighbor->GetVisitedID() == visitedID)
+                {
+                    uint32_t neighborLevel = neighbor->GetEvaluationLevel();
+
+                    // a pending neighbor means a cycle, which the graph shouldn't contain
+                    HELIUM_ASSERT( neighborLevel != EVALUATION_LEVEL_PENDING );
+                    if (neighborLevel != EVALUATION_LEVEL_PENDING && neighborLevel + 1 > level)
+                    {
+                        level = neighborLevel + 1;
+                    }
+                }
+            }
+
+            node->SetEvaluationLevel( level );
+
+            m_EvaluationNodes.push_back( node );
+        }
+    }
+}
 
+void Graph::Evaluate(const S_SceneNodeDumbPtr& roots, GraphDirection direction)
+{
+    switch (direction)
+    {
+    case GraphDirections::Downstream:
+        {
+            // ancestors must be clean before we evaluate
+            CollectDirtyNodes< S_SceneNodeDumbPtr >( roots, direction, &SceneNode::GetAncestors );
             break;
         }
 
     case GraphDirections::Upstream:
         {
-            for ( S_SceneNodeSmartPtr::const_iterator itr = node->GetDescendants().begin(), end = node->GetDescendants().end(); itr != end; ++itr )
+            // descendants must be clean before we evaluate
+            CollectDirtyNodes< S_SceneNodeSmartPtr >( roots, direction, &SceneNode::GetDescendants );
+            break;
+        }
+    }
+
+    if (m_EvaluationNodes.empty())
+    {
+        return;
+    }
+
+    //
+    // Bucket the nodes by level, nodes within a level don't depend on each other
+    //
+
+    uint32_t levelCount = 0;
+    for ( V_SceneNodeDumbPtr::const_iterator itr = m_EvaluationNodes.begin(), end = m_EvaluationNodes.end(); itr != end; ++itr )
+    {
+        levelCount = std::max( levelCount, (*itr)->GetEvaluationLevel() + 1 );
+    }
+
+    m_EvaluationLevelOffsets.assign( levelCount + 1, 0 );
+    for ( V_SceneNodeDumbPtr::const_iterator itr = m_EvaluationNodes.begin(), end = m_EvaluationNodes.end(); itr != end; ++itr )
+    {
+        m_EvaluationLevelOffsets[ (*itr)->GetEvaluationLevel() + 1 ]++;
+    }
+
+    for ( uint32_t level = 1; level <= levelCount; ++level )
+    {
+        m_EvaluationLevelOffsets[ level ] += m_EvaluationLevelOffsets[ level - 1 ];
+    }
+
+    m_EvaluationOrder.resize( m_EvaluationNodes.size() );
+    for ( V_SceneNodeDumbPtr::const_iterator itr = m_EvaluationNodes.begin(), end = m_EvaluationNodes.end(); itr != end; ++itr )
+    {
+        // the finish order is a valid serial order, so keep it stable within each level
+        m_EvaluationOrder[ m_EvaluationLevelOffsets[ (*itr)->GetEvaluationLevel() ]++ ] = *itr;
+    }
+
+    // placement advanced each offset to the end of its level, shift them back to the start
+    for ( uint32_t level = levelCount; level > 0; --level )
+    {
+        m_EvaluationLevelOffsets[ level ] = m_EvaluationLevelOffsets[ level - 1 ];
+    }
+    m_EvaluationLevelOffsets[ 0 ] = 0;
+
+    //
+    // Evaluate each level, farming thread-safe nodes out to the job system
+    //
+
+    for ( uint32_t level = 0; level < levelCount; ++level )
+    {
+        SceneNode* const* levelNodes = &m_EvaluationOrder[ m_EvaluationLevelOffsets[ level ] ];
+        size_t levelNodeCount = m_EvaluationLevelOffsets[ level + 1 ] - m_EvaluationLevelOffsets[ level ];
+
+        m_EvaluationParallelNodes.clear();
+        for ( size_t i = 0; i < levelNodeCount; ++i )
+        {
+            SceneNode* node = levelNodes[ i ];
+            if (node->IsEvaluateThreadSafe( direction ))
             {
-                if ((*itr)->GetNodeState(direction) == NodeStates::Dirty)
-                {
-                    Evaluate(*itr, direction);
-                }
+                m_EvaluationParallelNodes.push_back( node );
+            }
+            else
+            {
+                EvaluateNodes( &node, 1, direction );
             }
+        }
 
-            break;
+        if (m_EvaluationParallelNodes.size() >= EVALUATE_PARALLEL_NODE_COUNT_MIN)
+        {
+            EvaluateNodesRange range;
+            range.pNodes = &m_EvaluationParallelNodes[ 0 ];
+            range.direction = direction;
+            ParallelFor( EvaluateNodesSlice, &range, m_EvaluationParallelNodes.size(), EVALUATE_JOB_NODE_COUNT_MAX );
+        }
+        else if (!m_EvaluationParallelNodes.empty())
+        {
+            EvaluateNodes( &m_EvaluationParallelNodes[ 0 ], m_EvaluationParallelNodes.size(), direction );
+        }
+
+        // back on the main thread, let nodes publish anything they deferred
+        for ( size_t i = 0; i < levelNodeCount; ++i )
+        {
+            levelNodes[ i ]->EvaluateComplete( direction );
+
+            m_EvaluatedNodes.insert( levelNodes[ i ] );
         }
     }
+}
 
-    // perform evaluate
-    node->DoEvaluate(direction);
+void Graph::EvaluateNodesSlice(void* pUserData, size_t begin, size_t end)
+{
+    const EvaluateNodesRange* pRange = static_cast< const EvaluateNodesRange* >( pUserData );
+    EvaluateNodes( pRange->pNodes + begin, end - begin, pRange->direction );
+}
 
-    m_EvaluatedNodes.insert( node );
-}
\ No newline at end of file
+void Graph::EvaluateNodes(SceneGraph::SceneNode* const* nodes, size_t count, GraphDirection direction)
+{
+    for ( size_t i = 0; i < count; ++i )
+    {
+        // perform evaluate
+        nodes[ i ]->DoEvaluate( direction );
+    }
+}
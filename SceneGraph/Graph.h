@@ -84,8 +84,18 @@ namespace Helium
             EvaluateResult EvaluateGraph(bool silent = false);
 
         private:
-            // walk upstream and evaluate graph
-            void Evaluate(SceneGraph::SceneNode* node, GraphDirection direction);
+            // sort dirty nodes into dependency levels, then evaluate level by level
+            void Evaluate(const S_SceneNodeDumbPtr& roots, GraphDirection direction);
+
+            // compute the dependency level of every dirty node reachable from the roots
+            template< class NeighborSetType >
+            void CollectDirtyNodes(const S_SceneNodeDumbPtr& roots, GraphDirection direction, const NeighborSetType& (SceneNode::*getNeighbors)() const);
+
+            // evaluate a range of nodes that are independent of each other (may run on a worker thread)
+            static void EvaluateNodes(SceneGraph::SceneNode* const* nodes, size_t count, GraphDirection direction);
+
+            // ParallelFor callback evaluating a slice of a dependency level's thread-safe nodes
+            static void EvaluateNodesSlice(void* pUserData, size_t begin, size_t end);
 
         protected:
             mutable SceneGraphEvaluatedSignature::Event m_EvaluatedEvent;
@@ -120,6 +130,13 @@ namespace Helium
 
             // number of nodes evaluated
             S_SceneNodeDumbPtr m_EvaluatedNodes;
+
+            // scratch storage for evaluation, kept around to avoid reallocating every evaluation
+            std::vector< std::pair< SceneNode*, bool > > m_EvaluationStack;
+            V_SceneNodeDumbPtr m_EvaluationNodes;
+            V_SceneNodeDumbPtr m_EvaluationOrder;
+            V_SceneNodeDumbPtr m_EvaluationParallelNodes;
+            std::vector< uint32_t > m_EvaluationLevelOffsets;
         };
     }
 }
\ No newline at end of file
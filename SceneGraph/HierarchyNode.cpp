@@ -48,6 +48,7 @@ HierarchyNode::HierarchyNode()
 , m_Next( NULL )
 , m_LayerColor( NULL )
 , m_Visible( true )
+, m_VisibilityDirty( false )
 , m_Selectable( true )
 , m_Highlighted( false )
 , m_Reactive( false )
@@ -640,7 +641,8 @@ void HierarchyNode::Evaluate(GraphDirection direction)
             m_Visible = ComputeVisibility();
             if ( previousVisiblity != m_Visible )
             {
-                m_VisibilityChanged.Raise( SceneNodeChangeArgs( this ) );
+                // listeners are UI, so defer until we are back on the main thread
+                m_VisibilityDirty = true;
             }
 
             m_Selectable = ComputeSelectability();
@@ -685,6 +687,17 @@ void HierarchyNode::Evaluate(GraphDirection direction)
     Base::Evaluate(direction);
 }
 
+void HierarchyNode::EvaluateComplete(GraphDirection direction)
+{
+    if ( m_VisibilityDirty )
+    {
+        m_VisibilityDirty = false;
+        m_VisibilityChanged.Raise( SceneNodeChangeArgs( this ) );
+    }
+
+    Base::EvaluateComplete(direction);
+}
+
 bool HierarchyNode::BoundsCheck(const Matrix4& instanceMatrix) const
 {
     SceneGraph::Camera* camera = m_Owner->GetViewport()->GetCamera();
@@ -241,6 +241,9 @@ namespace Helium
             // update our global bounding volume for culling
             virtual void Evaluate(GraphDirection direction) HELIUM_OVERRIDE;
 
+            // visibility change events are deferred to EvaluateComplete(), so Evaluate() itself only touches this node
+            virtual void EvaluateComplete(GraphDirection direction) HELIUM_OVERRIDE;
+
         public:
             // do bounds check
             virtual bool BoundsCheck(const Matrix4& instanceMatrix) const;
@@ -313,6 +316,7 @@ namespace Helium
 
             // Non-reflected
             bool                        m_Visible;                  // computed from layers
+            bool                        m_VisibilityDirty;          // visibility changed during evaluate, raise event on completion
             bool                        m_Selectable;               // computed from layers
             bool                        m_Highlighted;              // highlight state in 3d
             bool                        m_Reactive;                 // when a node's parent is selected, meaning that if you move the parent, this node will also move.
@@ -49,6 +49,8 @@ Mesh::Mesh()
 , m_LineCount( 0x0 )
 , m_VertexCount( 0x0 )
 , m_TriangleCount( 0x0 )
+, m_PickBVHsDirty( true )
+, m_PickPositionsHash( 0 )
 {
 
 }
@@ -106,6 +108,9 @@ void Mesh::Initialize()
         }
     }
 
+    // geometry was (re)loaded, rebuild pick hierarchies on the next pick
+    m_PickBVHsDirty = true;
+
     m_LineCount = (uint32_t)m_WireframeVertexIndices.size() / 2;
     m_VertexCount = (uint32_t)m_Positions.size();
     m_TriangleCount = (uint32_t)m_TriangleVertexIndices.size() / 3;
@@ -227,9 +232,24 @@ void Mesh::Evaluate(GraphDirection direction)
         {
             m_ObjectBounds.Reset();
 
+            // most downstream evaluations are transform changes, which don't touch our local space geometry, so
+            //  fingerprint the positions while bounding them and only rebuild the pick hierarchies if they moved
+            uint32_t positionsHash = 0x811c9dc5;
             for ( uint32_t i=0; i<m_VertexCount; ++i )
             {
                 m_ObjectBounds.Test( m_Positions[i] );
+
+                const uint8_t* bytes = reinterpret_cast< const uint8_t* >( &m_Positions[i] );
+                for ( size_t b=0; b<sizeof( Vector3 ); ++b )
+                {
+                    positionsHash = ( positionsHash ^ bytes[b] ) * 0x01000193;
+                }
+            }
+
+            if ( positionsHash != m_PickPositionsHash )
+            {
+                m_PickPositionsHash = positionsHash;
+                m_PickBVHsDirty = true;
             }
 
             if (m_IsInitialized)
@@ -575,20 +595,30 @@ bool Mesh::Pick( PickVisitor* pick )
     // set the pick's matrices to process intersections in this space
     pick->SetCurrentObject (this, pick->State().m_Matrix);
 
+    UpdatePickBVHs();
+
+    m_PickCandidates.clear();
+
     if (pick->GetCamera()->GetShadingMode() == ShadingMode::Wireframe)
     {
-        // test each segment (vertex data is in local space, intersection function will transform)
-        for (size_t i=0; i<m_WireframeVertexIndices.size(); i+=2)
+        // test each segment whose bounds the pick touches (vertex data is in local space, intersection function will transform)
+        m_SegmentBVH.Query( pick, m_PickCandidates );
+
+        for ( std::vector< uint32_t >::const_iterator itr = m_PickCandidates.begin(), end = m_PickCandidates.end(); itr != end; ++itr )
         {
+            size_t i = (*itr) * 2;
             pick->PickSegment(m_Positions[ m_WireframeVertexIndices[i] ],
                 m_Positions[ m_WireframeVertexIndices[i+1] ]);
         }
     }
     else
     {
-        // test each triangle (vertex data is in local space, intersection function will transform)
-        for (size_t i=0; i<m_TriangleVertexIndices.size(); i+=3)
+        // test each triangle whose bounds the pick touches (vertex data is in local space, intersection function will transform)
+        m_TriangleBVH.Query( pick, m_PickCandidates );
+
+        for ( std::vector< uint32_t >::const_iterator itr = m_PickCandidates.begin(), end = m_PickCandidates.end(); itr != end; ++itr )
         {
+            size_t i = (*itr) * 3;
             pick->PickTriangle(m_Positions[ m_TriangleVertexIndices[i] ],
                 m_Positions[ m_TriangleVertexIndices[i+1] ],
                 m_Positions[ m_TriangleVertexIndices[i+2] ]);
@@ -598,6 +628,41 @@ bool Mesh::Pick( PickVisitor* pick )
     return pick->GetHits().size() > high;
 }
 
+void Mesh::UpdatePickBVHs()
+{
+    // editing functions change the index arrays directly, so catch those too
+    if ( !m_PickBVHsDirty
+        && m_TriangleBVH.GetItemCount() == m_TriangleVertexIndices.size() / 3
+        && m_SegmentBVH.GetItemCount() == m_WireframeVertexIndices.size() / 2 )
+    {
+        return;
+    }
+
+    std::vector< AlignedBox > bounds;
+
+    // grow by the pick slop so near misses that the line pick accepts aren't culled
+    bounds.resize( m_TriangleVertexIndices.size() / 3 );
+    for ( size_t i = 0; i < bounds.size(); ++i )
+    {
+        bounds[ i ].Reset();
+        bounds[ i ].Test( m_Positions[ m_TriangleVertexIndices[ i * 3 ] ] );
+        bounds[ i ].Test( m_Positions[ m_TriangleVertexIndices[ i * 3 + 1 ] ] );
+        bounds[ i ].Test( m_Positions[ m_TriangleVertexIndices[ i * 3 + 2 ] ] );
+    }
+    m_TriangleBVH.Build( bounds, 8, HELIUM_LINEAR_INTERSECTION_ERROR );
+
+    bounds.resize( m_WireframeVertexIndices.size() / 2 );
+    for ( size_t i = 0; i < bounds.size(); ++i )
+    {
+        bounds[ i ].Reset();
+        bounds[ i ].Test( m_Positions[ m_WireframeVertexIndices[ i * 2 ] ] );
+        bounds[ i ].Test( m_Positions[ m_WireframeVertexIndices[ i * 2 + 1 ] ] );
+    }
+    m_SegmentBVH.Build( bounds, 8, HELIUM_LINEAR_INTERSECTION_ERROR );
+
+    m_PickBVHsDirty = false;
+}
+
 
 void Mesh::ComputeTNBs()
 {
@@ -3,6 +3,7 @@
 #include "Math/CalculateBounds.h"
 #include "Math/AlignedBox.h"
 
+#include "SceneGraph/BoundingVolumeHierarchy.h"
 #include "SceneGraph/VertexResource.h"
 #include "SceneGraph/IndexResource.h"
 #include "SceneGraph/PivotTransform.h"
@@ -126,6 +127,10 @@ namespace Helium
 
             uint32_t AddShader( Shader* shader );
 
+        protected:
+            // (re)build the pick acceleration structures if the geometry changed since they were built
+            void UpdatePickBVHs();
+
             // temp hack
             friend class Skin;
 
@@ -196,6 +201,11 @@ namespace Helium
             std::vector< uint32_t > m_ShaderStartIndices;   // the start index of each shader-sorted segment of indices
             IndexResourcePtr        m_Indices;
             VertexResourcePtr       m_Vertices;
+            BoundingVolumeHierarchy m_TriangleBVH;          // triangles by index, built on first pick
+            BoundingVolumeHierarchy m_SegmentBVH;           // wireframe segments by index, built on first pick
+            bool                    m_PickBVHsDirty;        // geometry changed since the pick hierarchies were built
+            uint32_t                m_PickPositionsHash;    // fingerprint of the positions as of the last evaluation
+            std::vector< uint32_t > m_PickCandidates;       // scratch for pick queries
         };
         typedef Helium::StrongPtr< Mesh > MeshPtr;
     }
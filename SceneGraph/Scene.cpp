@@ -16,6 +16,7 @@
 #include "SceneGraph/Statistics.h"
 #include "SceneGraph/SceneSettings.h"
 #include "SceneGraph/SceneManifest.h"
+#include "SceneGraph/SceneBinaryFile.h"
 #include "SceneGraph/ParentCommand.h"
 #include "SceneGraph/PivotTransform.h"
 #include "SceneGraph/JointTransform.h"
@@ -47,6 +48,7 @@ Scene::Scene( SceneGraph::Viewport* viewport, const Helium::FilePath& path, Scen
 , m_ValidSmartDuplicateMatrix( false )
 , m_Color( 255 )
 , m_IsFocused( true )
+, m_PickBVHDirty( true )
 {
 	// This event delegate will cause the scene to execute and render a frame to effect the visual outcome of a selection change
 	m_Selection.AddChangingListener( SelectionChangingSignature::Delegate (this, &Scene::SelectionChanging) );
@@ -214,30 +216,54 @@ UndoCommandPtr Scene::Import( const Helium::FilePath& path, ImportAction action,
 
 	// read data
 	m_Progress = 0;
-	std::vector< Reflect::ObjectPtr > elements;
 
 	bool success = true;
+	UndoCommandPtr command;
 
-	try
+	if ( SceneBinaryFile::IsBinaryScene( path ) )
 	{
-#if REFLECT_REFACTOR
-		Persist::ArchiveReaderPtr archive = Persist::GetReader( path );
-		archive->e_Status.AddMethod( this, &Scene::ArchiveStatus );
-		archive->Get( elements );
-#endif
+		// nodes are deserialized in parallel chunks and imported a chunk at a time as they arrive, so the whole
+		//  file is never held in memory.  Whatever was imported before a failure is still hooked up to the graph.
+		uint64_t startTimer = Helium::TimerGetClock();
+		BatchUndoCommandPtr batch = new BatchUndoCommand ();
+		V_SceneNodeSmartPtr createdNodes;
+
+		BeginImportSceneNodes();
+
+		ImportChunkContext context;
+		context.m_Scene = this;
+		context.m_Command = batch.Ptr();
+		context.m_CreatedNodes = &createdNodes;
+		context.m_Action = action;
+		context.m_ImportFlags = importFlags;
+		context.m_ImportReflectType = importReflectType;
+		success = SceneBinaryFile::Read( path, &Scene::ImportChunk, &context );
+
+		command = EndImportSceneNodes( batch, createdNodes, importFlags, startTimer );
 	}
-	catch ( const Helium::Exception& exception )
+	else
 	{
-		Log::Error( TXT( "%s\n" ), exception.What() );
-		success = false;
-	}
+		std::vector< Reflect::ObjectPtr > elements;
 
-	UndoCommandPtr command;
+		try
+		{
+#if REFLECT_REFACTOR
+			Persist::ArchiveReaderPtr archive = Persist::GetReader( path );
+			archive->e_Status.AddMethod( this, &Scene::ArchiveStatus );
+			archive->Get( elements );
+#endif
+		}
+		catch ( const Helium::Exception& exception )
+		{
+			Log::Error( TXT( "%s\n" ), exception.What() );
+			success = false;
+		}
 
-	if ( success )
-	{
-		// load and init nodes
-		command = ImportSceneNodes( elements, action, importFlags, importReflectType );
+		if ( success )
+		{
+			// load and init nodes
+			command = ImportSceneNodes( elements, action, importFlags, importReflectType );
+		}
 	}
 
 	m_ImportRoot = m_Root;
@@ -324,6 +350,11 @@ void Scene::Reset()
 	// Clear flat hash of nodes
 	m_Nodes.clear();
 
+	// Drop pick acceleration, it points at the nodes
+	m_PickBVH.Clear();
+	m_PickNodes.clear();
+	m_PickBVHDirty = true;
+
 	// Reset root
 	if ( m_Root.ReferencesObject() )
 	{
@@ -337,15 +368,7 @@ UndoCommandPtr Scene::ImportSceneNodes( std::vector< Reflect::ObjectPtr >& eleme
 
 	uint64_t startTimer = Helium::TimerGetClock();
 
-	// 
-	// Initialize
-	// 
-
-	m_Importing = true;
-	e_SceneContextChanged.Raise( SceneContextChangeArgs( SceneContexts::Normal, SceneContexts::Loading ) );
-	e_StatusChanged.Raise( std::string( TXT("Loading Objects") ) );
-
-	m_RemappedIDs.clear();
+	BeginImportSceneNodes();
 
 	// 
 	// Load Elements
@@ -364,6 +387,34 @@ UndoCommandPtr Scene::ImportSceneNodes( std::vector< Reflect::ObjectPtr >& eleme
 		}
 	}
 
+	return EndImportSceneNodes( command, createdNodes, importFlags, startTimer );
+}
+
+void Scene::BeginImportSceneNodes()
+{
+	m_Importing = true;
+	e_SceneContextChanged.Raise( SceneContextChangeArgs( SceneContexts::Normal, SceneContexts::Loading ) );
+	e_StatusChanged.Raise( std::string( TXT("Loading Objects") ) );
+
+	m_RemappedIDs.clear();
+}
+
+void Scene::ImportChunk( void* context, std::vector< Reflect::ObjectPtr >& elements )
+{
+	ImportChunkContext& rContext = *static_cast< ImportChunkContext* >( context );
+
+	std::vector< Reflect::ObjectPtr >::const_iterator itr = elements.begin();
+	std::vector< Reflect::ObjectPtr >::const_iterator end = elements.end();
+	for ( ; itr != end; ++itr )
+	{
+		UndoCommandPtr command = rContext.m_Scene->ImportSceneNode(
+			*itr, *rContext.m_CreatedNodes, rContext.m_Action, rContext.m_ImportFlags, rContext.m_ImportReflectType );
+		rContext.m_Command->Push( command );
+	}
+}
+
+UndoCommandPtr Scene::EndImportSceneNodes( const BatchUndoCommandPtr& command, V_SceneNodeSmartPtr& createdNodes, uint32_t importFlags, uint64_t startTimer )
+{
 	// 
 	// Build Hierarchy
 	// 
@@ -845,7 +896,15 @@ void Scene::ExportHierarchyNode( SceneGraph::HierarchyNode* node, std::vector< R
 bool Scene::Serialize()
 {
 	HELIUM_ASSERT( !m_Path.empty() );
-	return Export( m_Path, ExportFlags::Default );
+
+	// the binary format is opt-in, by extension or by the file already being a binary scene
+	uint32_t flags = ExportFlags::Default;
+	if ( m_Path.HasExtension( SceneBinaryFile::EXTENSION ) || SceneBinaryFile::IsBinaryScene( m_Path ) )
+	{
+		flags |= ExportFlags::Binary;
+	}
+
+	return Export( m_Path, flags );
 }
 
 bool Scene::Export( const Helium::FilePath& path, const ExportArgs& args )
@@ -869,7 +928,20 @@ bool Scene::Export( const Helium::FilePath& path, const ExportArgs& args )
 	std::vector< Reflect::ObjectPtr > spool;
 	result = Export( spool, args, changes );
 
-	if (result)
+	if ( result && ExportFlags::HasFlag( args.m_Flags, ExportFlags::Binary ) )
+	{
+		// only the nodes that changed since the file was last written are appended to it
+		uint32_t writtenCount = 0;
+		result = SceneBinaryFile::Write( path, spool, &writtenCount );
+
+		if ( result )
+		{
+			std::ostringstream str;
+			str << "Wrote " << writtenCount << " changed of " << spool.size() << " objects to: " << path.c_str();
+			e_StatusChanged.Raise( str.str() );
+		}
+	}
+	else if (result)
 	{
 		try
 		{
@@ -1183,6 +1255,8 @@ void Scene::AddSceneNode( const SceneNodePtr& node )
 {
 	node->SetOwner( this );
 
+	m_PickBVHDirty = true;
+
 	{
 		SCENE_GRAPH_SCOPE_TIMER( ("Insert in node list") );
 
@@ -1235,6 +1309,8 @@ void Scene::RemoveSceneNode( const SceneNodePtr& node )
 {
 	SCENE_GRAPH_SCOPE_TIMER( ("") );
 
+	m_PickBVHDirty = true;
+
 	if ( !node->IsTransient() )
 	{
 		e_NodeRemoving.Raise( NodeChangeArgs( node.Ptr() ) );
@@ -1298,9 +1374,44 @@ bool Scene::Pick( PickVisitor* pick ) const
 
 	size_t hitCount = pick->GetHits().size();
 
-	HierarchyPickTraverser pickTraverser ( pick );
+	if ( m_PickBVHDirty )
+	{
+		SCENE_GRAPH_SCOPE_TIMER( ("Build pick BVH") );
+
+		HierarchyPickBoundsTraverser boundsTraverser;
+		m_Root->TraverseHierarchy( &boundsTraverser );
+
+		m_PickNodes.swap( boundsTraverser.m_Nodes );
+		m_PickBVH.Build( boundsTraverser.m_Bounds );
+		m_PickBVHDirty = false;
+	}
+
+	Matrix4 matrix = pick->State().m_Matrix;
 
-	m_Root->TraverseHierarchy ( &pickTraverser );
+	// cull against global bounds, then do the same per-node tests as HierarchyPickTraverser on what survives
+	pick->SetCurrentObject( NULL, matrix );
+
+	m_PickCandidates.clear();
+	m_PickBVH.Query( pick, m_PickCandidates );
+
+	for ( std::vector< uint32_t >::const_iterator itr = m_PickCandidates.begin(), end = m_PickCandidates.end(); itr != end; ++itr )
+	{
+		HierarchyNode* node = m_PickNodes[ *itr ];
+
+		pick->State().m_Matrix = node->GetTransform()->GetGlobalTransform() * matrix;
+
+		if ( node->BoundsCheck( pick->State().m_Matrix ) && node->IsVisible() )
+		{
+			pick->SetCurrentObject( node, pick->State().m_Matrix );
+
+			if ( pick->IntersectsBox( node->GetObjectHierarchyBounds() ) )
+			{
+				node->Pick( pick );
+			}
+		}
+	}
+
+	pick->State().m_Matrix = matrix;
 
 	return pick->GetHits().size() > hitCount;
 }
@@ -1611,6 +1722,12 @@ void Scene::Evaluate(bool silent)
 
 	SceneGraph::EvaluateResult result = m_Graph->EvaluateGraph(silent);
 
+	if ( result.m_NodeCount )
+	{
+		// transforms or bounds may have moved
+		m_PickBVHDirty = true;
+	}
+
 	Statistics* stats = m_View->GetStatistics();
 	stats->m_EvaluateTime += result.m_TotalTime;
 	stats->m_NodeCount += result.m_NodeCount;
@@ -15,6 +15,7 @@
 #include "SceneGraph/PropertiesGenerator.h"
 
 #include "Pick.h"
+#include "BoundingVolumeHierarchy.h"
 #include "Tool.h"
 #include "SceneNode.h"
 #include "Graph.h"
@@ -115,6 +116,7 @@ namespace Helium
                     SelectedNodes         = 1 << 1, //!< Only export nodes that are selected
                     MaintainHierarchy     = 1 << 2, //!< Include Parents and children
                     MaintainDependencies  = 1 << 3, //!< Include layers, etc...
+                    Binary                = 1 << 4, //!< Write a SceneBinaryFile instead of a text archive (when exporting to a file)
 
                     Default = MaintainHierarchy | MaintainDependencies,
                 };
@@ -434,6 +436,22 @@ namespace Helium
 
             UndoCommandPtr ImportSceneNode( const Reflect::ObjectPtr& element, V_SceneNodeSmartPtr& createdNodes, ImportAction action, uint32_t importFlags, const Reflect::MetaClass* importReflectType = NULL  );
 
+            // ImportSceneNodes in steps, so nodes can be imported as they are read
+            void BeginImportSceneNodes();
+            UndoCommandPtr EndImportSceneNodes( const BatchUndoCommandPtr& command, V_SceneNodeSmartPtr& createdNodes, uint32_t importFlags, uint64_t startTimer );
+
+            // Imports each chunk of a binary scene as SceneBinaryFile::Read hands it over
+            struct ImportChunkContext
+            {
+                Scene*                      m_Scene;
+                BatchUndoCommand*           m_Command;
+                V_SceneNodeSmartPtr*        m_CreatedNodes;
+                ImportAction                m_Action;
+                uint32_t                    m_ImportFlags;
+                const Reflect::MetaClass*   m_ImportReflectType;
+            };
+            static void ImportChunk( void* context, std::vector< Reflect::ObjectPtr >& elements );
+
             /// @brief If this node has been remapped from another node, return the source nodes ID
             /// When we copy elements, we give them a new UniqueID. If we need information related
             /// to the original node, we need a way to gather the id of the original node.
@@ -533,6 +551,12 @@ namespace Helium
             Color3 m_Color;
 
             bool m_IsFocused;
+
+            // pick acceleration over global hierarchy bounds, rebuilt lazily after evaluation
+            mutable BoundingVolumeHierarchy m_PickBVH;
+            mutable std::vector< HierarchyNode* > m_PickNodes;
+            mutable std::vector< uint32_t > m_PickCandidates;
+            mutable bool m_PickBVHDirty;
         };
 
         typedef Helium::StrongPtr< Scene > ScenePtr;
@@ -0,0 +1,499 @@
+#include "SceneGraphPch.h"
+#include "SceneGraph/SceneBinaryFile.h"
+
+#include "Platform/Atomic.h"
+#include "Platform/Thread.h"
+#include "Foundation/FileStream.h"
+#include "Foundation/Log.h"
+#include "Foundation/MemoryStream.h"
+#include "Persist/ArchiveMessagePack.h"
+
+#include "SceneGraph/SceneNode.h"
+
+#include <map>
+
+using namespace Helium;
+using namespace Helium::SceneGraph;
+
+const tchar_t* const SceneBinaryFile::EXTENSION = TXT( ".hscn" );
+
+// chunks are deserialized on at most this many threads (including the caller), and at most this many chunks are
+//  held in memory waiting for the caller to take them
+static const uint32_t MAX_THREAD_COUNT = 4;
+static const uint32_t MAX_PENDING_CHUNK_COUNT = 2 * MAX_THREAD_COUNT;
+
+static const uint64_t FNV1A_64_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+static const uint64_t FNV1A_64_PRIME = 0x100000001b3ULL;
+
+///////////////////////////////////////////////////////////////////////////////
+// Compute a 64-bit FNV-1a hash of a block of memory.
+//
+static uint64_t HashContents( const uint8_t* pData, size_t size )
+{
+	uint64_t hash = FNV1A_64_OFFSET_BASIS;
+	for ( size_t i = 0; i < size; ++i )
+	{
+		hash ^= pData[ i ];
+		hash *= FNV1A_64_PRIME;
+	}
+
+	return hash;
+}
+
+namespace
+{
+	///////////////////////////////////////////////////////////////////////////////
+	// Deserializes the records of a binary scene in chunks on the calling thread
+	//  and a few worker threads, and hands each chunk to a callback on the calling
+	//  thread, in file order, as soon as it's ready.  Workers only run a few chunks
+	//  ahead of the callback, so the whole scene is never held in memory at once.
+	//
+	class ChunkReader
+	{
+	public:
+		ChunkReader( const FilePath& path, const std::vector< SceneBinaryFile::IndexEntry >& index )
+			: m_Path( path )
+			, m_Index( index )
+			, m_ChunkCount( static_cast< int32_t >(
+				( index.size() + SceneBinaryFile::CHUNK_OBJECT_COUNT - 1 ) / SceneBinaryFile::CHUNK_OBJECT_COUNT ) )
+			, m_NextChunk( 0 )
+			, m_TakenCount( 0 )
+			, m_Failed( false )
+		{
+			for ( uint32_t i = 0; i < MAX_PENDING_CHUNK_COUNT; ++i )
+			{
+				m_Chunks[ i ].m_Ready = 0;
+			}
+		}
+
+		bool Run( SceneBinaryFile::ReadChunkCallback callback, void* context )
+		{
+			uint32_t threadCount = Min< uint32_t >( MAX_THREAD_COUNT, static_cast< uint32_t >( m_ChunkCount ) );
+
+			uint32_t startedCount = 0;
+			for ( uint32_t i = 1; i < threadCount; ++i )
+			{
+				Helium::CallbackThread::Entry entry =
+					&Helium::CallbackThread::EntryHelper< ChunkReader, &ChunkReader::ProcessChunks >;
+				if ( !m_Threads[ startedCount ].Create( entry, this, TXT( "Scene Binary File Thread" ) ) )
+				{
+					// the calling thread picks up the slack
+					break;
+				}
+				++startedCount;
+			}
+
+			for ( int32_t chunk = 0; chunk < m_ChunkCount && !m_Failed; )
+			{
+				Chunk& rChunk = m_Chunks[ chunk % MAX_PENDING_CHUNK_COUNT ];
+				if ( !rChunk.m_Ready )
+				{
+					// help out while waiting on the workers
+					int32_t claimed = ClaimChunk();
+					if ( claimed >= 0 )
+					{
+						ReadChunk( claimed );
+					}
+					else
+					{
+						Thread::Yield();
+					}
+					continue;
+				}
+
+				if ( m_Failed )
+				{
+					break;
+				}
+
+				callback( context, rChunk.m_Objects );
+
+				// release the chunk before its slot is handed out again
+				std::vector< Reflect::ObjectPtr >().swap( rChunk.m_Objects );
+				rChunk.m_Ready = 0;
+				AtomicIncrementRelease( m_TakenCount );
+				++chunk;
+			}
+
+			// stop the workers early if we bailed out
+			bool failed = m_Failed;
+			m_Failed = true;
+
+			for ( uint32_t i = 0; i < startedCount; ++i )
+			{
+				m_Threads[ i ].Join();
+			}
+
+			return !failed;
+		}
+
+	private:
+		struct Chunk
+		{
+			std::vector< Reflect::ObjectPtr >   m_Objects;
+			volatile int32_t                    m_Ready;
+		};
+
+		// claim the next chunk if its slot is free, -1 if there's nothing to do right now
+		int32_t ClaimChunk()
+		{
+			for ( ;; )
+			{
+				int32_t next = m_NextChunk;
+				if ( m_Failed
+					|| next >= m_ChunkCount
+					|| next >= m_TakenCount + static_cast< int32_t >( MAX_PENDING_CHUNK_COUNT ) )
+				{
+					return -1;
+				}
+
+				if ( AtomicCompareExchangeRelease( m_NextChunk, next + 1, next ) == next )
+				{
+					return next;
+				}
+			}
+		}
+
+		void ProcessChunks()
+		{
+			while ( !m_Failed && m_NextChunk < m_ChunkCount )
+			{
+				int32_t chunk = ClaimChunk();
+				if ( chunk >= 0 )
+				{
+					ReadChunk( chunk );
+				}
+				else
+				{
+					Thread::Yield();
+				}
+			}
+		}
+
+		// each chunk streams its records through its own file handle, buffer and archive
+		void ReadChunk( int32_t chunk )
+		{
+			Chunk& rChunk = m_Chunks[ chunk % MAX_PENDING_CHUNK_COUNT ];
+
+			size_t begin = static_cast< size_t >( chunk ) * SceneBinaryFile::CHUNK_OBJECT_COUNT;
+			size_t end = Min< size_t >( begin + SceneBinaryFile::CHUNK_OBJECT_COUNT, m_Index.size() );
+			rChunk.m_Objects.resize( end - begin );
+
+			FileStream* pStream = FileStream::OpenFileStream( m_Path.c_str(), FileStream::MODE_READ );
+			if ( !pStream )
+			{
+				m_Failed = true;
+			}
+
+			DynamicArray< uint8_t > record;
+			for ( size_t i = begin; pStream && i < end && !m_Failed; ++i )
+			{
+				const SceneBinaryFile::IndexEntry& entry = m_Index[ i ];
+
+				record.Resize( entry.m_Size );
+				if ( pStream->Seek( static_cast< int64_t >( entry.m_Offset ), SeekOrigins::Begin ) != static_cast< int64_t >( entry.m_Offset )
+					|| pStream->Read( record.GetData(), 1, entry.m_Size ) != entry.m_Size
+					|| HashContents( record.GetData(), record.GetSize() ) != entry.m_Hash )
+				{
+					m_Failed = true;
+					break;
+				}
+
+				Reflect::ObjectPtr& rObject = rChunk.m_Objects[ i - begin ];
+				StaticMemoryStream recordStream( record.GetData(), record.GetSize() );
+				Persist::ArchiveReaderMessagePack::ReadFromStream( recordStream, rObject, NULL );
+				if ( !rObject.ReferencesObject() )
+				{
+					m_Failed = true;
+				}
+			}
+
+			delete pStream;
+
+			// the caller checks for failure before taking the chunk
+			AtomicExchangeRelease( rChunk.m_Ready, 1 );
+		}
+
+		const FilePath&                                     m_Path;
+		const std::vector< SceneBinaryFile::IndexEntry >&   m_Index;
+		int32_t                                             m_ChunkCount;
+		volatile int32_t                                    m_NextChunk;
+		volatile int32_t                                    m_TakenCount;   // chunks handed to the callback
+		volatile bool                                       m_Failed;
+		Chunk                                               m_Chunks[ MAX_PENDING_CHUNK_COUNT ];
+		Helium::CallbackThread                              m_Threads[ MAX_THREAD_COUNT - 1 ];
+	};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Gather every chunk into one array, for callers that want the whole scene.
+//
+static void AppendChunk( void* context, std::vector< Reflect::ObjectPtr >& objects )
+{
+	std::vector< Reflect::ObjectPtr >& rObjects = *static_cast< std::vector< Reflect::ObjectPtr >* >( context );
+	rObjects.insert( rObjects.end(), objects.begin(), objects.end() );
+}
+
+bool SceneBinaryFile::IsBinaryScene( const FilePath& path )
+{
+	FileStream* pStream = FileStream::OpenFileStream( path.c_str(), FileStream::MODE_READ );
+	if ( !pStream )
+	{
+		return false;
+	}
+
+	uint32_t magic = 0;
+	size_t bytesRead = pStream->Read( &magic, sizeof( magic ), 1 );
+	delete pStream;
+
+	return bytesRead == 1 && magic == MAGIC;
+}
+
+bool SceneBinaryFile::ReadIndex( const FilePath& path, Header& header, std::vector< IndexEntry >& index )
+{
+	FileStream* pStream = FileStream::OpenFileStream( path.c_str(), FileStream::MODE_READ );
+	if ( !pStream )
+	{
+		return false;
+	}
+
+	int64_t fileSize = pStream->GetSize();
+
+	bool success = pStream->Read( &header, sizeof( header ), 1 ) == 1
+		&& header.m_Magic == MAGIC
+		&& header.m_Version == VERSION
+		&& header.m_IndexOffset >= sizeof( Header )
+		&& header.m_FileSize == header.m_IndexOffset + header.m_ObjectCount * sizeof( IndexEntry )
+		&& header.m_FileSize <= static_cast< uint64_t >( fileSize );
+
+	if ( success )
+	{
+		index.resize( header.m_ObjectCount );
+		success = pStream->Seek( static_cast< int64_t >( header.m_IndexOffset ), SeekOrigins::Begin ) == static_cast< int64_t >( header.m_IndexOffset )
+			&& ( index.empty() || pStream->Read( &index[ 0 ], sizeof( IndexEntry ), index.size() ) == index.size() );
+	}
+
+	delete pStream;
+
+	// records always precede the index that refers to them
+	for ( std::vector< IndexEntry >::const_iterator itr = index.begin(), end = index.end(); success && itr != end; ++itr )
+	{
+		success = itr->m_Offset >= sizeof( Header ) && itr->m_Offset + itr->m_Size <= header.m_IndexOffset;
+	}
+
+	return success;
+}
+
+bool SceneBinaryFile::Read( const FilePath& path, ReadChunkCallback callback, void* context )
+{
+	Header header;
+	std::vector< IndexEntry > index;
+	if ( !ReadIndex( path, header, index ) )
+	{
+		Log::Error( TXT( "Failed to read binary scene index from %s\n" ), path.c_str() );
+		return false;
+	}
+
+	ChunkReader reader( path, index );
+	if ( !reader.Run( callback, context ) )
+	{
+		Log::Error( TXT( "Failed to read binary scene objects from %s\n" ), path.c_str() );
+		return false;
+	}
+
+	return true;
+}
+
+bool SceneBinaryFile::Read( const FilePath& path, std::vector< Reflect::ObjectPtr >& objects )
+{
+	size_t firstObject = objects.size();
+	if ( !Read( path, &AppendChunk, &objects ) )
+	{
+		objects.resize( firstObject );
+		return false;
+	}
+
+	return true;
+}
+
+bool SceneBinaryFile::Write( const FilePath& path, const std::vector< Reflect::ObjectPtr >& objects, uint32_t* writtenCount )
+{
+	//
+	// Serialize every object to its own record
+	//
+
+	std::vector< DynamicArray< uint8_t > > records;
+	std::vector< uint64_t > hashes;
+	records.resize( objects.size() );
+	hashes.resize( objects.size() );
+
+	for ( size_t i = 0; i < objects.size(); ++i )
+	{
+		DynamicMemoryStream recordStream( &records[ i ] );
+		Persist::ArchiveWriterMessagePack::WriteToStream( objects[ i ].Ptr(), recordStream, NULL );
+
+		hashes[ i ] = HashContents( records[ i ].GetData(), records[ i ].GetSize() );
+	}
+
+	//
+	// Find the records the file already holds
+	//
+
+	Header oldHeader;
+	std::vector< IndexEntry > oldIndex;
+	std::map< uint64_t, const IndexEntry* > oldEntries;
+	if ( path.Exists() && ReadIndex( path, oldHeader, oldIndex ) )
+	{
+		for ( std::vector< IndexEntry >::const_iterator itr = oldIndex.begin(), end = oldIndex.end(); itr != end; ++itr )
+		{
+			if ( itr->m_ID )
+			{
+				oldEntries[ itr->m_ID ] = &*itr;
+			}
+		}
+	}
+
+	std::vector< IndexEntry > index;
+	index.resize( objects.size() );
+
+	uint64_t liveBytes = 0;
+	uint64_t appendBytes = 0;
+	for ( size_t i = 0; i < objects.size(); ++i )
+	{
+		SceneNode* node = Reflect::SafeCast< SceneNode >( objects[ i ] );
+
+		IndexEntry& entry = index[ i ];
+		entry.m_ID = node ? static_cast< tuid >( node->GetID() ) : 0;
+		entry.m_Offset = 0;
+		entry.m_Hash = hashes[ i ];
+		entry.m_Size = static_cast< uint32_t >( records[ i ].GetSize() );
+		entry.m_Reserved = 0;
+
+		std::map< uint64_t, const IndexEntry* >::const_iterator found = entry.m_ID ? oldEntries.find( entry.m_ID ) : oldEntries.end();
+		if ( found != oldEntries.end() && found->second->m_Hash == entry.m_Hash && found->second->m_Size == entry.m_Size )
+		{
+			entry.m_Offset = found->second->m_Offset;
+		}
+		else
+		{
+			appendBytes += entry.m_Size;
+		}
+
+		liveBytes += entry.m_Size;
+	}
+
+	// rewrite from scratch when there's nothing to reuse, or when the file would mostly be stale records
+	bool incremental = !oldEntries.empty();
+	if ( incremental )
+	{
+		uint64_t recordBytes = oldHeader.m_FileSize + appendBytes - sizeof( Header );
+		incremental = liveBytes * 2 >= recordBytes;
+	}
+
+	if ( !incremental )
+	{
+		for ( std::vector< IndexEntry >::iterator itr = index.begin(), end = index.end(); itr != end; ++itr )
+		{
+			itr->m_Offset = 0;
+		}
+		appendBytes = liveBytes;
+	}
+
+	//
+	// Append the new records and index, then commit them by rewriting the header.  A full rewrite goes to a
+	//  temporary file that replaces the original only once it's complete, so a failed save keeps the old scene.
+	//
+
+	FilePath writePath( incremental ? path.Get() : path.Get() + TXT( ".tmp" ) );
+
+	FileStream* pStream = FileStream::OpenFileStream( writePath.c_str(), FileStream::MODE_WRITE, !incremental );
+	if ( !pStream )
+	{
+		Log::Error( TXT( "Failed to open %s for writing\n" ), writePath.c_str() );
+		return false;
+	}
+
+	Header header;
+	header.m_Magic = 0;     // only valid once everything else is written
+	header.m_Version = VERSION;
+	header.m_ObjectCount = static_cast< uint32_t >( index.size() );
+	header.m_Reserved = 0;
+	header.m_LiveBytes = liveBytes;
+
+	uint64_t offset = incremental ? oldHeader.m_FileSize : sizeof( Header );
+	bool success = true;
+
+	if ( !incremental )
+	{
+		success = pStream->Write( &header, sizeof( header ), 1 ) == 1;
+	}
+	else
+	{
+		success = pStream->Seek( static_cast< int64_t >( offset ), SeekOrigins::Begin ) == static_cast< int64_t >( offset );
+	}
+
+	uint32_t appendCount = 0;
+	for ( size_t i = 0; success && i < index.size(); ++i )
+	{
+		IndexEntry& entry = index[ i ];
+		if ( entry.m_Offset )
+		{
+			continue;
+		}
+
+		entry.m_Offset = offset;
+		success = entry.m_Size == 0 || pStream->Write( records[ i ].GetData(), 1, entry.m_Size ) == entry.m_Size;
+		offset += entry.m_Size;
+		++appendCount;
+	}
+
+	header.m_IndexOffset = offset;
+	header.m_FileSize = offset + index.size() * sizeof( IndexEntry );
+
+	if ( success && !index.empty() )
+	{
+		success = pStream->Write( &index[ 0 ], sizeof( IndexEntry ), index.size() ) == index.size();
+	}
+
+	if ( success )
+	{
+		// the records and index have to reach the file before the header that refers to them
+		pStream->Flush();
+
+		header.m_Magic = MAGIC;
+		success = pStream->Seek( 0, SeekOrigins::Begin ) == 0
+			&& pStream->Write( &header, sizeof( header ), 1 ) == 1;
+	}
+
+	if ( success )
+	{
+		pStream->Flush();
+	}
+
+	delete pStream;
+
+	if ( !success )
+	{
+		if ( !incremental )
+		{
+			writePath.Delete();
+		}
+
+		Log::Error( TXT( "Failed to write binary scene %s\n" ), path.c_str() );
+		return false;
+	}
+
+	// replace the original, deleting it first if the move can't overwrite it
+	if ( !incremental && !writePath.Move( path ) && !( ( !path.Exists() || path.Delete() ) && writePath.Move( path ) ) )
+	{
+		Log::Error( TXT( "Failed to replace %s, the saved scene was left in %s\n" ), path.c_str(), writePath.c_str() );
+		return false;
+	}
+
+	if ( writtenCount )
+	{
+		*writtenCount = appendCount;
+	}
+
+	return true;
+}
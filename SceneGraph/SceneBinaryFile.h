@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Foundation/FilePath.h"
+#include "Reflect/Object.h"
+
+#include "SceneGraph/API.h"
+
+#include <vector>
+
+namespace Helium
+{
+    namespace SceneGraph
+    {
+        //
+        // Binary Scene File
+        //  Compact container that serializes each scene object on its own, so objects can be deserialized in
+        //  parallel chunks, streamed into the scene a chunk at a time, and rewritten individually.
+        //   o Header: magic, version, object count, index offset, live record bytes and file size.
+        //   o Object records (MessagePack), in any order.
+        //   o Index: one entry per object in export order, with its node id, record location and content hash.
+        //  Saving an existing file appends only the records whose contents changed, followed by a new index, and then
+        //  rewrites the header in place.  An interrupted save leaves the previous index (and so the previous scene)
+        //  intact.  Once stale records would make up more than half the file, the scene is written from scratch to a
+        //  temporary file that then replaces the original.  Scenes are only saved in this format when their path has
+        //  the binary extension, or when the file is already a binary scene; the text archive remains the default.
+        //
+
+        class HELIUM_SCENE_GRAPH_API SceneBinaryFile
+        {
+        public:
+            static const uint32_t MAGIC = 0x4e435348;   // 'HSCN'
+            static const uint32_t VERSION = 1;
+            static const uint32_t CHUNK_OBJECT_COUNT = 256; // objects deserialized together when reading
+            static const tchar_t* const EXTENSION;     // file extension that selects the binary format
+
+            struct Header
+            {
+                uint32_t m_Magic;
+                uint32_t m_Version;
+                uint32_t m_ObjectCount;
+                uint32_t m_Reserved;
+                uint64_t m_IndexOffset;
+                uint64_t m_LiveBytes;   // bytes of records referenced by the index
+                uint64_t m_FileSize;    // end of the index
+            };
+
+            struct IndexEntry
+            {
+                uint64_t m_ID;          // node id, zero for objects that aren't scene nodes (never reused)
+                uint64_t m_Offset;
+                uint64_t m_Hash;
+                uint32_t m_Size;
+                uint32_t m_Reserved;
+            };
+
+            // check the header of a file to see if it's a binary scene
+            static bool IsBinaryScene( const Helium::FilePath& path );
+
+            // receives each chunk of objects on the thread that called Read, in the order they were written
+            typedef void (*ReadChunkCallback)( void* context, std::vector< Reflect::ObjectPtr >& objects );
+
+            // read the file a chunk at a time, chunks after the current one are deserialized on other threads
+            static bool Read( const Helium::FilePath& path, ReadChunkCallback callback, void* context );
+
+            // read every object in the file, in the order they were written
+            static bool Read( const Helium::FilePath& path, std::vector< Reflect::ObjectPtr >& objects );
+
+            // write the objects, reusing unchanged records if the file already holds a binary scene
+            static bool Write( const Helium::FilePath& path, const std::vector< Reflect::ObjectPtr >& objects, uint32_t* writtenCount = NULL );
+
+        private:
+            static bool ReadIndex( const Helium::FilePath& path, Header& header, std::vector< IndexEntry >& index );
+        };
+    }
+}
@@ -39,6 +39,7 @@ SceneNode::SceneNode()
 , m_Owner( NULL )
 , m_Graph( NULL )
 , m_VisitedID( 0 )
+, m_EvaluationLevel( 0 )
 {
     m_NodeStates[ GraphDirections::Downstream ] = NodeStates::Dirty;
     m_NodeStates[ GraphDirections::Upstream ] = NodeStates::Dirty;
@@ -364,6 +365,17 @@ void SceneNode::Evaluate(GraphDirection direction)
 
 }
 
+bool SceneNode::IsEvaluateThreadSafe(GraphDirection direction) const
+{
+    // unknown node types are evaluated serially on the main thread
+    return false;
+}
+
+void SceneNode::EvaluateComplete(GraphDirection direction)
+{
+
+}
+
 void SceneNode::PopulateManifest( SceneManifest* manifest ) const
 {
     // by default we reference no other assets
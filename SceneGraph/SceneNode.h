@@ -201,6 +201,20 @@ namespace Helium
                 m_VisitedID = id;
             }
 
+            //
+            // EvaluationLevel is the dependency depth of this node within the current eval traversal
+            //
+
+            uint32_t GetEvaluationLevel() const
+            {
+                return m_EvaluationLevel;
+            }
+
+            void SetEvaluationLevel(uint32_t level)
+            {
+                m_EvaluationLevel = level;
+            }
+
             //
             // Node management
             //
@@ -267,6 +281,15 @@ namespace Helium
             // overridable method for derived classes
             virtual void Evaluate(GraphDirection direction);
 
+            // can Evaluate() run on a worker thread alongside other nodes of the same dependency level?
+            //  defaults to false, only override it to return true for classes whose whole Evaluate() chain has been
+            //  checked: nodes that touch render resources, raise events, use the (non thread-safe) scope timers, or
+            //  write to other nodes must stay serial
+            virtual bool IsEvaluateThreadSafe(GraphDirection direction) const;
+
+            // called on the main thread once every node in this node's dependency level has evaluated
+            virtual void EvaluateComplete(GraphDirection direction);
+
 			//
 			// Manifest
 			//
@@ -373,6 +396,7 @@ namespace Helium
             S_SceneNodeSmartPtr     m_Descendants;                          // nodes that are evaluated after this Node
             NodeState               m_NodeStates[ GraphDirections::Count ]; // our current state
             uint32_t                m_VisitedID;                            // data cached for evaluation
+            uint32_t                m_EvaluationLevel;                      // data cached for evaluation
        };
     }
 }
\ No newline at end of file
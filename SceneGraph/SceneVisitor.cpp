@@ -95,4 +95,21 @@ TraversalAction HierarchyPickTraverser::VisitHierarchyNode(SceneGraph::Hierarchy
   m_PickVisitor->State().m_Matrix = matrix;
 
   return action;
-}
\ No newline at end of file
+}
+
+TraversalAction HierarchyPickBoundsTraverser::VisitHierarchyNode(SceneGraph::HierarchyNode* node)
+{
+  const AlignedBox& bounds = node->GetObjectHierarchyBounds();
+
+  // empty bounds never pass the pick's box test, so they can't produce hits
+  if (bounds.minimum.x <= bounds.maximum.x)
+  {
+    AlignedBox globalBounds (bounds);
+    globalBounds.Transform( node->GetTransform()->GetGlobalTransform() );
+
+    m_Nodes.push_back( node );
+    m_Bounds.push_back( globalBounds );
+  }
+
+  return TraversalActions::Continue;
+}
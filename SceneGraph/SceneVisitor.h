@@ -3,6 +3,8 @@
 #include "SceneGraph/API.h"
 #include "SceneGraph/SceneNode.h"
 
+#include "Math/AlignedBox.h"
+
 namespace Helium
 {
     namespace SceneGraph
@@ -85,5 +87,19 @@ namespace Helium
 
             virtual TraversalAction VisitHierarchyNode(SceneGraph::HierarchyNode* node) HELIUM_OVERRIDE;
         };
+
+
+        //
+        // Gather pickable items and their global hierarchy bounds (for building a pick BVH)
+        //
+
+        class HierarchyPickBoundsTraverser : public HierarchyTraverser
+        {
+        public:
+            std::vector< SceneGraph::HierarchyNode* > m_Nodes;
+            std::vector< AlignedBox > m_Bounds;
+
+            virtual TraversalAction VisitHierarchyNode(SceneGraph::HierarchyNode* node) HELIUM_OVERRIDE;
+        };
     }
 }
\ No newline at end of file
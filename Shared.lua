@@ -282,6 +282,12 @@ project( prefix .. "Bullet" )
 		"Dependencies/bullet/src",
 	}
 
+	-- must match the bullet library, see Dependencies.lua
+	defines
+	{
+		"BT_NO_PROFILE=1",
+	}
+
 	configuration "SharedLib"
 		links
 		{
@@ -537,9 +543,12 @@ project( prefix .. "TestApp" )
 	if string.find( project().name, "Helium%-Tools%-" ) then
 		links
 		{
+			"Helium-Tools-SceneGraph",
 			"Helium-Tools-PreprocessingPc",
 			"Helium-Tools-PcSupport",
 			"Helium-Tools-EditorSupport",
+			"Helium-Tools-Inspect",
+			"Helium-Tools-Application",
 		}
 	end
 
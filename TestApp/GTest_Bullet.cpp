@@ -0,0 +1,164 @@
+#include "TestAppPch.h"
+
+#if GTEST
+
+#include "Bullet/BulletWorld.h"
+#include "Bullet/BulletWorldDefinition.h"
+#include "Bullet/BulletMotionState.h"
+
+#include "btBulletDynamicsCommon.h"
+
+using namespace Helium;
+
+// Fixed step length used by these tests, a power of two so that the accumulator arithmetic is exact.
+static const float BULLET_TEST_TIME_STEP = 0.125f;
+
+class BulletWorldTest : public testing::Test
+{
+public:
+    BulletWorldTest()
+        : m_pShape( NULL )
+        , m_pMotionState( NULL )
+        , m_pBody( NULL )
+    {
+    }
+
+    void InitializeWorld( bool bInterpolateTransforms )
+    {
+        BulletWorldDefinitionPtr spDefinition(
+            Reflect::AssertCast< BulletWorldDefinition >( BulletWorldDefinition::CreateObject() ) );
+        HELIUM_ASSERT( spDefinition );
+        spDefinition->m_Gravity = Simd::Vector3( 0.0f, -10.0f, 0.0f );
+        spDefinition->m_FixedTimeStep = BULLET_TEST_TIME_STEP;
+        spDefinition->m_MaxSubSteps = 4;
+        spDefinition->m_InterpolateTransforms = bInterpolateTransforms;
+
+        m_World.Initialize( *spDefinition );
+
+        // The tick callback reports contacts to the owning BulletWorldComponent, which a bare world doesn't have
+        m_World.GetBulletWorld()->setInternalTickCallback( NULL );
+
+        // A falling sphere, set up the same way BulletBody does it
+        m_pShape = new btSphereShape( 0.5f );
+        btVector3 inertia;
+        m_pShape->calculateLocalInertia( 1.0f, inertia );
+
+        btTransform startTransform;
+        startTransform.setIdentity();
+        startTransform.setOrigin( btVector3( 0.0f, 10.0f, 0.0f ) );
+
+        m_pMotionState = new BulletMotionState( startTransform, m_World );
+        m_pBody = new btRigidBody( 1.0f, m_pMotionState, m_pShape, inertia );
+        m_pMotionState->m_pBody = m_pBody;
+        m_World.GetBulletWorld()->addRigidBody( m_pBody );
+    }
+
+    void TearDown()
+    {
+        if (m_pBody)
+        {
+            if (m_pMotionState->m_bMoved)
+            {
+                m_World.RemoveMovedBody( m_pBody );
+            }
+
+            m_World.GetBulletWorld()->removeRigidBody( m_pBody );
+        }
+
+        delete m_pBody;
+        delete m_pMotionState;
+        delete m_pShape;
+    }
+
+    float GetInterpolatedHeight()
+    {
+        btTransform transform;
+        m_pMotionState->GetInterpolatedTransform( m_World.GetInterpolationAlpha(), transform );
+
+        return transform.getOrigin().getY();
+    }
+
+    BulletWorld m_World;
+    btCollisionShape *m_pShape;
+    BulletMotionState *m_pMotionState;
+    btRigidBody *m_pBody;
+};
+
+TEST_F(BulletWorldTest, FixedStepAccumulator)
+{
+    InitializeWorld( true );
+
+    // Half a step only accumulates time, nothing moves yet
+    m_World.Simulate( BULLET_TEST_TIME_STEP * 0.5f );
+    EXPECT_FLOAT_EQ( 0.5f, m_World.GetInterpolationAlpha() );
+    EXPECT_TRUE( m_World.GetMovedBodies().IsEmpty() );
+    EXPECT_FLOAT_EQ( 10.0f, GetInterpolatedHeight() );
+
+    // The second half completes a step with nothing left over, so the synced pose is still the previous step's
+    m_World.Simulate( BULLET_TEST_TIME_STEP * 0.5f );
+    EXPECT_FLOAT_EQ( 0.0f, m_World.GetInterpolationAlpha() );
+    ASSERT_EQ( 1u, m_World.GetMovedBodies().GetSize() );
+    EXPECT_EQ( m_pBody, m_World.GetMovedBodies()[ 0 ] );
+    EXPECT_FLOAT_EQ( 10.0f, GetInterpolatedHeight() );
+
+    float previousHeight = m_pMotionState->m_PreviousTransform.getOrigin().getY();
+    float currentHeight = m_pMotionState->m_Transform.getOrigin().getY();
+    EXPECT_LT( currentHeight, previousHeight );
+
+    // Another half step doesn't step again, it blends halfway between the last two steps
+    m_World.Simulate( BULLET_TEST_TIME_STEP * 0.5f );
+    EXPECT_FLOAT_EQ( 0.5f, m_World.GetInterpolationAlpha() );
+    EXPECT_FLOAT_EQ( currentHeight, m_pMotionState->m_Transform.getOrigin().getY() );
+    EXPECT_NEAR( ( previousHeight + currentHeight ) * 0.5f, GetInterpolatedHeight(), 1.0e-4f );
+
+    // A long frame runs at most m_MaxSubSteps steps and drops the rest of the time
+    m_World.Simulate( 10.0f );
+    EXPECT_FLOAT_EQ( 0.0f, m_World.GetInterpolationAlpha() );
+
+    m_World.Simulate( BULLET_TEST_TIME_STEP * 0.25f );
+    EXPECT_FLOAT_EQ( 0.25f, m_World.GetInterpolationAlpha() );
+}
+
+TEST_F(BulletWorldTest, FixedStepWithoutInterpolation)
+{
+    InitializeWorld( false );
+
+    m_World.Simulate( BULLET_TEST_TIME_STEP * 1.5f );
+    EXPECT_FLOAT_EQ( 1.0f, m_World.GetInterpolationAlpha() );
+    EXPECT_FLOAT_EQ( m_pMotionState->m_Transform.getOrigin().getY(), GetInterpolatedHeight() );
+}
+
+TEST_F(BulletWorldTest, SleepingBodySyncsRestingTransform)
+{
+    InitializeWorld( true );
+
+    // Step once, leaving half a step in the accumulator so syncs land between the last two steps
+    m_World.Simulate( BULLET_TEST_TIME_STEP * 1.5f );
+    EXPECT_FLOAT_EQ( 0.5f, m_World.GetInterpolationAlpha() );
+    ASSERT_EQ( 1u, m_World.GetMovedBodies().GetSize() );
+
+    float restingHeight = m_pMotionState->m_Transform.getOrigin().getY();
+    EXPECT_GT( GetInterpolatedHeight(), restingHeight );
+
+    // Once asleep, bullet stops reporting the body. It must still get one sync at exactly its resting transform.
+    m_pBody->forceActivationState( ISLAND_SLEEPING );
+
+    m_World.Simulate( BULLET_TEST_TIME_STEP );
+    EXPECT_FLOAT_EQ( 0.5f, m_World.GetInterpolationAlpha() );
+    ASSERT_EQ( 1u, m_World.GetMovedBodies().GetSize() );
+    EXPECT_EQ( m_pBody, m_World.GetMovedBodies()[ 0 ] );
+    EXPECT_FLOAT_EQ( restingHeight, m_pMotionState->m_Transform.getOrigin().getY() );
+    EXPECT_FLOAT_EQ( restingHeight, GetInterpolatedHeight() );
+
+    // After that it leaves the list until it moves again
+    m_World.Simulate( BULLET_TEST_TIME_STEP );
+    EXPECT_TRUE( m_World.GetMovedBodies().IsEmpty() );
+    EXPECT_FALSE( m_pMotionState->m_bMoved );
+
+    m_pBody->activate( true );
+    m_World.Simulate( BULLET_TEST_TIME_STEP );
+    ASSERT_EQ( 1u, m_World.GetMovedBodies().GetSize() );
+    EXPECT_LT( m_pMotionState->m_Transform.getOrigin().getY(), restingHeight );
+}
+
+#endif
@@ -3,6 +3,7 @@
 #if GTEST
 
 #include "Framework/Components.h"
+#include "Components/TransformHierarchy.h"
 
 using namespace Helium;
 
@@ -388,6 +389,308 @@ TEST_F(ComponentsTest, SmartPtr)
     }
 }
 
+// World space translation of a transform hierarchy node, as of the last update
+static void GetWorldTranslation(
+    const TransformHierarchy &hierarchy,
+    TransformHierarchy::NodeId node,
+    float32_t translation[3] )
+{
+    const Simd::Matrix44 &rWorldMatrix = hierarchy.GetWorldMatrix( node );
+    translation[0] = rWorldMatrix.GetElement( 12 );
+    translation[1] = rWorldMatrix.GetElement( 13 );
+    translation[2] = rWorldMatrix.GetElement( 14 );
+}
+
+static bool IsChanged( const TransformHierarchy &hierarchy, TransformHierarchy::NodeId node )
+{
+    const DynamicArray< TransformHierarchy::NodeId > &rChangedNodes = hierarchy.GetChangedNodes();
+    for (size_t i = 0; i < rChangedNodes.GetSize(); ++i)
+    {
+        if (rChangedNodes[i] == node)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+TEST_F(ComponentsTest, TransformHierarchyAllocateFree)
+{
+    TransformHierarchy hierarchy;
+
+    TransformHierarchy::NodeId a = hierarchy.AllocateNode( NULL );
+    TransformHierarchy::NodeId b = hierarchy.AllocateNode( NULL );
+    TransformHierarchy::NodeId c = hierarchy.AllocateNode( NULL );
+    EXPECT_NE(a, b);
+    EXPECT_NE(b, c);
+    EXPECT_NE(a, c);
+
+    // New nodes are dirty roots with an identity transform
+    EXPECT_TRUE(IsInvalid(hierarchy.GetParent(b)));
+    EXPECT_TRUE(hierarchy.IsDirty(b));
+
+    hierarchy.SetLocalPosition( b, Simd::Vector3( 1.0f, 2.0f, 3.0f ) );
+    hierarchy.SetParent( c, b );
+    hierarchy.Update();
+    hierarchy.ClearDirtyFlags();
+
+    // Freeing a parent turns its children into roots that keep their local transforms
+    hierarchy.SetLocalPosition( c, Simd::Vector3( 4.0f, 0.0f, 0.0f ) );
+    hierarchy.FreeNode( b );
+    EXPECT_TRUE(IsInvalid(hierarchy.GetParent(c)));
+    EXPECT_EQ(4.0f, hierarchy.GetLocalPosition(c).GetElement(0));
+
+    // Freed nodes are reused, with their transform and links reset
+    TransformHierarchy::NodeId d = hierarchy.AllocateNode( NULL );
+    EXPECT_EQ(b, d);
+    EXPECT_TRUE(IsInvalid(hierarchy.GetParent(d)));
+    EXPECT_EQ(0.0f, hierarchy.GetLocalPosition(d).GetElement(0));
+    EXPECT_EQ(0.0f, hierarchy.GetLocalPosition(d).GetElement(1));
+    EXPECT_EQ(0.0f, hierarchy.GetLocalPosition(d).GetElement(2));
+
+    // The reused node is updated along with the orphaned child
+    hierarchy.Update();
+    float32_t translation[3];
+    GetWorldTranslation( hierarchy, d, translation );
+    EXPECT_EQ(0.0f, translation[0]);
+    EXPECT_EQ(0.0f, translation[1]);
+    EXPECT_EQ(0.0f, translation[2]);
+    GetWorldTranslation( hierarchy, c, translation );
+    EXPECT_EQ(4.0f, translation[0]);
+
+    hierarchy.ClearDirtyFlags();
+    EXPECT_TRUE(hierarchy.GetChangedNodes().IsEmpty());
+
+    TransformHierarchy::NodeId e = hierarchy.AllocateNode( NULL );
+    EXPECT_NE(a, e);
+    EXPECT_NE(c, e);
+    EXPECT_NE(d, e);
+}
+
+TEST_F(ComponentsTest, TransformHierarchyParenting)
+{
+    TransformHierarchy hierarchy;
+
+    TransformHierarchy::NodeId root = hierarchy.AllocateNode( NULL );
+    TransformHierarchy::NodeId child = hierarchy.AllocateNode( NULL );
+    TransformHierarchy::NodeId grandchild = hierarchy.AllocateNode( NULL );
+    TransformHierarchy::NodeId other = hierarchy.AllocateNode( NULL );
+
+    hierarchy.SetLocalPosition( root, Simd::Vector3( 1.0f, 0.0f, 0.0f ) );
+    hierarchy.SetLocalPosition( child, Simd::Vector3( 0.0f, 2.0f, 0.0f ) );
+    hierarchy.SetLocalPosition( grandchild, Simd::Vector3( 0.0f, 0.0f, 3.0f ) );
+    hierarchy.SetLocalPosition( other, Simd::Vector3( 10.0f, 0.0f, 0.0f ) );
+
+    EXPECT_TRUE(hierarchy.SetParent( child, root ));
+    EXPECT_TRUE(hierarchy.SetParent( grandchild, child ));
+    EXPECT_EQ(root, hierarchy.GetParent(child));
+    EXPECT_EQ(child, hierarchy.GetParent(grandchild));
+
+    EXPECT_TRUE(hierarchy.IsAncestor( root, grandchild ));
+    EXPECT_TRUE(hierarchy.IsAncestor( child, grandchild ));
+    EXPECT_FALSE(hierarchy.IsAncestor( grandchild, root ));
+    EXPECT_FALSE(hierarchy.IsAncestor( other, grandchild ));
+
+    hierarchy.Update();
+
+    float32_t translation[3];
+    GetWorldTranslation( hierarchy, grandchild, translation );
+    EXPECT_EQ(1.0f, translation[0]);
+    EXPECT_EQ(2.0f, translation[1]);
+    EXPECT_EQ(3.0f, translation[2]);
+
+    // Attaching a node to itself or to one of its descendants is rejected and leaves the hierarchy alone
+    EXPECT_FALSE(hierarchy.SetParent( root, root ));
+    EXPECT_FALSE(hierarchy.SetParent( root, grandchild ));
+    EXPECT_FALSE(hierarchy.SetParent( child, grandchild ));
+    EXPECT_TRUE(IsInvalid(hierarchy.GetParent(root)));
+    EXPECT_EQ(root, hierarchy.GetParent(child));
+
+    // Setting the current parent again is a no-op that succeeds
+    EXPECT_TRUE(hierarchy.SetParent( child, root ));
+
+    // Reparenting moves the whole subtree, keeping local transforms
+    EXPECT_TRUE(hierarchy.SetParent( child, other ));
+    EXPECT_EQ(other, hierarchy.GetParent(child));
+    EXPECT_FALSE(hierarchy.IsAncestor( root, grandchild ));
+    EXPECT_TRUE(hierarchy.IsAncestor( other, grandchild ));
+
+    hierarchy.Update();
+
+    GetWorldTranslation( hierarchy, grandchild, translation );
+    EXPECT_EQ(10.0f, translation[0]);
+    EXPECT_EQ(2.0f, translation[1]);
+    EXPECT_EQ(3.0f, translation[2]);
+
+    // Detaching makes a root again
+    EXPECT_TRUE(hierarchy.SetParent( child, Invalid< TransformHierarchy::NodeId >() ));
+    hierarchy.Update();
+
+    GetWorldTranslation( hierarchy, grandchild, translation );
+    EXPECT_EQ(0.0f, translation[0]);
+    EXPECT_EQ(2.0f, translation[1]);
+    EXPECT_EQ(3.0f, translation[2]);
+}
+
+TEST_F(ComponentsTest, TransformHierarchyDepthOrder)
+{
+    TransformHierarchy hierarchy;
+
+    // Allocate a chain with the deepest nodes first, so node order is the reverse of depth order and the update has
+    // to sort by depth to compute parents before their children
+    static const size_t chainLength = 8;
+    TransformHierarchy::NodeId chain[chainLength];
+    for (size_t i = 0; i < chainLength; ++i)
+    {
+        chain[chainLength - 1 - i] = hierarchy.AllocateNode( NULL );
+    }
+
+    for (size_t i = 0; i < chainLength; ++i)
+    {
+        hierarchy.SetLocalPosition( chain[i], Simd::Vector3( 1.0f, 0.0f, 0.0f ) );
+        if (i != 0)
+        {
+            hierarchy.SetParent( chain[i], chain[i - 1] );
+        }
+    }
+
+    // A wide level next to the chain
+    static const size_t siblingCount = 16;
+    TransformHierarchy::NodeId siblings[siblingCount];
+    for (size_t i = 0; i < siblingCount; ++i)
+    {
+        siblings[i] = hierarchy.AllocateNode( NULL );
+        hierarchy.SetLocalPosition( siblings[i], Simd::Vector3( 0.0f, static_cast< float32_t >( i ), 0.0f ) );
+        hierarchy.SetParent( siblings[i], chain[chainLength / 2] );
+    }
+
+    hierarchy.Update();
+
+    float32_t translation[3];
+    for (size_t i = 0; i < chainLength; ++i)
+    {
+        GetWorldTranslation( hierarchy, chain[i], translation );
+        EXPECT_EQ(static_cast< float32_t >( i + 1 ), translation[0]);
+    }
+
+    for (size_t i = 0; i < siblingCount; ++i)
+    {
+        GetWorldTranslation( hierarchy, siblings[i], translation );
+        EXPECT_EQ(static_cast< float32_t >( chainLength / 2 + 1 ), translation[0]);
+        EXPECT_EQ(static_cast< float32_t >( i ), translation[1]);
+    }
+
+    hierarchy.ClearDirtyFlags();
+
+    // Moving the chain under a new root shifts the depth of every node in it
+    TransformHierarchy::NodeId newRoot = hierarchy.AllocateNode( NULL );
+    hierarchy.SetLocalPosition( newRoot, Simd::Vector3( 100.0f, 0.0f, 0.0f ) );
+    hierarchy.SetParent( chain[0], newRoot );
+
+    // Dirty a deep node as well, so the update has queued nodes at several depths from separate dirty roots
+    hierarchy.SetLocalPosition( chain[chainLength - 1], Simd::Vector3( 2.0f, 0.0f, 0.0f ) );
+
+    hierarchy.Update();
+
+    for (size_t i = 0; i < chainLength; ++i)
+    {
+        GetWorldTranslation( hierarchy, chain[i], translation );
+        float32_t expected = 100.0f + static_cast< float32_t >( i + 1 ) + ( i == chainLength - 1 ? 1.0f : 0.0f );
+        EXPECT_EQ(expected, translation[0]);
+    }
+
+    for (size_t i = 0; i < siblingCount; ++i)
+    {
+        GetWorldTranslation( hierarchy, siblings[i], translation );
+        EXPECT_EQ(static_cast< float32_t >( 100 + chainLength / 2 + 1 ), translation[0]);
+    }
+}
+
+TEST_F(ComponentsTest, TransformHierarchyDirtyPropagation)
+{
+    TransformHierarchy hierarchy;
+
+    TransformHierarchy::NodeId root = hierarchy.AllocateNode( NULL );
+    TransformHierarchy::NodeId left = hierarchy.AllocateNode( NULL );
+    TransformHierarchy::NodeId right = hierarchy.AllocateNode( NULL );
+    TransformHierarchy::NodeId leftChild = hierarchy.AllocateNode( NULL );
+
+    hierarchy.SetParent( left, root );
+    hierarchy.SetParent( right, root );
+    hierarchy.SetParent( leftChild, left );
+
+    hierarchy.Update();
+    EXPECT_EQ(4u, hierarchy.GetChangedNodes().GetSize());
+    hierarchy.ClearDirtyFlags();
+
+    EXPECT_FALSE(hierarchy.IsDirty(root));
+    EXPECT_FALSE(hierarchy.IsDirty(left));
+    EXPECT_FALSE(hierarchy.IsDirty(right));
+    EXPECT_FALSE(hierarchy.IsDirty(leftChild));
+    EXPECT_TRUE(hierarchy.GetChangedNodes().IsEmpty());
+
+    // An update with nothing dirty does nothing
+    hierarchy.Update();
+    EXPECT_TRUE(hierarchy.GetChangedNodes().IsEmpty());
+
+    // Changing a node only dirties that node until the next update
+    hierarchy.SetLocalPosition( left, Simd::Vector3( 5.0f, 0.0f, 0.0f ) );
+    EXPECT_TRUE(hierarchy.IsDirty(left));
+    EXPECT_FALSE(hierarchy.IsDirty(leftChild));
+    EXPECT_FALSE(hierarchy.IsDirty(root));
+
+    // The update recomputes the node and its descendants, and nothing else
+    hierarchy.Update();
+    EXPECT_EQ(2u, hierarchy.GetChangedNodes().GetSize());
+    EXPECT_TRUE(IsChanged(hierarchy, left));
+    EXPECT_TRUE(IsChanged(hierarchy, leftChild));
+    EXPECT_TRUE(hierarchy.IsDirty(left));
+    EXPECT_TRUE(hierarchy.IsDirty(leftChild));
+    EXPECT_FALSE(hierarchy.IsDirty(root));
+    EXPECT_FALSE(hierarchy.IsDirty(right));
+
+    float32_t translation[3];
+    GetWorldTranslation( hierarchy, leftChild, translation );
+    EXPECT_EQ(5.0f, translation[0]);
+
+    // A second update before the flags are cleared doesn't list nodes twice
+    hierarchy.SetLocalPosition( leftChild, Simd::Vector3( 1.0f, 0.0f, 0.0f ) );
+    hierarchy.Update();
+    EXPECT_EQ(2u, hierarchy.GetChangedNodes().GetSize());
+
+    GetWorldTranslation( hierarchy, leftChild, translation );
+    EXPECT_EQ(6.0f, translation[0]);
+
+    hierarchy.ClearDirtyFlags();
+    EXPECT_FALSE(hierarchy.IsDirty(left));
+    EXPECT_FALSE(hierarchy.IsDirty(leftChild));
+
+    // Marking a node dirty without changing it still refreshes its subtree
+    hierarchy.MarkDirty( root );
+    hierarchy.Update();
+    EXPECT_EQ(4u, hierarchy.GetChangedNodes().GetSize());
+    hierarchy.ClearDirtyFlags();
+
+    // UpdateNodes() recomputes exactly the nodes it is given, from their parents' current world matrices
+    hierarchy.SetLocalPosition( root, Simd::Vector3( 0.0f, 7.0f, 0.0f ) );
+    TransformHierarchy::NodeId level0[] = { root };
+    TransformHierarchy::NodeId level1[] = { left };
+    hierarchy.UpdateNodes( level0, HELIUM_ARRAY_COUNT( level0 ) );
+    hierarchy.UpdateNodes( level1, HELIUM_ARRAY_COUNT( level1 ) );
+
+    GetWorldTranslation( hierarchy, left, translation );
+    EXPECT_EQ(5.0f, translation[0]);
+    EXPECT_EQ(7.0f, translation[1]);
+    GetWorldTranslation( hierarchy, leftChild, translation );
+    EXPECT_EQ(6.0f, translation[0]);
+    EXPECT_EQ(0.0f, translation[1]);
+
+    hierarchy.Update();
+    GetWorldTranslation( hierarchy, leftChild, translation );
+    EXPECT_EQ(7.0f, translation[1]);
+}
+
 //class Object
 //{
 //
@@ -0,0 +1,300 @@
+#include "TestAppPch.h"
+
+#if GTEST && HELIUM_TOOLS
+
+#include "EditorSupport/MeshProcessing.h"
+
+using namespace Helium;
+
+// Build a grid of quads as a triangle soup (every triangle has its own three vertices).
+static void BuildTriangleSoupGrid(
+    size_t quadsPerSide,
+    DynamicArray< StaticMeshVertex< 1 > >& rVertices,
+    DynamicArray< uint32_t >& rIndices )
+{
+    static const size_t cornerOffsets[ 6 ][ 2 ] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 0 }, { 1, 1 }, { 0, 1 } };
+
+    StaticMeshVertex< 1 > vertex;
+    MemoryZero( &vertex, sizeof( vertex ) );
+    vertex.normal[ 2 ] = 255;
+    vertex.color[ 0 ] = vertex.color[ 1 ] = vertex.color[ 2 ] = vertex.color[ 3 ] = 0xff;
+
+    rVertices.Clear();
+    rIndices.Clear();
+    for( size_t y = 0; y < quadsPerSide; ++y )
+    {
+        for( size_t x = 0; x < quadsPerSide; ++x )
+        {
+            for( size_t cornerIndex = 0; cornerIndex < 6; ++cornerIndex )
+            {
+                vertex.position[ 0 ] = static_cast< float32_t >( x + cornerOffsets[ cornerIndex ][ 0 ] );
+                vertex.position[ 1 ] = static_cast< float32_t >( y + cornerOffsets[ cornerIndex ][ 1 ] );
+                vertex.position[ 2 ] = 0.0f;
+
+                rIndices.Push( static_cast< uint32_t >( rVertices.GetSize() ) );
+                rVertices.Push( vertex );
+            }
+        }
+    }
+}
+
+TEST(MeshProcessing, WeldTriangleSoup)
+{
+    const size_t quadsPerSide = 256;
+
+    DynamicArray< StaticMeshVertex< 1 > > vertices;
+    DynamicArray< uint32_t > indices;
+    BuildTriangleSoupGrid( quadsPerSide, vertices, indices );
+
+    DynamicArray< StaticMeshVertex< 1 > > sourceVertices( vertices );
+    DynamicArray< uint32_t > sourceIndices( indices );
+
+    float64_t startTime = Timer::GetSeconds();
+    VertexWelder::WeldMesh( vertices, indices );
+    HELIUM_TRACE(
+        TraceLevels::Info,
+        TXT( "Welded %" ) PRIuSZ TXT( " vertices to %" ) PRIuSZ TXT( " in %f seconds.\n" ),
+        sourceVertices.GetSize(),
+        vertices.GetSize(),
+        Timer::GetSeconds() - startTime );
+
+    EXPECT_EQ( ( quadsPerSide + 1 ) * ( quadsPerSide + 1 ), vertices.GetSize() );
+    ASSERT_EQ( sourceIndices.GetSize(), indices.GetSize() );
+
+    // Every corner must still be at the same place.
+    for( size_t indexIndex = 0; indexIndex < indices.GetSize(); ++indexIndex )
+    {
+        ASSERT_LT( indices[ indexIndex ], vertices.GetSize() );
+
+        const StaticMeshVertex< 1 >& rSource = sourceVertices[ sourceIndices[ indexIndex ] ];
+        const StaticMeshVertex< 1 >& rWelded = vertices[ indices[ indexIndex ] ];
+        EXPECT_EQ( rSource.position[ 0 ], rWelded.position[ 0 ] );
+        EXPECT_EQ( rSource.position[ 1 ], rWelded.position[ 1 ] );
+        EXPECT_EQ( rSource.position[ 2 ], rWelded.position[ 2 ] );
+    }
+}
+
+TEST(MeshProcessing, WeldAttributesAndTags)
+{
+    StaticMeshVertex< 1 > vertex;
+    MemoryZero( &vertex, sizeof( vertex ) );
+    vertex.position[ 0 ] = 1.0f;
+
+    VertexWelder welder;
+    bool bAdded;
+
+    EXPECT_EQ( 0u, welder.Weld( vertex, 0, bAdded ) );
+    EXPECT_TRUE( bAdded );
+    EXPECT_EQ( 0u, welder.Weld( vertex, 0, bAdded ) );
+    EXPECT_FALSE( bAdded );
+
+    // A different tag keeps otherwise identical vertices apart.
+    EXPECT_EQ( 1u, welder.Weld( vertex, 1, bAdded ) );
+    EXPECT_TRUE( bAdded );
+
+    // So does any attribute difference.
+    StaticMeshVertex< 1 > uvSeamVertex = vertex;
+    uvSeamVertex.texCoords[ 0 ][ 0 ].packed = 0x3c00;
+    EXPECT_EQ( 2u, welder.Weld( uvSeamVertex, 0, bAdded ) );
+    EXPECT_TRUE( bAdded );
+
+    // Positive and negative zero are the same position.
+    StaticMeshVertex< 1 > zeroVertex = vertex;
+    zeroVertex.position[ 1 ] = -0.0f;
+    EXPECT_EQ( 0u, welder.Weld( zeroVertex, 0, bAdded ) );
+    EXPECT_FALSE( bAdded );
+
+    EXPECT_EQ( 3u, welder.GetVertexCount() );
+
+    // With a tolerance, nearby positions snap together.
+    VertexWelder tolerantWelder( 0.01f );
+    StaticMeshVertex< 1 > nearbyVertex = vertex;
+    nearbyVertex.position[ 0 ] = 1.001f;
+    EXPECT_EQ( 0u, tolerantWelder.Weld( vertex, 0, bAdded ) );
+    EXPECT_EQ( 0u, tolerantWelder.Weld( nearbyVertex, 0, bAdded ) );
+    EXPECT_FALSE( bAdded );
+}
+
+TEST(MeshProcessing, OptimizeGrid)
+{
+    const size_t quadsPerSide = 64;
+
+    DynamicArray< StaticMeshVertex< 1 > > vertices;
+    DynamicArray< uint32_t > indices;
+    BuildTriangleSoupGrid( quadsPerSide, vertices, indices );
+    VertexWelder::WeldMesh( vertices, indices );
+
+    size_t vertexCount = vertices.GetSize();
+    size_t indexCount = indices.GetSize();
+
+    float32_t acmrBefore = MeshOptimizer::ComputeAcmr( indices.GetData(), indexCount, vertexCount );
+
+    DynamicArray< uint32_t > optimizedIndices( indices );
+    DynamicArray< uint32_t > clusterStarts;
+    MeshOptimizer::OptimizeVertexCache(
+        optimizedIndices.GetData(),
+        indexCount,
+        vertexCount,
+        MeshOptimizer::DEFAULT_CACHE_SIZE,
+        &clusterStarts );
+    MeshOptimizer::OptimizeOverdraw(
+        optimizedIndices.GetData(),
+        indexCount,
+        vertices.GetData(),
+        vertexCount,
+        clusterStarts );
+
+    float32_t acmrAfter = MeshOptimizer::ComputeAcmr( optimizedIndices.GetData(), indexCount, vertexCount );
+    HELIUM_TRACE( TraceLevels::Info, TXT( "Grid ACMR %.3f -> %.3f.\n" ), acmrBefore, acmrAfter );
+    EXPECT_LT( acmrAfter, acmrBefore );
+    ASSERT_FALSE( clusterStarts.IsEmpty() );
+    EXPECT_EQ( 0u, clusterStarts[ 0 ] );
+
+    // The same input must always produce the same output.
+    DynamicArray< uint32_t > repeatIndices( indices );
+    DynamicArray< uint32_t > repeatClusterStarts;
+    MeshOptimizer::OptimizeVertexCache(
+        repeatIndices.GetData(),
+        indexCount,
+        vertexCount,
+        MeshOptimizer::DEFAULT_CACHE_SIZE,
+        &repeatClusterStarts );
+    MeshOptimizer::OptimizeOverdraw(
+        repeatIndices.GetData(),
+        indexCount,
+        vertices.GetData(),
+        vertexCount,
+        repeatClusterStarts );
+    for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+    {
+        ASSERT_EQ( optimizedIndices[ indexIndex ], repeatIndices[ indexIndex ] );
+    }
+
+    // Every source triangle must still be drawn exactly once, with its winding intact.
+    DynamicArray< uint64_t > sourceTriangles;
+    DynamicArray< uint64_t > optimizedTriangles;
+    for( size_t indexIndex = 0; indexIndex < indexCount; indexIndex += 3 )
+    {
+        for( size_t pass = 0; pass < 2; ++pass )
+        {
+            const uint32_t* pTriangle = ( pass == 0 ? indices.GetData() : optimizedIndices.GetData() ) + indexIndex;
+
+            // Rotate the lowest index to the front so the key keeps the winding.
+            size_t first = 0;
+            if( pTriangle[ 1 ] < pTriangle[ first ] )
+            {
+                first = 1;
+            }
+            if( pTriangle[ 2 ] < pTriangle[ first ] )
+            {
+                first = 2;
+            }
+
+            uint64_t key =
+                ( static_cast< uint64_t >( pTriangle[ first ] ) << 42 ) |
+                ( static_cast< uint64_t >( pTriangle[ ( first + 1 ) % 3 ] ) << 21 ) |
+                static_cast< uint64_t >( pTriangle[ ( first + 2 ) % 3 ] );
+            ( pass == 0 ? sourceTriangles : optimizedTriangles ).Push( key );
+        }
+    }
+
+    std::sort( sourceTriangles.GetData(), sourceTriangles.GetData() + sourceTriangles.GetSize() );
+    std::sort( optimizedTriangles.GetData(), optimizedTriangles.GetData() + optimizedTriangles.GetSize() );
+    for( size_t triangleIndex = 0; triangleIndex < sourceTriangles.GetSize(); ++triangleIndex )
+    {
+        ASSERT_EQ( sourceTriangles[ triangleIndex ], optimizedTriangles[ triangleIndex ] );
+    }
+
+    // After reordering for fetch, vertices are first referenced in increasing order.
+    DynamicArray< uint32_t > remap;
+    MeshOptimizer::OptimizeVertexFetch( optimizedIndices.GetData(), indexCount, vertexCount, remap );
+    MeshOptimizer::RemapVertices( vertices.GetData(), vertexCount, remap );
+
+    uint32_t nextNewVertex = 0;
+    for( size_t indexIndex = 0; indexIndex < indexCount; ++indexIndex )
+    {
+        ASSERT_LE( optimizedIndices[ indexIndex ], nextNewVertex );
+        if( optimizedIndices[ indexIndex ] == nextNewVertex )
+        {
+            ++nextNewVertex;
+        }
+    }
+
+    EXPECT_EQ( vertexCount, nextNewVertex );
+    EXPECT_EQ(
+        acmrAfter,
+        MeshOptimizer::ComputeAcmr( optimizedIndices.GetData(), indexCount, vertexCount ) );
+}
+
+TEST(MeshProcessing, SimplifyGrid)
+{
+    const size_t quadsPerSide = 32;
+
+    DynamicArray< StaticMeshVertex< 1 > > vertices;
+    DynamicArray< uint32_t > indices;
+    BuildTriangleSoupGrid( quadsPerSide, vertices, indices );
+    VertexWelder::WeldMesh( vertices, indices );
+
+    size_t vertexCount = vertices.GetSize();
+    size_t indexCount = indices.GetSize();
+    size_t targetIndexCount = indexCount / 2;
+
+    DynamicArray< uint32_t > simplifiedIndices( indices );
+    size_t simplifiedIndexCount = MeshOptimizer::SimplifyMesh(
+        simplifiedIndices.GetData(),
+        indexCount,
+        vertices.GetData(),
+        vertexCount,
+        targetIndexCount );
+    EXPECT_LE( simplifiedIndexCount, targetIndexCount );
+    EXPECT_EQ( 0u, simplifiedIndexCount % 3 );
+    EXPECT_NE( 0u, simplifiedIndexCount );
+
+    // Triangles must stay valid and keep facing the same way.
+    for( size_t indexIndex = 0; indexIndex < simplifiedIndexCount; indexIndex += 3 )
+    {
+        const uint32_t* pTriangle = simplifiedIndices.GetData() + indexIndex;
+        ASSERT_LT( pTriangle[ 0 ], vertexCount );
+        ASSERT_LT( pTriangle[ 1 ], vertexCount );
+        ASSERT_LT( pTriangle[ 2 ], vertexCount );
+
+        const float32_t* pPosition0 = vertices[ pTriangle[ 0 ] ].position;
+        const float32_t* pPosition1 = vertices[ pTriangle[ 1 ] ].position;
+        const float32_t* pPosition2 = vertices[ pTriangle[ 2 ] ].position;
+        float32_t normalZ =
+            ( pPosition1[ 0 ] - pPosition0[ 0 ] ) * ( pPosition2[ 1 ] - pPosition0[ 1 ] ) -
+            ( pPosition1[ 1 ] - pPosition0[ 1 ] ) * ( pPosition2[ 0 ] - pPosition0[ 0 ] );
+        EXPECT_GT( normalZ, 0.0f );
+    }
+
+    // Border vertices are never removed, so the grid corners must still be referenced.
+    size_t cornerReferenceCount = 0;
+    for( size_t indexIndex = 0; indexIndex < simplifiedIndexCount; ++indexIndex )
+    {
+        const float32_t* pPosition = vertices[ simplifiedIndices[ indexIndex ] ].position;
+        if( ( pPosition[ 0 ] == 0.0f || pPosition[ 0 ] == static_cast< float32_t >( quadsPerSide ) ) &&
+            ( pPosition[ 1 ] == 0.0f || pPosition[ 1 ] == static_cast< float32_t >( quadsPerSide ) ) )
+        {
+            ++cornerReferenceCount;
+        }
+    }
+
+    EXPECT_GE( cornerReferenceCount, 4u );
+
+    // The same input must always produce the same output.
+    DynamicArray< uint32_t > repeatIndices( indices );
+    ASSERT_EQ(
+        simplifiedIndexCount,
+        MeshOptimizer::SimplifyMesh(
+            repeatIndices.GetData(),
+            indexCount,
+            vertices.GetData(),
+            vertexCount,
+            targetIndexCount ) );
+    for( size_t indexIndex = 0; indexIndex < simplifiedIndexCount; ++indexIndex )
+    {
+        ASSERT_EQ( simplifiedIndices[ indexIndex ], repeatIndices[ indexIndex ] );
+    }
+}
+
+#endif
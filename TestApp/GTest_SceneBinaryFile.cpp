@@ -0,0 +1,104 @@
+#include "TestAppPch.h"
+
+#if GTEST && HELIUM_TOOLS
+
+#include "SceneGraph/SceneBinaryFile.h"
+#include "TestAsset.h"
+
+using namespace Helium;
+using namespace Helium::SceneGraph;
+
+// Enough objects to fill several chunks, with a partial chunk at the end.
+static const size_t TEST_OBJECT_COUNT = 3 * SceneBinaryFile::CHUNK_OBJECT_COUNT + 17;
+
+// Get a scratch path for a binary scene in the user data directory.
+static FilePath GetTestScenePath()
+{
+    FilePath userDataDirectory;
+    HELIUM_VERIFY( FileLocations::GetUserDataDirectory( userDataDirectory ) );
+
+    return FilePath( userDataDirectory.Get() + TXT( "GTest_SceneBinaryFile" ) + SceneBinaryFile::EXTENSION );
+}
+
+// Build objects whose first value records their position, so the order they are read back in can be checked.
+static void BuildTestObjects( std::vector< Reflect::ObjectPtr >& rObjects )
+{
+    rObjects.clear();
+    for( size_t index = 0; index < TEST_OBJECT_COUNT; ++index )
+    {
+        TestAsset1* pObject = Reflect::AssertCast< TestAsset1 >( TestAsset1::CreateObject() );
+        pObject->m_TestValue1 = static_cast< float >( index );
+        pObject->m_TestValue2 = 0.0f;
+        rObjects.push_back( pObject );
+    }
+}
+
+// Check that objects read back from a file match the ones written, in order.
+static void CheckTestObjects( const std::vector< Reflect::ObjectPtr >& rObjects, size_t firstIndex )
+{
+    for( size_t index = 0; index < rObjects.size(); ++index )
+    {
+        TestAsset1* pObject = Reflect::SafeCast< TestAsset1 >( rObjects[ index ].Get() );
+        ASSERT_TRUE( pObject != NULL );
+        EXPECT_EQ( static_cast< float >( firstIndex + index ), pObject->m_TestValue1 );
+    }
+}
+
+struct ChunkCounts
+{
+    size_t chunkCount;
+    size_t objectCount;
+};
+
+static void CountChunk( void* pContext, std::vector< Reflect::ObjectPtr >& rObjects )
+{
+    ChunkCounts& rCounts = *static_cast< ChunkCounts* >( pContext );
+
+    // every chunk but the last is full, so chunks arrive in file order if each starts where the last one ended
+    EXPECT_LE( rObjects.size(), static_cast< size_t >( SceneBinaryFile::CHUNK_OBJECT_COUNT ) );
+    CheckTestObjects( rObjects, rCounts.objectCount );
+
+    ++rCounts.chunkCount;
+    rCounts.objectCount += rObjects.size();
+}
+
+TEST(SceneGraph, SceneBinaryFileReadChunks)
+{
+    FilePath path = GetTestScenePath();
+
+    std::vector< Reflect::ObjectPtr > objects;
+    BuildTestObjects( objects );
+
+    uint32_t writtenCount = 0;
+    ASSERT_TRUE( SceneBinaryFile::Write( path, objects, &writtenCount ) );
+    EXPECT_EQ( TEST_OBJECT_COUNT, writtenCount );
+    ASSERT_TRUE( SceneBinaryFile::IsBinaryScene( path ) );
+
+    std::vector< Reflect::ObjectPtr > readObjects;
+    ASSERT_TRUE( SceneBinaryFile::Read( path, readObjects ) );
+    ASSERT_EQ( TEST_OBJECT_COUNT, readObjects.size() );
+    CheckTestObjects( readObjects, 0 );
+
+    path.Delete();
+}
+
+TEST(SceneGraph, SceneBinaryFileStreamChunks)
+{
+    FilePath path = GetTestScenePath();
+
+    std::vector< Reflect::ObjectPtr > objects;
+    BuildTestObjects( objects );
+    ASSERT_TRUE( SceneBinaryFile::Write( path, objects ) );
+    objects.clear();
+
+    ChunkCounts counts;
+    counts.chunkCount = 0;
+    counts.objectCount = 0;
+    ASSERT_TRUE( SceneBinaryFile::Read( path, &CountChunk, &counts ) );
+    EXPECT_EQ( 4u, counts.chunkCount );
+    EXPECT_EQ( TEST_OBJECT_COUNT, counts.objectCount );
+
+    path.Delete();
+}
+
+#endif
@@ -0,0 +1,240 @@
+#include "TestAppPch.h"
+
+#if GTEST
+
+using namespace Helium;
+
+// Fill an array with pseudo-random values in [0, valueRange) so that larger arrays contain plenty of duplicates.
+static void FillRandom( DynamicArray< uint32_t >& rValues, size_t count, uint32_t valueRange, uint32_t seed )
+{
+    rValues.Resize( 0 );
+    rValues.Reserve( count );
+
+    uint32_t state = seed;
+    for( size_t index = 0; index < count; ++index )
+    {
+        state = state * 1664525 + 1013904223;
+        rValues.Push( ( state >> 8 ) % valueRange );
+    }
+}
+
+// Run a SortJob over the given values, then check the result against std::sort on a copy of the input.
+static void SortAndCheck( DynamicArray< uint32_t >& rValues, size_t singleJobCount )
+{
+    DynamicArray< uint32_t > expected( rValues );
+    std::sort( expected.GetData(), expected.GetData() + expected.GetSize() );
+
+    {
+        JobContext::Spawner< 1 > rootSpawner;
+
+        JobContext* pContext = rootSpawner.Allocate();
+        HELIUM_ASSERT( pContext );
+        SortJob< uint32_t >* pJob = pContext->Create< SortJob< uint32_t > >();
+        HELIUM_ASSERT( pJob );
+
+        SortJob< uint32_t >::Parameters& rParameters = pJob->GetParameters();
+        rParameters.pBase = rValues.GetData();
+        rParameters.count = rValues.GetSize();
+        rParameters.singleJobCount = singleJobCount;
+    }
+
+    ASSERT_EQ( expected.GetSize(), rValues.GetSize() );
+    for( size_t index = 0; index < expected.GetSize(); ++index )
+    {
+        ASSERT_EQ( expected[ index ], rValues[ index ] ) << "count " << expected.GetSize() << ", index " << index;
+    }
+}
+
+// Element counts straddling the insertion sort cutoff and the minimum automatic single job count.
+static const size_t SORT_TEST_COUNTS[] = { 0, 1, 2, 3, 15, 16, 17, 127, 128, 129, 511, 512, 513, 1024, 4097, 65536 };
+
+TEST(EngineJobs, SortJobRandom)
+{
+    DynamicArray< uint32_t > values;
+    for( size_t countIndex = 0; countIndex < HELIUM_ARRAY_COUNT( SORT_TEST_COUNTS ); ++countIndex )
+    {
+        size_t count = SORT_TEST_COUNTS[ countIndex ];
+
+        FillRandom( values, count, 0xffffffff, static_cast< uint32_t >( count ) );
+        SortAndCheck( values, 0 );
+    }
+}
+
+TEST(EngineJobs, SortJobDuplicates)
+{
+    DynamicArray< uint32_t > values;
+    for( size_t countIndex = 0; countIndex < HELIUM_ARRAY_COUNT( SORT_TEST_COUNTS ); ++countIndex )
+    {
+        size_t count = SORT_TEST_COUNTS[ countIndex ];
+
+        FillRandom( values, count, 7, static_cast< uint32_t >( count ) );
+        SortAndCheck( values, 0 );
+
+        // All elements equal.
+        FillRandom( values, count, 1, 0 );
+        SortAndCheck( values, 0 );
+    }
+}
+
+TEST(EngineJobs, SortJobPresorted)
+{
+    DynamicArray< uint32_t > values;
+    for( size_t countIndex = 0; countIndex < HELIUM_ARRAY_COUNT( SORT_TEST_COUNTS ); ++countIndex )
+    {
+        size_t count = SORT_TEST_COUNTS[ countIndex ];
+
+        values.Resize( count );
+        for( size_t index = 0; index < count; ++index )
+        {
+            values[ index ] = static_cast< uint32_t >( index );
+        }
+
+        SortAndCheck( values, 0 );
+
+        for( size_t index = 0; index < count; ++index )
+        {
+            values[ index ] = static_cast< uint32_t >( count - index );
+        }
+
+        SortAndCheck( values, 0 );
+    }
+}
+
+TEST(EngineJobs, SortJobSingleJobCount)
+{
+    // Explicit grain sizes force child jobs on small arrays.  Grains below the insertion sort cutoff are clamped to it,
+    // so a grain of 1 actually runs with a grain of SORT_JOB_INSERTION_COUNT_MAX (16); sizes are tested around the
+    // clamped grain to cover both sides of the serial/parallel cutoff.
+    static const size_t singleJobCounts[] = { 1, 24, 64 };
+
+    DynamicArray< uint32_t > values;
+    for( size_t grainIndex = 0; grainIndex < HELIUM_ARRAY_COUNT( singleJobCounts ); ++grainIndex )
+    {
+        size_t singleJobCount = singleJobCounts[ grainIndex ];
+        size_t effectiveSingleJobCount = Max( singleJobCount, SORT_JOB_INSERTION_COUNT_MAX );
+        for( size_t count = effectiveSingleJobCount - 1; count <= effectiveSingleJobCount + 1; ++count )
+        {
+            FillRandom( values, count, 0xffffffff, static_cast< uint32_t >( count ) );
+            SortAndCheck( values, singleJobCount );
+        }
+
+        FillRandom( values, 10000, 0xffffffff, 1 );
+        SortAndCheck( values, singleJobCount );
+
+        FillRandom( values, 10000, 13, 2 );
+        SortAndCheck( values, singleJobCount );
+    }
+
+    // The automatic grain never drops below the minimum, and splits large arrays into several leaf jobs.
+    EXPECT_EQ( 512u, GetSortJobSingleJobCount( 1 ) );
+    EXPECT_GE( GetSortJobSingleJobCount( 1 << 20 ), 512u );
+    EXPECT_LT( GetSortJobSingleJobCount( 1 << 20 ), static_cast< size_t >( 1 << 20 ) );
+}
+
+// Element with a sort key and its original position, for checking that RadixSortJob is stable.
+struct RadixSortTestElement
+{
+    uint32_t key;
+    uint32_t order;
+};
+
+// RadixSortJob key function returning the sort key of a RadixSortTestElement.
+class RadixSortTestKey
+{
+public:
+    typedef uint32_t KeyType;
+
+    KeyType operator()( const RadixSortTestElement& rElement ) const
+    {
+        return rElement.key;
+    }
+};
+
+// Run a RadixSortJob over the given elements.
+template< typename T, typename KeyFunction >
+static void RadixSort( DynamicArray< T >& rValues, size_t digitCount, size_t singleJobCount )
+{
+    DynamicArray< T > scratch;
+    scratch.Resize( rValues.GetSize() );
+
+    JobContext::Spawner< 1 > rootSpawner;
+
+    JobContext* pContext = rootSpawner.Allocate();
+    HELIUM_ASSERT( pContext );
+    RadixSortJob< T, KeyFunction >* pJob = pContext->Create< RadixSortJob< T, KeyFunction > >();
+    HELIUM_ASSERT( pJob );
+
+    typename RadixSortJob< T, KeyFunction >::Parameters& rParameters = pJob->GetParameters();
+    rParameters.pBase = rValues.GetData();
+    rParameters.pScratch = scratch.GetData();
+    rParameters.count = rValues.GetSize();
+    rParameters.digitCount = digitCount;
+    rParameters.singleJobCount = singleJobCount;
+}
+
+TEST(EngineJobs, RadixSortJobRandom)
+{
+    // Automatic grain, a grain that spawns children for most buckets, and the smallest grain.
+    static const size_t singleJobCounts[] = { 0, 64, 1 };
+
+    DynamicArray< uint32_t > values;
+    for( size_t grainIndex = 0; grainIndex < HELIUM_ARRAY_COUNT( singleJobCounts ); ++grainIndex )
+    {
+        for( size_t countIndex = 0; countIndex < HELIUM_ARRAY_COUNT( SORT_TEST_COUNTS ); ++countIndex )
+        {
+            size_t count = SORT_TEST_COUNTS[ countIndex ];
+
+            FillRandom( values, count, 0xffffffff, static_cast< uint32_t >( count ) );
+            DynamicArray< uint32_t > expected( values );
+            std::sort( expected.GetData(), expected.GetData() + expected.GetSize() );
+
+            RadixSort< uint32_t, RadixSortKey< uint32_t > >( values, 0, singleJobCounts[ grainIndex ] );
+
+            for( size_t index = 0; index < count; ++index )
+            {
+                ASSERT_EQ( expected[ index ], values[ index ] ) << "count " << count << ", index " << index;
+            }
+        }
+    }
+}
+
+TEST(EngineJobs, RadixSortJobStable)
+{
+    // Keys fit in the two low-order bytes, so only two digits are sorted, and repeat often enough to check that
+    // equal keys keep their original order.
+    static const size_t counts[] = { 20, 33, 1000, 65536 };
+    static const size_t singleJobCounts[] = { 0, 64 };
+
+    DynamicArray< uint32_t > keys;
+    DynamicArray< RadixSortTestElement > values;
+    for( size_t grainIndex = 0; grainIndex < HELIUM_ARRAY_COUNT( singleJobCounts ); ++grainIndex )
+    {
+        for( size_t countIndex = 0; countIndex < HELIUM_ARRAY_COUNT( counts ); ++countIndex )
+        {
+            size_t count = counts[ countIndex ];
+
+            FillRandom( keys, count, 4000, static_cast< uint32_t >( count ) );
+            values.Resize( count );
+            for( size_t index = 0; index < count; ++index )
+            {
+                values[ index ].key = keys[ index ];
+                values[ index ].order = static_cast< uint32_t >( index );
+            }
+
+            RadixSort< RadixSortTestElement, RadixSortTestKey >( values, 2, singleJobCounts[ grainIndex ] );
+
+            for( size_t index = 1; index < count; ++index )
+            {
+                const RadixSortTestElement& rPrevious = values[ index - 1 ];
+                const RadixSortTestElement& rCurrent = values[ index ];
+                ASSERT_LE( rPrevious.key, rCurrent.key ) << "count " << count << ", index " << index;
+                if( rPrevious.key == rCurrent.key )
+                {
+                    ASSERT_LT( rPrevious.order, rCurrent.order ) << "count " << count << ", index " << index;
+                }
+            }
+        }
+    }
+}
+
+#endif
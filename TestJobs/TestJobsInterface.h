@@ -45,6 +45,7 @@ public:
     //@{
     void Run( JobContext* pContext );
     inline static void RunCallback( void* pJob, JobContext* pContext );
+    inline static const tchar_t* GetJobName();
     //@}
 
 private:
@@ -87,6 +88,7 @@ public:
     //@{
     void Run( JobContext* pContext );
     inline static void RunCallback( void* pJob, JobContext* pContext );
+    inline static const tchar_t* GetJobName();
     //@}
 
 private:
@@ -52,6 +52,14 @@ namespace Helium
 		static_cast< FibJob* >( pJob )->Run( pContext );
 	}
 
+	/// Get the name of this job type for profiling.
+	///
+	/// @return  Job type name.
+	const tchar_t* FibJob::GetJobName()
+	{
+		return TXT( "FibJob" );
+	}
+
 	/// Constructor.
 	FibJob::Parameters::Parameters()
 		: n(0)
@@ -110,6 +118,14 @@ namespace Helium
 		static_cast< FibContinuation* >( pJob )->Run( pContext );
 	}
 
+	/// Get the name of this job type for profiling.
+	///
+	/// @return  Job type name.
+	const tchar_t* FibContinuation::GetJobName()
+	{
+		return TXT( "FibContinuation" );
+	}
+
 	/// Constructor.
 	FibContinuation::Parameters::Parameters()
 		: x(0)
@@ -116,6 +116,7 @@ project( prefix .. "EditorSupport" )
 project( prefix .. "SceneGraph" )
 
 	Helium.DoModuleProjectSettings( ".", "HELIUM", "SceneGraph", "SCENE_GRAPH" )
+	Helium.DoTbbProjectSettings()
 
 	files
 	{
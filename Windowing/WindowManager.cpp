@@ -61,16 +61,16 @@ struct HELIUM_WINDOWING_API WindowManagerUpdateTask : public TaskDefinition
 	HELIUM_DECLARE_TASK(WindowManagerUpdateTask)
 	virtual void DefineContract(TaskContract &rContract)
 	{
+		// Not flagged as requiring graphics, so any windows still get their messages while running headless
 		rContract.ExecuteAfter< Helium::StandardDependencies::Render >();
 	}
 };
 
 void UpdateWindows( DynamicArray< WorldPtr > & )
 {
+	// Dedicated servers don't create a window manager
 	WindowManager *pWindowManager = WindowManager::GetStaticInstance();
-	HELIUM_ASSERT( pWindowManager );
-
-	if ( !pWindowManager->Update() )
+	if ( pWindowManager && !pWindowManager->Update() )
 	{
 		GameSystem::GetStaticInstance()->StopRunning();
 	}